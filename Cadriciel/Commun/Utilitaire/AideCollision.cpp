@@ -16,16 +16,121 @@
 #include "glm\gtx\norm.hpp"
 #include "glm\gtx\projection.hpp"
 
+#include <cmath>
+#include <initializer_list>
+
 namespace aidecollision {
 
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn DetailsCollision calculerCollisionSegment(
-	///        const glm::dvec2& point1,
-	///        const glm::dvec2& point2,
-	///        const glm::dvec2& position,
-	///        double          rayon,
+	/// @fn static bool estDansArc(
+	///        const Vecteur3<T>& direction1,
+	///        const Vecteur3<T>& direction2,
+	///        const Vecteur3<T>& direction
+	///        );
+	///
+	/// Cette fonction vrifie si une direction, dans le plan XY, est situe
+	///  l'intrieur d'un arc de cercle dlimit par les directions de ses
+	/// deux extrmits,  l'aide de produits vectoriels.
+	///
+	/// @param[in] direction1 : Direction de la premire extrmit de l'arc.
+	/// @param[in] direction2 : Direction de la seconde extrmit de l'arc.
+	/// @param[in] direction  : Direction  vrifier.
+	///
+	/// @return Vrai si la direction est  l'intrieur de l'arc.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	static bool estDansArc(
+		const Vecteur3<T>& direction1,
+		const Vecteur3<T>& direction2,
+		const Vecteur3<T>& direction
+		)
+	{
+		T sensExtremites{ glm::cross(direction1, direction2)[2] };
+		T sens1{ glm::cross(direction1, direction)[2] };
+		T sens2{ glm::cross(direction, direction2)[2] };
+
+		return ((sens1 > 0.0) == (sensExtremites > 0.0)) &&
+			((sens1 > 0.0) == (sens2 > 0.0));
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool calculerPremiereRacine(
+	///        T a, T b, T c, T& instant
+	///        );
+	///
+	/// Cette fonction calcule le premier instant, entre 0 et 1, o la
+	/// distance au carr entre un objet en mouvement et un obstacle,
+	/// exprime par a t^2 + b t + c moins le carr de la distance de
+	/// contact, devient nulle.  Il n'y a pas d'impact si l'objet ne se
+	/// rapproche pas (b >= 0) ou s'il est dj en contact (c < 0).
+	///
+	/// @param[in]  a       : Coefficient du terme au carr.
+	/// @param[in]  b       : Coefficient du terme linaire.
+	/// @param[in]  c       : Terme constant.
+	/// @param[out] instant : Instant du premier contact.
+	///
+	/// @return Vrai s'il y a un contact entre 0 et 1.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	static bool calculerPremiereRacine(
+		T a, T b, T c, T& instant
+		)
+	{
+		if (a <= 0.0 || b >= 0.0 || c < 0.0)
+			return false;
+
+		const T discriminant{ b * b - T(4) * a * c };
+		if (discriminant < 0.0)
+			return false;
+
+		instant = (-b - std::sqrt(discriminant)) / (T(2) * a);
+		return instant <= 1.0;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static Vecteur3<T> normaliserDirection(
+	///        const Vecteur3<T>& direction,
+	///        const Vecteur3<T>& deplacement
+	///        );
+	///
+	/// Cette fonction normalise la direction d'un impact.  Lorsque le
+	/// centre de l'objet passe exactement sur l'obstacle, la direction est
+	/// nulle et on utilise plutt l'oppos du dplacement.
+	///
+	/// @param[in] direction   : Direction de l'impact.
+	/// @param[in] deplacement : Dplacement de l'objet.
+	///
+	/// @return Direction unitaire de l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	static Vecteur3<T> normaliserDirection(
+		const Vecteur3<T>& direction,
+		const Vecteur3<T>& deplacement
+		)
+	{
+		const T longueur{ glm::length(direction) };
+		if (longueur > 0.0)
+			return direction / longueur;
+		return -glm::normalize(deplacement);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsCollisiont<T> calculerCollisionSegment(
+	///        const Vecteur2<T>& point1,
+	///        const Vecteur2<T>& point2,
+	///        const Vecteur2<T>& position,
+	///        T          rayon,
 	///        bool            collisionAvecPoints
 	///        );
 	///
@@ -47,18 +152,19 @@ namespace aidecollision {
 	/// @return Structure contenant de l'information sur la collision.
 	///
 	////////////////////////////////////////////////////////////////////////
-	DetailsCollision calculerCollisionSegment(
-		const glm::dvec2& point1,
-		const glm::dvec2& point2,
-		const glm::dvec2& position,
-		double          rayon,
+	template <class T>
+	DetailsCollisiont<T> calculerCollisionSegment(
+		const Vecteur2<T>& point1,
+		const Vecteur2<T>& point2,
+		const Vecteur2<T>& position,
+		typename Identite<T>::Type rayon,
 		bool            collisionAvecPoints //= true
 		)
 	{
 		return calculerCollisionSegment(
-			glm::dvec3{ point1, 0.0 },
-			glm::dvec3{ point2, 0.0 },
-			glm::dvec3{ position, 0.0 },
+			Vecteur3<T>{ point1, 0.0 },
+			Vecteur3<T>{ point2, 0.0 },
+			Vecteur3<T>{ position, 0.0 },
 			rayon,
 			collisionAvecPoints
 			);
@@ -67,11 +173,11 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn DetailsCollision calculerCollisionSegment(
-	///        const glm::dvec3& point1,
-	///        const glm::dvec3& point2,
-	///        const glm::dvec3& position,
-	///        double          rayon,
+	/// @fn DetailsCollisiont<T> calculerCollisionSegment(
+	///        const Vecteur3<T>& point1,
+	///        const Vecteur3<T>& point2,
+	///        const Vecteur3<T>& position,
+	///        T          rayon,
 	///        bool            collisionAvecPoints
 	///        );
 	///
@@ -91,29 +197,30 @@ namespace aidecollision {
 	/// @return Structure contenant de l'information sur la collision.
 	///
 	////////////////////////////////////////////////////////////////////////
-	DetailsCollision calculerCollisionSegment(
-		const glm::dvec3& point1,
-		const glm::dvec3& point2,
-		const glm::dvec3& position,
-		double          rayon,
+	template <class T>
+	DetailsCollisiont<T> calculerCollisionSegment(
+		const Vecteur3<T>& point1,
+		const Vecteur3<T>& point2,
+		const Vecteur3<T>& position,
+		typename Identite<T>::Type rayon,
 		bool            collisionAvecPoints //= true
 		)
 	{
 		// Valeur de retour.
-		DetailsCollision detailsCollision;
+		DetailsCollisiont<T> detailsCollision;
 		detailsCollision.type = COLLISION_AUCUNE;
 
 		// On calcule la projection de la position de la sphre sur le vecteur
 		// du segment de droite.
-		const glm::dvec3 segment{ point2 - point1 };
-		const double ratio = glm::dot(position - point1, segment) /
+		const Vecteur3<T> segment{ point2 - point1 };
+		const T ratio = glm::dot(position - point1, segment) /
 			glm::length2(segment);
 
 		if (collisionAvecPoints) {
 			if (ratio < 0.0) {
 				// On est du ct du premier point.
-				const glm::dvec3 directionCollision{ position - point1 };
-				const double distance = glm::length(directionCollision);
+				const Vecteur3<T> directionCollision{ position - point1 };
+				const T distance = glm::length(directionCollision);
 				if (distance < rayon) {
 					detailsCollision.type = COLLISION_SEGMENT_PREMIERPOINT;
 					detailsCollision.direction = directionCollision / distance;
@@ -122,8 +229,8 @@ namespace aidecollision {
 			}
 			else if (ratio > 1.0) {
 				// On est du ct du second point.
-				const glm::dvec3 directionCollision{ position - point2 };
-				const double distance = glm::length(directionCollision);
+				const Vecteur3<T> directionCollision{ position - point2 };
+				const T distance = glm::length(directionCollision);
 				if (distance < rayon) {
 					detailsCollision.type = COLLISION_SEGMENT_DEUXIEMEPOINT;
 					detailsCollision.direction = directionCollision / distance;
@@ -134,9 +241,9 @@ namespace aidecollision {
 
 		if (ratio >= 0.0 && ratio <= 1.0) {
 			// On est sur le segment de droite.
-			glm::dvec3 pointPerpendiculaire{ (1 - ratio) * point1 + ratio * point2 };
-			const glm::dvec3 directionCollision{ position - pointPerpendiculaire };
-			const double distance{ glm::length(directionCollision) };
+			Vecteur3<T> pointPerpendiculaire{ (1 - ratio) * point1 + ratio * point2 };
+			const Vecteur3<T> directionCollision{ position - pointPerpendiculaire };
+			const T distance{ glm::length(directionCollision) };
 			if (distance < rayon) {
 				detailsCollision.type = COLLISION_SEGMENT;
 				detailsCollision.direction = directionCollision / distance;
@@ -144,17 +251,27 @@ namespace aidecollision {
 			}
 		}
 
+		if (detailsCollision.type == COLLISION_AUCUNE) {
+			// L'enfoncement ngatif donne la distance qui spare la sphre du
+			// segment, extrmits comprises mme si elles sont ignores :
+			// l'objet ne peut toucher le segment avant de l'avoir parcourue.
+			const T ratioBorne{ ratio < 0.0 ? T(0) : (ratio > 1.0 ? T(1) : ratio) };
+			const Vecteur3<T> pointProche{ point1 + ratioBorne * segment };
+			detailsCollision.direction = position - pointProche;
+			detailsCollision.enfoncement = rayon - glm::length(detailsCollision.direction);
+		}
+
 		return detailsCollision;
 	}
 
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn DetailsCollision calculerCollisionCercle(
-	///        const glm::dvec2& centreCercle,
-	///        double          rayonCercle,
-	///        const glm::dvec2& positionObjet,
-	///        double          rayonObjet
+	/// @fn DetailsCollisiont<T> calculerCollisionCercle(
+	///        const Vecteur2<T>& centreCercle,
+	///        T          rayonCercle,
+	///        const Vecteur2<T>& positionObjet,
+	///        T          rayonObjet
 	///        );
 	///
 	/// Cette fonction calcule l'intersection d'un cercle avec un autre
@@ -172,17 +289,18 @@ namespace aidecollision {
 	/// @return Structure contenant de l'information sur la collision.
 	///
 	////////////////////////////////////////////////////////////////////////
-	DetailsCollision calculerCollisionCercle(
-		const glm::dvec2& centreCercle,
-		double          rayonCercle,
-		const glm::dvec2& positionObjet,
-		double          rayonObjet
+	template <class T>
+	DetailsCollisiont<T> calculerCollisionCercle(
+		const Vecteur2<T>& centreCercle,
+		typename Identite<T>::Type rayonCercle,
+		const Vecteur2<T>& positionObjet,
+		typename Identite<T>::Type rayonObjet
 		)
 	{
 		return calculerCollisionSphere(
-			glm::dvec3{ centreCercle, 0.0 },
+			Vecteur3<T>{ centreCercle, 0.0 },
 			rayonCercle,
-			glm::dvec3{ positionObjet, 0.0 },
+			Vecteur3<T>{ positionObjet, 0.0 },
 			rayonObjet
 			);
 	}
@@ -190,12 +308,12 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn DetailsCollision calculerCollisionArc(
-	///        const glm::dvec2& centreCercle,
-	///        const glm::dvec2& pointArc1,
-	///        const glm::dvec2& pointArc2,
-	///        const glm::dvec2& positionObjet,
-	///        double          rayonObjet
+	/// @fn DetailsCollisiont<T> calculerCollisionArc(
+	///        const Vecteur2<T>& centreCercle,
+	///        const Vecteur2<T>& pointArc1,
+	///        const Vecteur2<T>& pointArc2,
+	///        const Vecteur2<T>& positionObjet,
+	///        T          rayonObjet
 	///        );
 	///
 	/// Cette fonction calcule l'intersection d'un cercle identifi par
@@ -214,37 +332,32 @@ namespace aidecollision {
 	/// @return Structure contenant de l'information sur la collision.
 	///
 	////////////////////////////////////////////////////////////////////////
-	DetailsCollision calculerCollisionArc(
-		const glm::dvec2& centreCercle,
-		const glm::dvec2& pointArc1,
-		const glm::dvec2& pointArc2,
-		const glm::dvec2& positionObjet,
-		double          rayonObjet
+	template <class T>
+	DetailsCollisiont<T> calculerCollisionArc(
+		const Vecteur2<T>& centreCercle,
+		const Vecteur2<T>& pointArc1,
+		const Vecteur2<T>& pointArc2,
+		const Vecteur2<T>& positionObjet,
+		typename Identite<T>::Type rayonObjet
 		)
 	{
 		// Valeur de retour.
-		DetailsCollision detailsCollision;
+		DetailsCollisiont<T> detailsCollision;
 		detailsCollision.type = COLLISION_AUCUNE;
 
 		// Rayon de l'arc de cercle.
-		double rayonCercle{ glm::length((pointArc1 - centreCercle)) };
+		T rayonCercle{ glm::length((pointArc1 - centreCercle)) };
 
-		detailsCollision.direction = glm::dvec3(positionObjet - centreCercle, 0.0);
+		detailsCollision.direction = Vecteur3<T>(positionObjet - centreCercle, 0.0);
 		detailsCollision.enfoncement = rayonCercle + rayonObjet -
 			glm::length(detailsCollision.direction);
 
 		if (detailsCollision.enfoncement > 0) {
-			glm::dvec3 direction1{ (pointArc1 - centreCercle), 0.0 };
-			glm::dvec3 direction2{ (pointArc2 - centreCercle), 0.0 };
+			Vecteur3<T> direction1{ (pointArc1 - centreCercle), 0.0 };
+			Vecteur3<T> direction2{ (pointArc2 - centreCercle), 0.0 };
 
-			// On vrifie si la direction est situe  l'intrieur de l'arc 
-			// l'aide de produits vectoriels.
-			double sensExtremites{ glm::cross(direction1, direction2)[2] };
-			double sens1{ glm::cross(direction1, detailsCollision.direction)[2] };
-			double sens2{ glm::cross(detailsCollision.direction, direction2)[2] };
-
-			if (((sens1 > 0.0) == (sensExtremites > 0.0)) &&
-				((sens1 > 0.0) == (sens2 > 0.0))) {
+			// On vrifie si la direction est situe  l'intrieur de l'arc.
+			if (estDansArc(direction1, direction2, detailsCollision.direction)) {
 				detailsCollision.type = COLLISION_ARC;
 			}
 		}
@@ -255,7 +368,7 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn DetailsCollision calculerCollisionSphere( const glm::dvec3& centreSphere, double rayonSphere, const glm::dvec3& positionObjet, double rayonObjet );
+	/// @fn DetailsCollisiont<T> calculerCollisionSphere( const Vecteur3<T>& centreSphere, T rayonSphere, const Vecteur3<T>& positionObjet, T rayonObjet );
 	///
 	/// Cette fonction calcule l'intersection d'une sphre avec une autre
 	/// sphre, chacune identifie par son centre et son rayon.
@@ -270,15 +383,16 @@ namespace aidecollision {
 	/// @return Structure contenant de l'information sur la collision.
 	///
 	////////////////////////////////////////////////////////////////////////
-	DetailsCollision calculerCollisionSphere(
-		const glm::dvec3& centreSphere,
-		double          rayonSphere,
-		const glm::dvec3& positionObjet,
-		double          rayonObjet
+	template <class T>
+	DetailsCollisiont<T> calculerCollisionSphere(
+		const Vecteur3<T>& centreSphere,
+		typename Identite<T>::Type rayonSphere,
+		const Vecteur3<T>& positionObjet,
+		typename Identite<T>::Type rayonObjet
 		)
 	{
 		// Valeur de retour
-		DetailsCollision detailsCollision;
+		DetailsCollisiont<T> detailsCollision;
 
 		detailsCollision.direction = positionObjet - centreSphere;
 		detailsCollision.enfoncement = rayonSphere + rayonObjet -
@@ -295,9 +409,529 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec2 calculerForceRebondissement2D(
-	///        const DetailsCollision& details,
-	///        double constanteRebondissement
+	/// @fn DetailsImpactt<T> calculerImpactSegment(
+	///        const Vecteur2<T>& point1,
+	///        const Vecteur2<T>& point2,
+	///        const Vecteur2<T>& position,
+	///        const Vecteur2<T>& deplacement,
+	///        T          rayon,
+	///        bool            collisionAvecPoints
+	///        );
+	///
+	/// Cette fonction calcule le premier impact d'un cercle en mouvement,
+	/// identifi par son centre et son rayon, avec un segment de droite,
+	/// identifi par les coordonnes de chacune de ses extrmits.
+	///
+	/// Elle ne fait qu'appeler la version 3D de cette mme fonction.
+	///
+	/// @param[in] point1              : Premire extrmit du segment de
+	///                                  droite.
+	/// @param[in] point2              : Seconde extrmit du segment de
+	///                                  droite.
+	/// @param[in] position            : Centre du cercle au dpart.
+	/// @param[in] deplacement         : Dplacement du cercle.
+	/// @param[in] rayon               : Rayon du cercle.
+	/// @param[in] collisionAvecPoints : Vrai si on veut les collisions avec
+	///                                  les extrmits.
+	///
+	/// @return Structure contenant de l'information sur l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	DetailsImpactt<T> calculerImpactSegment(
+		const Vecteur2<T>& point1,
+		const Vecteur2<T>& point2,
+		const Vecteur2<T>& position,
+		const Vecteur2<T>& deplacement,
+		typename Identite<T>::Type rayon,
+		bool            collisionAvecPoints //= true
+		)
+	{
+		return calculerImpactSegment(
+			Vecteur3<T>{ point1, 0.0 },
+			Vecteur3<T>{ point2, 0.0 },
+			Vecteur3<T>{ position, 0.0 },
+			Vecteur3<T>{ deplacement, 0.0 },
+			rayon,
+			collisionAvecPoints
+			);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsImpactt<T> calculerImpactSegment(
+	///        const Vecteur3<T>& point1,
+	///        const Vecteur3<T>& point2,
+	///        const Vecteur3<T>& position,
+	///        const Vecteur3<T>& deplacement,
+	///        T          rayon,
+	///        bool            collisionAvecPoints
+	///        );
+	///
+	/// Cette fonction calcule le premier impact d'une sphre en mouvement,
+	/// identifie par son centre et son rayon, avec un segment de droite,
+	/// identifi par les coordonnes de chacune de ses extrmits.  La
+	/// sphre se dplace en ligne droite de sa position de dpart jusqu'
+	/// sa position de dpart plus le dplacement, ce qui permet de
+	/// dtecter un segment mince travers entre deux pas de simulation.
+	///
+	/// On cherche le contact avec le cylindre entourant le segment, puis
+	/// avec les sphres entourant ses extrmits ou, si les extrmits sont
+	/// ignores, avec les plans qui bornent le cylindre.  Si la sphre
+	/// touche dj le segment au dpart, l'impact est immdiat lorsqu'elle
+	/// s'y enfonce et il n'y a pas d'impact lorsqu'elle s'en loigne.
+	///
+	/// @param[in] point1              : Premire extrmit du segment de
+	///                                  droite.
+	/// @param[in] point2              : Seconde extrmit du segment de
+	///                                  droite.
+	/// @param[in] position            : Centre de la sphre au dpart.
+	/// @param[in] deplacement         : Dplacement de la sphre.
+	/// @param[in] rayon               : Rayon de la sphre.
+	/// @param[in] collisionAvecPoints : Vrai si on veut les collisions avec
+	///                                  les extrmits.
+	///
+	/// @return Structure contenant de l'information sur l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	DetailsImpactt<T> calculerImpactSegment(
+		const Vecteur3<T>& point1,
+		const Vecteur3<T>& point2,
+		const Vecteur3<T>& position,
+		const Vecteur3<T>& deplacement,
+		typename Identite<T>::Type rayon,
+		bool            collisionAvecPoints //= true
+		)
+	{
+		// Valeur de retour.
+		DetailsImpactt<T> impact;
+		impact.type = COLLISION_AUCUNE;
+		impact.instant = 1.0;
+
+		const Vecteur3<T> segment{ point2 - point1 };
+		const T longueur2{ glm::length2(segment) };
+		if (longueur2 <= 0.0 || rayon <= 0.0)
+			return impact;
+
+		// Collision ds le dpart.
+		const DetailsCollisiont<T> depart{ calculerCollisionSegment(
+			point1, point2, position, rayon, collisionAvecPoints
+			) };
+		if (depart.type != COLLISION_AUCUNE) {
+			if (glm::dot(deplacement, depart.direction) < 0.0) {
+				impact.type = depart.type;
+				impact.instant = 0.0;
+				impact.position = position;
+				impact.normale = depart.direction;
+			}
+			return impact;
+		}
+
+		// Composantes perpendiculaires au segment de la position relative et
+		// du dplacement.
+		const Vecteur3<T> relatif{ position - point1 };
+		const T projectionRelatif{ glm::dot(relatif, segment) };
+		const T projectionDeplacement{ glm::dot(deplacement, segment) };
+		const Vecteur3<T> relatifPerpendiculaire{ relatif - segment * (projectionRelatif / longueur2) };
+		const Vecteur3<T> deplacementPerpendiculaire{ deplacement - segment * (projectionDeplacement / longueur2) };
+
+		// Contact avec le cylindre, retenu s'il est vis--vis du segment.
+		T instant;
+		if (calculerPremiereRacine(
+			glm::length2(deplacementPerpendiculaire),
+			T(2) * glm::dot(relatifPerpendiculaire, deplacementPerpendiculaire),
+			glm::length2(relatifPerpendiculaire) - rayon * rayon,
+			instant)) {
+			const T ratio{ (projectionRelatif + instant * projectionDeplacement) / longueur2 };
+			if (ratio >= 0.0 && ratio <= 1.0) {
+				impact.type = COLLISION_SEGMENT;
+				impact.instant = instant;
+				impact.normale = normaliserDirection(
+					relatifPerpendiculaire + instant * deplacementPerpendiculaire, deplacement
+					);
+			}
+		}
+
+		if (collisionAvecPoints) {
+			// Contact avec les sphres entourant les extrmits.
+			const Vecteur3<T> points[2]{ point1, point2 };
+			for (int i = 0; i < 2; ++i) {
+				const DetailsImpactt<T> impactPoint{ calculerImpactSphere(points[i], 0.0, position, deplacement, rayon) };
+				if (impactPoint.type == COLLISION_AUCUNE || impactPoint.instant >= impact.instant)
+					continue;
+
+				const T ratio{ (projectionRelatif + impactPoint.instant * projectionDeplacement) / longueur2 };
+				if (i == 0 && ratio < 0.0) {
+					impact = impactPoint;
+					impact.type = COLLISION_SEGMENT_PREMIERPOINT;
+				}
+				else if (i == 1 && ratio > 1.0) {
+					impact = impactPoint;
+					impact.type = COLLISION_SEGMENT_DEUXIEMEPOINT;
+				}
+			}
+		}
+		else if (projectionDeplacement != 0.0) {
+			// Entre dans le cylindre par l'un des plans qui le bornent.
+			for (T ratio : { T(0), T(1) }) {
+				instant = (ratio * longueur2 - projectionRelatif) / projectionDeplacement;
+				if (instant < 0.0 || instant >= impact.instant)
+					continue;
+
+				const Vecteur3<T> directionCollision{ relatifPerpendiculaire + instant * deplacementPerpendiculaire };
+				if (glm::length2(directionCollision) < rayon * rayon) {
+					impact.type = COLLISION_SEGMENT;
+					impact.instant = instant;
+					impact.normale = normaliserDirection(directionCollision, deplacement);
+				}
+			}
+		}
+
+		if (impact.type != COLLISION_AUCUNE)
+			impact.position = position + impact.instant * deplacement;
+
+		return impact;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsImpactt<T> calculerImpactCercle(
+	///        const Vecteur2<T>& centreCercle,
+	///        T          rayonCercle,
+	///        const Vecteur2<T>& positionObjet,
+	///        const Vecteur2<T>& deplacement,
+	///        T          rayonObjet
+	///        );
+	///
+	/// Cette fonction calcule le premier impact d'un cercle en mouvement
+	/// avec un autre cercle, chacun identifi par son centre et son rayon.
+	///
+	/// Elle ne fait qu'appeler la version 3D de cette mme fonction.
+	///
+	/// @param[in] centreCercle  : Centre du cercle avec lequel on teste la
+	///                            collision.
+	/// @param[in] rayonCercle   : Rayon du cercle avec lequel on teste la
+	///                            collision.
+	/// @param[in] positionObjet : Position de l'objet au dpart.
+	/// @param[in] deplacement   : Dplacement de l'objet.
+	/// @param[in] rayonObjet    : Rayon de l'objet.
+	///
+	/// @return Structure contenant de l'information sur l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	DetailsImpactt<T> calculerImpactCercle(
+		const Vecteur2<T>& centreCercle,
+		typename Identite<T>::Type rayonCercle,
+		const Vecteur2<T>& positionObjet,
+		const Vecteur2<T>& deplacement,
+		typename Identite<T>::Type rayonObjet
+		)
+	{
+		return calculerImpactSphere(
+			Vecteur3<T>{ centreCercle, 0.0 },
+			rayonCercle,
+			Vecteur3<T>{ positionObjet, 0.0 },
+			Vecteur3<T>{ deplacement, 0.0 },
+			rayonObjet
+			);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsImpactt<T> calculerImpactArc(
+	///        const Vecteur2<T>& centreCercle,
+	///        const Vecteur2<T>& pointArc1,
+	///        const Vecteur2<T>& pointArc2,
+	///        const Vecteur2<T>& positionObjet,
+	///        const Vecteur2<T>& deplacement,
+	///        T          rayonObjet
+	///        );
+	///
+	/// Cette fonction calcule le premier impact d'un cercle en mouvement
+	/// avec un arc de cercle identifi par ses deux extrmits et son
+	/// centre.  Comme dans calculerCollisionArc(), la collision a lieu
+	/// lorsque l'objet est dans le secteur dlimit par l'arc : on cherche
+	/// donc l'entre par le cercle, retenue si elle est  l'intrieur de
+	/// l'arc, et l'entre par les rayons qui bornent le secteur.
+	///
+	/// @param[in] centreCercle  : Centre de l'arc avec lequel on teste
+	///                            la collision.
+	/// @param[in] pointArc1     : Premire extrmit de l'arc avec lequel on
+	///                            teste la collision.
+	/// @param[in] pointArc2     : Seconde extrmit de l'arc avec lequel on
+	///                            teste la collision.
+	/// @param[in] positionObjet : Position de l'objet au dpart.
+	/// @param[in] deplacement   : Dplacement de l'objet.
+	/// @param[in] rayonObjet    : Rayon de l'objet.
+	///
+	/// @return Structure contenant de l'information sur l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	DetailsImpactt<T> calculerImpactArc(
+		const Vecteur2<T>& centreCercle,
+		const Vecteur2<T>& pointArc1,
+		const Vecteur2<T>& pointArc2,
+		const Vecteur2<T>& positionObjet,
+		const Vecteur2<T>& deplacement,
+		typename Identite<T>::Type rayonObjet
+		)
+	{
+		// Valeur de retour.
+		DetailsImpactt<T> impact;
+		impact.type = COLLISION_AUCUNE;
+		impact.instant = 1.0;
+
+		const Vecteur3<T> deplacement3D{ deplacement, 0.0 };
+
+		// Collision ds le dpart.
+		const DetailsCollisiont<T> depart{ calculerCollisionArc(
+			centreCercle, pointArc1, pointArc2, positionObjet, rayonObjet
+			) };
+		if (depart.type != COLLISION_AUCUNE) {
+			if (glm::dot(deplacement3D, depart.direction) < 0.0) {
+				impact.type = COLLISION_ARC;
+				impact.instant = 0.0;
+				impact.position = Vecteur3<T>{ positionObjet, 0.0 };
+				impact.normale = normaliserDirection(depart.direction, deplacement3D);
+			}
+			return impact;
+		}
+
+		const T rayon{ glm::length(pointArc1 - centreCercle) + rayonObjet };
+		if (rayon <= 0.0)
+			return impact;
+
+		const Vecteur3<T> relatif{ positionObjet - centreCercle, 0.0 };
+		const Vecteur3<T> direction1{ (pointArc1 - centreCercle), 0.0 };
+		const Vecteur3<T> direction2{ (pointArc2 - centreCercle), 0.0 };
+
+		// Entre par le cercle.
+		T instant;
+		if (calculerPremiereRacine(
+			glm::length2(deplacement3D),
+			T(2) * glm::dot(relatif, deplacement3D),
+			glm::length2(relatif) - rayon * rayon,
+			instant)) {
+			const Vecteur3<T> directionCollision{ relatif + instant * deplacement3D };
+			if (estDansArc(direction1, direction2, directionCollision)) {
+				impact.type = COLLISION_ARC;
+				impact.instant = instant;
+				impact.normale = directionCollision / rayon;
+			}
+		}
+
+		// Entre par l'un des rayons qui bornent le secteur.
+		for (const Vecteur3<T>& direction : { direction1, direction2 }) {
+			const T sens{ glm::cross(direction, deplacement3D)[2] };
+			if (sens == 0.0)
+				continue;
+
+			instant = -glm::cross(direction, relatif)[2] / sens;
+			if (instant < 0.0 || instant >= impact.instant)
+				continue;
+
+			const Vecteur3<T> directionCollision{ relatif + instant * deplacement3D };
+			if (glm::dot(direction, directionCollision) >= 0.0 &&
+				glm::length2(directionCollision) < rayon * rayon) {
+				impact.type = COLLISION_ARC;
+				impact.instant = instant;
+				impact.normale = normaliserDirection(directionCollision, deplacement3D);
+			}
+		}
+
+		if (impact.type != COLLISION_AUCUNE)
+			impact.position = Vecteur3<T>{ positionObjet, 0.0 } + impact.instant * deplacement3D;
+
+		return impact;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsImpactt<T> calculerImpactSphere(
+	///        const Vecteur3<T>& centreSphere,
+	///        T          rayonSphere,
+	///        const Vecteur3<T>& positionObjet,
+	///        const Vecteur3<T>& deplacement,
+	///        T          rayonObjet
+	///        );
+	///
+	/// Cette fonction calcule le premier impact d'une sphre en mouvement
+	/// avec une autre sphre, chacune identifie par son centre et son
+	/// rayon.  Si les deux sphres sont en mouvement, on passe le
+	/// dplacement de l'objet relatif  celui de la sphre.
+	///
+	/// @param[in] centreSphere  : Centre de la sphre avec laquelle on teste
+	///                            la collision.
+	/// @param[in] rayonSphere   : Rayon de la sphre avec laquelle on teste
+	///                            la collision.
+	/// @param[in] positionObjet : Position de l'objet au dpart.
+	/// @param[in] deplacement   : Dplacement de l'objet.
+	/// @param[in] rayonObjet    : Rayon de l'objet.
+	///
+	/// @return Structure contenant de l'information sur l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	DetailsImpactt<T> calculerImpactSphere(
+		const Vecteur3<T>& centreSphere,
+		typename Identite<T>::Type rayonSphere,
+		const Vecteur3<T>& positionObjet,
+		const Vecteur3<T>& deplacement,
+		typename Identite<T>::Type rayonObjet
+		)
+	{
+		// Valeur de retour.
+		DetailsImpactt<T> impact;
+		impact.type = COLLISION_AUCUNE;
+		impact.instant = 1.0;
+
+		const T rayon{ rayonSphere + rayonObjet };
+		if (rayon <= 0.0)
+			return impact;
+
+		const Vecteur3<T> relatif{ positionObjet - centreSphere };
+		const T ecart{ glm::length2(relatif) - rayon * rayon };
+
+		// Collision ds le dpart.
+		if (ecart < 0.0) {
+			if (glm::dot(deplacement, relatif) < 0.0) {
+				impact.type = COLLISION_SPHERE;
+				impact.instant = 0.0;
+				impact.position = positionObjet;
+				impact.normale = normaliserDirection(relatif, deplacement);
+			}
+			return impact;
+		}
+
+		T instant;
+		if (calculerPremiereRacine(
+			glm::length2(deplacement), T(2) * glm::dot(relatif, deplacement), ecart, instant
+			)) {
+			impact.type = COLLISION_SPHERE;
+			impact.instant = instant;
+			impact.position = positionObjet + instant * deplacement;
+			impact.normale = (relatif + instant * deplacement) / rayon;
+		}
+
+		return impact;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn const DetailsImpactt<T>& choisirPremierImpact(
+	///        const DetailsImpactt<T>& impact1,
+	///        const DetailsImpactt<T>& impact2
+	///        );
+	///
+	/// Cette fonction retourne le premier de deux impacts, ce qui permet de
+	/// combiner les impacts avec les diffrents obstacles d'une scne.
+	///
+	/// @param[in] impact1 : Le premier impact.
+	/// @param[in] impact2 : Le second impact.
+	///
+	/// @return L'impact qui survient en premier, ou un impact sans
+	///         collision s'il n'y en a aucun.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	const DetailsImpactt<T>& choisirPremierImpact(
+		const DetailsImpactt<T>& impact1,
+		const DetailsImpactt<T>& impact2
+		)
+	{
+		if (impact2.type == COLLISION_AUCUNE)
+			return impact1;
+		if (impact1.type == COLLISION_AUCUNE)
+			return impact2;
+		return impact2.instant < impact1.instant ? impact2 : impact1;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int avancerParImpacts(
+	///        Vecteur3<T>&         position,
+	///        Vecteur3<T>&         vitesse,
+	///        T              temps,
+	///        T              restitution,
+	///        const CalculImpactt<T>& calculerImpact,
+	///        unsigned int        nombreMaximal
+	///        );
+	///
+	/// Cette fonction avance un objet sphrique pendant un intervalle de
+	/// temps en s'arrtant  chaque impact plutt qu'en dcoupant
+	/// l'intervalle en sous-pas de dure fixe.   chaque impact, l'objet
+	/// est plac au point de contact, la composante de sa vitesse vers
+	/// l'obstacle est rflchie selon le coefficient de restitution et le
+	/// reste du dplacement est calcul de nouveau.  Un objet rapide ne
+	/// peut donc pas traverser un segment mince, peu importe la dure de
+	/// l'intervalle.
+	///
+	/// Aprs le nombre maximal d'impacts, l'objet reste au dernier point de
+	/// contact pour le reste de l'intervalle, ce qui vite de le faire
+	/// traverser un obstacle lorsqu'il est coinc.
+	///
+	/// @param[in,out] position       : Position de l'objet.
+	/// @param[in,out] vitesse        : Vitesse de l'objet.
+	/// @param[in]     temps          : Dure de l'intervalle.
+	/// @param[in]     restitution    : Coefficient de restitution, entre 0
+	///                                 (aucun rebond) et 1 (rebond
+	///                                 parfait).
+	/// @param[in]     calculerImpact : Calcul du premier impact d'un
+	///                                 dplacement avec les obstacles.
+	/// @param[in]     nombreMaximal  : Nombre maximal d'impacts traits.
+	///
+	/// @return Le nombre d'impacts traits.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	unsigned int avancerParImpacts(
+		Vecteur3<T>&         position,
+		Vecteur3<T>&         vitesse,
+		typename Identite<T>::Type temps,
+		typename Identite<T>::Type restitution,
+		const typename Identite< CalculImpactt<T> >::Type& calculerImpact,
+		unsigned int        nombreMaximal //= 8
+		)
+	{
+		unsigned int nombreImpacts{ 0 };
+		T tempsRestant{ temps };
+
+		while (tempsRestant > 0.0 && nombreImpacts < nombreMaximal) {
+			const Vecteur3<T> deplacement{ vitesse * tempsRestant };
+			const DetailsImpactt<T> impact{ calculerImpact(position, deplacement) };
+			if (impact.type == COLLISION_AUCUNE) {
+				position += deplacement;
+				break;
+			}
+
+			position = impact.position;
+			tempsRestant *= T(1) - impact.instant;
+
+			const T vitesseNormale{ glm::dot(vitesse, impact.normale) };
+			if (vitesseNormale < 0.0)
+				vitesse -= (T(1) + restitution) * vitesseNormale * impact.normale;
+
+			++nombreImpacts;
+		}
+
+		return nombreImpacts;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Vecteur2<T> calculerForceRebondissement2D(
+	///        const DetailsCollisiont<T>& details,
+	///        T constanteRebondissement
 	///        );
 	///
 	/// Cette fonction calcule la force cause par une collision  partir
@@ -314,28 +948,29 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en deux dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec2 calculerForceRebondissement2D(
-		const DetailsCollision& details,
-		double constanteRebondissement
+	template <class T>
+	Vecteur2<T> calculerForceRebondissement2D(
+		const DetailsCollisiont<T>& details,
+		typename Identite<T>::Type constanteRebondissement
 		)
 	{
 		if (details.type == COLLISION_AUCUNE) {
 			// Pas de collision, donc pas de force
-			return glm::dvec2{ 0, 0 };
+			return Vecteur2<T>{ 0, 0 };
 		}
 		else {
 			// Collision: application de la loi des ressorts
 			return details.enfoncement * constanteRebondissement *
-				glm::dvec2{ details.direction };
+				Vecteur2<T>{ details.direction };
 		}
 	}
 
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec3 calculerForceRebondissement3D(
-	///        const DetailsCollision& details,
-	///        double constanteRebondissement
+	/// @fn Vecteur3<T> calculerForceRebondissement3D(
+	///        const DetailsCollisiont<T>& details,
+	///        T constanteRebondissement
 	///        );
 	///
 	/// Cette fonction calcule la force cause par une collision  partir
@@ -351,14 +986,15 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en trois dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec3 calculerForceRebondissement3D(
-		const DetailsCollision& details,
-		double constanteRebondissement
+	template <class T>
+	Vecteur3<T> calculerForceRebondissement3D(
+		const DetailsCollisiont<T>& details,
+		typename Identite<T>::Type constanteRebondissement
 		)
 	{
 		if (details.type == COLLISION_AUCUNE) {
 			// Pas de collision, donc pas de force.
-			return glm::dvec3{ 0, 0, 0 };
+			return Vecteur3<T>{ 0, 0, 0 };
 		}
 		else {
 			// Collision: application de la loi des ressorts.
@@ -370,10 +1006,10 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec2 calculerForceAmortissement2D(
-	///        const DetailsCollision& details,
-	///        const glm::dvec2& vitesse,
-	///        double constanteAmortissement
+	/// @fn Vecteur2<T> calculerForceAmortissement2D(
+	///        const DetailsCollisiont<T>& details,
+	///        const Vecteur2<T>& vitesse,
+	///        T constanteAmortissement
 	///        );
 	///
 	/// Cette fonction calcule une force d'amortissement proportionnelle 
@@ -389,24 +1025,25 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en deux dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec2 calculerForceAmortissement2D(
-		const DetailsCollision& details,
-		const glm::dvec2& vitesse,
-		double constanteAmortissement
+	template <class T>
+	Vecteur2<T> calculerForceAmortissement2D(
+		const DetailsCollisiont<T>& details,
+		const Vecteur2<T>& vitesse,
+		typename Identite<T>::Type constanteAmortissement
 		)
 	{
-		return glm::dvec2{ calculerForceAmortissement3D(
-			details, glm::dvec3{ vitesse, 0.0 }, constanteAmortissement
+		return Vecteur2<T>{ calculerForceAmortissement3D(
+			details, Vecteur3<T>{ vitesse, 0.0 }, constanteAmortissement
 			) };
 	}
 
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec3 calculerForceAmortissement3D(
-	///        const DetailsCollision& details,
-	///        const glm::dvec3& vitesse,
-	///        double constanteAmortissement
+	/// @fn Vecteur3<T> calculerForceAmortissement3D(
+	///        const DetailsCollisiont<T>& details,
+	///        const Vecteur3<T>& vitesse,
+	///        T constanteAmortissement
 	///        );
 	///
 	/// Cette fonction calcule une force d'amortissement proportionnelle 
@@ -420,19 +1057,20 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en trois dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec3 calculerForceAmortissement3D(
-		const DetailsCollision& details,
-		const glm::dvec3& vitesse,
-		double constanteAmortissement
+	template <class T>
+	Vecteur3<T> calculerForceAmortissement3D(
+		const DetailsCollisiont<T>& details,
+		const Vecteur3<T>& vitesse,
+		typename Identite<T>::Type constanteAmortissement
 		)
 	{
 		if (details.type == COLLISION_AUCUNE) {
 			// Pas de collision, donc pas de force.
-			return glm::dvec3{ 0, 0, 0 };
+			return Vecteur3<T>{ 0, 0, 0 };
 		}
 		else {
 			// Collision: application d'un amortissement.
-			const glm::dvec3 vitesseCollision{ glm::proj(vitesse, details.direction) };
+			const Vecteur3<T> vitesseCollision{ glm::proj(vitesse, details.direction) };
 			return vitesseCollision * -constanteAmortissement;
 		}
 	}
@@ -440,16 +1078,16 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec2 calculerCollisionSegment(
-	///        const glm::dvec2&   point1,
-	///        const glm::dvec2&   point2,
-	///        const glm::dvec2&   position,
-	///        double            rayon,
+	/// @fn Vecteur2<T> calculerCollisionSegment(
+	///        const Vecteur2<T>&   point1,
+	///        const Vecteur2<T>&   point2,
+	///        const Vecteur2<T>&   position,
+	///        T            rayon,
 	///        bool              collisionAvecPoints,
-	///        double            constanteRebondissement,
-	///        double            constanteAmortissement,
-	///        const glm::dvec2&   vitesse,
-	///        DetailsCollision* retourDetails = 0
+	///        T            constanteRebondissement,
+	///        T            constanteAmortissement,
+	///        const Vecteur2<T>&   vitesse,
+	///        DetailsCollisiont<T>* retourDetails = 0
 	///        );
 	///
 	/// Cette fonction calcule la force cause par la collision d'un cercle,
@@ -479,25 +1117,26 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en deux dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec2 calculerCollisionSegment(
-		const glm::dvec2&   point1,
-		const glm::dvec2&   point2,
-		const glm::dvec2&   position,
-		double            rayon,
+	template <class T>
+	Vecteur2<T> calculerCollisionSegment(
+		const Vecteur2<T>&   point1,
+		const Vecteur2<T>&   point2,
+		const Vecteur2<T>&   position,
+		typename Identite<T>::Type rayon,
 		bool              collisionAvecPoints,
-		double            constanteRebondissement,
-		double            constanteAmortissement,
-		const glm::dvec2&   vitesse,
-		DetailsCollision* retourDetails //= 0
+		typename Identite<T>::Type constanteRebondissement,
+		typename Identite<T>::Type constanteAmortissement,
+		const Vecteur2<T>&   vitesse,
+		DetailsCollisiont<T>* retourDetails //= 0
 		)
 	{
-		return glm::dvec2(calculerCollisionSegment(
-			glm::dvec3{ point1, 0.0 }, glm::dvec3{ point2, 0.0 },
-			glm::dvec3{ position, 0.0 }, rayon,
+		return Vecteur2<T>(calculerCollisionSegment(
+			Vecteur3<T>{ point1, 0.0 }, Vecteur3<T>{ point2, 0.0 },
+			Vecteur3<T>{ position, 0.0 }, rayon,
 			collisionAvecPoints,
 			constanteRebondissement,
 			constanteAmortissement,
-			glm::dvec3{ vitesse, 0.0 },
+			Vecteur3<T>{ vitesse, 0.0 },
 			retourDetails
 			));
 	}
@@ -505,16 +1144,16 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec3 calculerCollisionSegment(
-	///        const glm::dvec3&   point1,
-	///        const glm::dvec3&   point2,
-	///        const glm::dvec3&   position,
-	///        double            rayon,
+	/// @fn Vecteur3<T> calculerCollisionSegment(
+	///        const Vecteur3<T>&   point1,
+	///        const Vecteur3<T>&   point2,
+	///        const Vecteur3<T>&   position,
+	///        T            rayon,
 	///        bool              collisionAvecPoints,
-	///        double            constanteRebondissement,
-	///        double            constanteAmortissement,
-	///        const glm::dvec3&   vitesse,
-	///        DetailsCollision* retourDetails = 0
+	///        T            constanteRebondissement,
+	///        T            constanteAmortissement,
+	///        const Vecteur3<T>&   vitesse,
+	///        DetailsCollisiont<T>* retourDetails = 0
 	///        );
 	///
 	/// Cette fonction calcule la force cause par la collision d'un cercle,
@@ -542,25 +1181,26 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en trois dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec3 calculerCollisionSegment(
-		const glm::dvec3&   point1,
-		const glm::dvec3&   point2,
-		const glm::dvec3&   position,
-		double            rayon,
+	template <class T>
+	Vecteur3<T> calculerCollisionSegment(
+		const Vecteur3<T>&   point1,
+		const Vecteur3<T>&   point2,
+		const Vecteur3<T>&   position,
+		typename Identite<T>::Type rayon,
 		bool              collisionAvecPoints,
-		double            constanteRebondissement,
-		double            constanteAmortissement,
-		const glm::dvec3&   vitesse,
-		DetailsCollision* retourDetails //= 0
+		typename Identite<T>::Type constanteRebondissement,
+		typename Identite<T>::Type constanteAmortissement,
+		const Vecteur3<T>&   vitesse,
+		DetailsCollisiont<T>* retourDetails //= 0
 		)
 	{
-		DetailsCollision details = calculerCollisionSegment(
+		DetailsCollisiont<T> details = calculerCollisionSegment(
 			point1, point2,
 			position, rayon,
 			collisionAvecPoints
 			);
 
-		glm::dvec3 force{ calculerForceRebondissement3D(
+		Vecteur3<T> force{ calculerForceRebondissement3D(
 			details, constanteRebondissement
 			) };
 		force += calculerForceAmortissement3D(
@@ -576,15 +1216,15 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec2 calculerCollisionCercle(
-	///        const glm::dvec2&   centreCercle,
-	///        double            rayonCercle,
-	///        const glm::dvec2&   positionObjet,
-	///        double            rayonObjet,
-	///        double            constanteRebondissement,
-	///        double            constanteAmortissement,
-	///        const glm::dvec2&   vitesse,
-	///        DetailsCollision* retourDetails = 0
+	/// @fn Vecteur2<T> calculerCollisionCercle(
+	///        const Vecteur2<T>&   centreCercle,
+	///        T            rayonCercle,
+	///        const Vecteur2<T>&   positionObjet,
+	///        T            rayonObjet,
+	///        T            constanteRebondissement,
+	///        T            constanteAmortissement,
+	///        const Vecteur2<T>&   vitesse,
+	///        DetailsCollisiont<T>* retourDetails = 0
 	///        );
 	///
 	/// Cette fonction calcule la force cause par la collision d'un
@@ -613,23 +1253,24 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en deux dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec2 calculerCollisionCercle(
-		const glm::dvec2&   centreCercle,
-		double            rayonCercle,
-		const glm::dvec2&   positionObjet,
-		double            rayonObjet,
-		double            constanteRebondissement,
-		double            constanteAmortissement,
-		const glm::dvec2&   vitesse,
-		DetailsCollision* retourDetails //= 0
+	template <class T>
+	Vecteur2<T> calculerCollisionCercle(
+		const Vecteur2<T>&   centreCercle,
+		typename Identite<T>::Type rayonCercle,
+		const Vecteur2<T>&   positionObjet,
+		typename Identite<T>::Type rayonObjet,
+		typename Identite<T>::Type constanteRebondissement,
+		typename Identite<T>::Type constanteAmortissement,
+		const Vecteur2<T>&   vitesse,
+		DetailsCollisiont<T>* retourDetails //= 0
 		)
 	{
-		return glm::dvec2(calculerCollisionSphere(
-			glm::dvec3{ centreCercle, 0.0 }, rayonCercle,
-			glm::dvec3{ positionObjet, 0.0 }, rayonObjet,
+		return Vecteur2<T>(calculerCollisionSphere(
+			Vecteur3<T>{ centreCercle, 0.0 }, rayonCercle,
+			Vecteur3<T>{ positionObjet, 0.0 }, rayonObjet,
 			constanteRebondissement,
 			constanteAmortissement,
-			glm::dvec3{ vitesse, 0.0 },
+			Vecteur3<T>{ vitesse, 0.0 },
 			retourDetails
 			));
 	}
@@ -637,15 +1278,15 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec3 calculerCollisionSphere(
-	///        const glm::dvec3&   centreSphere,
-	///        double            rayonSphere,
-	///        const glm::dvec3&   positionObjet,
-	///        double            rayonObjet,
-	///        double            constanteRebondissement,
-	///        double            constanteAmortissement,
-	///        const glm::dvec3&   vitesse,
-	///        DetailsCollision* retourDetails = 0
+	/// @fn Vecteur3<T> calculerCollisionSphere(
+	///        const Vecteur3<T>&   centreSphere,
+	///        T            rayonSphere,
+	///        const Vecteur3<T>&   positionObjet,
+	///        T            rayonObjet,
+	///        T            constanteRebondissement,
+	///        T            constanteAmortissement,
+	///        const Vecteur3<T>&   vitesse,
+	///        DetailsCollisiont<T>* retourDetails = 0
 	///        );
 	///
 	/// Cette fonction calcule la force cause par la collision d'une
@@ -672,23 +1313,24 @@ namespace aidecollision {
 	/// @return Force cause par la collision, en trois dimensions.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec3 calculerCollisionSphere(
-		const glm::dvec3&   centreSphere,
-		double            rayonSphere,
-		const glm::dvec3&   positionObjet,
-		double            rayonObjet,
-		double            constanteRebondissement,
-		double            constanteAmortissement,
-		const glm::dvec3&   vitesse,
-		DetailsCollision* retourDetails //= 0
+	template <class T>
+	Vecteur3<T> calculerCollisionSphere(
+		const Vecteur3<T>&   centreSphere,
+		typename Identite<T>::Type rayonSphere,
+		const Vecteur3<T>&   positionObjet,
+		typename Identite<T>::Type rayonObjet,
+		typename Identite<T>::Type constanteRebondissement,
+		typename Identite<T>::Type constanteAmortissement,
+		const Vecteur3<T>&   vitesse,
+		DetailsCollisiont<T>* retourDetails //= 0
 		)
 	{
-		DetailsCollision details = calculerCollisionSphere(
+		DetailsCollisiont<T> details = calculerCollisionSphere(
 			centreSphere, rayonSphere,
 			positionObjet, rayonObjet
 			);
 
-		glm::dvec3 force{ calculerForceRebondissement3D(
+		Vecteur3<T> force{ calculerForceRebondissement3D(
 			details, constanteRebondissement
 			) };
 		force += calculerForceAmortissement3D(
@@ -704,8 +1346,8 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn double calculerCombinaisonRebondissement(
-	///        double constante1, double constante2
+	/// @fn T calculerCombinaisonRebondissement(
+	///        T constante1, T constante2
 	///        );
 	///
 	/// Cette fonction calcule la constante rsultant de la combinaison de deux
@@ -720,8 +1362,9 @@ namespace aidecollision {
 	/// @return Constante rsultante pour les deux objets.
 	///
 	////////////////////////////////////////////////////////////////////////
-	double calculerCombinaisonRebondissement(
-		double constante1, double constante2
+	template <class T>
+	T calculerCombinaisonRebondissement(
+		T constante1, typename Identite<T>::Type constante2
 		)
 	{
 		return constante1 * constante2 / (constante1 + constante2);
@@ -730,8 +1373,8 @@ namespace aidecollision {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn double calculerCombinaisonAmortissement(
-	///        double constante1, double constante2
+	/// @fn T calculerCombinaisonAmortissement(
+	///        T constante1, T constante2
 	///        );
 	///
 	/// Cette fonction calcule la constante rsultant de la combinaison de deux
@@ -743,14 +1386,66 @@ namespace aidecollision {
 	/// @return Constante rsultante pour les deux objets.
 	///
 	////////////////////////////////////////////////////////////////////////
-	double calculerCombinaisonAmortissement(
-		double constante1, double constante2
+	template <class T>
+	T calculerCombinaisonAmortissement(
+		T constante1, typename Identite<T>::Type constante2
 		)
 	{
 		return constante1 + constante2;
 	}
 
 
+	// Instanciations explicites pour les deux prcisions.
+#define AIDECOLLISION_INSTANCIER(T) \
+	template DetailsCollisiont<T> calculerCollisionSegment<T>( \
+		const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, T, bool); \
+	template DetailsCollisiont<T> calculerCollisionSegment<T>( \
+		const Vecteur3<T>&, const Vecteur3<T>&, const Vecteur3<T>&, T, bool); \
+	template DetailsCollisiont<T> calculerCollisionCercle<T>( \
+		const Vecteur2<T>&, T, const Vecteur2<T>&, T); \
+	template DetailsCollisiont<T> calculerCollisionArc<T>( \
+		const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, T); \
+	template DetailsCollisiont<T> calculerCollisionSphere<T>( \
+		const Vecteur3<T>&, T, const Vecteur3<T>&, T); \
+	template DetailsImpactt<T> calculerImpactSegment<T>( \
+		const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, T, bool); \
+	template DetailsImpactt<T> calculerImpactSegment<T>( \
+		const Vecteur3<T>&, const Vecteur3<T>&, const Vecteur3<T>&, const Vecteur3<T>&, T, bool); \
+	template DetailsImpactt<T> calculerImpactCercle<T>( \
+		const Vecteur2<T>&, T, const Vecteur2<T>&, const Vecteur2<T>&, T); \
+	template DetailsImpactt<T> calculerImpactArc<T>( \
+		const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, T); \
+	template DetailsImpactt<T> calculerImpactSphere<T>( \
+		const Vecteur3<T>&, T, const Vecteur3<T>&, const Vecteur3<T>&, T); \
+	template const DetailsImpactt<T>& choisirPremierImpact<T>( \
+		const DetailsImpactt<T>&, const DetailsImpactt<T>&); \
+	template unsigned int avancerParImpacts<T>( \
+		Vecteur3<T>&, Vecteur3<T>&, T, T, const CalculImpactt<T>&, unsigned int); \
+	template Vecteur2<T> calculerForceRebondissement2D<T>( \
+		const DetailsCollisiont<T>&, T); \
+	template Vecteur3<T> calculerForceRebondissement3D<T>( \
+		const DetailsCollisiont<T>&, T); \
+	template Vecteur2<T> calculerForceAmortissement2D<T>( \
+		const DetailsCollisiont<T>&, const Vecteur2<T>&, T); \
+	template Vecteur3<T> calculerForceAmortissement3D<T>( \
+		const DetailsCollisiont<T>&, const Vecteur3<T>&, T); \
+	template Vecteur2<T> calculerCollisionSegment<T>( \
+		const Vecteur2<T>&, const Vecteur2<T>&, const Vecteur2<T>&, T, bool, T, T, const Vecteur2<T>&, DetailsCollisiont<T>*); \
+	template Vecteur3<T> calculerCollisionSegment<T>( \
+		const Vecteur3<T>&, const Vecteur3<T>&, const Vecteur3<T>&, T, bool, T, T, const Vecteur3<T>&, DetailsCollisiont<T>*); \
+	template Vecteur2<T> calculerCollisionCercle<T>( \
+		const Vecteur2<T>&, T, const Vecteur2<T>&, T, T, T, const Vecteur2<T>&, DetailsCollisiont<T>*); \
+	template Vecteur3<T> calculerCollisionSphere<T>( \
+		const Vecteur3<T>&, T, const Vecteur3<T>&, T, T, T, const Vecteur3<T>&, DetailsCollisiont<T>*); \
+	template T calculerCombinaisonRebondissement<T>(T, T); \
+	template T calculerCombinaisonAmortissement<T>(T, T);
+
+	AIDECOLLISION_INSTANCIER(float)
+	AIDECOLLISION_INSTANCIER(double)
+
+#undef AIDECOLLISION_INSTANCIER
+
+
 } // Fin de l'espace de nom aidecollision.
 
 
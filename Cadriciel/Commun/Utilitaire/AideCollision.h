@@ -5,6 +5,11 @@
 /// Il contient les dclarations de fonctions utiles pour le calcul des forces
 /// causes par les collisions.
 ///
+/// Les fonctions sont gnriques sur le type de rel utilis et sont
+/// instancies pour les float et les double.  Le type est dduit des
+/// vecteurs passs en paramtre : les paramtres rels isols (rayons,
+/// constantes) sont convertis au type des vecteurs.
+///
 /// @author Martin Bisson
 /// @date 2007-01-10
 ///
@@ -17,11 +22,30 @@
 
 #include "glm\glm.hpp"
 
+#include <functional>
+
 /// Espace de nom contenant des fonctions utiles pour le calcul des forces
 /// causes par les collisions.
 namespace aidecollision {
 
 
+   /// Vecteur en deux dimensions d'un type de rel donn.
+   template <class T>
+   using Vecteur2 = glm::detail::tvec2<T, glm::defaultp>;
+
+   /// Vecteur en trois dimensions d'un type de rel donn.
+   template <class T>
+   using Vecteur3 = glm::detail::tvec3<T, glm::defaultp>;
+
+   /// Identit sur les types, qui exclut un paramtre de la dduction du
+   /// type de rel des fonctions gnriques.
+   template <class T>
+   class Identite {
+   public:
+      /// Le type lui-mme.
+      using Type = T;
+   };
+
    /// Type de collisions possibles avec un segment.
    enum Collision {
       COLLISION_AUCUNE = 0 ,
@@ -29,153 +53,278 @@ namespace aidecollision {
       COLLISION_SEGMENT ,
       COLLISION_SEGMENT_DEUXIEMEPOINT ,
       COLLISION_SPHERE ,
-      COLLISION_ARC
+      COLLISION_ARC ,
+      COLLISION_TRIANGLE
    };
 
    /// Structure contenant les informations d'une collision.
-   class DetailsCollision {
+   template <class T>
+   class DetailsCollisiont {
    public:
       /// Type de collision.
       Collision type;
       /// Direction de la collision.
-      glm::dvec3  direction;
-      /// Enfoncement de l'objet  l'intrieur de la collision.
-      double    enfoncement;
+      Vecteur3<T>  direction;
+      /// Enfoncement de l'objet  l'intrieur de la collision.  Sans
+      /// collision, un enfoncement ngatif indique que l'objet est spar
+      /// de l'obstacle d'au moins son oppos.
+      T    enfoncement;
+   };
+
+   /// Informations d'une collision en double prcision.
+   using DetailsCollision = DetailsCollisiont<double>;
+
+   /// Structure contenant les informations du premier impact d'un objet
+   /// en mouvement.
+   template <class T>
+   class DetailsImpactt {
+   public:
+      /// Type de collision.
+      Collision type;
+      /// Fraction du dplacement parcourue avant l'impact, entre 0 et 1.
+      T    instant;
+      /// Position de l'objet au moment de l'impact.
+      Vecteur3<T>  position;
+      /// Direction unitaire de la collision au moment de l'impact.
+      Vecteur3<T>  normale;
    };
 
+   /// Informations d'un impact en double prcision.
+   using DetailsImpact = DetailsImpactt<double>;
+
+   /// Calcul du premier impact d'un dplacement avec les obstacles d'une
+   /// scne.
+   template <class T>
+   using CalculImpactt = std::function<DetailsImpactt<T>(const Vecteur3<T>& position, const Vecteur3<T>& deplacement)>;
+
+   /// Calcul du premier impact en double prcision.
+   using CalculImpact = CalculImpactt<double>;
+
    /// Calcule la collision d'un objet circulaire avec un segment de droite.
-   DetailsCollision calculerCollisionSegment(
-      const glm::dvec2& point1,
-      const glm::dvec2& point2,
-      const glm::dvec2& position,
-      double          rayon,
+   template <class T>
+   DetailsCollisiont<T> calculerCollisionSegment(
+      const Vecteur2<T>& point1,
+      const Vecteur2<T>& point2,
+      const Vecteur2<T>& position,
+      typename Identite<T>::Type rayon,
       bool            collisionAvecPoints = true
       );
 
    /// Calcule la collision d'un objet sphrique avec un segment de droite.
-   DetailsCollision calculerCollisionSegment(
-      const glm::dvec3& point1,
-      const glm::dvec3& point2,
-      const glm::dvec3& position,
-      double          rayon,
+   template <class T>
+   DetailsCollisiont<T> calculerCollisionSegment(
+      const Vecteur3<T>& point1,
+      const Vecteur3<T>& point2,
+      const Vecteur3<T>& position,
+      typename Identite<T>::Type rayon,
       bool            collisionAvecPoints = true
       );
 
    /// Calcule la collision d'un objet circulaire avec un cercle.
-   DetailsCollision calculerCollisionCercle(
-      const glm::dvec2& centreCercle,
-      double          rayonCercle,
-      const glm::dvec2& positionObjet,
-      double          rayonObjet
+   template <class T>
+   DetailsCollisiont<T> calculerCollisionCercle(
+      const Vecteur2<T>& centreCercle,
+      typename Identite<T>::Type rayonCercle,
+      const Vecteur2<T>& positionObjet,
+      typename Identite<T>::Type rayonObjet
       );
 
    /// Calcule la collision d'un objet circulaire avec un arc de cercle.
-   DetailsCollision calculerCollisionArc(
-      const glm::dvec2& centreCercle,
-      const glm::dvec2& pointArc1,
-      const glm::dvec2& pointArc2,
-      const glm::dvec2& positionObjet,
-      double          rayonObjet
+   template <class T>
+   DetailsCollisiont<T> calculerCollisionArc(
+      const Vecteur2<T>& centreCercle,
+      const Vecteur2<T>& pointArc1,
+      const Vecteur2<T>& pointArc2,
+      const Vecteur2<T>& positionObjet,
+      typename Identite<T>::Type rayonObjet
       );
 
    /// Calcule la collision d'un objet sphrique avec une sphre.
-   DetailsCollision calculerCollisionSphere(
-      const glm::dvec3& centreSphere,
-      double          rayonSphere,
-      const glm::dvec3& positionObjet,
-      double          rayonObjet
+   template <class T>
+   DetailsCollisiont<T> calculerCollisionSphere(
+      const Vecteur3<T>& centreSphere,
+      typename Identite<T>::Type rayonSphere,
+      const Vecteur3<T>& positionObjet,
+      typename Identite<T>::Type rayonObjet
+      );
+
+   /// Calcule le premier impact d'un objet circulaire en mouvement avec un
+   /// segment de droite.
+   template <class T>
+   DetailsImpactt<T> calculerImpactSegment(
+      const Vecteur2<T>& point1,
+      const Vecteur2<T>& point2,
+      const Vecteur2<T>& position,
+      const Vecteur2<T>& deplacement,
+      typename Identite<T>::Type rayon,
+      bool            collisionAvecPoints = true
+      );
+
+   /// Calcule le premier impact d'un objet sphrique en mouvement avec un
+   /// segment de droite.
+   template <class T>
+   DetailsImpactt<T> calculerImpactSegment(
+      const Vecteur3<T>& point1,
+      const Vecteur3<T>& point2,
+      const Vecteur3<T>& position,
+      const Vecteur3<T>& deplacement,
+      typename Identite<T>::Type rayon,
+      bool            collisionAvecPoints = true
+      );
+
+   /// Calcule le premier impact d'un objet circulaire en mouvement avec un
+   /// cercle.
+   template <class T>
+   DetailsImpactt<T> calculerImpactCercle(
+      const Vecteur2<T>& centreCercle,
+      typename Identite<T>::Type rayonCercle,
+      const Vecteur2<T>& positionObjet,
+      const Vecteur2<T>& deplacement,
+      typename Identite<T>::Type rayonObjet
+      );
+
+   /// Calcule le premier impact d'un objet circulaire en mouvement avec un
+   /// arc de cercle.
+   template <class T>
+   DetailsImpactt<T> calculerImpactArc(
+      const Vecteur2<T>& centreCercle,
+      const Vecteur2<T>& pointArc1,
+      const Vecteur2<T>& pointArc2,
+      const Vecteur2<T>& positionObjet,
+      const Vecteur2<T>& deplacement,
+      typename Identite<T>::Type rayonObjet
+      );
+
+   /// Calcule le premier impact d'un objet sphrique en mouvement avec une
+   /// sphre.
+   template <class T>
+   DetailsImpactt<T> calculerImpactSphere(
+      const Vecteur3<T>& centreSphere,
+      typename Identite<T>::Type rayonSphere,
+      const Vecteur3<T>& positionObjet,
+      const Vecteur3<T>& deplacement,
+      typename Identite<T>::Type rayonObjet
+      );
+
+   /// Retient le premier de deux impacts.
+   template <class T>
+   const DetailsImpactt<T>& choisirPremierImpact(
+      const DetailsImpactt<T>& impact1,
+      const DetailsImpactt<T>& impact2
+      );
+
+   /// Avance un objet sphrique d'impact en impact plutt que par sous-pas
+   /// de dure fixe.
+   template <class T>
+   unsigned int avancerParImpacts(
+      Vecteur3<T>&         position,
+      Vecteur3<T>&         vitesse,
+      typename Identite<T>::Type temps,
+      typename Identite<T>::Type restitution,
+      const typename Identite< CalculImpactt<T> >::Type& calculerImpact,
+      unsigned int        nombreMaximal = 8
       );
 
    /// Calcule la force en deux dimensions  partir d'une collision.
-   glm::dvec2 calculerForceRebondissement2D(
-      const DetailsCollision& details,
-      double constanteRebondissement
+   template <class T>
+   Vecteur2<T> calculerForceRebondissement2D(
+      const DetailsCollisiont<T>& details,
+      typename Identite<T>::Type constanteRebondissement
       );
 
    /// Calcule la force en trois dimensions  partir d'une collision.
-   glm::dvec3 calculerForceRebondissement3D(
-      const DetailsCollision& details,
-      double constanteRebondissement
+   template <class T>
+   Vecteur3<T> calculerForceRebondissement3D(
+      const DetailsCollisiont<T>& details,
+      typename Identite<T>::Type constanteRebondissement
       );
 
    /// Calcule la force d'amortissement en deux dimensions au cours d'une
    /// collision.
-   glm::dvec2 calculerForceAmortissement2D(
-      const DetailsCollision& details,
-      const glm::dvec2& vitesse,
-      double constanteAmortissement
+   template <class T>
+   Vecteur2<T> calculerForceAmortissement2D(
+      const DetailsCollisiont<T>& details,
+      const Vecteur2<T>& vitesse,
+      typename Identite<T>::Type constanteAmortissement
       );
 
    /// Calcule la force d'amortissement en trois dimensions au cours d'une
    /// collision.
-   glm::dvec3 calculerForceAmortissement3D(
-      const DetailsCollision& details,
-      const glm::dvec3& vitesse,
-      double constanteAmortissement
+   template <class T>
+   Vecteur3<T> calculerForceAmortissement3D(
+      const DetailsCollisiont<T>& details,
+      const Vecteur3<T>& vitesse,
+      typename Identite<T>::Type constanteAmortissement
       );
 
    /// Calcule la force en deux dimensions cause par la collision d'un objet
    /// circulaire avec un segment de droite.
-   glm::dvec2 calculerCollisionSegment(
-      const glm::dvec2&   point1,
-      const glm::dvec2&   point2,
-      const glm::dvec2&   position,
-      double            rayon,
+   template <class T>
+   Vecteur2<T> calculerCollisionSegment(
+      const Vecteur2<T>&   point1,
+      const Vecteur2<T>&   point2,
+      const Vecteur2<T>&   position,
+      typename Identite<T>::Type rayon,
       bool              collisionAvecPoints,
-      double            constanteRebondissement,
-      double            constanteAmortissement,
-      const glm::dvec2&   vitesse,
-      DetailsCollision* retourDetails = 0
+      typename Identite<T>::Type constanteRebondissement,
+      typename Identite<T>::Type constanteAmortissement,
+      const Vecteur2<T>&   vitesse,
+      DetailsCollisiont<T>* retourDetails = 0
       );
 
    /// Calcule la force en trois dimensions cause par la collision d'un objet
    /// sphrique avec un segment de droite.
-   glm::dvec3 calculerCollisionSegment(
-      const glm::dvec3&   point1,
-      const glm::dvec3&   point2,
-      const glm::dvec3&   position,
-      double            rayon,
+   template <class T>
+   Vecteur3<T> calculerCollisionSegment(
+      const Vecteur3<T>&   point1,
+      const Vecteur3<T>&   point2,
+      const Vecteur3<T>&   position,
+      typename Identite<T>::Type rayon,
       bool              collisionAvecPoints,
-      double            constanteRebondissement,
-      double            constanteAmortissement,
-      const glm::dvec3&   vitesse,
-      DetailsCollision* retourDetails = 0
+      typename Identite<T>::Type constanteRebondissement,
+      typename Identite<T>::Type constanteAmortissement,
+      const Vecteur3<T>&   vitesse,
+      DetailsCollisiont<T>* retourDetails = 0
       );
 
    /// Calcule la force en deux dimensions cause par la collision d'un objet
    /// circulaire avec un cercle.
-   glm::dvec3 calculerCollisionCercle(
-      const glm::dvec3&   centreCercle,
-      double            rayonCercle,
-      const glm::dvec3&   positionObjet,
-      double            rayonObjet,
-      double            constanteRebondissement,
-      double            constanteAmortissement,
-      const glm::dvec2&   vitesse,
-      DetailsCollision* retourDetails = 0
+   template <class T>
+   Vecteur2<T> calculerCollisionCercle(
+      const Vecteur2<T>&   centreCercle,
+      typename Identite<T>::Type rayonCercle,
+      const Vecteur2<T>&   positionObjet,
+      typename Identite<T>::Type rayonObjet,
+      typename Identite<T>::Type constanteRebondissement,
+      typename Identite<T>::Type constanteAmortissement,
+      const Vecteur2<T>&   vitesse,
+      DetailsCollisiont<T>* retourDetails = 0
       );
 
    /// Calcule la force en trois dimensions cause par la collision d'un objet
    /// sphrique avec une sphre.
-   glm::dvec3 calculerCollisionSphere(
-      const glm::dvec3&   centreSphere,
-      double            rayonSphere,
-      const glm::dvec3&   positionObjet,
-      double            rayonObjet,
-      double            constanteRebondissement,
-      double            constanteAmortissement,
-      const glm::dvec3&   vitesse,
-      DetailsCollision* retourDetails = 0
+   template <class T>
+   Vecteur3<T> calculerCollisionSphere(
+      const Vecteur3<T>&   centreSphere,
+      typename Identite<T>::Type rayonSphere,
+      const Vecteur3<T>&   positionObjet,
+      typename Identite<T>::Type rayonObjet,
+      typename Identite<T>::Type constanteRebondissement,
+      typename Identite<T>::Type constanteAmortissement,
+      const Vecteur3<T>&   vitesse,
+      DetailsCollisiont<T>* retourDetails = 0
       );
 
    /// Calcule la combinaison de deux constantes de rebondissement.
-   double calculerCombinaisonRebondissement(
-      double constante1, double constante2
+   template <class T>
+   T calculerCombinaisonRebondissement(
+      T constante1, typename Identite<T>::Type constante2
       );
 
    /// Calcule la combinaison de deux constantes d'amortissement.
-   double calculerCombinaisonAmortissement(
-      double constante1, double constante2
+   template <class T>
+   T calculerCombinaisonAmortissement(
+      T constante1, typename Identite<T>::Type constante2
       );
 
 
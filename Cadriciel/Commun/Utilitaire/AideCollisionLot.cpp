@@ -0,0 +1,581 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file AideCollisionLot.cpp
+/// @brief Ce fichier contient l'implantation des calculs de collisions par
+///        lots de l'espace de nom aidecollision.
+///
+/// Chaque calcul est crit une seule fois, sous la forme d'un noyau
+/// paramtr par une classe d'oprations vectorielles.  Le noyau traite
+/// les objets par groupes de la largeur des registres; les objets qui
+/// restent sont traits par le mme noyau avec les oprations scalaires.
+/// Seuls les objets retenus par le noyau sont ensuite dtaills, de la
+/// mme faon que dans les fonctions de AideCollision.cpp.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "AideCollisionLot.h"
+
+#if defined(__AVX__)
+#define AIDECOLLISION_AVX
+#include <immintrin.h>
+#endif
+
+#if defined(AIDECOLLISION_AVX) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AIDECOLLISION_SSE
+#include <emmintrin.h>
+#endif
+
+namespace aidecollision {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class OperationsScalaires
+	/// @brief Oprations des noyaux de calcul sur un seul rel  la fois.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class OperationsScalaires
+	{
+	public:
+		/// Registre contenant les rels.
+		using Registre = T;
+		/// Rsultat d'une comparaison.
+		using Masque = bool;
+		/// Nombre de rels par registre.
+		static const int LARGEUR{ 1 };
+
+		static inline Registre charger(const T* source) { return *source; }
+		static inline Registre diffuser(T valeur) { return valeur; }
+		static inline Registre additionner(Registre a, Registre b) { return a + b; }
+		static inline Registre soustraire(Registre a, Registre b) { return a - b; }
+		static inline Registre multiplier(Registre a, Registre b) { return a * b; }
+		static inline Registre diviser(Registre a, Registre b) { return a / b; }
+		static inline Registre minimum(Registre a, Registre b) { return a < b ? a : b; }
+		static inline Registre maximum(Registre a, Registre b) { return a > b ? a : b; }
+		static inline Masque inferieur(Registre a, Registre b) { return a < b; }
+		static inline Masque inferieurEgal(Registre a, Registre b) { return a <= b; }
+		static inline Masque et(Masque a, Masque b) { return a && b; }
+		static inline int extraireBits(Masque masque) { return masque ? 1 : 0; }
+	};
+
+
+#ifdef AIDECOLLISION_SSE
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class OperationsSse
+	/// @brief Oprations des noyaux de calcul sur des registres SSE de 128
+	///        bits.  Seules les spcialisations pour float et double
+	///        existent.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class OperationsSse;
+
+	/// Oprations SSE sur quatre float.
+	template <>
+	class OperationsSse<float>
+	{
+	public:
+		using Registre = __m128;
+		using Masque = __m128;
+		static const int LARGEUR{ 4 };
+
+		static inline Registre charger(const float* source) { return _mm_loadu_ps(source); }
+		static inline Registre diffuser(float valeur) { return _mm_set1_ps(valeur); }
+		static inline Registre additionner(Registre a, Registre b) { return _mm_add_ps(a, b); }
+		static inline Registre soustraire(Registre a, Registre b) { return _mm_sub_ps(a, b); }
+		static inline Registre multiplier(Registre a, Registre b) { return _mm_mul_ps(a, b); }
+		static inline Registre diviser(Registre a, Registre b) { return _mm_div_ps(a, b); }
+		static inline Registre minimum(Registre a, Registre b) { return _mm_min_ps(a, b); }
+		static inline Registre maximum(Registre a, Registre b) { return _mm_max_ps(a, b); }
+		static inline Masque inferieur(Registre a, Registre b) { return _mm_cmplt_ps(a, b); }
+		static inline Masque inferieurEgal(Registre a, Registre b) { return _mm_cmple_ps(a, b); }
+		static inline Masque et(Masque a, Masque b) { return _mm_and_ps(a, b); }
+		static inline int extraireBits(Masque masque) { return _mm_movemask_ps(masque); }
+	};
+
+	/// Oprations SSE sur deux double.
+	template <>
+	class OperationsSse<double>
+	{
+	public:
+		using Registre = __m128d;
+		using Masque = __m128d;
+		static const int LARGEUR{ 2 };
+
+		static inline Registre charger(const double* source) { return _mm_loadu_pd(source); }
+		static inline Registre diffuser(double valeur) { return _mm_set1_pd(valeur); }
+		static inline Registre additionner(Registre a, Registre b) { return _mm_add_pd(a, b); }
+		static inline Registre soustraire(Registre a, Registre b) { return _mm_sub_pd(a, b); }
+		static inline Registre multiplier(Registre a, Registre b) { return _mm_mul_pd(a, b); }
+		static inline Registre diviser(Registre a, Registre b) { return _mm_div_pd(a, b); }
+		static inline Registre minimum(Registre a, Registre b) { return _mm_min_pd(a, b); }
+		static inline Registre maximum(Registre a, Registre b) { return _mm_max_pd(a, b); }
+		static inline Masque inferieur(Registre a, Registre b) { return _mm_cmplt_pd(a, b); }
+		static inline Masque inferieurEgal(Registre a, Registre b) { return _mm_cmple_pd(a, b); }
+		static inline Masque et(Masque a, Masque b) { return _mm_and_pd(a, b); }
+		static inline int extraireBits(Masque masque) { return _mm_movemask_pd(masque); }
+	};
+
+#endif // AIDECOLLISION_SSE
+
+
+#ifdef AIDECOLLISION_AVX
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class OperationsAvx
+	/// @brief Oprations des noyaux de calcul sur des registres AVX de 256
+	///        bits.  Seules les spcialisations pour float et double
+	///        existent.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class OperationsAvx;
+
+	/// Oprations AVX sur huit float.
+	template <>
+	class OperationsAvx<float>
+	{
+	public:
+		using Registre = __m256;
+		using Masque = __m256;
+		static const int LARGEUR{ 8 };
+
+		static inline Registre charger(const float* source) { return _mm256_loadu_ps(source); }
+		static inline Registre diffuser(float valeur) { return _mm256_set1_ps(valeur); }
+		static inline Registre additionner(Registre a, Registre b) { return _mm256_add_ps(a, b); }
+		static inline Registre soustraire(Registre a, Registre b) { return _mm256_sub_ps(a, b); }
+		static inline Registre multiplier(Registre a, Registre b) { return _mm256_mul_ps(a, b); }
+		static inline Registre diviser(Registre a, Registre b) { return _mm256_div_ps(a, b); }
+		static inline Registre minimum(Registre a, Registre b) { return _mm256_min_ps(a, b); }
+		static inline Registre maximum(Registre a, Registre b) { return _mm256_max_ps(a, b); }
+		static inline Masque inferieur(Registre a, Registre b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static inline Masque inferieurEgal(Registre a, Registre b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		static inline Masque et(Masque a, Masque b) { return _mm256_and_ps(a, b); }
+		static inline int extraireBits(Masque masque) { return _mm256_movemask_ps(masque); }
+	};
+
+	/// Oprations AVX sur quatre double.
+	template <>
+	class OperationsAvx<double>
+	{
+	public:
+		using Registre = __m256d;
+		using Masque = __m256d;
+		static const int LARGEUR{ 4 };
+
+		static inline Registre charger(const double* source) { return _mm256_loadu_pd(source); }
+		static inline Registre diffuser(double valeur) { return _mm256_set1_pd(valeur); }
+		static inline Registre additionner(Registre a, Registre b) { return _mm256_add_pd(a, b); }
+		static inline Registre soustraire(Registre a, Registre b) { return _mm256_sub_pd(a, b); }
+		static inline Registre multiplier(Registre a, Registre b) { return _mm256_mul_pd(a, b); }
+		static inline Registre diviser(Registre a, Registre b) { return _mm256_div_pd(a, b); }
+		static inline Registre minimum(Registre a, Registre b) { return _mm256_min_pd(a, b); }
+		static inline Registre maximum(Registre a, Registre b) { return _mm256_max_pd(a, b); }
+		static inline Masque inferieur(Registre a, Registre b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+		static inline Masque inferieurEgal(Registre a, Registre b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+		static inline Masque et(Masque a, Masque b) { return _mm256_and_pd(a, b); }
+		static inline int extraireBits(Masque masque) { return _mm256_movemask_pd(masque); }
+	};
+
+#endif // AIDECOLLISION_AVX
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn JeuInstructions obtenirJeuInstructions()
+	///
+	/// Cette fonction retourne le meilleur jeu d'instructions vectorielles
+	/// que le compilateur a t autoris  utiliser (/arch:AVX, par
+	/// exemple).  C'est celui qu'utilisent par dfaut les calculs par lots.
+	///
+	/// @return Le meilleur jeu d'instructions disponible.
+	///
+	////////////////////////////////////////////////////////////////////////
+	JeuInstructions obtenirJeuInstructions()
+	{
+#if defined(AIDECOLLISION_AVX)
+		return JEU_AVX;
+#elif defined(AIDECOLLISION_SSE)
+		return JEU_SSE;
+#else
+		return JEU_SCALAIRE;
+#endif
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn ContactLot<T> detaillerSphere(
+	///        const LotSpheres<T>& objets, std::size_t indice,
+	///        const Vecteur3<T>& centreSphere, T rayonSphere, unsigned int cible
+	///        );
+	///
+	/// Cette fonction dtaille la collision d'un objet retenu avec une
+	/// sphre, comme calculerCollisionSphere(): la direction va du centre
+	/// de la sphre  celui de l'objet et n'est pas normalise.
+	///
+	/// @param[in] objets       : Le lot d'objets.
+	/// @param[in] indice       : L'indice de l'objet dans le lot.
+	/// @param[in] centreSphere : Centre de la sphre touche.
+	/// @param[in] rayonSphere  : Rayon de la sphre touche.
+	/// @param[in] cible        : Indice de la sphre dans son lot.
+	///
+	/// @return Le contact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	ContactLot<T> detaillerSphere(
+		const LotSpheres<T>& objets, std::size_t indice,
+		const Vecteur3<T>& centreSphere, T rayonSphere, unsigned int cible
+		)
+	{
+		const Vecteur3<T> position{ objets.x[indice], objets.y[indice], objets.z[indice] };
+
+		ContactLot<T> contact;
+		contact.objet = static_cast<unsigned int>(indice);
+		contact.cible = cible;
+		contact.type = COLLISION_SPHERE;
+		contact.direction = position - centreSphere;
+		contact.enfoncement = rayonSphere + objets.rayon[indice] - glm::length(contact.direction);
+		return contact;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn ContactLot<T> detaillerSegment(
+	///        const LotSpheres<T>& objets, std::size_t indice,
+	///        const Vecteur3<T>& point1, const Vecteur3<T>& point2, unsigned int cible
+	///        );
+	///
+	/// Cette fonction dtaille la collision d'un objet retenu avec un
+	/// segment, comme calculerCollisionSegment(): le point touch est une
+	/// des extrmits ou la projection du centre de l'objet sur le
+	/// segment, et la direction est normalise.
+	///
+	/// @param[in] objets : Le lot d'objets.
+	/// @param[in] indice : L'indice de l'objet dans le lot.
+	/// @param[in] point1 : Premire extrmit du segment.
+	/// @param[in] point2 : Seconde extrmit du segment.
+	/// @param[in] cible  : Indice du segment dans son lot.
+	///
+	/// @return Le contact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	ContactLot<T> detaillerSegment(
+		const LotSpheres<T>& objets, std::size_t indice,
+		const Vecteur3<T>& point1, const Vecteur3<T>& point2, unsigned int cible
+		)
+	{
+		const Vecteur3<T> position{ objets.x[indice], objets.y[indice], objets.z[indice] };
+		const Vecteur3<T> segment{ point2 - point1 };
+		const T ratio{ glm::dot(position - point1, segment) / glm::dot(segment, segment) };
+
+		ContactLot<T> contact;
+		contact.objet = static_cast<unsigned int>(indice);
+		contact.cible = cible;
+
+		Vecteur3<T> pointTouche;
+		if (ratio < T(0)) {
+			contact.type = COLLISION_SEGMENT_PREMIERPOINT;
+			pointTouche = point1;
+		}
+		else if (ratio > T(1)) {
+			contact.type = COLLISION_SEGMENT_DEUXIEMEPOINT;
+			pointTouche = point2;
+		}
+		else {
+			contact.type = COLLISION_SEGMENT;
+			pointTouche = (T(1) - ratio) * point1 + ratio * point2;
+		}
+
+		const Vecteur3<T> direction{ position - pointTouche };
+		const T distance{ glm::length(direction) };
+		contact.direction = direction / distance;
+		contact.enfoncement = objets.rayon[indice] - distance;
+		return contact;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::size_t balayerSphere(
+	///        const LotSpheres<T>& objets, std::size_t debut,
+	///        const Vecteur3<T>& centreSphere, T rayonSphere, unsigned int cible,
+	///        std::vector< ContactLot<T> >& contacts
+	///        );
+	///
+	/// Ce noyau compare une sphre aux objets du lot, par groupes de
+	/// S::LARGEUR objets  partir de l'indice donn.  Un objet touche la
+	/// sphre si le carr de la distance entre les centres est infrieur au
+	/// carr de la somme des rayons, ce qui vite une racine carre.
+	///
+	/// @param[in]  objets       : Le lot d'objets.
+	/// @param[in]  debut        : L'indice du premier objet  traiter.
+	/// @param[in]  centreSphere : Centre de la sphre.
+	/// @param[in]  rayonSphere  : Rayon de la sphre.
+	/// @param[in]  cible        : Indice de la sphre dans son lot.
+	/// @param[out] contacts     : Les contacts, ajouts  la fin.
+	///
+	/// @return L'indice du premier objet qui n'a pas t trait, parce
+	///         qu'il ne reste pas assez d'objets pour remplir un registre.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T, class S>
+	std::size_t balayerSphere(
+		const LotSpheres<T>& objets, std::size_t debut,
+		const Vecteur3<T>& centreSphere, T rayonSphere, unsigned int cible,
+		std::vector< ContactLot<T> >& contacts
+		)
+	{
+		using Registre = typename S::Registre;
+		using Masque = typename S::Masque;
+
+		const Registre cx{ S::diffuser(centreSphere.x) };
+		const Registre cy{ S::diffuser(centreSphere.y) };
+		const Registre cz{ S::diffuser(centreSphere.z) };
+		const Registre rs{ S::diffuser(rayonSphere) };
+		const Registre zero{ S::diffuser(T(0)) };
+
+		const std::size_t taille{ objets.obtenirTaille() };
+		std::size_t i{ debut };
+		for (; i + S::LARGEUR <= taille; i += S::LARGEUR) {
+			const Registre dx{ S::soustraire(S::charger(&objets.x[i]), cx) };
+			const Registre dy{ S::soustraire(S::charger(&objets.y[i]), cy) };
+			const Registre dz{ S::soustraire(S::charger(&objets.z[i]), cz) };
+			const Registre distance2{ S::additionner(S::additionner(
+				S::multiplier(dx, dx), S::multiplier(dy, dy)), S::multiplier(dz, dz)) };
+			const Registre somme{ S::additionner(S::charger(&objets.rayon[i]), rs) };
+
+			const Masque touche{ S::et(
+				S::inferieur(distance2, S::multiplier(somme, somme)), S::inferieur(zero, somme)) };
+
+			int bits{ S::extraireBits(touche) };
+			for (std::size_t voie = i; bits != 0; ++voie, bits >>= 1) {
+				if (bits & 1)
+					contacts.push_back(detaillerSphere(objets, voie, centreSphere, rayonSphere, cible));
+			}
+		}
+		return i;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::size_t balayerSegment(
+	///        const LotSpheres<T>& objets, std::size_t debut,
+	///        const Vecteur3<T>& point1, const Vecteur3<T>& point2, unsigned int cible,
+	///        bool collisionAvecPoints, std::vector< ContactLot<T> >& contacts
+	///        );
+	///
+	/// Ce noyau compare un segment aux objets du lot, par groupes de
+	/// S::LARGEUR objets  partir de l'indice donn.  Le centre de chaque
+	/// objet est projet sur la droite du segment; la projection, ramene
+	/// entre les extrmits, donne le point le plus proche du segment.
+	/// Sans collision avec les extrmits, seuls les objets dont la
+	/// projection tombe sur le segment sont retenus.
+	///
+	/// @param[in]  objets              : Le lot d'objets.
+	/// @param[in]  debut               : L'indice du premier objet  traiter.
+	/// @param[in]  point1              : Premire extrmit du segment.
+	/// @param[in]  point2              : Seconde extrmit du segment.
+	/// @param[in]  cible               : Indice du segment dans son lot.
+	/// @param[in]  collisionAvecPoints : Vrai si on veut les collisions avec
+	///                                   les extrmits.
+	/// @param[out] contacts            : Les contacts, ajouts  la fin.
+	///
+	/// @return L'indice du premier objet qui n'a pas t trait, parce
+	///         qu'il ne reste pas assez d'objets pour remplir un registre.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T, class S>
+	std::size_t balayerSegment(
+		const LotSpheres<T>& objets, std::size_t debut,
+		const Vecteur3<T>& point1, const Vecteur3<T>& point2, unsigned int cible,
+		bool collisionAvecPoints, std::vector< ContactLot<T> >& contacts
+		)
+	{
+		using Registre = typename S::Registre;
+		using Masque = typename S::Masque;
+
+		const Vecteur3<T> segment{ point2 - point1 };
+		const Registre px{ S::diffuser(point1.x) };
+		const Registre py{ S::diffuser(point1.y) };
+		const Registre pz{ S::diffuser(point1.z) };
+		const Registre sx{ S::diffuser(segment.x) };
+		const Registre sy{ S::diffuser(segment.y) };
+		const Registre sz{ S::diffuser(segment.z) };
+		const Registre longueur2{ S::diffuser(glm::dot(segment, segment)) };
+		const Registre zero{ S::diffuser(T(0)) };
+		const Registre un{ S::diffuser(T(1)) };
+
+		const std::size_t taille{ objets.obtenirTaille() };
+		std::size_t i{ debut };
+		for (; i + S::LARGEUR <= taille; i += S::LARGEUR) {
+			const Registre dx{ S::soustraire(S::charger(&objets.x[i]), px) };
+			const Registre dy{ S::soustraire(S::charger(&objets.y[i]), py) };
+			const Registre dz{ S::soustraire(S::charger(&objets.z[i]), pz) };
+			const Registre ratio{ S::diviser(S::additionner(S::additionner(
+				S::multiplier(dx, sx), S::multiplier(dy, sy)), S::multiplier(dz, sz)), longueur2) };
+			const Registre t{ S::minimum(S::maximum(ratio, zero), un) };
+
+			const Registre ex{ S::soustraire(dx, S::multiplier(t, sx)) };
+			const Registre ey{ S::soustraire(dy, S::multiplier(t, sy)) };
+			const Registre ez{ S::soustraire(dz, S::multiplier(t, sz)) };
+			const Registre distance2{ S::additionner(S::additionner(
+				S::multiplier(ex, ex), S::multiplier(ey, ey)), S::multiplier(ez, ez)) };
+			const Registre rayon{ S::charger(&objets.rayon[i]) };
+
+			Masque touche{ S::et(
+				S::inferieur(distance2, S::multiplier(rayon, rayon)), S::inferieur(zero, rayon)) };
+			if (!collisionAvecPoints) {
+				touche = S::et(touche, S::et(S::inferieurEgal(zero, ratio), S::inferieurEgal(ratio, un)));
+			}
+
+			int bits{ S::extraireBits(touche) };
+			for (std::size_t voie = i; bits != 0; ++voie, bits >>= 1) {
+				if (bits & 1)
+					contacts.push_back(detaillerSegment(objets, voie, point1, point2, cible));
+			}
+		}
+		return i;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void calculerCollisionsSpheres(
+	///        const LotSpheres<T>&         spheres,
+	///        const LotSpheres<T>&         objets,
+	///        std::vector< ContactLot<T> >& contacts,
+	///        JeuInstructions              jeu
+	///        );
+	///
+	/// Cette fonction calcule la collision de chaque objet du lot avec
+	/// chaque sphre, comme le ferait calculerCollisionSphere() pour chaque
+	/// paire, et ne retourne que les paires en collision.
+	///
+	/// @param[in]  spheres  : Les sphres avec lesquelles on teste la
+	///                        collision.
+	/// @param[in]  objets   : Les objets peut-tre en collision.
+	/// @param[out] contacts : Les contacts, ajouts  la fin, par sphre
+	///                        puis par objet.
+	/// @param[in]  jeu      : Le jeu d'instructions  ne pas dpasser.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void calculerCollisionsSpheres(
+		const LotSpheres<T>&         spheres,
+		const LotSpheres<T>&         objets,
+		std::vector< ContactLot<T> >& contacts,
+		JeuInstructions              jeu
+		)
+	{
+		for (std::size_t j = 0; j < spheres.obtenirTaille(); ++j) {
+			const Vecteur3<T> centre{ spheres.x[j], spheres.y[j], spheres.z[j] };
+			const T rayon{ spheres.rayon[j] };
+			const unsigned int cible{ static_cast<unsigned int>(j) };
+
+			std::size_t i{ 0 };
+#ifdef AIDECOLLISION_AVX
+			if (jeu >= JEU_AVX)
+				i = balayerSphere< T, OperationsAvx<T> >(objets, i, centre, rayon, cible, contacts);
+#endif
+#ifdef AIDECOLLISION_SSE
+			if (jeu >= JEU_SSE)
+				i = balayerSphere< T, OperationsSse<T> >(objets, i, centre, rayon, cible, contacts);
+#endif
+			balayerSphere< T, OperationsScalaires<T> >(objets, i, centre, rayon, cible, contacts);
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void calculerCollisionsSegments(
+	///        const LotSegments<T>&        segments,
+	///        const LotSpheres<T>&         objets,
+	///        std::vector< ContactLot<T> >& contacts,
+	///        bool                         collisionAvecPoints,
+	///        JeuInstructions              jeu
+	///        );
+	///
+	/// Cette fonction calcule la collision de chaque objet du lot avec
+	/// chaque segment, comme le ferait calculerCollisionSegment() pour
+	/// chaque paire, et ne retourne que les paires en collision.  Un
+	/// segment dont les extrmits sont confondues ne touche rien.
+	///
+	/// @param[in]  segments            : Les segments avec lesquels on teste
+	///                                   la collision.
+	/// @param[in]  objets              : Les objets peut-tre en collision.
+	/// @param[out] contacts            : Les contacts, ajouts  la fin, par
+	///                                   segment puis par objet.
+	/// @param[in]  collisionAvecPoints : Vrai si on veut les collisions avec
+	///                                   les extrmits.
+	/// @param[in]  jeu                 : Le jeu d'instructions  ne pas
+	///                                   dpasser.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void calculerCollisionsSegments(
+		const LotSegments<T>&        segments,
+		const LotSpheres<T>&         objets,
+		std::vector< ContactLot<T> >& contacts,
+		bool                         collisionAvecPoints,
+		JeuInstructions              jeu
+		)
+	{
+		for (std::size_t j = 0; j < segments.obtenirTaille(); ++j) {
+			const Vecteur3<T> point1{ segments.x1[j], segments.y1[j], segments.z1[j] };
+			const Vecteur3<T> point2{ segments.x2[j], segments.y2[j], segments.z2[j] };
+			const unsigned int cible{ static_cast<unsigned int>(j) };
+			if (point1 == point2)
+				continue;
+
+			std::size_t i{ 0 };
+#ifdef AIDECOLLISION_AVX
+			if (jeu >= JEU_AVX)
+				i = balayerSegment< T, OperationsAvx<T> >(objets, i, point1, point2, cible, collisionAvecPoints, contacts);
+#endif
+#ifdef AIDECOLLISION_SSE
+			if (jeu >= JEU_SSE)
+				i = balayerSegment< T, OperationsSse<T> >(objets, i, point1, point2, cible, collisionAvecPoints, contacts);
+#endif
+			balayerSegment< T, OperationsScalaires<T> >(objets, i, point1, point2, cible, collisionAvecPoints, contacts);
+		}
+	}
+
+
+	// Instanciations explicites pour les deux prcisions.
+	template void calculerCollisionsSpheres<float>(
+		const LotSpheres<float>&, const LotSpheres<float>&, std::vector< ContactLot<float> >&, JeuInstructions);
+	template void calculerCollisionsSpheres<double>(
+		const LotSpheres<double>&, const LotSpheres<double>&, std::vector< ContactLot<double> >&, JeuInstructions);
+	template void calculerCollisionsSegments<float>(
+		const LotSegments<float>&, const LotSpheres<float>&, std::vector< ContactLot<float> >&, bool, JeuInstructions);
+	template void calculerCollisionsSegments<double>(
+		const LotSegments<double>&, const LotSpheres<double>&, std::vector< ContactLot<double> >&, bool, JeuInstructions);
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
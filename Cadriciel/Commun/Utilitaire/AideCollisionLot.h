@@ -0,0 +1,270 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file AideCollisionLot.h
+/// @brief Ce fichier contient les calculs de collisions par lots de
+///        l'espace de nom aidecollision.
+///
+/// Les fonctions de ce fichier testent d'un coup un grand nombre d'objets
+/// sphriques, rangs par composante dans des tableaux contigus, contre
+/// des sphres ou des segments.  Elles sont vectorises avec les
+/// instructions SSE ou AVX lorsque le compilateur les permet.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_AIDECOLLISIONLOT_H__
+#define __UTILITAIRE_AIDECOLLISIONLOT_H__
+
+#include "AideCollision.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace aidecollision {
+
+
+	/// Jeux d'instructions utilisables par les calculs par lots.
+	enum JeuInstructions {
+		JEU_SCALAIRE = 0, ///< Aucune instruction vectorielle.
+		JEU_SSE,          ///< Registres de 128 bits.
+		JEU_AVX           ///< Registres de 256 bits.
+	};
+
+	/// Obtient le meilleur jeu d'instructions permis  la compilation.
+	JeuInstructions obtenirJeuInstructions();
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class LotSpheres
+	/// @brief Lot de sphres ranges par composante (structure de tableaux).
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class LotSpheres
+	{
+	public:
+		/// Ajoute une sphre au lot.
+		inline void ajouter(const Vecteur3<T>& centre, T rayon);
+		/// Retire toutes les sphres du lot.
+		inline void vider();
+		/// Obtient le nombre de sphres du lot.
+		inline std::size_t obtenirTaille() const;
+
+		/// Coordonnes x des centres.
+		std::vector<T> x;
+		/// Coordonnes y des centres.
+		std::vector<T> y;
+		/// Coordonnes z des centres.
+		std::vector<T> z;
+		/// Rayons des sphres.
+		std::vector<T> rayon;
+	};
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class LotSegments
+	/// @brief Lot de segments rangs par composante (structure de tableaux).
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class LotSegments
+	{
+	public:
+		/// Ajoute un segment au lot.
+		inline void ajouter(const Vecteur3<T>& point1, const Vecteur3<T>& point2);
+		/// Retire tous les segments du lot.
+		inline void vider();
+		/// Obtient le nombre de segments du lot.
+		inline std::size_t obtenirTaille() const;
+
+		/// Coordonnes x des premires extrmits.
+		std::vector<T> x1;
+		/// Coordonnes y des premires extrmits.
+		std::vector<T> y1;
+		/// Coordonnes z des premires extrmits.
+		std::vector<T> z1;
+		/// Coordonnes x des secondes extrmits.
+		std::vector<T> x2;
+		/// Coordonnes y des secondes extrmits.
+		std::vector<T> y2;
+		/// Coordonnes z des secondes extrmits.
+		std::vector<T> z2;
+	};
+
+
+	/// Contact trouv par un calcul de collisions par lots.
+	template <class T>
+	class ContactLot {
+	public:
+		/// Indice de l'objet dans son lot.
+		unsigned int objet;
+		/// Indice de la sphre ou du segment touch dans son lot.
+		unsigned int cible;
+		/// Type de collision.
+		Collision type;
+		/// Direction de la collision, comme dans DetailsCollision.
+		Vecteur3<T> direction;
+		/// Enfoncement de l'objet  l'intrieur de la collision.
+		T enfoncement;
+	};
+
+
+	/// Calcule les collisions d'un lot d'objets sphriques avec un lot de
+	/// sphres.
+	template <class T>
+	void calculerCollisionsSpheres(
+		const LotSpheres<T>&         spheres,
+		const LotSpheres<T>&         objets,
+		std::vector< ContactLot<T> >& contacts,
+		JeuInstructions              jeu = obtenirJeuInstructions()
+		);
+
+	/// Calcule les collisions d'un lot d'objets sphriques avec un lot de
+	/// segments de droite.
+	template <class T>
+	void calculerCollisionsSegments(
+		const LotSegments<T>&        segments,
+		const LotSpheres<T>&         objets,
+		std::vector< ContactLot<T> >& contacts,
+		bool                         collisionAvecPoints = true,
+		JeuInstructions              jeu = obtenirJeuInstructions()
+		);
+
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void LotSpheres<T>::ajouter(const Vecteur3<T>& centre, T rayon)
+	///
+	/// Cette fonction ajoute une sphre  la fin du lot.
+	///
+	/// @param[in] centre : Le centre de la sphre.
+	/// @param[in] rayon  : Le rayon de la sphre.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline void LotSpheres<T>::ajouter(const Vecteur3<T>& centre, T rayon)
+	{
+		x.push_back(centre.x);
+		y.push_back(centre.y);
+		z.push_back(centre.z);
+		this->rayon.push_back(rayon);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void LotSpheres<T>::vider()
+	///
+	/// Cette fonction retire toutes les sphres du lot, en conservant la
+	/// mmoire des tableaux.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline void LotSpheres<T>::vider()
+	{
+		x.clear();
+		y.clear();
+		z.clear();
+		rayon.clear();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t LotSpheres<T>::obtenirTaille() const
+	///
+	/// Cette fonction retourne le nombre de sphres du lot.
+	///
+	/// @return Le nombre de sphres.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline std::size_t LotSpheres<T>::obtenirTaille() const
+	{
+		return rayon.size();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void LotSegments<T>::ajouter(const Vecteur3<T>& point1, const Vecteur3<T>& point2)
+	///
+	/// Cette fonction ajoute un segment  la fin du lot.
+	///
+	/// @param[in] point1 : Premire extrmit du segment.
+	/// @param[in] point2 : Seconde extrmit du segment.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline void LotSegments<T>::ajouter(const Vecteur3<T>& point1, const Vecteur3<T>& point2)
+	{
+		x1.push_back(point1.x);
+		y1.push_back(point1.y);
+		z1.push_back(point1.z);
+		x2.push_back(point2.x);
+		y2.push_back(point2.y);
+		z2.push_back(point2.z);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void LotSegments<T>::vider()
+	///
+	/// Cette fonction retire tous les segments du lot, en conservant la
+	/// mmoire des tableaux.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline void LotSegments<T>::vider()
+	{
+		x1.clear();
+		y1.clear();
+		z1.clear();
+		x2.clear();
+		y2.clear();
+		z2.clear();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t LotSegments<T>::obtenirTaille() const
+	///
+	/// Cette fonction retourne le nombre de segments du lot.
+	///
+	/// @return Le nombre de segments.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline std::size_t LotSegments<T>::obtenirTaille() const
+	{
+		return x1.size();
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+#endif // __UTILITAIRE_AIDECOLLISIONLOT_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
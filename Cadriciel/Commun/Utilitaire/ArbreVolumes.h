@@ -0,0 +1,932 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file ArbreVolumes.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_ARBREVOLUMES_H__
+#define __UTILITAIRE_ARBREVOLUMES_H__
+
+#include "Utilitaire.h"
+
+#include <vector>
+#include <queue>
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class ArbreVolumes
+	/// @brief Hirarchie dynamique de botes englobantes alignes sur les
+	///        axes, qui associe une donne  chaque bote.
+	///
+	///        Les feuilles contiennent les botes insres, agrandies d'une
+	///        marge: un lment qui se dplace un peu reste dans sa bote et
+	///        n'a pas  tre rinsr.  Chaque insertion choisit l'emplacement
+	///        qui augmente le moins l'aire des botes de la hirarchie, puis
+	///        les anctres de la nouvelle feuille sont rquilibrs par
+	///        rotations, de sorte que la hauteur reste logarithmique.
+	///
+	///        Les noeuds sont conservs dans un tableau et dsigns par leur
+	///        indice; les noeuds librs sont rutiliss.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class ArbreVolumes
+	{
+	public:
+		/// Identifiant d'une feuille de l'arbre.
+		using Identifiant = unsigned int;
+		/// Identifiant qui ne dsigne aucune feuille.
+		static const Identifiant AUCUN{ 0xFFFFFFFF };
+
+		/// Constructeur  partir de la marge des feuilles.
+		inline ArbreVolumes(double marge = 0.0);
+
+		/// Insre une bote et retourne l'identifiant de sa feuille.
+		Identifiant inserer(const BoiteEnglobante& boite, const T& donnee);
+		/// Retire une feuille.
+		void retirer(Identifiant feuille);
+		/// Dplace la bote d'une feuille.
+		bool deplacer(Identifiant feuille, const BoiteEnglobante& boite);
+		/// Retire toutes les feuilles.
+		void vider();
+
+		/// Obtient la donne associe  une feuille.
+		inline const T& obtenirDonnee(Identifiant feuille) const;
+		/// Obtient la bote, marge comprise, d'une feuille.
+		inline const BoiteEnglobante& obtenirBoite(Identifiant feuille) const;
+		/// Obtient le nombre de feuilles.
+		inline unsigned int obtenirNombreFeuilles() const;
+		/// Obtient la hauteur de l'arbre.
+		inline int obtenirHauteur() const;
+
+		/// Visite les feuilles dont la bote chevauche une bote.
+		template <class Fonction>
+		void chercherDansBoite(const BoiteEnglobante& boite, Fonction fonction) const;
+		/// Visite les feuilles dont la bote est traverse par un rayon.
+		template <class Fonction>
+		void lancerRayon(const glm::dvec3& origine, const glm::dvec3& direction,
+			double distanceMax, Fonction fonction) const;
+		/// Obtient les donnes les plus proches d'un point.
+		template <class Fonction>
+		void chercherPlusProches(const glm::dvec3& point, unsigned int nombre,
+			Fonction distance, std::vector<T>& resultats) const;
+
+		/// Calcule la distance entre un point et une bote.
+		static double calculerDistance(const glm::dvec3& point, const BoiteEnglobante& boite);
+
+	private:
+		/// Noeud de l'arbre, feuille ou noeud interne.
+		struct Noeud {
+			/// Bote englobant le sous-arbre.
+			BoiteEnglobante boite;
+			/// Donne associe, pour une feuille.
+			T donnee;
+			/// Parent du noeud, ou prochain noeud libre.
+			Identifiant parent;
+			/// Premier enfant, ou AUCUN pour une feuille.
+			Identifiant enfant1;
+			/// Second enfant, ou AUCUN pour une feuille.
+			Identifiant enfant2;
+			/// Hauteur du sous-arbre: 0 pour une feuille, -1 si libre.
+			int hauteur;
+
+			/// Vrifie si le noeud est une feuille.
+			bool estFeuille() const { return enfant1 == AUCUN; }
+		};
+
+		/// Alloue un noeud.
+		Identifiant allouerNoeud();
+		/// Libre un noeud.
+		void libererNoeud(Identifiant indice);
+		/// Place une feuille dans la hirarchie.
+		void insererFeuille(Identifiant feuille);
+		/// Dtache une feuille de la hirarchie.
+		void retirerFeuille(Identifiant feuille);
+		/// Recalcule les botes et les hauteurs  partir d'un noeud jusqu' la racine.
+		void remonter(Identifiant indice);
+		/// Rquilibre un noeud par rotation et retourne la nouvelle racine du sous-arbre.
+		Identifiant balancer(Identifiant indice);
+
+		/// Calcule la bote englobant deux botes.
+		static BoiteEnglobante fusionner(const BoiteEnglobante& a, const BoiteEnglobante& b);
+		/// Calcule l'aire de la surface d'une bote.
+		static double calculerAire(const BoiteEnglobante& boite);
+		/// Vrifie si une bote en contient une autre.
+		static bool contient(const BoiteEnglobante& a, const BoiteEnglobante& b);
+		/// Vrifie si deux botes se chevauchent.
+		static bool chevauche(const BoiteEnglobante& a, const BoiteEnglobante& b);
+		/// Calcule la distance d'entre d'un rayon dans une bote.
+		static bool intersecterRayon(const BoiteEnglobante& boite, const glm::dvec3& origine,
+			const glm::dvec3& direction, double distanceMax, double& distance);
+
+		/// Noeuds de l'arbre, utiliss ou libres.
+		std::vector<Noeud> noeuds_;
+		/// Racine de l'arbre.
+		Identifiant racine_{ AUCUN };
+		/// Premier noeud libre.
+		Identifiant premierLibre_{ AUCUN };
+		/// Nombre de feuilles.
+		unsigned int nombreFeuilles_{ 0 };
+		/// Marge ajoute de chaque ct des botes insres.
+		double marge_;
+	};
+
+
+	/// Identifiant qui ne dsigne aucune feuille.
+	template <class T>
+	const typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::AUCUN;
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline ArbreVolumes<T>::ArbreVolumes(double marge)
+	///
+	/// Ce constructeur cre un arbre vide.
+	///
+	/// @param[in] marge : La marge ajoute de chaque ct des botes
+	///                    insres, afin d'viter de rinsrer les lments
+	///                    qui se dplacent peu.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline ArbreVolumes<T>::ArbreVolumes(double marge)
+		: marge_{ marge }
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::inserer(const BoiteEnglobante& boite, const T& donnee)
+	///
+	/// Cette fonction insre une bote, agrandie de la marge, dans une
+	/// nouvelle feuille.
+	///
+	/// @param[in] boite  : La bote de l'lment.
+	/// @param[in] donnee : La donne associe  l'lment.
+	///
+	/// @return L'identifiant de la feuille, qui reste valide jusqu' son
+	///         retrait.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::inserer(const BoiteEnglobante& boite, const T& donnee)
+	{
+		const Identifiant feuille{ allouerNoeud() };
+		Noeud& noeud = noeuds_[feuille];
+		const glm::dvec3 marge{ marge_ };
+		noeud.boite.coinMin = boite.coinMin - marge;
+		noeud.boite.coinMax = boite.coinMax + marge;
+		noeud.donnee = donnee;
+		noeud.hauteur = 0;
+
+		insererFeuille(feuille);
+		++nombreFeuilles_;
+		return feuille;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::retirer(Identifiant feuille)
+	///
+	/// Cette fonction retire une feuille de l'arbre.  Son identifiant
+	/// pourra tre rutilis par une insertion subsquente.
+	///
+	/// @param[in] feuille : L'identifiant de la feuille.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void ArbreVolumes<T>::retirer(Identifiant feuille)
+	{
+		retirerFeuille(feuille);
+		libererNoeud(feuille);
+		--nombreFeuilles_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool ArbreVolumes<T>::deplacer(Identifiant feuille, const BoiteEnglobante& boite)
+	///
+	/// Cette fonction met  jour la bote d'un lment qui s'est dplac.
+	/// Tant que la nouvelle bote reste dans la bote agrandie de la
+	/// feuille, l'arbre n'est pas modifi; sinon, la feuille est rinsre
+	/// avec la nouvelle bote.  L'identifiant de la feuille est conserv.
+	///
+	/// @param[in] feuille : L'identifiant de la feuille.
+	/// @param[in] boite   : La nouvelle bote de l'lment.
+	///
+	/// @return Vrai si la feuille a t rinsre.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	bool ArbreVolumes<T>::deplacer(Identifiant feuille, const BoiteEnglobante& boite)
+	{
+		if (contient(noeuds_[feuille].boite, boite))
+			return false;
+
+		retirerFeuille(feuille);
+		const glm::dvec3 marge{ marge_ };
+		noeuds_[feuille].boite.coinMin = boite.coinMin - marge;
+		noeuds_[feuille].boite.coinMax = boite.coinMax + marge;
+		insererFeuille(feuille);
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::vider()
+	///
+	/// Cette fonction retire toutes les feuilles de l'arbre.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void ArbreVolumes<T>::vider()
+	{
+		noeuds_.clear();
+		racine_ = AUCUN;
+		premierLibre_ = AUCUN;
+		nombreFeuilles_ = 0;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const T& ArbreVolumes<T>::obtenirDonnee(Identifiant feuille) const
+	///
+	/// Cette fonction retourne la donne associe  une feuille.
+	///
+	/// @param[in] feuille : L'identifiant de la feuille.
+	///
+	/// @return La donne de la feuille.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline const T& ArbreVolumes<T>::obtenirDonnee(Identifiant feuille) const
+	{
+		return noeuds_[feuille].donnee;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const BoiteEnglobante& ArbreVolumes<T>::obtenirBoite(Identifiant feuille) const
+	///
+	/// Cette fonction retourne la bote d'une feuille, qui englobe la
+	/// bote insre agrandie de la marge.
+	///
+	/// @param[in] feuille : L'identifiant de la feuille.
+	///
+	/// @return La bote de la feuille.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline const BoiteEnglobante& ArbreVolumes<T>::obtenirBoite(Identifiant feuille) const
+	{
+		return noeuds_[feuille].boite;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int ArbreVolumes<T>::obtenirNombreFeuilles() const
+	///
+	/// Cette fonction retourne le nombre de feuilles de l'arbre.
+	///
+	/// @return Le nombre de feuilles.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline unsigned int ArbreVolumes<T>::obtenirNombreFeuilles() const
+	{
+		return nombreFeuilles_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline int ArbreVolumes<T>::obtenirHauteur() const
+	///
+	/// Cette fonction retourne la hauteur de l'arbre, soit le nombre de
+	/// niveaux sous la racine.
+	///
+	/// @return La hauteur, ou -1 si l'arbre est vide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline int ArbreVolumes<T>::obtenirHauteur() const
+	{
+		return racine_ != AUCUN ? noeuds_[racine_].hauteur : -1;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::chercherDansBoite(const BoiteEnglobante& boite, Fonction fonction) const
+	///
+	/// Cette fonction appelle une fonction pour chaque feuille dont la
+	/// bote, marge comprise, chevauche la bote donne.  La fonction
+	/// reoit la donne de la feuille et retourne faux pour arrter la
+	/// recherche.
+	///
+	/// @param[in] boite    : La bote recherche.
+	/// @param[in] fonction : La fonction appele pour chaque feuille.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	template <class Fonction>
+	void ArbreVolumes<T>::chercherDansBoite(const BoiteEnglobante& boite, Fonction fonction) const
+	{
+		if (racine_ == AUCUN)
+			return;
+
+		std::vector<Identifiant> pile;
+		pile.push_back(racine_);
+		while (!pile.empty()) {
+			const Noeud& noeud = noeuds_[pile.back()];
+			pile.pop_back();
+			if (!chevauche(noeud.boite, boite))
+				continue;
+
+			if (noeud.estFeuille()) {
+				if (!fonction(noeud.donnee))
+					return;
+			}
+			else {
+				pile.push_back(noeud.enfant1);
+				pile.push_back(noeud.enfant2);
+			}
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::lancerRayon(const glm::dvec3& origine, const glm::dvec3& direction, double distanceMax, Fonction fonction) const
+	///
+	/// Cette fonction appelle une fonction pour chaque feuille dont la
+	/// bote est traverse par un rayon,  une distance d'au plus
+	/// distanceMax de l'origine.  Les distances sont mesures en multiples
+	/// de la direction, qui devrait donc tre unitaire.
+	///
+	/// La fonction reoit la donne de la feuille et la distance maximale
+	/// courante, et retourne la nouvelle distance maximale: la distance
+	/// de l'intersection trouve pour ne plus visiter que les feuilles plus
+	/// proches, la distance reue pour continuer sans changement, ou zro
+	/// pour arrter.
+	///
+	/// @param[in] origine     : L'origine du rayon.
+	/// @param[in] direction   : La direction du rayon.
+	/// @param[in] distanceMax : La longueur du rayon.
+	/// @param[in] fonction    : La fonction appele pour chaque feuille.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	template <class Fonction>
+	void ArbreVolumes<T>::lancerRayon(const glm::dvec3& origine, const glm::dvec3& direction,
+		double distanceMax, Fonction fonction) const
+	{
+		if (racine_ == AUCUN)
+			return;
+
+		std::vector<Identifiant> pile;
+		pile.push_back(racine_);
+		while (!pile.empty()) {
+			const Noeud& noeud = noeuds_[pile.back()];
+			pile.pop_back();
+			double distance;
+			if (!intersecterRayon(noeud.boite, origine, direction, distanceMax, distance))
+				continue;
+
+			if (noeud.estFeuille()) {
+				distanceMax = fonction(noeud.donnee, distanceMax);
+				if (distanceMax <= 0.0)
+					return;
+			}
+			else {
+				pile.push_back(noeud.enfant1);
+				pile.push_back(noeud.enfant2);
+			}
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::chercherPlusProches(const glm::dvec3& point, unsigned int nombre, Fonction distance, std::vector<T>& resultats) const
+	///
+	/// Cette fonction obtient les donnes des feuilles les plus proches
+	/// d'un point, de la plus proche  la plus loigne.  Les noeuds sont
+	/// visits du plus proche au plus loign, ce qui permet de s'arrter
+	/// ds que le nombre demand est atteint.
+	///
+	/// La fonction de distance donne la distance exacte entre le point et
+	/// l'lment d'une donne.  Elle ne doit jamais tre infrieure  la
+	/// distance entre le point et la bote de la feuille, sans quoi
+	/// l'ordre des rsultats n'est pas garanti.
+	///
+	/// @param[in]  point     : Le point de rfrence.
+	/// @param[in]  nombre    : Le nombre de donnes recherches.
+	/// @param[in]  distance  : La fonction de distance d'une donne.
+	/// @param[out] resultats : Les donnes trouves, ajoutes en ordre de
+	///                         distance croissante.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	template <class Fonction>
+	void ArbreVolumes<T>::chercherPlusProches(const glm::dvec3& point, unsigned int nombre,
+		Fonction distance, std::vector<T>& resultats) const
+	{
+		if (racine_ == AUCUN || nombre == 0)
+			return;
+
+		// Candidat  visiter: un noeud  la distance de sa bote, ou une
+		// feuille dont la distance exacte est connue.
+		struct Candidat {
+			double distance;
+			Identifiant indice;
+			bool exact;
+			bool operator<(const Candidat& autre) const { return distance > autre.distance; }
+		};
+
+		std::priority_queue<Candidat> candidats;
+		candidats.push(Candidat{ calculerDistance(point, noeuds_[racine_].boite), racine_, false });
+
+		unsigned int trouves{ 0 };
+		while (!candidats.empty() && trouves < nombre) {
+			const Candidat candidat{ candidats.top() };
+			candidats.pop();
+
+			const Noeud& noeud = noeuds_[candidat.indice];
+			if (candidat.exact) {
+				resultats.push_back(noeud.donnee);
+				++trouves;
+			}
+			else if (noeud.estFeuille()) {
+				candidats.push(Candidat{ distance(noeud.donnee), candidat.indice, true });
+			}
+			else {
+				candidats.push(Candidat{ calculerDistance(point, noeuds_[noeud.enfant1].boite), noeud.enfant1, false });
+				candidats.push(Candidat{ calculerDistance(point, noeuds_[noeud.enfant2].boite), noeud.enfant2, false });
+			}
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn double ArbreVolumes<T>::calculerDistance(const glm::dvec3& point, const BoiteEnglobante& boite)
+	///
+	/// Cette fonction calcule la distance entre un point et le point le
+	/// plus proche d'une bote.
+	///
+	/// @param[in] point : Le point.
+	/// @param[in] boite : La bote.
+	///
+	/// @return La distance, nulle si le point est dans la bote.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	double ArbreVolumes<T>::calculerDistance(const glm::dvec3& point, const BoiteEnglobante& boite)
+	{
+		glm::dvec3 ecart{ 0.0 };
+		for (int i = 0; i < 3; ++i) {
+			if (point[i] < boite.coinMin[i])
+				ecart[i] = boite.coinMin[i] - point[i];
+			else if (point[i] > boite.coinMax[i])
+				ecart[i] = point[i] - boite.coinMax[i];
+		}
+		return glm::length(ecart);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::allouerNoeud()
+	///
+	/// Cette fonction alloue un noeud, en rutilisant un noeud libre s'il
+	/// en existe un.  Elle peut dplacer les noeuds existants en mmoire.
+	///
+	/// @return L'indice du noeud allou.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::allouerNoeud()
+	{
+		Identifiant indice;
+		if (premierLibre_ != AUCUN) {
+			indice = premierLibre_;
+			premierLibre_ = noeuds_[indice].parent;
+		}
+		else {
+			indice = static_cast<Identifiant>(noeuds_.size());
+			noeuds_.push_back(Noeud{});
+		}
+
+		Noeud& noeud = noeuds_[indice];
+		noeud.parent = AUCUN;
+		noeud.enfant1 = AUCUN;
+		noeud.enfant2 = AUCUN;
+		noeud.hauteur = 0;
+		return indice;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::libererNoeud(Identifiant indice)
+	///
+	/// Cette fonction ajoute un noeud  la liste des noeuds libres.
+	///
+	/// @param[in] indice : L'indice du noeud.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void ArbreVolumes<T>::libererNoeud(Identifiant indice)
+	{
+		Noeud& noeud = noeuds_[indice];
+		noeud.donnee = T{};
+		noeud.parent = premierLibre_;
+		noeud.hauteur = -1;
+		premierLibre_ = indice;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::insererFeuille(Identifiant feuille)
+	///
+	/// Cette fonction place une feuille dans la hirarchie.  En descendant
+	/// depuis la racine, elle choisit  chaque niveau l'enfant dont la
+	/// bote augmente le moins en aire, ou s'arrte lorsqu'il est moins
+	/// coteux de faire de la feuille la soeur du noeud courant.
+	///
+	/// @param[in] feuille : L'indice de la feuille, dj alloue.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void ArbreVolumes<T>::insererFeuille(Identifiant feuille)
+	{
+		if (racine_ == AUCUN) {
+			racine_ = feuille;
+			noeuds_[feuille].parent = AUCUN;
+			return;
+		}
+
+		const BoiteEnglobante boite{ noeuds_[feuille].boite };
+		Identifiant indice{ racine_ };
+		while (!noeuds_[indice].estFeuille()) {
+			const Noeud& noeud = noeuds_[indice];
+			const double aire{ calculerAire(noeud.boite) };
+			const double aireCombinee{ calculerAire(fusionner(noeud.boite, boite)) };
+
+			// Cot de crer un nouveau parent pour ce noeud et la feuille,
+			// et cot minimal que la descente ajoute aux anctres.
+			const double cout{ 2.0 * aireCombinee };
+			const double coutHerite{ 2.0 * (aireCombinee - aire) };
+
+			double couts[2];
+			const Identifiant enfants[2]{ noeud.enfant1, noeud.enfant2 };
+			for (int i = 0; i < 2; ++i) {
+				const Noeud& enfant = noeuds_[enfants[i]];
+				const double aireEnfant{ calculerAire(fusionner(enfant.boite, boite)) };
+				couts[i] = coutHerite +
+					(enfant.estFeuille() ? aireEnfant : aireEnfant - calculerAire(enfant.boite));
+			}
+
+			if (cout < couts[0] && cout < couts[1])
+				break;
+			indice = couts[0] < couts[1] ? enfants[0] : enfants[1];
+		}
+
+		// La feuille devient la soeur du noeud trouv, sous un nouveau parent.
+		const Identifiant soeur{ indice };
+		const Identifiant nouveauParent{ allouerNoeud() };
+		const Identifiant ancienParent{ noeuds_[soeur].parent };
+		Noeud& parent = noeuds_[nouveauParent];
+		parent.parent = ancienParent;
+		parent.boite = fusionner(noeuds_[soeur].boite, boite);
+		parent.hauteur = noeuds_[soeur].hauteur + 1;
+		parent.enfant1 = soeur;
+		parent.enfant2 = feuille;
+		noeuds_[soeur].parent = nouveauParent;
+		noeuds_[feuille].parent = nouveauParent;
+
+		if (ancienParent == AUCUN)
+			racine_ = nouveauParent;
+		else if (noeuds_[ancienParent].enfant1 == soeur)
+			noeuds_[ancienParent].enfant1 = nouveauParent;
+		else
+			noeuds_[ancienParent].enfant2 = nouveauParent;
+
+		remonter(ancienParent);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::retirerFeuille(Identifiant feuille)
+	///
+	/// Cette fonction dtache une feuille de la hirarchie.  Son parent est
+	/// libr et remplac par sa soeur.
+	///
+	/// @param[in] feuille : L'indice de la feuille.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void ArbreVolumes<T>::retirerFeuille(Identifiant feuille)
+	{
+		if (feuille == racine_) {
+			racine_ = AUCUN;
+			return;
+		}
+
+		const Identifiant parent{ noeuds_[feuille].parent };
+		const Identifiant grandParent{ noeuds_[parent].parent };
+		const Identifiant soeur{
+			noeuds_[parent].enfant1 == feuille ? noeuds_[parent].enfant2 : noeuds_[parent].enfant1
+		};
+
+		noeuds_[soeur].parent = grandParent;
+		if (grandParent == AUCUN)
+			racine_ = soeur;
+		else if (noeuds_[grandParent].enfant1 == parent)
+			noeuds_[grandParent].enfant1 = soeur;
+		else
+			noeuds_[grandParent].enfant2 = soeur;
+		libererNoeud(parent);
+
+		remonter(grandParent);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreVolumes<T>::remonter(Identifiant indice)
+	///
+	/// Cette fonction rquilibre un noeud et chacun de ses anctres, puis
+	/// recalcule leur bote et leur hauteur  partir de leurs enfants.
+	///
+	/// @param[in] indice : Le premier noeud  mettre  jour, ou AUCUN.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void ArbreVolumes<T>::remonter(Identifiant indice)
+	{
+		while (indice != AUCUN) {
+			indice = balancer(indice);
+
+			Noeud& noeud = noeuds_[indice];
+			const Noeud& enfant1 = noeuds_[noeud.enfant1];
+			const Noeud& enfant2 = noeuds_[noeud.enfant2];
+			noeud.boite = fusionner(enfant1.boite, enfant2.boite);
+			noeud.hauteur = 1 + (enfant1.hauteur > enfant2.hauteur ? enfant1.hauteur : enfant2.hauteur);
+
+			indice = noeud.parent;
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::balancer(Identifiant indice)
+	///
+	/// Cette fonction rquilibre un noeud interne dont les sous-arbres
+	/// diffrent de plus d'un niveau en hauteur: l'enfant le plus haut
+	/// prend sa place, et le noeud reoit le plus bas des petits-enfants
+	/// correspondants.  Les enfants du noeud doivent tre  jour.
+	///
+	/// @param[in] indice : L'indice du noeud.
+	///
+	/// @return L'indice du noeud qui a pris sa place, ou du noeud lui-mme.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	typename ArbreVolumes<T>::Identifiant ArbreVolumes<T>::balancer(Identifiant indice)
+	{
+		Noeud& a = noeuds_[indice];
+		if (a.estFeuille() || a.hauteur < 2)
+			return indice;
+
+		const int ecart{ noeuds_[a.enfant2].hauteur - noeuds_[a.enfant1].hauteur };
+		if (ecart >= -1 && ecart <= 1)
+			return indice;
+
+		// L'enfant le plus haut monte, l'autre reste sous le noeud.
+		const bool secondMonte{ ecart > 1 };
+		const Identifiant iMontant{ secondMonte ? a.enfant2 : a.enfant1 };
+		const Identifiant iRestant{ secondMonte ? a.enfant1 : a.enfant2 };
+		Noeud& montant = noeuds_[iMontant];
+		const Noeud& restant = noeuds_[iRestant];
+
+		const Identifiant iF{ montant.enfant1 };
+		const Identifiant iG{ montant.enfant2 };
+		const Noeud& f = noeuds_[iF];
+		const Noeud& g = noeuds_[iG];
+
+		// Le noeud montant remplace le noeud chez son parent.
+		montant.enfant1 = indice;
+		montant.parent = a.parent;
+		a.parent = iMontant;
+		if (montant.parent == AUCUN)
+			racine_ = iMontant;
+		else if (noeuds_[montant.parent].enfant1 == indice)
+			noeuds_[montant.parent].enfant1 = iMontant;
+		else
+			noeuds_[montant.parent].enfant2 = iMontant;
+
+		// Le plus haut des petits-enfants reste sous le noeud montant, le
+		// plus bas descend sous le noeud.
+		const bool fReste{ f.hauteur > g.hauteur };
+		const Identifiant iGarde{ fReste ? iF : iG };
+		const Identifiant iCede{ fReste ? iG : iF };
+		montant.enfant2 = iGarde;
+		if (secondMonte)
+			a.enfant2 = iCede;
+		else
+			a.enfant1 = iCede;
+		noeuds_[iCede].parent = indice;
+
+		const Noeud& garde = noeuds_[iGarde];
+		const Noeud& cede = noeuds_[iCede];
+		a.boite = fusionner(restant.boite, cede.boite);
+		a.hauteur = 1 + (restant.hauteur > cede.hauteur ? restant.hauteur : cede.hauteur);
+		montant.boite = fusionner(a.boite, garde.boite);
+		montant.hauteur = 1 + (a.hauteur > garde.hauteur ? a.hauteur : garde.hauteur);
+
+		return iMontant;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn BoiteEnglobante ArbreVolumes<T>::fusionner(const BoiteEnglobante& a, const BoiteEnglobante& b)
+	///
+	/// Cette fonction calcule la plus petite bote englobant deux botes.
+	///
+	/// @param[in] a : La premire bote.
+	/// @param[in] b : La seconde bote.
+	///
+	/// @return La bote englobante.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	BoiteEnglobante ArbreVolumes<T>::fusionner(const BoiteEnglobante& a, const BoiteEnglobante& b)
+	{
+		return BoiteEnglobante{ glm::min(a.coinMin, b.coinMin), glm::max(a.coinMax, b.coinMax) };
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn double ArbreVolumes<T>::calculerAire(const BoiteEnglobante& boite)
+	///
+	/// Cette fonction calcule l'aire de la surface d'une bote, qui sert 
+	/// estimer le cot des requtes qui la traversent.
+	///
+	/// @param[in] boite : La bote.
+	///
+	/// @return L'aire de la bote.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	double ArbreVolumes<T>::calculerAire(const BoiteEnglobante& boite)
+	{
+		const glm::dvec3 d{ boite.coinMax - boite.coinMin };
+		return 2.0 * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool ArbreVolumes<T>::contient(const BoiteEnglobante& a, const BoiteEnglobante& b)
+	///
+	/// Cette fonction vrifie si une bote en contient entirement une autre.
+	///
+	/// @param[in] a : La bote englobante.
+	/// @param[in] b : La bote englobe.
+	///
+	/// @return Vrai si la bote a contient la bote b.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	bool ArbreVolumes<T>::contient(const BoiteEnglobante& a, const BoiteEnglobante& b)
+	{
+		return a.coinMin.x <= b.coinMin.x && a.coinMin.y <= b.coinMin.y && a.coinMin.z <= b.coinMin.z &&
+			b.coinMax.x <= a.coinMax.x && b.coinMax.y <= a.coinMax.y && b.coinMax.z <= a.coinMax.z;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool ArbreVolumes<T>::chevauche(const BoiteEnglobante& a, const BoiteEnglobante& b)
+	///
+	/// Cette fonction vrifie si deux botes ont au moins un point commun.
+	///
+	/// @param[in] a : La premire bote.
+	/// @param[in] b : La seconde bote.
+	///
+	/// @return Vrai si les botes se chevauchent.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	bool ArbreVolumes<T>::chevauche(const BoiteEnglobante& a, const BoiteEnglobante& b)
+	{
+		return a.coinMin.x <= b.coinMax.x && b.coinMin.x <= a.coinMax.x &&
+			a.coinMin.y <= b.coinMax.y && b.coinMin.y <= a.coinMax.y &&
+			a.coinMin.z <= b.coinMax.z && b.coinMin.z <= a.coinMax.z;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool ArbreVolumes<T>::intersecterRayon(const BoiteEnglobante& boite, const glm::dvec3& origine, const glm::dvec3& direction, double distanceMax, double& distance)
+	///
+	/// Cette fonction calcule l'intersection d'un rayon avec une bote par
+	/// la mthode des tranches: le rayon est dcoup successivement par
+	/// les deux plans de la bote perpendiculaires  chaque axe.
+	///
+	/// @param[in]  boite       : La bote.
+	/// @param[in]  origine     : L'origine du rayon.
+	/// @param[in]  direction   : La direction du rayon.
+	/// @param[in]  distanceMax : La longueur du rayon.
+	/// @param[out] distance    : La distance d'entre dans la bote, nulle
+	///                           si l'origine est dans la bote.
+	///
+	/// @return Vrai si le rayon traverse la bote.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	bool ArbreVolumes<T>::intersecterRayon(const BoiteEnglobante& boite, const glm::dvec3& origine,
+		const glm::dvec3& direction, double distanceMax, double& distance)
+	{
+		double entree{ 0.0 };
+		double sortie{ distanceMax };
+		for (int i = 0; i < 3; ++i) {
+			if (direction[i] == 0.0) {
+				// Rayon parallle aux plans de cet axe.
+				if (origine[i] < boite.coinMin[i] || origine[i] > boite.coinMax[i])
+					return false;
+				continue;
+			}
+
+			const double inverse{ 1.0 / direction[i] };
+			double t1{ (boite.coinMin[i] - origine[i]) * inverse };
+			double t2{ (boite.coinMax[i] - origine[i]) * inverse };
+			if (t1 > t2) {
+				const double t{ t1 };
+				t1 = t2;
+				t2 = t;
+			}
+			if (t1 > entree)
+				entree = t1;
+			if (t2 < sortie)
+				sortie = t2;
+			if (entree > sortie)
+				return false;
+		}
+
+		distance = entree;
+		return true;
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_ARBREVOLUMES_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,61 @@
+/////////////////////////////////////////////////////////////////////////////////
+/// @file CacheContacts.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "CacheContacts.h"
+
+namespace aidecollision {
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void CacheContacts::retirerPaires(const std::vector<Paire>& paires)
+	///
+	/// Cette fonction oublie les rsultats de paires qui ne sont plus
+	/// candidates, normalement les paires disparues de la phase large.  Les
+	/// paires d'un objet retir de la phase large en font partie, ce qui
+	/// vite qu'un objet qui rutilise son identifiant hrite de ses
+	/// rsultats.
+	///
+	/// @param[in] paires : Les paires  oublier.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void CacheContacts::retirerPaires(const std::vector<Paire>& paires)
+	{
+		for (const Paire& paire : paires)
+			entrees_.erase(obtenirCle(paire));
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void CacheContacts::vider()
+	///
+	/// Cette fonction oublie tous les rsultats et tous les parcours.  Les
+	/// dures mesures, qui servent  estimer la dure conomise, sont
+	/// conserves.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void CacheContacts::vider()
+	{
+		entrees_.clear();
+		parcours_.clear();
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,350 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file CacheContacts.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_CACHECONTACTS_H__
+#define __UTILITAIRE_CACHECONTACTS_H__
+
+#include "PhaseLarge.h"
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace aidecollision {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class CacheContacts
+	/// @brief Cache des rsultats de la phase troite, par paire d'objets,
+	///        qui exploite la cohrence temporelle entre deux sous-pas.
+	///
+	/// Chaque objet accumule une borne du chemin qu'il a parcouru, fournie
+	/// par deplacer().  Aprs un calcul exact, le cache retient, pour la
+	/// paire, la distance qui sparait les deux objets et la somme de leurs
+	/// parcours.  Tant que les objets n'ont pas, ensemble, parcouru plus
+	/// que cette distance, ils ne peuvent pas se toucher et le calcul exact
+	/// est vit.
+	///
+	/// Un contact au repos, dont les objets ont parcouru moins que la
+	/// tolrance de repos depuis le calcul exact, reprend le contact
+	/// prcdent tel quel.  Avec une tolrance nulle, seul un contact dont
+	/// aucun des objets n'a boug est repris, et le rsultat est identique
+	///  celui du calcul exact.
+	///
+	/// La distance de sparation est l'oppos de l'enfoncement retourn par
+	/// le calcul sans collision.  Un calcul qui ne la fournit pas (un
+	/// enfoncement nul) est simplement refait  chaque requte.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class CacheContacts
+	{
+	public:
+		/// Identifiant d'un objet.
+		using Identifiant = PhaseLarge::Identifiant;
+		/// Paire d'objets, dont le premier identifiant est le plus petit.
+		using Paire = PhaseLarge::Paire;
+
+		/// Statistiques de l'image courante.
+		class Statistiques {
+		public:
+			/// Nombre de requtes.
+			unsigned int nombreRequetes{ 0 };
+			/// Nombre de calculs vits pour des objets spars.
+			unsigned int nombreSeparations{ 0 };
+			/// Nombre de contacts au repos repris sans calcul.
+			unsigned int nombreRepos{ 0 };
+			/// Nombre de calculs exacts effectus.
+			unsigned int nombreCalculs{ 0 };
+			/// Dure des calculs exacts, en millisecondes.
+			double dureeCalculs{ 0.0 };
+			/// Estimation de la dure conomise, en millisecondes.
+			double dureeEconomisee{ 0.0 };
+
+			/// Obtient la proportion des requtes servies par le cache.
+			inline double obtenirTauxSucces() const;
+		};
+
+		/// Constructeur  partir de la tolrance des contacts au repos.
+		inline CacheContacts(double toleranceRepos = 0.0);
+
+		/// Ajoute une borne du dplacement d'un objet.
+		inline void deplacer(Identifiant objet, double distance);
+		/// Calcule la collision d'une paire, ou la reprend du cache.
+		template <class Fonction>
+		DetailsCollision calculerCollision(const Paire& paire, Fonction calculer);
+
+		/// Oublie les paires qui ne sont plus candidates.
+		void retirerPaires(const std::vector<Paire>& paires);
+		/// Oublie toutes les paires et tous les parcours.
+		void vider();
+
+		/// Remet  zro les statistiques au dbut d'une image.
+		inline void commencerImage();
+		/// Obtient les statistiques de l'image courante.
+		inline const Statistiques& obtenirStatistiques() const;
+		/// Obtient le nombre de paires conserves.
+		inline std::size_t obtenirNombrePaires() const;
+
+
+	private:
+		/// Rsultat conserv pour une paire.
+		class Entree {
+		public:
+			/// Rsultat du dernier calcul exact.
+			DetailsCollision details;
+			/// Distance qui sparait les objets, nulle s'ils se touchaient.
+			double distance;
+			/// Somme des parcours des deux objets lors du calcul exact.
+			double parcours;
+		};
+
+		/// Obtient la cl d'une paire.
+		static inline std::uint64_t obtenirCle(const Paire& paire);
+		/// Obtient le chemin parcouru par un objet depuis sa cration.
+		inline double obtenirParcours(Identifiant objet) const;
+
+		/// Rsultats conservs, selon la cl de la paire.
+		std::unordered_map<std::uint64_t, Entree> entrees_;
+		/// Chemin parcouru par chaque objet, selon son identifiant.
+		std::vector<double> parcours_;
+		/// Parcours en de duquel un contact est considr au repos.
+		double toleranceRepos_;
+		/// Nombre total de calculs exacts chronomtrs.
+		unsigned int nombreCalculsTotal_{ 0 };
+		/// Dure totale des calculs exacts, en millisecondes.
+		double dureeCalculsTotal_{ 0.0 };
+		/// Statistiques de l'image courante.
+		Statistiques statistiques_;
+
+	};
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double CacheContacts::Statistiques::obtenirTauxSucces() const
+	///
+	/// Cette fonction retourne la proportion des requtes de l'image qui
+	/// n'ont pas ncessit de calcul exact.
+	///
+	/// @return Le taux de succs, entre 0 et 1.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double CacheContacts::Statistiques::obtenirTauxSucces() const
+	{
+		if (nombreRequetes == 0)
+			return 0.0;
+		return static_cast<double>(nombreSeparations + nombreRepos) / nombreRequetes;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline CacheContacts::CacheContacts(double toleranceRepos)
+	///
+	/// Ce constructeur cre un cache vide.
+	///
+	/// @param[in] toleranceRepos : Parcours total des deux objets en de
+	///                             duquel un contact est repris tel quel.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline CacheContacts::CacheContacts(double toleranceRepos)
+		: toleranceRepos_{ toleranceRepos }
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void CacheContacts::deplacer(Identifiant objet, double distance)
+	///
+	/// Cette fonction ajoute une borne du dplacement d'un objet, par
+	/// exemple la norme de son dplacement durant un sous-pas.  La borne
+	/// doit tre conservatrice: aucun point de l'objet ne doit s'tre
+	/// dplac de plus que cette distance.  Un objet tlport doit donc
+	/// signaler toute la distance franchie.
+	///
+	/// @param[in] objet    : L'identifiant de l'objet.
+	/// @param[in] distance : La borne du dplacement.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline void CacheContacts::deplacer(Identifiant objet, double distance)
+	{
+		if (objet >= parcours_.size())
+			parcours_.resize(objet + 1, 0.0);
+		parcours_[objet] += distance;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsCollision CacheContacts::calculerCollision(const Paire& paire, Fonction calculer)
+	///
+	/// Cette fonction retourne la collision d'une paire d'objets.  Si les
+	/// objets taient spars et n'ont pas pu franchir la distance qui les
+	/// sparait, ou s'ils sont en contact au repos, le rsultat est tir
+	/// du cache.  Sinon, la fonction de calcul exact est appele et son
+	/// rsultat est conserv.
+	///
+	/// Un rsultat tir du cache pour des objets spars n'indique aucune
+	/// collision, avec un enfoncement gal  l'oppos de ce qui reste de la
+	/// distance de sparation.
+	///
+	/// @param[in] paire    : La paire d'objets.
+	/// @param[in] calculer : Fonction sans paramtre qui effectue le calcul
+	///                       exact et retourne un DetailsCollision.
+	///
+	/// @return Structure contenant de l'information sur la collision.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class Fonction>
+	DetailsCollision CacheContacts::calculerCollision(const Paire& paire, Fonction calculer)
+	{
+		++statistiques_.nombreRequetes;
+
+		const double parcours{ obtenirParcours(paire.first) + obtenirParcours(paire.second) };
+		const double moyenne{ nombreCalculsTotal_ > 0 ? dureeCalculsTotal_ / nombreCalculsTotal_ : 0.0 };
+
+		auto iterateur = entrees_.find(obtenirCle(paire));
+		if (iterateur != entrees_.end()) {
+			const Entree& entree{ iterateur->second };
+			const double ecart{ parcours - entree.parcours };
+
+			if (entree.distance > 0.0 && ecart < entree.distance) {
+				++statistiques_.nombreSeparations;
+				statistiques_.dureeEconomisee += moyenne;
+
+				DetailsCollision details(entree.details);
+				details.enfoncement = ecart - entree.distance;
+				return details;
+			}
+			if (entree.details.type != COLLISION_AUCUNE && ecart <= toleranceRepos_) {
+				++statistiques_.nombreRepos;
+				statistiques_.dureeEconomisee += moyenne;
+				return entree.details;
+			}
+		}
+
+		const auto debut = std::chrono::high_resolution_clock::now();
+		const DetailsCollision details(calculer());
+		const auto fin = std::chrono::high_resolution_clock::now();
+
+		const double duree{ std::chrono::duration<double, std::milli>(fin - debut).count() };
+		++statistiques_.nombreCalculs;
+		statistiques_.dureeCalculs += duree;
+		++nombreCalculsTotal_;
+		dureeCalculsTotal_ += duree;
+
+		Entree& entree = entrees_[obtenirCle(paire)];
+		entree.details = details;
+		entree.distance = (details.type == COLLISION_AUCUNE && details.enfoncement < 0.0) ?
+			-details.enfoncement : 0.0;
+		entree.parcours = parcours;
+		return details;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void CacheContacts::commencerImage()
+	///
+	/// Cette fonction remet  zro les statistiques, qui s'accumulent
+	/// ensuite sur tous les sous-pas de l'image.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline void CacheContacts::commencerImage()
+	{
+		statistiques_ = Statistiques{};
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const CacheContacts::Statistiques& CacheContacts::obtenirStatistiques() const
+	///
+	/// Cette fonction retourne les statistiques accumules depuis le dbut
+	/// de l'image.
+	///
+	/// @return Les statistiques.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const CacheContacts::Statistiques& CacheContacts::obtenirStatistiques() const
+	{
+		return statistiques_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t CacheContacts::obtenirNombrePaires() const
+	///
+	/// Cette fonction retourne le nombre de paires dont un rsultat est
+	/// conserv.
+	///
+	/// @return Le nombre de paires.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t CacheContacts::obtenirNombrePaires() const
+	{
+		return entrees_.size();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::uint64_t CacheContacts::obtenirCle(const Paire& paire)
+	///
+	/// Cette fonction combine les deux identifiants d'une paire en une cl.
+	///
+	/// @param[in] paire : La paire.
+	///
+	/// @return La cl de la paire.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::uint64_t CacheContacts::obtenirCle(const Paire& paire)
+	{
+		return (static_cast<std::uint64_t>(paire.first) << 32) | paire.second;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double CacheContacts::obtenirParcours(Identifiant objet) const
+	///
+	/// Cette fonction retourne le chemin parcouru par un objet, selon les
+	/// bornes fournies  deplacer().
+	///
+	/// @param[in] objet : L'identifiant de l'objet.
+	///
+	/// @return Le chemin parcouru.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double CacheContacts::obtenirParcours(Identifiant objet) const
+	{
+		return objet < parcours_.size() ? parcours_[objet] : 0.0;
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+#endif // __UTILITAIRE_CACHECONTACTS_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
@@ -11,13 +11,15 @@
 #include "Plan3D.h"
 #include "Utilitaire.h"
 
+#include <cmath>
+
 
 namespace math {
 
 
 	///////////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn Droite3D::Droite3D(const glm::dvec3& point1, const glm::dvec3& point2)
+	/// @fn Droite3Dt<T>::Droite3Dt(const Vecteur& point1, const Vecteur& point2)
 	///
 	/// Constructeur d'une droite 3D  partir de 2 points. \n
 	/// Une droite dans l'espace 3d passant par 2 points
@@ -33,7 +35,8 @@ namespace math {
 	/// @return Aucune (constructeur).
 	///
 	///////////////////////////////////////////////////////////////////////////////
-	Droite3D::Droite3D(const glm::dvec3& point1, const glm::dvec3& point2)
+	template <class T>
+	Droite3Dt<T>::Droite3Dt(const Vecteur& point1, const Vecteur& point2)
 		: direction_{ point2 - point1 }, pointDroite_{ point1 }
 	{
 		if (utilitaire::EGAL_ZERO(glm::length(direction_)))
@@ -43,7 +46,7 @@ namespace math {
 
 	///////////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn bool Droite3D::intersection(const Plan3D& planCoupe, glm::dvec3& intersection)
+	/// @fn bool Droite3Dt<T>::intersection(const Plan3Dt<T>& planCoupe, Vecteur& intersection)
 	///
 	/// Cette fonction permet de trouver l'intersection entre une droite et un plan
 	/// dans l'espace 3D. La droite ne doit pas tre parallle au plan. \n
@@ -77,22 +80,23 @@ namespace math {
 	///          l'intersection ne peut tre trouve, vrai autrement.
 	///
 	///////////////////////////////////////////////////////////////////////////////
-	bool Droite3D::intersection(const Plan3D& planCoupe, glm::dvec3& intersection)
+	template <class T>
+	bool Droite3Dt<T>::intersection(const Plan3Dt<T>& planCoupe, Vecteur& intersection)
 	{
 		// Initialisation de variables
-		const double x0{ pointDroite_[0] };
-		const double y0{ pointDroite_[1] };
-		const double z0{ pointDroite_[2] };
+		const T x0{ pointDroite_[0] };
+		const T y0{ pointDroite_[1] };
+		const T z0{ pointDroite_[2] };
 
-		const double a{ direction_[0] };
-		const double b{ direction_[1] };
-		const double c{ direction_[2] };
+		const T a{ direction_[0] };
+		const T b{ direction_[1] };
+		const T c{ direction_[2] };
 
-		double A, B, C, D;
+		T A, B, C, D;
 		planCoupe.lireParam(A, B, C, D);
 
 		//Le rsultat
-		double x, y, z;
+		T x, y, z;
 
 		// On regarde si le plan et la droite sont parallles.
 		bool bParalleles = utilitaire::EGAL_ZERO(
@@ -128,7 +132,7 @@ namespace math {
 
 	///////////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn bool Droite3D::intersectionSegment( const glm::dvec3& point1, const glm::dvec3& point2)
+	/// @fn bool Droite3Dt<T>::intersectionSegment( const Vecteur& point1, const Vecteur& point2)
 	///
 	/// Cette fonction permet de trouver l'intersection entre un segment de droite
 	/// dfini par 2 points @f$ (P_1, P_2) @f$ et une droite dans l'espace 3D.
@@ -142,11 +146,12 @@ namespace math {
 	/// @date  2006-02-21  Modification suite aux changements dans Vecteur3
 	///
 	///////////////////////////////////////////////////////////////////////////////
-	bool Droite3D::intersectionSegment(const glm::dvec3& point1,
-		const glm::dvec3& point2)
+	template <class T>
+	bool Droite3Dt<T>::intersectionSegment(const Vecteur& point1,
+		const Vecteur& point2)
 	{
-		glm::dvec3 pointHaut;
-		glm::dvec3 pointBas;
+		Vecteur pointHaut;
+		Vecteur pointBas;
 
 		// Si le y n'est pas au niveau du x
 		if ((pointDroite_[1] < point1[1]) && (pointDroite_[1] < point2[1])) {
@@ -182,11 +187,11 @@ namespace math {
 		pointBas[1] = pointBas[1] - pointDroite_[1];
 
 		// L'quation de la droite
-		double m{ (pointHaut[1] - pointBas[1]) / (pointHaut[0] - pointBas[0]) };
-		double b{ pointHaut[1] - pointHaut[0] * m };
+		T m{ (pointHaut[1] - pointBas[1]) / (pointHaut[0] - pointBas[0]) };
+		T b{ pointHaut[1] - pointHaut[0] * m };
 
 		// Lorsque y = 0
-		double x{ (-1.0 * b) / m };
+		T x{ -b / m };
 
 		if (x > 0.0) {
 			return true;
@@ -198,7 +203,7 @@ namespace math {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn double Droite3D::distancePoint( const glm::dvec3& centre )
+	/// @fn T Droite3Dt<T>::distancePoint( const Vecteur& centre )
 	///
 	/// Calcule la distance euclidienne entre la droite et un point.
 	///
@@ -207,21 +212,22 @@ namespace math {
 	/// @return Distance du point  la droite.
 	///
 	////////////////////////////////////////////////////////////////////////
-	double Droite3D::distancePoint(const glm::dvec3& centre)
+	template <class T>
+	T Droite3Dt<T>::distancePoint(const Vecteur& centre)
 	{
 		// En 2D
-		const double ad{ direction_[1] };
-		const double bd{ -1.0 * direction_[0] };
-		const double cd{ -1.0 * direction_[1] * pointDroite_[0] +
+		const T ad{ direction_[1] };
+		const T bd{ -direction_[0] };
+		const T cd{ -direction_[1] * pointDroite_[0] +
 			direction_[0] * pointDroite_[1] };
 
-		double num{ fabs(ad * centre[0] + bd * centre[1] + cd) };
-		double den{ sqrt(pow(ad, 2) + pow(bd, 2)) };
+		T num{ std::abs(ad * centre[0] + bd * centre[1] + cd) };
+		T den{ std::sqrt(ad * ad + bd * bd) };
 
 		// En 3D
-		const glm::dvec3 centreNul{ centre[0], centre[1], 0.0 };
-		const glm::dvec3 vect{ centreNul - pointDroite_ };
-		const glm::dvec3 mult{ glm::cross(vect, direction_) };
+		const Vecteur centreNul{ centre[0], centre[1], 0.0 };
+		const Vecteur vect{ centreNul - pointDroite_ };
+		const Vecteur mult{ glm::cross(vect, direction_) };
 		num = glm::length(mult);
 		den = glm::length(direction_);
 
@@ -231,7 +237,7 @@ namespace math {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn glm::dvec3 Droite3D::perpendiculaireDroite(const glm::dvec3& point)
+	/// @fn typename Droite3Dt<T>::Vecteur Droite3Dt<T>::perpendiculaireDroite(const Vecteur& point)
 	///
 	/// On trace la perpendicaulaire entre le point et le droite et on trouve
 	/// le point d'intersection.
@@ -242,40 +248,46 @@ namespace math {
 	/// @return Le point de rencontre entre la droite et la perpendiculaire.
 	///
 	////////////////////////////////////////////////////////////////////////
-	glm::dvec3 Droite3D::perpendiculaireDroite(const glm::dvec3& point)
+	template <class T>
+	typename Droite3Dt<T>::Vecteur Droite3Dt<T>::perpendiculaireDroite(const Vecteur& point)
 	{
-		const glm::dvec3& a{ direction_ };
-		const glm::dvec3& p1{ pointDroite_ };
-		const glm::dvec3  orig{ 0.0, 0.0, 0.0 };
-		const glm::dvec3  op1{ p1 - orig };
+		const Vecteur& a{ direction_ };
+		const Vecteur& p1{ pointDroite_ };
+		const Vecteur  orig{ 0.0, 0.0, 0.0 };
+		const Vecteur  op1{ p1 - orig };
 
-		const double op1x{ p1[0] };
-		const double op1y{ p1[1] };
-		const double op1z{ p1[2] };
+		const T op1x{ p1[0] };
+		const T op1y{ p1[1] };
+		const T op1z{ p1[2] };
 
-		const double op0x{ point[0] };
-		const double op0y{ point[1] };
-		const double op0z{ point[2] };
+		const T op0x{ point[0] };
+		const T op0y{ point[1] };
+		const T op0z{ point[2] };
 
-		const double ax{ a[0] };
-		const double ay{ a[1] };
-		const double az{ a[2] };
+		const T ax{ a[0] };
+		const T ay{ a[1] };
+		const T az{ a[2] };
 
-		const double num{ ax * (op1x - op0x) +
+		const T num{ ax * (op1x - op0x) +
 			ay * (op1y - op0y) +
 			az * (op1z - op0z) };
-		const double den{ -1.0 * (pow(ax, 2) +
-			pow(ay, 2) +
-			pow(az, 2)) };
+		const T den{ -(ax * ax +
+			ay * ay +
+			az * az) };
 
-		const double r{ num / den };
+		const T r{ num / den };
 
-		const glm::dvec3 oq{ op1 + a * r };
+		const Vecteur oq{ op1 + a * r };
 
 		return oq;
 	}
 
 
+	// Instanciations explicites pour les deux prcisions.
+	template class Droite3Dt<float>;
+	template class Droite3Dt<double>;
+
+
 } // Fin de l'espace de nom math.
 
 
@@ -16,7 +16,7 @@
 namespace math {
    
    
-   class Plan3D;
+   template <class T> class Plan3Dt;
 
 
    ///////////////////////////////////////////////////////////////////////////
@@ -43,49 +43,62 @@ namespace math {
    ///    @li perpendiculaireDroite;
    ///    @li les mthodes d'accs.
    ///
+   /// La classe est gnrique sur le type de rel et est instancie pour
+   /// les float et les double (Droite3D).
+   ///
    /// @author DGI-2990
    /// @date 2005-09-27
    ///////////////////////////////////////////////////////////////////////////
-   class Droite3D
+   template <class T>
+   class Droite3Dt
    {
    public:
+      /// Vecteur du type de rel de la droite.
+      using Vecteur = glm::detail::tvec3<T, glm::defaultp>;
+
       /// Constructeur.
-      Droite3D(const glm::dvec3& point1, const glm::dvec3& point2);
+      Droite3Dt(const Vecteur& point1, const Vecteur& point2);
 
       /// Trouve l'intersection entre la droite et un plan.
-      bool      intersection(const Plan3D& planCoupe, glm::dvec3& intersection);
+      bool      intersection(const Plan3Dt<T>& planCoupe, Vecteur& intersection);
       /// Trouve l'intersection entre la droite et un segment.
-      bool      intersectionSegment(const glm::dvec3& point1, const glm::dvec3& point2);
+      bool      intersectionSegment(const Vecteur& point1, const Vecteur& point2);
       /// Calcule la distance entre un point et la droite.
-      double    distancePoint(const glm::dvec3& centre);
+      T         distancePoint(const Vecteur& centre);
       /// Trouve le point de rencontre entre la droite et une perpendiculaire  partir d'un point.
-      glm::dvec3 perpendiculaireDroite(const glm::dvec3& point);
+      Vecteur   perpendiculaireDroite(const Vecteur& point);
 
       /// Avoir le vecteur directeur de la droite.
-      inline const glm::dvec3& lireVecteur() const;
+      inline const Vecteur& lireVecteur() const;
       /// Avoir un point de la droite.
-      inline const glm::dvec3& lirePoint() const;
+      inline const Vecteur& lirePoint() const;
 
 
    private:
       /// @f$ (x_0, y_0, z_0) @f$
-      const glm::dvec3 pointDroite_;
+      const Vecteur pointDroite_;
       /// @f$ (a, b, c) @f$
-      const glm::dvec3 direction_;
+      const Vecteur direction_;
 
    };
 
+   /// Droite en double prcision.
+   using Droite3D = Droite3Dt<double>;
+   /// Droite en simple prcision.
+   using Droite3Df = Droite3Dt<float>;
+
 
    ////////////////////////////////////////////////////////////////////////////
    ///
-   /// @fn inline const glm::dvec3& Droite3D::lireVecteur() const
+   /// @fn inline const typename Droite3Dt<T>::Vecteur& Droite3Dt<T>::lireVecteur() const
    ///
    /// Cette fonction retourne le vecteur directeur de la droite.
    ///
    /// @return Le vecteur directeur de la droite.
    ///
    ////////////////////////////////////////////////////////////////////////////
-   inline const glm::dvec3& Droite3D::lireVecteur() const
+   template <class T>
+   inline const typename Droite3Dt<T>::Vecteur& Droite3Dt<T>::lireVecteur() const
    {
       return direction_;
    }
@@ -93,14 +106,15 @@ namespace math {
 
    ////////////////////////////////////////////////////////////////////////////
    ///
-   /// @fn inline const glm::dvec3& Droite3D::lirePoint() const
+   /// @fn inline const typename Droite3Dt<T>::Vecteur& Droite3Dt<T>::lirePoint() const
    ///
    /// Cette fonction retourne un point quelconque de la droite.
    ///
    /// @return Un point quelconque de la droite.
    ///
    ////////////////////////////////////////////////////////////////////////////
-   inline const glm::dvec3& Droite3D::lirePoint() const
+   template <class T>
+   inline const typename Droite3Dt<T>::Vecteur& Droite3Dt<T>::lirePoint() const
    {
       return pointDroite_;
    }
@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file Etendue.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_ETENDUE_H__
+#define __UTILITAIRE_ETENDUE_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class Etendue
+	/// @brief Vue en lecture seule sur des lments contigus, sans en tre
+	///        propritaire ("span").
+	///
+	///        Les lments peuvent appartenir  un std::vector ou  une
+	///        rgion de mmoire quelconque, par exemple un fichier projet.
+	///        L'tendue reste valide tant que ces lments existent.
+	///
+	///        L'interface reprend celle de std::vector (data(), size(),
+	///        operator[], begin(), end()) pour que le code qui lisait un
+	///        vecteur puisse lire une tendue sans modification.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class Etendue
+	{
+	public:
+		/// Type des lments.
+		using value_type = T;
+		/// Itrateur sur les lments.
+		using iterator = const T*;
+		/// Itrateur constant sur les lments.
+		using const_iterator = const T*;
+
+		/// tendue vide.
+		Etendue() = default;
+		/// tendue sur des lments contigus.
+		inline Etendue(const T* donnees, std::size_t taille);
+		/// tendue sur les lments d'un vecteur.
+		inline Etendue(const std::vector<T>& vecteur);
+
+		/// Dbut des lments.
+		inline const T* data() const { return donnees_; }
+		/// Nombre d'lments.
+		inline std::size_t size() const { return taille_; }
+		/// Vrifie si l'tendue est vide.
+		inline bool empty() const { return taille_ == 0; }
+
+		/// Accde  un lment.
+		inline const T& operator[](std::size_t indice) const { return donnees_[indice]; }
+		/// Premier lment.
+		inline const T& front() const { return donnees_[0]; }
+		/// Dernier lment.
+		inline const T& back() const { return donnees_[taille_ - 1]; }
+
+		/// Dbut des lments.
+		inline const_iterator begin() const { return donnees_; }
+		/// Fin des lments.
+		inline const_iterator end() const { return donnees_ + taille_; }
+
+	private:
+		/// Premier lment.
+		const T* donnees_{ nullptr };
+		/// Nombre d'lments.
+		std::size_t taille_{ 0 };
+	};
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline Etendue<T>::Etendue(const T* donnees, std::size_t taille)
+	///
+	/// Ce constructeur cre une tendue sur des lments contigus.
+	///
+	/// @param[in] donnees : Le premier lment.
+	/// @param[in] taille  : Le nombre d'lments.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline Etendue<T>::Etendue(const T* donnees, std::size_t taille)
+		: donnees_{ donnees }
+		, taille_{ taille }
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline Etendue<T>::Etendue(const std::vector<T>& vecteur)
+	///
+	/// Ce constructeur cre une tendue sur les lments d'un vecteur.
+	/// L'tendue devient invalide si le vecteur est modifi ou dtruit.
+	///
+	/// @param[in] vecteur : Le vecteur.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline Etendue<T>::Etendue(const std::vector<T>& vecteur)
+		: donnees_{ vecteur.data() }
+		, taille_{ vecteur.size() }
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool operator==(const Etendue<T>& etendue1, const Etendue<T>& etendue2)
+	///
+	/// Cette fonction compare le contenu de deux tendues, lment par
+	/// lment.
+	///
+	/// @param[in] etendue1 : La premire tendue.
+	/// @param[in] etendue2 : La seconde tendue.
+	///
+	/// @return Vrai si les tendues ont les mmes lments.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline bool operator==(const Etendue<T>& etendue1, const Etendue<T>& etendue2)
+	{
+		return etendue1.size() == etendue2.size() &&
+			std::equal(etendue1.begin(), etendue1.end(), etendue2.begin());
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool operator!=(const Etendue<T>& etendue1, const Etendue<T>& etendue2)
+	///
+	/// Cette fonction compare le contenu de deux tendues, lment par
+	/// lment.
+	///
+	/// @param[in] etendue1 : La premire tendue.
+	/// @param[in] etendue2 : La seconde tendue.
+	///
+	/// @return Vrai si les tendues diffrent.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline bool operator!=(const Etendue<T>& etendue1, const Etendue<T>& etendue2)
+	{
+		return !(etendue1 == etendue2);
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_ETENDUE_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
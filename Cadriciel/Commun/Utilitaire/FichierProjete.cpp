@@ -0,0 +1,165 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file FichierProjete.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#include <windows.h>
+
+#include "FichierProjete.h"
+
+#include <utility>
+
+
+namespace utilitaire {
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn FichierProjete::FichierProjete(FichierProjete&& fichier)
+	///
+	/// Constructeur "move".  Utilise l'assignation "move".
+	///
+	/// @param[in] fichier : Le fichier projet  transfrer.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	FichierProjete::FichierProjete(FichierProjete&& fichier)
+	{
+		*this = std::move(fichier);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn FichierProjete& FichierProjete::operator =(FichierProjete&& fichier)
+	///
+	/// Assignation par transfert ("move").  La projection courante est
+	/// relche, puis celle du fichier pass en paramtre lui est retire
+	/// pour qu'elle ne soit relche qu'une seule fois.
+	///
+	/// @param[in] fichier : Le fichier projet  transfrer.
+	///
+	/// @return Le fichier projet courant.
+	///
+	////////////////////////////////////////////////////////////////////////
+	FichierProjete& FichierProjete::operator =(FichierProjete&& fichier)
+	{
+		if (this != &fichier) {
+			fermer();
+
+			fichier_ = fichier.fichier_;
+			projection_ = fichier.projection_;
+			donnees_ = fichier.donnees_;
+			taille_ = fichier.taille_;
+
+			fichier.fichier_ = nullptr;
+			fichier.projection_ = nullptr;
+			fichier.donnees_ = nullptr;
+			fichier.taille_ = 0;
+		}
+		return *this;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn FichierProjete::~FichierProjete()
+	///
+	/// Ce destructeur relche la projection et le fichier.
+	///
+	/// @return Aucune (destructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	FichierProjete::~FichierProjete()
+	{
+		fermer();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool FichierProjete::ouvrir(const std::string& nomFichier)
+	///
+	/// Cette fonction projette un fichier en mmoire, en lecture seule.  Le
+	/// fichier reste ouvert, et peut donc tre lu mais pas remplac par les
+	/// autres processus, jusqu' l'appel de fermer().
+	///
+	/// @param[in] nomFichier : Le nom du fichier  projeter.
+	///
+	/// @return Faux si le fichier n'existe pas, est vide ou ne peut tre
+	///         projet, vrai autrement.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool FichierProjete::ouvrir(const std::string& nomFichier)
+	{
+		fermer();
+
+		HANDLE fichier{ CreateFileA(nomFichier.c_str(), GENERIC_READ, FILE_SHARE_READ,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+		if (fichier == INVALID_HANDLE_VALUE)
+			return false;
+		fichier_ = fichier;
+
+		// Un fichier vide ne peut pas tre projet.
+		LARGE_INTEGER taille;
+		if (!GetFileSizeEx(fichier, &taille) || taille.QuadPart <= 0 ||
+			static_cast<unsigned long long>(taille.QuadPart) > static_cast<std::size_t>(-1)) {
+			fermer();
+			return false;
+		}
+
+		projection_ = CreateFileMappingA(fichier, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (projection_ == nullptr) {
+			fermer();
+			return false;
+		}
+
+		donnees_ = static_cast<const char*>(MapViewOfFile(projection_, FILE_MAP_READ, 0, 0, 0));
+		if (donnees_ == nullptr) {
+			fermer();
+			return false;
+		}
+
+		taille_ = static_cast<std::size_t>(taille.QuadPart);
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void FichierProjete::fermer()
+	///
+	/// Cette fonction relche la projection et ferme le fichier.  Les
+	/// donnes obtenues par obtenirDonnees() deviennent invalides.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void FichierProjete::fermer()
+	{
+		if (donnees_ != nullptr)
+			UnmapViewOfFile(donnees_);
+		if (projection_ != nullptr)
+			CloseHandle(projection_);
+		if (fichier_ != nullptr)
+			CloseHandle(fichier_);
+
+		fichier_ = nullptr;
+		projection_ = nullptr;
+		donnees_ = nullptr;
+		taille_ = 0;
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file FichierProjete.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_FICHIERPROJETE_H__
+#define __UTILITAIRE_FICHIERPROJETE_H__
+
+#include <cstddef>
+#include <string>
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class FichierProjete
+	/// @brief Fichier projet en mmoire, en lecture seule.
+	///
+	///        Le contenu du fichier est accessible directement en mmoire,
+	///        sans copie: les pages ne sont lues du disque qu'au moment o
+	///        elles sont consultes.  Les donnes restent valides tant que
+	///        le fichier n'est pas ferm.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class FichierProjete
+	{
+	public:
+		FichierProjete() = default;
+		/// Construction par transfert ("move").
+		FichierProjete(FichierProjete&& fichier);
+		/// Assignation par transfert ("move").
+		FichierProjete& operator =(FichierProjete&& fichier);
+		/// Destructeur.
+		~FichierProjete();
+
+		/// Pas de copie, la projection serait relche deux fois.
+		FichierProjete(const FichierProjete&) = delete;
+		/// Pas d'assignation, la projection serait relche deux fois.
+		FichierProjete& operator =(const FichierProjete&) = delete;
+
+		/// Projette un fichier en mmoire.
+		bool ouvrir(const std::string& nomFichier);
+		/// Relche la projection et le fichier.
+		void fermer();
+
+		/// Obtient le dbut du contenu du fichier.
+		inline const char* obtenirDonnees() const;
+		/// Obtient la taille du fichier, en octets.
+		inline std::size_t obtenirTaille() const;
+		/// Vrifie si un fichier est projet.
+		inline bool estOuvert() const;
+
+	private:
+		/// Fichier ouvert (HANDLE).
+		void* fichier_{ nullptr };
+		/// Objet de projection du fichier (HANDLE).
+		void* projection_{ nullptr };
+		/// Dbut du contenu projet.
+		const char* donnees_{ nullptr };
+		/// Taille du contenu projet.
+		std::size_t taille_{ 0 };
+	};
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const char* FichierProjete::obtenirDonnees() const
+	///
+	/// Cette fonction retourne le dbut du contenu projet du fichier.
+	///
+	/// @return Le dbut du contenu, ou nullptr si aucun fichier n'est
+	///         projet.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const char* FichierProjete::obtenirDonnees() const
+	{
+		return donnees_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t FichierProjete::obtenirTaille() const
+	///
+	/// Cette fonction retourne la taille du fichier projet.
+	///
+	/// @return La taille, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t FichierProjete::obtenirTaille() const
+	{
+		return taille_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool FichierProjete::estOuvert() const
+	///
+	/// Cette fonction vrifie si un fichier est prsentement projet.
+	///
+	/// @return Vrai si un fichier est projet.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool FichierProjete::estOuvert() const
+	{
+		return donnees_ != nullptr;
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_FICHIERPROJETE_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
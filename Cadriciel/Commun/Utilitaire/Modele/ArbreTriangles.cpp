@@ -0,0 +1,522 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file ArbreTriangles.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ArbreTriangles.h"
+#include "Noeud.h"
+
+#include "glm/gtx/norm.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace modele{
+
+	/// Nombre maximal de triangles d'une feuille.
+	const unsigned int ArbreTriangles::TRIANGLES_PAR_FEUILLE;
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static glm::dvec3 calculerPointPlusProche(glm::dvec3 const& point, glm::dvec3 const& a, glm::dvec3 const& b, glm::dvec3 const& c)
+	///
+	/// Cette fonction calcule le point d'un triangle le plus proche d'un
+	/// point donn, en dterminant d'abord dans quelle rgion de Vorono
+	/// (sommet, arte ou face) du triangle se trouve le point.
+	///
+	/// @param[in] point : Le point dont on cherche le plus proche voisin.
+	/// @param[in] a     : Premier sommet du triangle.
+	/// @param[in] b     : Deuxime sommet du triangle.
+	/// @param[in] c     : Troisime sommet du triangle.
+	///
+	/// @return Le point du triangle le plus proche.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static glm::dvec3 calculerPointPlusProche(glm::dvec3 const& point,
+		glm::dvec3 const& a, glm::dvec3 const& b, glm::dvec3 const& c)
+	{
+		const glm::dvec3 ab{ b - a };
+		const glm::dvec3 ac{ c - a };
+
+		const glm::dvec3 ap{ point - a };
+		const double d1{ glm::dot(ab, ap) };
+		const double d2{ glm::dot(ac, ap) };
+		if (d1 <= 0.0 && d2 <= 0.0)
+			return a;
+
+		const glm::dvec3 bp{ point - b };
+		const double d3{ glm::dot(ab, bp) };
+		const double d4{ glm::dot(ac, bp) };
+		if (d3 >= 0.0 && d4 <= d3)
+			return b;
+
+		const double vc{ d1 * d4 - d3 * d2 };
+		if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+			return a + ab * (d1 / (d1 - d3));
+
+		const glm::dvec3 cp{ point - c };
+		const double d5{ glm::dot(ab, cp) };
+		const double d6{ glm::dot(ac, cp) };
+		if (d6 >= 0.0 && d5 <= d6)
+			return c;
+
+		const double vb{ d5 * d2 - d1 * d6 };
+		if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+			return a + ac * (d2 / (d2 - d6));
+
+		const double va{ d3 * d6 - d5 * d4 };
+		if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+			return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		// Le point se projette  l'intrieur de la face.
+		const double denominateur{ 1.0 / (va + vb + vc) };
+		return a + ab * (vb * denominateur) + ac * (vc * denominateur);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static double calculerDistance2(glm::dvec3 const& point, glm::vec3 const& coinMin, glm::vec3 const& coinMax)
+	///
+	/// Cette fonction calcule le carr de la distance entre un point et une
+	/// bote aligne sur les axes.  La distance est nulle si le point est
+	/// dans la bote.
+	///
+	/// @param[in] point   : Le point.
+	/// @param[in] coinMin : Coin minimal de la bote.
+	/// @param[in] coinMax : Coin maximal de la bote.
+	///
+	/// @return Le carr de la distance.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static double calculerDistance2(glm::dvec3 const& point,
+		glm::vec3 const& coinMin, glm::vec3 const& coinMax)
+	{
+		double distance2{ 0.0 };
+		for (glm::length_t i{ 0 }; i < 3; ++i) {
+			if (point[i] < coinMin[i])
+				distance2 += (coinMin[i] - point[i]) * (coinMin[i] - point[i]);
+			else if (point[i] > coinMax[i])
+				distance2 += (point[i] - coinMax[i]) * (point[i] - coinMax[i]);
+		}
+		return distance2;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool intersecterBoite(glm::vec3 const& coinMin, glm::vec3 const& coinMax, glm::dvec3 const& origine, glm::dvec3 const& deplacement, double instantMax, double& instant)
+	///
+	/// Cette fonction calcule l'instant d'entre d'un dplacement dans une
+	/// bote aligne sur les axes, par la mthode des tranches.  Une
+	/// composante nulle du dplacement est traite  part pour viter les
+	/// divisions par zro.
+	///
+	/// @param[in]  coinMin     : Coin minimal de la bote.
+	/// @param[in]  coinMax     : Coin maximal de la bote.
+	/// @param[in]  origine     : Point de dpart du dplacement.
+	/// @param[in]  deplacement : Dplacement complet.
+	/// @param[in]  instantMax  : Instant au-del duquel la bote est ignore.
+	/// @param[out] instant     : Instant d'entre dans la bote.
+	///
+	/// @return Vrai si le dplacement entre dans la bote avant instantMax.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool intersecterBoite(glm::vec3 const& coinMin, glm::vec3 const& coinMax,
+		glm::dvec3 const& origine, glm::dvec3 const& deplacement,
+		double instantMax, double& instant)
+	{
+		double entree{ 0.0 };
+		double sortie{ instantMax };
+		for (glm::length_t i{ 0 }; i < 3; ++i) {
+			if (deplacement[i] == 0.0) {
+				if (origine[i] < coinMin[i] || origine[i] > coinMax[i])
+					return false;
+				continue;
+			}
+
+			const double inverse{ 1.0 / deplacement[i] };
+			double t1{ (coinMin[i] - origine[i]) * inverse };
+			double t2{ (coinMax[i] - origine[i]) * inverse };
+			if (t1 > t2)
+				std::swap(t1, t2);
+			if (t1 > entree)
+				entree = t1;
+			if (t2 < sortie)
+				sortie = t2;
+			if (entree > sortie)
+				return false;
+		}
+		instant = entree;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreTriangles::construire(Noeud const& racine)
+	///
+	/// Cette fonction construit la hirarchie  partir de tous les
+	/// triangles de l'arbre des meshes d'un modle, en appliquant les
+	/// transformations des noeuds comme le fait le rendu.
+	///
+	/// @param[in] racine : Le noeud racine du modle.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void ArbreTriangles::construire(Noeud const& racine)
+	{
+		vider();
+		ajouterTriangles(racine, glm::mat4x4{ 1.0f });
+		construireNoeuds();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreTriangles::construire(std::vector<Sommet> const& sommets, std::vector<Face> const& faces)
+	///
+	/// Cette fonction construit la hirarchie  partir de sommets et de
+	/// faces triangulaires, indexes comme celles d'un Mesh.
+	///
+	/// @param[in] sommets : Les sommets.
+	/// @param[in] faces   : Les indices des sommets de chaque triangle.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void ArbreTriangles::construire(std::vector<Sommet> const& sommets, std::vector<Face> const& faces)
+	{
+		vider();
+		triangles_.reserve(faces.size());
+		for (Face const& face : faces) {
+			Triangle triangle;
+			for (glm::length_t i{ 0 }; i < 3; ++i)
+				triangle.sommets[i] = sommets[face[i]];
+			triangles_.push_back(triangle);
+		}
+		construireNoeuds();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreTriangles::vider()
+	///
+	/// Cette fonction retire tous les triangles et libre la mmoire de la
+	/// hirarchie.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void ArbreTriangles::vider()
+	{
+		std::vector<Triangle>{}.swap(triangles_);
+		std::vector<NoeudArbre>{}.swap(noeuds_);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreTriangles::ajouterTriangles(Noeud const& noeud, glm::mat4x4 const& transformation)
+	///
+	/// Cette fonction ajoute, rcursivement, les triangles des meshes d'un
+	/// noeud et de ses enfants, transforms en espace du modle.
+	///
+	/// @param[in] noeud          : Le noeud  parcourir.
+	/// @param[in] transformation : La transformation cumule des parents.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void ArbreTriangles::ajouterTriangles(Noeud const& noeud, glm::mat4x4 const& transformation)
+	{
+		const glm::mat4x4 cumul{ transformation * noeud.obtenirTransformation() };
+
+		for (Mesh const& mesh : noeud.obtenirMeshes()) {
+			const Mesh::Etendue<Mesh::Vertex> sommets{ mesh.obtenirSommets() };
+			for (Mesh::Face const& face : mesh.obtenirFaces()) {
+				Triangle triangle;
+				for (glm::length_t i{ 0 }; i < 3; ++i)
+					triangle.sommets[i] = Sommet{ cumul * glm::vec4{ sommets[face[i]], 1.0f } };
+				triangles_.push_back(triangle);
+			}
+		}
+
+		for (Noeud const& enfant : noeud.obtenirEnfants())
+			ajouterTriangles(enfant, cumul);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void ArbreTriangles::construireNoeuds()
+	///
+	/// Cette fonction construit les noeuds de la hirarchie  partir des
+	/// triangles accumuls, puis rordonne les triangles dans l'ordre des
+	/// feuilles.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void ArbreTriangles::construireNoeuds()
+	{
+		if (triangles_.empty())
+			return;
+
+		const unsigned int nombre{ static_cast<unsigned int>(triangles_.size()) };
+
+		// Le centre de chaque triangle sert de cl pour la sparation.
+		std::vector<Sommet> centres;
+		centres.reserve(nombre);
+		for (Triangle const& triangle : triangles_)
+			centres.push_back((triangle.sommets[0] + triangle.sommets[1] + triangle.sommets[2]) / 3.0f);
+
+		std::vector<unsigned int> ordre(nombre);
+		for (unsigned int i{ 0 }; i < nombre; ++i)
+			ordre[i] = i;
+
+		// Un arbre binaire de n/4 feuilles a au plus n/2 noeuds, arrondi.
+		noeuds_.reserve(2 * (nombre / TRIANGLES_PAR_FEUILLE + 1));
+		construirePlage(0, nombre, ordre, centres);
+		noeuds_.shrink_to_fit();
+
+		std::vector<Triangle> tries;
+		tries.reserve(nombre);
+		for (unsigned int indice : ordre)
+			tries.push_back(triangles_[indice]);
+		triangles_.swap(tries);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int ArbreTriangles::construirePlage(unsigned int debut, unsigned int fin, std::vector<unsigned int>& ordre, std::vector<Sommet> const& centres)
+	///
+	/// Cette fonction construit, rcursivement, le sous-arbre d'une plage
+	/// de triangles.  La plage est spare  la mdiane des centres selon
+	/// l'axe o ils sont le plus tals, ce qui garde l'arbre quilibr et
+	/// sa profondeur logarithmique.
+	///
+	/// @param[in]     debut   : Premier indice de la plage dans ordre.
+	/// @param[in]     fin     : Indice suivant le dernier de la plage.
+	/// @param[in,out] ordre   : Indices des triangles, permuts par la sparation.
+	/// @param[in]     centres : Centres des triangles.
+	///
+	/// @return L'indice du noeud cr.
+	///
+	////////////////////////////////////////////////////////////////////////
+	unsigned int ArbreTriangles::construirePlage(unsigned int debut, unsigned int fin,
+		std::vector<unsigned int>& ordre, std::vector<Sommet> const& centres)
+	{
+		const unsigned int indice{ static_cast<unsigned int>(noeuds_.size()) };
+		noeuds_.push_back(NoeudArbre{});
+
+		// Bote des triangles et bote de leurs centres.
+		Sommet coinMin{ triangles_[ordre[debut]].sommets[0] };
+		Sommet coinMax{ coinMin };
+		Sommet centreMin{ centres[ordre[debut]] };
+		Sommet centreMax{ centreMin };
+		for (unsigned int i{ debut }; i < fin; ++i) {
+			Triangle const& triangle{ triangles_[ordre[i]] };
+			for (Sommet const& sommet : triangle.sommets) {
+				coinMin = glm::min(coinMin, sommet);
+				coinMax = glm::max(coinMax, sommet);
+			}
+			centreMin = glm::min(centreMin, centres[ordre[i]]);
+			centreMax = glm::max(centreMax, centres[ordre[i]]);
+		}
+		noeuds_[indice].coinMin = coinMin;
+		noeuds_[indice].coinMax = coinMax;
+
+		if (fin - debut <= TRIANGLES_PAR_FEUILLE) {
+			noeuds_[indice].indice = debut;
+			noeuds_[indice].nombre = fin - debut;
+			return indice;
+		}
+
+		const Sommet etendue{ centreMax - centreMin };
+		glm::length_t axe{ 0 };
+		if (etendue.y > etendue[axe])
+			axe = 1;
+		if (etendue.z > etendue[axe])
+			axe = 2;
+
+		const unsigned int milieu{ debut + (fin - debut) / 2 };
+		std::nth_element(ordre.begin() + debut, ordre.begin() + milieu, ordre.begin() + fin,
+			[&centres, axe](unsigned int a, unsigned int b) {
+			return centres[a][axe] < centres[b][axe];
+		});
+
+		// L'enfant gauche suit immdiatement son parent.
+		construirePlage(debut, milieu, ordre, centres);
+		const unsigned int droit{ construirePlage(milieu, fin, ordre, centres) };
+		noeuds_[indice].indice = droit;
+		noeuds_[indice].nombre = 0;
+		return indice;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn aidecollision::DetailsCollision ArbreTriangles::calculerCollisionSphere(glm::dvec3 const& position, double rayon) const
+	///
+	/// Cette fonction calcule la collision d'un objet sphrique avec les
+	/// triangles.  Seul le contact le plus profond est retenu: la direction
+	/// va du point de contact vers le centre de l'objet, comme pour
+	/// aidecollision::calculerCollisionSphere, et n'est pas normalise.  Si
+	/// le centre est exactement sur un triangle, la normale du triangle
+	/// est utilise comme direction.
+	///
+	/// @param[in] position : Centre de l'objet peut-tre en collision.
+	/// @param[in] rayon    : Rayon de l'objet peut-tre en collision.
+	///
+	/// @return Structure contenant de l'information sur la collision.
+	///
+	////////////////////////////////////////////////////////////////////////
+	aidecollision::DetailsCollision ArbreTriangles::calculerCollisionSphere(
+		glm::dvec3 const& position, double rayon) const
+	{
+		aidecollision::DetailsCollision details;
+		details.type = aidecollision::COLLISION_AUCUNE;
+		details.direction = glm::dvec3{ 0.0 };
+		details.enfoncement = 0.0;
+
+		if (noeuds_.empty() || rayon <= 0.0)
+			return details;
+
+		double meilleure2{ rayon * rayon };
+		unsigned int pile[64];
+		unsigned int taille{ 0 };
+		pile[taille++] = 0;
+
+		while (taille > 0) {
+			const unsigned int indice{ pile[--taille] };
+			NoeudArbre const& noeud{ noeuds_[indice] };
+			if (calculerDistance2(position, noeud.coinMin, noeud.coinMax) >= meilleure2)
+				continue;
+
+			if (noeud.nombre == 0) {
+				pile[taille++] = noeud.indice;
+				pile[taille++] = indice + 1;
+				continue;
+			}
+
+			for (unsigned int i{ noeud.indice }; i < noeud.indice + noeud.nombre; ++i) {
+				const glm::dvec3 a{ triangles_[i].sommets[0] };
+				const glm::dvec3 b{ triangles_[i].sommets[1] };
+				const glm::dvec3 c{ triangles_[i].sommets[2] };
+				const glm::dvec3 point{ calculerPointPlusProche(position, a, b, c) };
+				const double distance2{ glm::length2(position - point) };
+				if (distance2 >= meilleure2)
+					continue;
+
+				meilleure2 = distance2;
+				details.type = aidecollision::COLLISION_TRIANGLE;
+				details.direction = position - point;
+				if (distance2 == 0.0)
+					details.direction = glm::cross(b - a, c - a);
+			}
+		}
+
+		if (details.type != aidecollision::COLLISION_AUCUNE)
+			details.enfoncement = rayon - std::sqrt(meilleure2);
+
+		return details;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn aidecollision::DetailsImpact ArbreTriangles::calculerImpactRayon(glm::dvec3 const& origine, glm::dvec3 const& deplacement) const
+	///
+	/// Cette fonction calcule le premier triangle travers par un point qui
+	/// se dplace, par le test de Mller et Trumbore.  Les deux faces des
+	/// triangles sont considres; la normale retourne est unitaire et
+	/// oriente vers l'origine du dplacement.  Sans impact, l'instant vaut
+	/// 1, comme pour les calculs d'impacts de aidecollision, ce qui permet
+	/// d'utiliser cette fonction comme aidecollision::CalculImpact.
+	///
+	/// @param[in] origine     : Point de dpart du dplacement.
+	/// @param[in] deplacement : Dplacement complet.
+	///
+	/// @return Structure contenant de l'information sur l'impact.
+	///
+	////////////////////////////////////////////////////////////////////////
+	aidecollision::DetailsImpact ArbreTriangles::calculerImpactRayon(
+		glm::dvec3 const& origine, glm::dvec3 const& deplacement) const
+	{
+		aidecollision::DetailsImpact impact;
+		impact.type = aidecollision::COLLISION_AUCUNE;
+		impact.instant = 1.0;
+
+		if (noeuds_.empty())
+			return impact;
+
+		unsigned int pile[64];
+		unsigned int taille{ 0 };
+		pile[taille++] = 0;
+
+		while (taille > 0) {
+			const unsigned int indice{ pile[--taille] };
+			NoeudArbre const& noeud{ noeuds_[indice] };
+			double entree;
+			if (!intersecterBoite(noeud.coinMin, noeud.coinMax, origine, deplacement, impact.instant, entree))
+				continue;
+
+			if (noeud.nombre == 0) {
+				// Visiter d'abord l'enfant qui se trouve du ct de l'origine.
+				unsigned int proche{ indice + 1 };
+				unsigned int loin{ noeud.indice };
+				NoeudArbre const& gauche{ noeuds_[proche] };
+				NoeudArbre const& droit{ noeuds_[loin] };
+				const glm::dvec3 ecart{ glm::dvec3{ droit.coinMin + droit.coinMax } - glm::dvec3{ gauche.coinMin + gauche.coinMax } };
+				if (glm::dot(ecart, deplacement) < 0.0)
+					std::swap(proche, loin);
+				pile[taille++] = loin;
+				pile[taille++] = proche;
+				continue;
+			}
+
+			for (unsigned int i{ noeud.indice }; i < noeud.indice + noeud.nombre; ++i) {
+				const glm::dvec3 a{ triangles_[i].sommets[0] };
+				const glm::dvec3 arete1{ glm::dvec3{ triangles_[i].sommets[1] } - a };
+				const glm::dvec3 arete2{ glm::dvec3{ triangles_[i].sommets[2] } - a };
+
+				const glm::dvec3 p{ glm::cross(deplacement, arete2) };
+				const double determinant{ glm::dot(arete1, p) };
+				if (determinant == 0.0)
+					continue;
+
+				const double inverse{ 1.0 / determinant };
+				const glm::dvec3 s{ origine - a };
+				const double u{ glm::dot(s, p) * inverse };
+				if (u < 0.0 || u > 1.0)
+					continue;
+
+				const glm::dvec3 q{ glm::cross(s, arete1) };
+				const double v{ glm::dot(deplacement, q) * inverse };
+				if (v < 0.0 || u + v > 1.0)
+					continue;
+
+				const double instant{ glm::dot(arete2, q) * inverse };
+				if (instant < 0.0 || instant >= impact.instant)
+					continue;
+
+				glm::dvec3 normale{ glm::cross(arete1, arete2) };
+				if (glm::dot(normale, deplacement) > 0.0)
+					normale = -normale;
+
+				impact.type = aidecollision::COLLISION_TRIANGLE;
+				impact.instant = instant;
+				impact.normale = glm::normalize(normale);
+			}
+		}
+
+		if (impact.type != aidecollision::COLLISION_AUCUNE)
+			impact.position = origine + impact.instant * deplacement;
+
+		return impact;
+	}
+
+} /// fin de modele
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file ArbreTriangles.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __RENDERING_ARBRETRIANGLES_H__
+#define __RENDERING_ARBRETRIANGLES_H__
+
+#include <vector>
+#include <cstddef>
+
+#include "glm/glm.hpp"
+#include "AideCollision.h"
+
+namespace modele{
+
+	class Noeud;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class ArbreTriangles
+	/// @brief Hirarchie statique de botes englobantes sur les triangles d'un
+	///		   modle 3D, qui permet de tester les collisions contre la
+	///		   gomtrie relle du modle plutt que contre une forme
+	///		   analytique approximative.
+	///
+	///		   Les triangles sont copis en espace du modle (transformations
+	///		   des noeuds appliques) puis rordonns pour que chaque feuille
+	///		   en dsigne une plage contigu.  Les noeuds sont rangs en
+	///		   profondeur d'abord: l'enfant gauche suit immdiatement son
+	///		   parent et seul l'indice de l'enfant droit est conserv.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class ArbreTriangles{
+	public:
+		/// Alias de type
+		using Sommet = glm::vec3;
+		using Face	 = glm::ivec3;
+
+		/// Nombre maximal de triangles d'une feuille.
+		static const unsigned int TRIANGLES_PAR_FEUILLE{ 4 };
+
+		ArbreTriangles() = default;
+
+		/// Construit la hirarchie  partir de l'arbre des meshes d'un modle
+		void construire(Noeud const& racine);
+		/// Construit la hirarchie  partir de sommets et de faces
+		void construire(std::vector<Sommet> const& sommets, std::vector<Face> const& faces);
+		/// Retire tous les triangles
+		void vider();
+
+		/// Calcule la collision d'un objet sphrique avec les triangles
+		aidecollision::DetailsCollision calculerCollisionSphere(
+			glm::dvec3 const& position, double rayon) const;
+		/// Calcule le premier triangle travers par un dplacement
+		aidecollision::DetailsImpact calculerImpactRayon(
+			glm::dvec3 const& origine, glm::dvec3 const& deplacement) const;
+
+		/// Obtient le nombre de triangles de la hirarchie
+		inline std::size_t obtenirNombreTriangles() const;
+		/// Obtient le nombre de noeuds de la hirarchie
+		inline std::size_t obtenirNombreNoeuds() const;
+		/// Obtient la mmoire occupe par la hirarchie, en octets
+		inline std::size_t obtenirMemoire() const;
+		/// Vrifie si la hirarchie ne contient aucun triangle
+		inline bool estVide() const;
+
+	private:
+		/// Triangle en espace du modle.
+		struct Triangle{
+			Sommet sommets[3];
+		};
+
+		/// Noeud de la hirarchie.
+		struct NoeudArbre{
+			/// Coin minimal de la bote englobante
+			Sommet coinMin;
+			/// Coin maximal de la bote englobante
+			Sommet coinMax;
+			/// Premier triangle d'une feuille, ou enfant droit d'un noeud interne
+			unsigned int indice;
+			/// Nombre de triangles d'une feuille, 0 pour un noeud interne
+			unsigned int nombre;
+		};
+
+		/// Ajoute les triangles d'un noeud et de ses enfants
+		void ajouterTriangles(Noeud const& noeud, glm::mat4x4 const& transformation);
+		/// Construit les noeuds  partir des triangles accumuls
+		void construireNoeuds();
+		/// Construit le sous-arbre d'une plage de triangles
+		unsigned int construirePlage(unsigned int debut, unsigned int fin,
+			std::vector<unsigned int>& ordre, std::vector<Sommet> const& centres);
+
+		/// Triangles, dans l'ordre des feuilles
+		std::vector<Triangle> triangles_;
+		/// Noeuds de la hirarchie, la racine en premier
+		std::vector<NoeudArbre> noeuds_;
+	};
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t ArbreTriangles::obtenirNombreTriangles() const
+	///
+	/// Cette fonction retourne le nombre de triangles de la hirarchie.
+	///
+	/// @return Le nombre de triangles.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t ArbreTriangles::obtenirNombreTriangles() const
+	{
+		return triangles_.size();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t ArbreTriangles::obtenirNombreNoeuds() const
+	///
+	/// Cette fonction retourne le nombre de noeuds, internes et feuilles,
+	/// de la hirarchie.
+	///
+	/// @return Le nombre de noeuds.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t ArbreTriangles::obtenirNombreNoeuds() const
+	{
+		return noeuds_.size();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t ArbreTriangles::obtenirMemoire() const
+	///
+	/// Cette fonction retourne la mmoire rserve pour les triangles et
+	/// les noeuds de la hirarchie.
+	///
+	/// @return La mmoire occupe, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t ArbreTriangles::obtenirMemoire() const
+	{
+		return triangles_.capacity() * sizeof(Triangle) +
+			noeuds_.capacity() * sizeof(NoeudArbre);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool ArbreTriangles::estVide() const
+	///
+	/// Cette fonction vrifie si la hirarchie ne contient aucun triangle.
+	///
+	/// @return Vrai si la hirarchie est vide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool ArbreTriangles::estVide() const
+	{
+		return triangles_.empty();
+	}
+
+} /// fin de modele
+
+#endif /// __RENDERING_ARBRETRIANGLES_H__
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,685 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file CacheModele.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#include <windows.h>
+
+#include "CacheModele.h"
+#include "Noeud.h"
+#include "FichierProjete.h"
+#include "CEcritureFichierBinaire.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace modele{
+
+	const std::uint32_t CacheModele::VERSION;
+	const std::size_t CacheModele::ALIGNEMENT;
+
+	/// Identifiant des fichiers cache, au dbut de l'en-tte.
+	static const char MAGIE[4]{ 'C', 'M', '3', 'D' };
+
+	/// Profondeur maximale de l'arbre des noeuds accepte  la lecture.
+	static const unsigned int PROFONDEUR_MAXIMALE{ 256 };
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @struct EnTeteCache
+	/// @brief En-tte d'un fichier cache, qui permet de vrifier qu'il
+	///		   correspond toujours au fichier source et  l'importation.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	struct EnTeteCache{
+		/// Identifiant des fichiers cache
+		char magie[4];
+		/// Version du format
+		std::uint32_t version;
+		/// Taille du fichier source, en octets
+		std::uint64_t tailleModele;
+		/// Date de modification du fichier source
+		std::uint64_t dateModele;
+		/// Hachage du contenu du fichier source
+		std::uint64_t hachageModele;
+		/// Drapeaux d'importation
+		std::uint64_t drapeaux;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @struct LectureCache
+	/// @brief Position de lecture dans un fichier cache projet en mmoire.
+	///
+	///		   Lorsque le fichier est conserv, les meshes lus sont projets:
+	///		   leurs tableaux restent dans le fichier au lieu d'tre copis.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	struct LectureCache{
+		/// Dbut du fichier
+		const char* donnees;
+		/// Taille du fichier
+		std::size_t taille;
+		/// Position de lecture
+		std::size_t position;
+		/// Fichier auquel les meshes lus font rfrence, nul pour copier
+		/// les tableaux
+		Mesh::Fichier fichier;
+	};
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool lireAttributs(CacheModele::Path const& chemin, std::uint64_t& taille, std::uint64_t& date)
+	///
+	/// Cette fonction lit la taille et la date de modification d'un fichier
+	/// sans l'ouvrir.
+	///
+	/// @param[in]  chemin : Le chemin du fichier
+	/// @param[out] taille : La taille du fichier, en octets
+	/// @param[out] date   : La date de modification du fichier
+	///
+	/// @return Faux si le fichier n'existe pas.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool lireAttributs(CacheModele::Path const& chemin, std::uint64_t& taille, std::uint64_t& date)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA attributs;
+		if (!GetFileAttributesExA(chemin.string().c_str(), GetFileExInfoStandard, &attributs))
+			return false;
+
+		taille = (static_cast<std::uint64_t>(attributs.nFileSizeHigh) << 32) | attributs.nFileSizeLow;
+		date = (static_cast<std::uint64_t>(attributs.ftLastWriteTime.dwHighDateTime) << 32) |
+			attributs.ftLastWriteTime.dwLowDateTime;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static void aligner(CEcritureFichierBinaire& fichier)
+	///
+	/// Cette fonction ajoute des octets nuls jusqu'au prochain multiple de
+	/// CacheModele::ALIGNEMENT.
+	///
+	/// @param[in] fichier : Le fichier en criture
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static void aligner(CEcritureFichierBinaire& fichier)
+	{
+		const std::size_t position{ static_cast<std::size_t>(fichier.tellp()) };
+		const std::size_t reste{ position % CacheModele::ALIGNEMENT };
+		if (reste != 0)
+			fichier.null(static_cast<int>(CacheModele::ALIGNEMENT - reste));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn template <typename T> static void ecrireTableau(CEcritureFichierBinaire& fichier, utilitaire::Etendue<T> const& tableau)
+	///
+	/// Cette fonction crit le contenu brut d'un tableau, align.  Le
+	/// nombre d'lments est crit sparment.
+	///
+	/// @param[in] fichier : Le fichier en criture
+	/// @param[in] tableau : Le tableau  crire
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <typename T>
+	static void ecrireTableau(CEcritureFichierBinaire& fichier, utilitaire::Etendue<T> const& tableau)
+	{
+		if (tableau.empty())
+			return;
+
+		aligner(fichier);
+		fichier.write(reinterpret_cast<const char*>(tableau.data()),
+			static_cast<std::streamsize>(tableau.size() * sizeof(T)));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static void ecrireMateriau(CEcritureFichierBinaire& fichier, Materiau const& materiau)
+	///
+	/// Cette fonction crit toutes les composantes d'un matriau.
+	///
+	/// @param[in] fichier  : Le fichier en criture
+	/// @param[in] materiau : Le matriau  crire
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static void ecrireMateriau(CEcritureFichierBinaire& fichier, Materiau const& materiau)
+	{
+		fichier < materiau.nom_;
+		for (Materiau::VecType const* composante : { &materiau.diffuse_, &materiau.speculaire_,
+			&materiau.ambiant_, &materiau.emission_, &materiau.transparence_ })
+			fichier.write(reinterpret_cast<const char*>(composante), sizeof(Materiau::VecType));
+		fichier < materiau.opacite_ < materiau.shininess_ < materiau.shininessStrength_;
+		fichier < materiau.nomTexture_;
+		fichier < materiau.filDeFer_ < materiau.afficherDeuxCotes_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static void ecrireMesh(CEcritureFichierBinaire& fichier, Mesh const& mesh)
+	///
+	/// Cette fonction crit le nom, le matriau et les donnes gomtriques
+	/// d'un mesh.  Les nombres d'lments prcdent les tableaux.
+	///
+	/// @param[in] fichier : Le fichier en criture
+	/// @param[in] mesh    : Le mesh  crire
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static void ecrireMesh(CEcritureFichierBinaire& fichier, Mesh const& mesh)
+	{
+		fichier < mesh.obtenirNom();
+		ecrireMateriau(fichier, mesh.obtenirMateriau());
+
+		fichier < static_cast<unsigned int>(mesh.obtenirSommets().size())
+			< static_cast<unsigned int>(mesh.obtenirNormales().size())
+			< static_cast<unsigned int>(mesh.obtenirTexCoords().size())
+			< static_cast<unsigned int>(mesh.obtenirCouleurs().size())
+			< static_cast<unsigned int>(mesh.obtenirFaces().size());
+
+		ecrireTableau(fichier, mesh.obtenirSommets());
+		ecrireTableau(fichier, mesh.obtenirNormales());
+		ecrireTableau(fichier, mesh.obtenirTexCoords());
+		ecrireTableau(fichier, mesh.obtenirCouleurs());
+		ecrireTableau(fichier, mesh.obtenirFaces());
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static void ecrireNoeud(CEcritureFichierBinaire& fichier, Noeud const& noeud)
+	///
+	/// Cette fonction crit un noeud, ses meshes et, rcursivement, ses
+	/// enfants.
+	///
+	/// @param[in] fichier : Le fichier en criture
+	/// @param[in] noeud   : Le noeud  crire
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static void ecrireNoeud(CEcritureFichierBinaire& fichier, Noeud const& noeud)
+	{
+		fichier < noeud.obtenirNom();
+		fichier.write(reinterpret_cast<const char*>(&noeud.obtenirTransformation()), sizeof(glm::mat4x4));
+
+		fichier < static_cast<unsigned int>(noeud.obtenirMeshes().size());
+		for (Mesh const& mesh : noeud.obtenirMeshes())
+			ecrireMesh(fichier, mesh);
+
+		fichier < static_cast<unsigned int>(noeud.obtenirEnfants().size());
+		for (Noeud const& enfant : noeud.obtenirEnfants())
+			ecrireNoeud(fichier, enfant);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool lireOctets(LectureCache& lecture, void* destination, std::size_t nombre)
+	///
+	/// Cette fonction copie des octets du fichier et avance la position de
+	/// lecture, sans jamais dpasser la fin du fichier.
+	///
+	/// @param[in,out] lecture     : La position de lecture
+	/// @param[out]    destination : La destination des octets
+	/// @param[in]     nombre      : Le nombre d'octets
+	///
+	/// @return Faux si le fichier est trop court.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool lireOctets(LectureCache& lecture, void* destination, std::size_t nombre)
+	{
+		if (nombre > lecture.taille - lecture.position)
+			return false;
+
+		std::memcpy(destination, lecture.donnees + lecture.position, nombre);
+		lecture.position += nombre;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn template <typename T> static bool lireValeur(LectureCache& lecture, T& valeur)
+	///
+	/// Cette fonction lit une valeur crite telle quelle.
+	///
+	/// @param[in,out] lecture : La position de lecture
+	/// @param[out]    valeur  : La valeur lue
+	///
+	/// @return Faux si le fichier est trop court.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <typename T>
+	static bool lireValeur(LectureCache& lecture, T& valeur)
+	{
+		return lireOctets(lecture, &valeur, sizeof(T));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool lireChaine(LectureCache& lecture, std::string& chaine)
+	///
+	/// Cette fonction lit une chane crite par CEcritureFichierBinaire,
+	/// c'est--dire sa longueur suivie de ses caractres.
+	///
+	/// @param[in,out] lecture : La position de lecture
+	/// @param[out]    chaine  : La chane lue
+	///
+	/// @return Faux si le fichier est trop court ou la longueur invalide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool lireChaine(LectureCache& lecture, std::string& chaine)
+	{
+		int longueur;
+		if (!lireValeur(lecture, longueur) || longueur < 0 ||
+			static_cast<std::size_t>(longueur) > lecture.taille - lecture.position)
+			return false;
+
+		chaine.assign(lecture.donnees + lecture.position, static_cast<std::size_t>(longueur));
+		lecture.position += static_cast<std::size_t>(longueur);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn template <typename T> static bool lireTableau(LectureCache& lecture, std::vector<T>& tableau, unsigned int nombre)
+	///
+	/// Cette fonction lit le contenu brut d'un tableau align.  La taille
+	/// est vrifie avant l'allocation, pour qu'un fichier corrompu ne
+	/// puisse pas provoquer une allocation dmesure.
+	///
+	/// @param[in,out] lecture : La position de lecture
+	/// @param[out]    tableau : Le tableau lu
+	/// @param[in]     nombre  : Le nombre d'lments
+	///
+	/// @return Faux si le fichier est trop court.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <typename T>
+	static bool lireTableau(LectureCache& lecture, std::vector<T>& tableau, unsigned int nombre)
+	{
+		if (nombre == 0)
+			return true;
+
+		const std::size_t reste{ lecture.position % CacheModele::ALIGNEMENT };
+		if (reste != 0)
+			lecture.position += CacheModele::ALIGNEMENT - reste;
+		if (lecture.position > lecture.taille ||
+			nombre > (lecture.taille - lecture.position) / sizeof(T))
+			return false;
+
+		tableau.resize(nombre);
+		return lireOctets(lecture, tableau.data(), nombre * sizeof(T));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn template <typename T> static bool projeterTableau(LectureCache& lecture, utilitaire::Etendue<T>& tableau, unsigned int nombre)
+	///
+	/// Cette fonction obtient un tableau align directement dans le fichier
+	/// projet, sans le copier.  Le dbut de la projection tant align sur
+	/// une page, l'alignement dans le fichier garantit celui des lments.
+	///
+	/// @param[in,out] lecture : La position de lecture
+	/// @param[out]    tableau : L'tendue du tableau dans le fichier
+	/// @param[in]     nombre  : Le nombre d'lments
+	///
+	/// @return Faux si le fichier est trop court.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <typename T>
+	static bool projeterTableau(LectureCache& lecture, utilitaire::Etendue<T>& tableau, unsigned int nombre)
+	{
+		if (nombre == 0)
+			return true;
+
+		const std::size_t reste{ lecture.position % CacheModele::ALIGNEMENT };
+		if (reste != 0)
+			lecture.position += CacheModele::ALIGNEMENT - reste;
+		if (lecture.position > lecture.taille ||
+			nombre > (lecture.taille - lecture.position) / sizeof(T))
+			return false;
+
+		tableau = utilitaire::Etendue<T>{ reinterpret_cast<const T*>(lecture.donnees + lecture.position), nombre };
+		lecture.position += nombre * sizeof(T);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool lireMateriau(LectureCache& lecture, Materiau& materiau)
+	///
+	/// Cette fonction lit toutes les composantes d'un matriau.
+	///
+	/// @param[in,out] lecture  : La position de lecture
+	/// @param[out]    materiau : Le matriau lu
+	///
+	/// @return Faux si le fichier est invalide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool lireMateriau(LectureCache& lecture, Materiau& materiau)
+	{
+		if (!lireChaine(lecture, materiau.nom_))
+			return false;
+		for (Materiau::VecType* composante : { &materiau.diffuse_, &materiau.speculaire_,
+			&materiau.ambiant_, &materiau.emission_, &materiau.transparence_ })
+			if (!lireValeur(lecture, *composante))
+				return false;
+
+		/// Les boolens sont lus comme des octets, pour ne pas dpendre de
+		/// leur reprsentation
+		char filDeFer, afficherDeuxCotes;
+		if (!lireValeur(lecture, materiau.opacite_) ||
+			!lireValeur(lecture, materiau.shininess_) ||
+			!lireValeur(lecture, materiau.shininessStrength_) ||
+			!lireChaine(lecture, materiau.nomTexture_) ||
+			!lireValeur(lecture, filDeFer) ||
+			!lireValeur(lecture, afficherDeuxCotes))
+			return false;
+
+		materiau.filDeFer_ = filDeFer != 0;
+		materiau.afficherDeuxCotes_ = afficherDeuxCotes != 0;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool lireMesh(LectureCache& lecture, Noeud::Conteneur<Mesh>& meshes)
+	///
+	/// Cette fonction lit un mesh et l'ajoute  la fin d'un conteneur.  Le
+	/// mesh est projet si la lecture conserve le fichier.
+	///
+	/// @param[in,out] lecture : La position de lecture
+	/// @param[in,out] meshes  : Le conteneur des meshes
+	///
+	/// @return Faux si le fichier est invalide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool lireMesh(LectureCache& lecture, Noeud::Conteneur<Mesh>& meshes)
+	{
+		std::string nom;
+		Materiau materiau;
+		unsigned int nombreSommets, nombreNormales, nombreTexCoords, nombreCouleurs, nombreFaces;
+		if (!lireChaine(lecture, nom) || !lireMateriau(lecture, materiau) ||
+			!lireValeur(lecture, nombreSommets) || !lireValeur(lecture, nombreNormales) ||
+			!lireValeur(lecture, nombreTexCoords) || !lireValeur(lecture, nombreCouleurs) ||
+			!lireValeur(lecture, nombreFaces))
+			return false;
+
+		if (lecture.fichier) {
+			Mesh::Etendue<Mesh::Vertex> sommets;
+			Mesh::Etendue<Mesh::Normale> normales;
+			Mesh::Etendue<Mesh::TexCoord> texCoords;
+			Mesh::Etendue<Mesh::Couleur> couleurs;
+			Mesh::Etendue<Mesh::Face> faces;
+			if (!projeterTableau(lecture, sommets, nombreSommets) ||
+				!projeterTableau(lecture, normales, nombreNormales) ||
+				!projeterTableau(lecture, texCoords, nombreTexCoords) ||
+				!projeterTableau(lecture, couleurs, nombreCouleurs) ||
+				!projeterTableau(lecture, faces, nombreFaces))
+				return false;
+
+			meshes.emplace_back(lecture.fichier, sommets, normales, texCoords, couleurs, faces,
+				std::move(materiau), std::move(nom));
+			return true;
+		}
+
+		Mesh::Conteneur<Mesh::Vertex> sommets;
+		Mesh::Conteneur<Mesh::Normale> normales;
+		Mesh::Conteneur<Mesh::TexCoord> texCoords;
+		Mesh::Conteneur<Mesh::Couleur> couleurs;
+		Mesh::Conteneur<Mesh::Face> faces;
+		if (!lireTableau(lecture, sommets, nombreSommets) ||
+			!lireTableau(lecture, normales, nombreNormales) ||
+			!lireTableau(lecture, texCoords, nombreTexCoords) ||
+			!lireTableau(lecture, couleurs, nombreCouleurs) ||
+			!lireTableau(lecture, faces, nombreFaces))
+			return false;
+
+		meshes.emplace_back(std::move(sommets), std::move(normales), std::move(texCoords),
+			std::move(couleurs), std::move(faces), std::move(materiau), std::move(nom));
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool lireNoeud(LectureCache& lecture, Noeud::Conteneur<Noeud>& noeuds, unsigned int profondeur)
+	///
+	/// Cette fonction lit un noeud, ses meshes et, rcursivement, ses
+	/// enfants, puis l'ajoute  la fin d'un conteneur.
+	///
+	/// @param[in,out] lecture    : La position de lecture
+	/// @param[in,out] noeuds     : Le conteneur des noeuds
+	/// @param[in]     profondeur : La profondeur du noeud dans l'arbre
+	///
+	/// @return Faux si le fichier est invalide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool lireNoeud(LectureCache& lecture, Noeud::Conteneur<Noeud>& noeuds, unsigned int profondeur)
+	{
+		if (profondeur > PROFONDEUR_MAXIMALE)
+			return false;
+
+		std::string nom;
+		glm::mat4x4 transformation;
+		unsigned int nombreMeshes;
+		if (!lireChaine(lecture, nom) || !lireValeur(lecture, transformation) ||
+			!lireValeur(lecture, nombreMeshes) || nombreMeshes > lecture.taille - lecture.position)
+			return false;
+
+		Noeud::Conteneur<Mesh> meshes;
+		meshes.reserve(nombreMeshes);
+		for (unsigned int i{ 0 }; i < nombreMeshes; ++i)
+			if (!lireMesh(lecture, meshes))
+				return false;
+
+		unsigned int nombreEnfants;
+		if (!lireValeur(lecture, nombreEnfants) || nombreEnfants > lecture.taille - lecture.position)
+			return false;
+
+		Noeud::Conteneur<Noeud> enfants;
+		enfants.reserve(nombreEnfants);
+		for (unsigned int i{ 0 }; i < nombreEnfants; ++i)
+			if (!lireNoeud(lecture, enfants, profondeur + 1))
+				return false;
+
+		noeuds.emplace_back(std::move(nom), transformation, std::move(meshes), std::move(enfants));
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn CacheModele::Path CacheModele::obtenirChemin(Path const& cheminModele)
+	///
+	/// Cette fonction retourne le chemin du cache associ  un fichier de
+	/// modle: le cache est plac  ct du modle.
+	///
+	/// @param[in] cheminModele : Le chemin du fichier de modle
+	///
+	/// @return Le chemin du cache.
+	///
+	////////////////////////////////////////////////////////////////////////
+	CacheModele::Path CacheModele::obtenirChemin(Path const& cheminModele)
+	{
+		return Path{ cheminModele.string() + ".cache" };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool CacheModele::ecrire(Path const& cheminCache, Path const& cheminModele, std::uint64_t drapeaux, Noeud const& racine, std::vector<std::string> const& textures)
+	///
+	/// Cette fonction crit la hirarchie d'un modle import et le nom de
+	/// ses textures dans le cache.  Le fichier est d'abord crit sous un nom
+	/// temporaire puis renomm, pour qu'un cache incomplet ne soit jamais
+	/// lu.
+	///
+	/// @param[in] cheminCache  : Le chemin du cache
+	/// @param[in] cheminModele : Le chemin du fichier de modle import
+	/// @param[in] drapeaux     : Les drapeaux d'importation utiliss
+	/// @param[in] racine       : Le noeud racine du modle import
+	/// @param[in] textures     : Les noms des textures du modle
+	///
+	/// @return Faux si le cache n'a pu tre crit.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool CacheModele::ecrire(Path const& cheminCache, Path const& cheminModele,
+		std::uint64_t drapeaux, Noeud const& racine,
+		std::vector<std::string> const& textures)
+	{
+		EnTeteCache enTete;
+		std::memcpy(enTete.magie, MAGIE, sizeof(MAGIE));
+		enTete.version = VERSION;
+		enTete.drapeaux = drapeaux;
+		if (!lireAttributs(cheminModele, enTete.tailleModele, enTete.dateModele) ||
+			!calculerHachage(cheminModele, enTete.hachageModele))
+			return false;
+
+		const std::string nomCache{ cheminCache.string() };
+		const std::string nomTemporaire{ nomCache + ".tmp" };
+		{
+			CEcritureFichierBinaire fichier{ nomTemporaire.c_str() };
+			if (!fichier.is_open())
+				return false;
+
+			fichier.write(reinterpret_cast<const char*>(&enTete), sizeof(enTete));
+
+			fichier < static_cast<unsigned int>(textures.size());
+			for (std::string const& texture : textures)
+				fichier < texture;
+
+			ecrireNoeud(fichier, racine);
+
+			if (!fichier.good()) {
+				fichier.close();
+				std::remove(nomTemporaire.c_str());
+				return false;
+			}
+		}
+
+		std::remove(nomCache.c_str());
+		if (std::rename(nomTemporaire.c_str(), nomCache.c_str()) != 0) {
+			std::remove(nomTemporaire.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool CacheModele::lire(Path const& cheminCache, Path const& cheminModele, std::uint64_t drapeaux, Noeud& racine, std::vector<std::string>& textures, bool projeter)
+	///
+	/// Cette fonction lit la hirarchie d'un modle et le nom de ses
+	/// textures  partir du cache, projet en mmoire.  Le cache n'est
+	/// utilis que si son format, ses drapeaux d'importation et le fichier
+	/// source correspondent.  Le noeud racine et les textures ne sont
+	/// modifis que si la lecture russit au complet.
+	///
+	/// Si les meshes sont projets, leurs tableaux ne sont pas copis: ils
+	/// restent dans le cache, qui demeure projet et ouvert en lecture
+	/// jusqu' la destruction du dernier mesh.  Le chargement ne cote
+	/// alors que les dfauts de page des donnes effectivement lues.
+	///
+	/// @param[in]  cheminCache  : Le chemin du cache
+	/// @param[in]  cheminModele : Le chemin du fichier de modle
+	/// @param[in]  drapeaux     : Les drapeaux d'importation attendus
+	/// @param[out] racine       : Le noeud racine du modle
+	/// @param[out] textures     : Les noms des textures du modle
+	/// @param[in]  projeter     : Vrai pour projeter les meshes plutt que
+	///							   copier leurs tableaux
+	///
+	/// @return Faux si le cache n'existe pas, est prim ou invalide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool CacheModele::lire(Path const& cheminCache, Path const& cheminModele,
+		std::uint64_t drapeaux, Noeud& racine,
+		std::vector<std::string>& textures, bool projeter)
+	{
+		std::shared_ptr<utilitaire::FichierProjete> fichier{ std::make_shared<utilitaire::FichierProjete>() };
+		if (!fichier->ouvrir(cheminCache.string()))
+			return false;
+
+		LectureCache lecture{ fichier->obtenirDonnees(), fichier->obtenirTaille(), 0, nullptr };
+		if (projeter)
+			lecture.fichier = fichier;
+
+		/// Vrifier le format et l'importation
+		EnTeteCache enTete;
+		if (!lireValeur(lecture, enTete) ||
+			std::memcmp(enTete.magie, MAGIE, sizeof(MAGIE)) != 0 ||
+			enTete.version != VERSION || enTete.drapeaux != drapeaux)
+			return false;
+
+		/// Vrifier le fichier source, en ne calculant le hachage que si
+		/// la date a chang
+		std::uint64_t taille, date;
+		if (!lireAttributs(cheminModele, taille, date) || taille != enTete.tailleModele)
+			return false;
+		if (date != enTete.dateModele) {
+			std::uint64_t hachage;
+			if (!calculerHachage(cheminModele, hachage) || hachage != enTete.hachageModele)
+				return false;
+		}
+
+		unsigned int nombreTextures;
+		if (!lireValeur(lecture, nombreTextures) || nombreTextures > lecture.taille - lecture.position)
+			return false;
+
+		std::vector<std::string> texturesLues(nombreTextures);
+		for (std::string& texture : texturesLues)
+			if (!lireChaine(lecture, texture))
+				return false;
+
+		Noeud::Conteneur<Noeud> noeuds;
+		if (!lireNoeud(lecture, noeuds, 0) || lecture.position != lecture.taille)
+			return false;
+
+		racine = std::move(noeuds.front());
+		textures = std::move(texturesLues);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool CacheModele::calculerHachage(Path const& chemin, std::uint64_t& hachage)
+	///
+	/// Cette fonction calcule le hachage FNV-1a sur 64 bits du contenu d'un
+	/// fichier, projet en mmoire.
+	///
+	/// @param[in]  chemin  : Le chemin du fichier
+	/// @param[out] hachage : Le hachage du contenu
+	///
+	/// @return Faux si le fichier n'existe pas ou est vide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool CacheModele::calculerHachage(Path const& chemin, std::uint64_t& hachage)
+	{
+		utilitaire::FichierProjete fichier;
+		if (!fichier.ouvrir(chemin.string()))
+			return false;
+
+		const unsigned char* octets{ reinterpret_cast<const unsigned char*>(fichier.obtenirDonnees()) };
+		hachage = 14695981039346656037ull;
+		for (std::size_t i{ 0 }; i < fichier.obtenirTaille(); ++i) {
+			hachage ^= octets[i];
+			hachage *= 1099511628211ull;
+		}
+		return true;
+	}
+
+} /// fin de modele
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file CacheModele.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __RENDERING_CACHEMODELE_H__
+#define __RENDERING_CACHEMODELE_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <filesystem>	/// std::tr2::sys::path
+
+namespace modele{
+
+	class Noeud;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class CacheModele
+	/// @brief Cache binaire de la hirarchie d'un modle 3D dj import par
+	///		   'assimp', pour viter de refaire l'importation et ses
+	///		   post-traitements (triangulation, normales, fusion des sommets)
+	///		    chaque lancement.
+	///
+	///		   L'en-tte du cache identifie le format (version), le fichier
+	///		   source (taille, date de modification et hachage du contenu) et
+	///		   les drapeaux d'importation.  Un cache dont l'en-tte ne
+	///		   correspond plus est ignor.  Lorsque seule la date diffre, le
+	///		   hachage du contenu dcide, ce qui vite de rimporter un
+	///		   fichier simplement recopi.
+	///
+	///		   Le cache est lu par projection en mmoire.  Les tableaux de
+	///		   sommets et de faces y sont aligns sur 16 octets, ce qui
+	///		   permet aussi aux meshes lus de les utiliser directement,
+	///		   sans copie.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class CacheModele{
+	public:
+		using Path = std::tr2::sys::path;
+
+		/// Version du format,  incrmenter  chaque modification du format
+		static const std::uint32_t VERSION{ 1 };
+		/// Alignement des tableaux dans le fichier
+		static const std::size_t ALIGNEMENT{ 16 };
+
+		/// Obtient le chemin du cache associ  un fichier de modle
+		static Path obtenirChemin(Path const& cheminModele);
+
+		/// crit la hirarchie d'un modle et ses textures dans le cache
+		static bool ecrire(Path const& cheminCache, Path const& cheminModele,
+			std::uint64_t drapeaux, Noeud const& racine,
+			std::vector<std::string> const& textures);
+		/// Lit la hirarchie d'un modle et ses textures, si le cache est valide
+		static bool lire(Path const& cheminCache, Path const& cheminModele,
+			std::uint64_t drapeaux, Noeud& racine,
+			std::vector<std::string>& textures, bool projeter = false);
+
+		/// Calcule le hachage du contenu d'un fichier
+		static bool calculerHachage(Path const& chemin, std::uint64_t& hachage);
+	};
+
+} /// fin de modele
+
+#endif /// __RENDERING_CACHEMODELE_H__
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file ChargeurModeles.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#include "ChargeurModeles.h"
+#include "OrdonnanceurTaches.h"
+
+namespace modele{
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::vector<Modele3D> ChargeurModeles::charger(std::vector<Path> const& chemins)
+	///
+	/// Cette fonction charge un lot de modles: les modles sont imports
+	/// en parallle, puis leurs textures sont charges sur le fil appelant.
+	/// Un modle qui n'a pu tre import est vide, comme aprs un appel 
+	/// Modele3D::charger() qui choue.
+	///
+	/// @param[in] chemins : Les chemins des fichiers de modles
+	///
+	/// @return Les modles, dans l'ordre des chemins.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::vector<Modele3D> ChargeurModeles::charger(std::vector<Path> const& chemins)
+	{
+		std::vector<Modele3D> modeles(chemins.size());
+		importer(modeles, chemins);
+
+		/// Les textures OpenGL ne peuvent tre cres que sur ce fil
+		for (Modele3D& modele : modeles)
+			modele.chargerTextures();
+
+		return modeles;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int ChargeurModeles::importer(std::vector<Modele3D>& modeles, std::vector<Path> const& chemins)
+	///
+	/// Cette fonction importe un lot de modles en parallle, une tche par
+	/// modle.  Aucun appel OpenGL n'est fait: il reste  appeler
+	/// Modele3D::chargerTextures() sur le fil OpenGL pour chaque modle.
+	///
+	/// @param[in,out] modeles : Les modles  importer, un par chemin
+	/// @param[in]     chemins : Les chemins des fichiers de modles
+	///
+	/// @return Le nombre de modles imports avec succs.
+	///
+	////////////////////////////////////////////////////////////////////////
+	unsigned int ChargeurModeles::importer(std::vector<Modele3D>& modeles,
+		std::vector<Path> const& chemins)
+	{
+		const std::size_t nombre{ chemins.size() < modeles.size() ? chemins.size() : modeles.size() };
+
+		/// Chaque tche n'crit que dans son modle et dans son rsultat
+		std::vector<char> reussites(nombre, 0);
+
+		utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+		utilitaire::GroupeTaches groupe;
+		for (std::size_t i{ 0 }; i < nombre; ++i) {
+			ordonnanceur->lancer(groupe, [&modeles, &chemins, &reussites, i] {
+				reussites[i] = modeles[i].importer(chemins[i]) ? 1 : 0;
+			});
+		}
+		ordonnanceur->attendre(groupe);
+
+		unsigned int nombreReussites{ 0 };
+		for (char reussite : reussites)
+			nombreReussites += reussite;
+		return nombreReussites;
+	}
+
+} /// fin de modele
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file ChargeurModeles.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __RENDERING_CHARGEURMODELES_H__
+#define __RENDERING_CHARGEURMODELES_H__
+
+#include <vector>
+
+#include "Modele3D.h"
+
+namespace modele{
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class ChargeurModeles
+	/// @brief Chargement d'un lot de modles 3D en parallle.
+	///
+	///		   L'importation de chaque modle (lecture du cache ou importation
+	///		   'assimp', avec un importateur propre  chaque tche) est lance
+	///		   sur l'ordonnanceur de tches.  Le temps de chargement d'un lot
+	///		   est donc celui du plus long modle plutt que la somme de
+	///		   tous.  Seules les tapes OpenGL, soit la cration des textures,
+	///		   sont faites ensuite sur le fil appelant, qui doit possder le
+	///		   contexte OpenGL.
+	///
+	///		   Les chemins d'un mme lot doivent tre distincts.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class ChargeurModeles{
+	public:
+		using Path = Modele3D::Path;
+
+		/// Charge un lot de modles, prts  tre affichs
+		static std::vector<Modele3D> charger(std::vector<Path> const& chemins);
+
+		/// Importe un lot de modles en parallle, sans appel OpenGL
+		static unsigned int importer(std::vector<Modele3D>& modeles,
+			std::vector<Path> const& chemins);
+	};
+
+} /// fin de modele
+
+#endif /// __RENDERING_CHARGEURMODELES_H__
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
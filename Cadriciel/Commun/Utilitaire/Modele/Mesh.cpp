@@ -80,6 +80,75 @@ namespace modele{
 	}
 
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Mesh::Mesh(Conteneur<Vertex> sommets, Conteneur<Normale> normales, Conteneur<TexCoord> texCoords, Conteneur<Couleur> couleurs, Conteneur<Face> faces, Materiau materiau, std::string nom)
+	///
+	/// Construit un mesh  partir de donnes gomtriques dj importes,
+	/// par exemple lues du cache des modles.  Les conteneurs sont
+	/// transfrs, sans copie des lments.
+	///
+	/// @param[in] sommets   : les sommets
+	/// @param[in] normales  : les normales, vide ou une par sommet
+	/// @param[in] texCoords : les coordonnes de texture, vide ou une par sommet
+	/// @param[in] couleurs  : les couleurs, vide ou une par sommet
+	/// @param[in] faces     : les faces (triangles)
+	/// @param[in] materiau  : le matriau
+	/// @param[in] nom       : le nom du mesh
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	Mesh::Mesh(Conteneur<Vertex> sommets, Conteneur<Normale> normales,
+		Conteneur<TexCoord> texCoords, Conteneur<Couleur> couleurs,
+		Conteneur<Face> faces, Materiau materiau, std::string nom)
+		: vertices_{ std::move(sommets) }
+		, normales_{ std::move(normales) }
+		, texcoords_{ std::move(texCoords) }
+		, couleurs_{ std::move(couleurs) }
+		, materiau_(std::move(materiau))
+		, faces_{ std::move(faces) }
+		, nom_{ std::move(nom) }
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Mesh::Mesh(Fichier fichier, Etendue<Vertex> sommets, Etendue<Normale> normales, Etendue<TexCoord> texCoords, Etendue<Couleur> couleurs, Etendue<Face> faces, Materiau materiau, std::string nom)
+	///
+	/// Construit un mesh projet, dont les donnes gomtriques restent
+	/// dans un fichier projet en mmoire.  Aucune donne n'est copie: les
+	/// pages du fichier ne sont lues qu'au premier accs.  Le mesh garde le
+	/// fichier ouvert tant qu'il existe.
+	///
+	/// @param[in] fichier   : le fichier projet qui contient les donnes
+	/// @param[in] sommets   : les sommets, dans le fichier
+	/// @param[in] normales  : les normales, vide ou une par sommet
+	/// @param[in] texCoords : les coordonnes de texture, vide ou une par sommet
+	/// @param[in] couleurs  : les couleurs, vide ou une par sommet
+	/// @param[in] faces     : les faces (triangles), dans le fichier
+	/// @param[in] materiau  : le matriau
+	/// @param[in] nom       : le nom du mesh
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	Mesh::Mesh(Fichier fichier, Etendue<Vertex> sommets, Etendue<Normale> normales,
+		Etendue<TexCoord> texCoords, Etendue<Couleur> couleurs,
+		Etendue<Face> faces, Materiau materiau, std::string nom)
+		: materiau_(std::move(materiau))
+		, nom_{ std::move(nom) }
+		, fichier_{ std::move(fichier) }
+		, sommetsProjetes_{ sommets }
+		, normalesProjetees_{ normales }
+		, texcoordsProjetees_{ texCoords }
+		, couleursProjetees_{ couleurs }
+		, facesProjetees_{ faces }
+	{
+	}
+
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn void Mesh::reserverMemoire(aiMesh const* mesh)
@@ -11,13 +11,20 @@
 #ifndef __RENDERING_MESH_H__
 #define __RENDERING_MESH_H__
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "Materiau.h"
+#include "Etendue.h"
 
 struct aiScene;		/// Dclarations avances de Assimp
 struct aiMesh;		//
 
+namespace utilitaire{
+	class FichierProjete;
+}
+
 namespace modele{
 
 	///////////////////////////////////////////////////////////////////////////
@@ -26,6 +33,12 @@ namespace modele{
 	///		   donc les vertices, les normales, les coordonnes de texture, les
 	///		   couleurs des vertices et les faces.
 	///
+	///		   Un mesh peut possder ses donnes ou tre "projet": ses
+	///		   donnes sont alors lues directement dans un fichier projet en
+	///		   mmoire (le cache des modles), sans copie.  Le fichier reste
+	///		   ouvert tant qu'un mesh y fait rfrence.  Dans les deux cas,
+	///		   les donnes sont obtenues sous forme d'tendues.
+	///
 	/// @author Martin Paradis
 	/// @date 2014-08-16
 	///////////////////////////////////////////////////////////////////////////
@@ -33,6 +46,8 @@ namespace modele{
 	public:
 		/// Alias de type
 		template <typename T> using Conteneur = std::vector<T>;
+		template <typename T> using Etendue = utilitaire::Etendue<T>;
+		using Fichier	= std::shared_ptr<utilitaire::FichierProjete const>;
 		using Vertex	= glm::vec3;
 		using Normale	= glm::vec3;
 		using TexCoord	= glm::vec2;
@@ -42,24 +57,32 @@ namespace modele{
 		Mesh() = default;
 		/// Constructeur  partir d'un mesh et d'une scne assimp
 		Mesh(aiScene const* scene, aiMesh const* mesh);
+		/// Constructeur  partir des donnes gomtriques
+		Mesh(Conteneur<Vertex> sommets, Conteneur<Normale> normales,
+			Conteneur<TexCoord> texCoords, Conteneur<Couleur> couleurs,
+			Conteneur<Face> faces, Materiau materiau, std::string nom);
+		/// Constructeur  partir de donnes d'un fichier projet en mmoire
+		Mesh(Fichier fichier, Etendue<Vertex> sommets, Etendue<Normale> normales,
+			Etendue<TexCoord> texCoords, Etendue<Couleur> couleurs,
+			Etendue<Face> faces, Materiau materiau, std::string nom);
 		
 		/// Mthode pour obtenir les vertex du mesh	
-		inline Conteneur<Vertex>   const& obtenirSommets()   const;
+		inline Etendue<Vertex>   obtenirSommets()   const;
 
 		/// Mthode pour obtenir les normales du mesh	
-		inline Conteneur<Normale>  const& obtenirNormales()  const;
+		inline Etendue<Normale>  obtenirNormales()  const;
 
 		/// Mthode pour obtenir les coordonnes de texture du mesh	
-		inline Conteneur<TexCoord> const& obtenirTexCoords() const;
+		inline Etendue<TexCoord> obtenirTexCoords() const;
 
 		/// Mthode pour obtenir les couleurs des sommets du mesh	
-		inline Conteneur<Couleur>  const& obtenirCouleurs()  const;
+		inline Etendue<Couleur>  obtenirCouleurs()  const;
 
 		/// Mthode pour obtenir le materiau du mesh	
 		inline Materiau			   const& obtenirMateriau()	 const;
 
 		/// Mthode pour obtenir les couleurs des sommets du mesh	
-		inline Conteneur<Face>	   const& obtenirFaces()     const;
+		inline Etendue<Face>	   obtenirFaces()     const;
 
 		/// Mthode pour obtenir le nom du noeud (souvent une chaine vide)
 		inline std::string		   const& obtenirNom()		 const;
@@ -75,6 +98,9 @@ namespace modele{
 		/// Vrifier si le mesh contient des faces
 		inline bool possedeFaces() const;
 
+		/// Vrifier si les donnes du mesh sont dans un fichier projet
+		inline bool estProjete() const;
+
 	private:
 		/// Permet d'allouer la mmoire ncessaire pour contenir le mesh
 		void reserverMemoire(aiMesh const* mesh);
@@ -93,62 +119,76 @@ namespace modele{
 		Conteneur<Face> faces_;
 		/// Le nom
 		std::string nom_;
+
+		/// Le fichier projet qui contient les donnes, nul si le mesh
+		/// possde ses donnes
+		Fichier fichier_;
+		/// Les sommets, dans le fichier projet
+		Etendue<Vertex> sommetsProjetes_;
+		/// Les normales, dans le fichier projet
+		Etendue<Normale> normalesProjetees_;
+		/// Les coordonnes de texture, dans le fichier projet
+		Etendue<TexCoord> texcoordsProjetees_;
+		/// Les couleurs des sommets, dans le fichier projet
+		Etendue<Couleur> couleursProjetees_;
+		/// Les faces, dans le fichier projet
+		Etendue<Face> facesProjetees_;
 	};
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn inline Mesh::Conteneur<Mesh::Vertex> const& Mesh::obtenirSommets() const
+	/// @fn inline Mesh::Etendue<Mesh::Vertex> Mesh::obtenirSommets() const
 	///
 	/// Cette fonction retourne les sommets dont est compos le mesh.
 	///
-	/// @return les sommets (const).
+	/// @return l'tendue des sommets.
 	///
 	////////////////////////////////////////////////////////////////////////
-	inline Mesh::Conteneur<Mesh::Vertex> const& Mesh::obtenirSommets() const
+	inline Mesh::Etendue<Mesh::Vertex> Mesh::obtenirSommets() const
 	{
-		return vertices_;
+		return fichier_ ? sommetsProjetes_ : Etendue<Vertex>{ vertices_ };
 	}
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn inline Mesh::Conteneur<Mesh::Normale> const& Mesh::obtenirNormales() const
+	/// @fn inline Mesh::Etendue<Mesh::Normale> Mesh::obtenirNormales() const
 	///
 	/// Cette fonction retourne les normales contenues dans le mesh.
 	///
-	/// @return les normales (const).
+	/// @return l'tendue des normales.
 	///
 	////////////////////////////////////////////////////////////////////////
-	inline Mesh::Conteneur<Mesh::Normale> const& Mesh::obtenirNormales() const
+	inline Mesh::Etendue<Mesh::Normale> Mesh::obtenirNormales() const
 	{
-		return normales_;
+		return fichier_ ? normalesProjetees_ : Etendue<Normale>{ normales_ };
 	}
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn inline Mesh::Conteneur<Mesh::TexCoord> const& Mesh::obtenirTexCoords() const
+	/// @fn inline Mesh::Etendue<Mesh::TexCoord> Mesh::obtenirTexCoords() const
 	///
 	/// Cette fonction retourne les coordonnes de texture dont est compos le mesh.
 	///
-	/// @return les coordonnes de textures (const).
+	/// @return l'tendue des coordonnes de textures.
 	///
 	////////////////////////////////////////////////////////////////////////
-	inline Mesh::Conteneur<Mesh::TexCoord> const& Mesh::obtenirTexCoords() const
+	inline Mesh::Etendue<Mesh::TexCoord> Mesh::obtenirTexCoords() const
 	{
-		return texcoords_;
+		return fichier_ ? texcoordsProjetees_ : Etendue<TexCoord>{ texcoords_ };
 	}
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn inline Mesh::Conteneur<Mesh::Couleur> const& Mesh::obtenirCouleurs() const
+	/// @fn inline Mesh::Etendue<Mesh::Couleur> Mesh::obtenirCouleurs() const
 	///
 	/// Cette fonction retourne les couleurs dont est compos le mesh.
 	///
-	/// @return les couleurs (const).
+	/// @return l'tendue des couleurs.
 	///
 	////////////////////////////////////////////////////////////////////////
-	inline Mesh::Conteneur<Mesh::Couleur> const& Mesh::obtenirCouleurs() const
+	inline Mesh::Etendue<Mesh::Couleur> Mesh::obtenirCouleurs() const
 	{
-		return couleurs_;
+		return fichier_ ? couleursProjetees_ : Etendue<Couleur>{ couleurs_ };
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -167,17 +207,17 @@ namespace modele{
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn inline Mesh::Conteneur<Mesh::Face> const& Mesh::obtenirFaces() const
+	/// @fn inline Mesh::Etendue<Mesh::Face> Mesh::obtenirFaces() const
 	///
 	/// Cette fonction retourne les index des faces dont est compos le mesh.
 	/// Les faces sont supposes toujours tre des triangles.
 	///
-	/// @return les faces (const).
+	/// @return l'tendue des faces.
 	///
 	////////////////////////////////////////////////////////////////////////
-	inline Mesh::Conteneur<Mesh::Face> const& Mesh::obtenirFaces() const
+	inline Mesh::Etendue<Mesh::Face> Mesh::obtenirFaces() const
 	{
-		return faces_;
+		return fichier_ ? facesProjetees_ : Etendue<Face>{ faces_ };
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -206,7 +246,7 @@ namespace modele{
 	////////////////////////////////////////////////////////////////////////
 	inline bool Mesh::possedeSommets() const
 	{
-		return !vertices_.empty();
+		return !obtenirSommets().empty();
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -220,7 +260,7 @@ namespace modele{
 	////////////////////////////////////////////////////////////////////////
 	inline bool Mesh::possedeNormales() const
 	{
-		return !normales_.empty();
+		return !obtenirNormales().empty();
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -234,7 +274,7 @@ namespace modele{
 	////////////////////////////////////////////////////////////////////////
 	inline bool Mesh::possedeTexCoords() const
 	{
-		return !texcoords_.empty();
+		return !obtenirTexCoords().empty();
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -248,7 +288,7 @@ namespace modele{
 	////////////////////////////////////////////////////////////////////////
 	inline bool Mesh::possedeCouleurs() const
 	{
-		return !couleurs_.empty();
+		return !obtenirCouleurs().empty();
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -262,7 +302,22 @@ namespace modele{
 	////////////////////////////////////////////////////////////////////////
 	inline bool Mesh::possedeFaces() const
 	{
-		return !faces_.empty();
+		return !obtenirFaces().empty();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool Mesh::estProjete() const
+	///
+	/// Cette fonction indique si les donnes du mesh sont lues directement
+	/// dans un fichier projet en mmoire plutt que possdes par le mesh.
+	///
+	/// @return vrai si le mesh est projet, faux sinon.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool Mesh::estProjete() const
+	{
+		return fichier_ != nullptr;
 	}
 
 } /// fin de rendering
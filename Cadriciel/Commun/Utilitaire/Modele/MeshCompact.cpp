@@ -0,0 +1,454 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file MeshCompact.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#include "MeshCompact.h"
+
+#include <cmath>
+#include <utility>
+
+#include "glm/glm.hpp"
+
+namespace modele{
+
+	/// Nombre maximal de sommets dont les indices tiennent sur 16 bits
+	static const std::size_t SOMMETS_INDICES_COURTS{ 65536 };
+
+	/// Pas de quantification des composantes normalises sur 16 bits
+	static const float PAS_SNORM16{ 1.0f / 32767.0f };
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static glm::vec2 signeNonNul(glm::vec2 const& v)
+	///
+	/// Cette fonction retourne le signe de chaque composante, en
+	/// considrant zro comme positif.
+	///
+	/// @param[in] v : Le vecteur
+	///
+	/// @return Un vecteur de -1 et de 1.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static glm::vec2 signeNonNul(glm::vec2 const& v)
+	{
+		return glm::vec2{ v.x >= 0.0f ? 1.0f : -1.0f, v.y >= 0.0f ? 1.0f : -1.0f };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static glm::vec2 projeterOctaedre(glm::vec3 const& normale)
+	///
+	/// Cette fonction projette une normale unitaire sur l'octadre, puis
+	/// dplie sa moiti infrieure sur les coins du carr [-1, 1].
+	///
+	/// @param[in] normale : La normale unitaire
+	///
+	/// @return Les coordonnes dans le carr.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static glm::vec2 projeterOctaedre(glm::vec3 const& normale)
+	{
+		const glm::vec3 p{ normale / (std::abs(normale.x) + std::abs(normale.y) + std::abs(normale.z)) };
+		const glm::vec2 o{ p.x, p.y };
+		if (p.z >= 0.0f)
+			return o;
+		return (1.0f - glm::abs(glm::vec2{ o.y, o.x })) * signeNonNul(o);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static glm::vec3 deplierOctaedre(glm::vec2 const& o)
+	///
+	/// Cette fonction est l'inverse de projeterOctaedre().
+	///
+	/// @param[in] o : Les coordonnes dans le carr [-1, 1]
+	///
+	/// @return La normale unitaire.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static glm::vec3 deplierOctaedre(glm::vec2 const& o)
+	{
+		glm::vec3 normale{ o.x, o.y, 1.0f - std::abs(o.x) - std::abs(o.y) };
+		if (normale.z < 0.0f) {
+			const glm::vec2 xy{ (1.0f - glm::abs(glm::vec2{ o.y, o.x })) * signeNonNul(o) };
+			normale.x = xy.x;
+			normale.y = xy.y;
+		}
+		return glm::normalize(normale);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static float angle(glm::vec3 const& a, glm::vec3 const& b)
+	///
+	/// Cette fonction retourne l'angle entre deux vecteurs.  Elle passe
+	/// par l'arc tangente plutt que par l'arc cosinus du produit scalaire,
+	/// qui n'a aucune prcision en simple prcision pour les trs petits
+	/// angles.
+	///
+	/// @param[in] a : Le premier vecteur
+	/// @param[in] b : Le second vecteur
+	///
+	/// @return L'angle, en radians.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static float angle(glm::vec3 const& a, glm::vec3 const& b)
+	{
+		return std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static float erreurComposantes(T const& a, T const& b)
+	///
+	/// Cette fonction retourne la plus grande diffrence absolue entre
+	/// les composantes de deux vecteurs.
+	///
+	/// @param[in] a : Le premier vecteur
+	/// @param[in] b : Le second vecteur
+	///
+	/// @return La diffrence maximale.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	static float erreurComposantes(T const& a, T const& b)
+	{
+		float erreur{ 0.0f };
+		for (glm::length_t i{ 0 }; i < a.length(); ++i) {
+			const float difference{ std::abs(a[i] - b[i]) };
+			erreur = erreur < difference ? difference : erreur;
+		}
+		return erreur;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::MeshCompact(Mesh const& mesh)
+	///
+	/// Ce constructeur quantifie les donnes d'un mesh.  Les indices des
+	/// faces sont sur 16 bits si le mesh a au plus 65536 sommets.
+	///
+	/// @param[in] mesh : Le mesh  compacter
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::MeshCompact(Mesh const& mesh)
+		: sommets_(mesh.obtenirSommets().begin(), mesh.obtenirSommets().end()),
+		materiau_{ mesh.obtenirMateriau() }, nom_{ mesh.obtenirNom() }
+	{
+		const Etendue<Face> faces{ mesh.obtenirFaces() };
+		if (sommets_.size() <= SOMMETS_INDICES_COURTS) {
+			indicesCourts_.reserve(3 * faces.size());
+			for (Face const& face : faces) {
+				for (glm::length_t i{ 0 }; i < face.length(); ++i)
+					indicesCourts_.push_back(static_cast<std::uint16_t>(face[i]));
+			}
+		}
+		else {
+			indicesLongs_.reserve(3 * faces.size());
+			for (Face const& face : faces) {
+				for (glm::length_t i{ 0 }; i < face.length(); ++i)
+					indicesLongs_.push_back(static_cast<std::uint32_t>(face[i]));
+			}
+		}
+
+		normales_.reserve(mesh.obtenirNormales().size());
+		for (Normale const& normale : mesh.obtenirNormales())
+			normales_.push_back(encoderNormale(normale));
+
+		texCoords_.reserve(mesh.obtenirTexCoords().size());
+		for (TexCoord const& texCoord : mesh.obtenirTexCoords())
+			texCoords_.push_back(encoderTexCoord(texCoord));
+
+		couleurs_.reserve(mesh.obtenirCouleurs().size());
+		for (Couleur const& couleur : mesh.obtenirCouleurs())
+			couleurs_.push_back(encoderCouleur(couleur));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Mesh MeshCompact::decompresser() const
+	///
+	/// Cette fonction reconstruit un mesh ordinaire, en virgule flottante,
+	/// pour les utilisateurs des donnes sur le CPU (arbre de triangles,
+	/// stockages OpenGL, cache des modles).
+	///
+	/// @return Le mesh reconstruit.
+	///
+	////////////////////////////////////////////////////////////////////////
+	Mesh MeshCompact::decompresser() const
+	{
+		Conteneur<Normale> normales;
+		normales.reserve(normales_.size());
+		for (NormaleCompacte normale : normales_)
+			normales.push_back(decoderNormale(normale));
+
+		Conteneur<TexCoord> texCoords;
+		texCoords.reserve(texCoords_.size());
+		for (TexCoordCompacte texCoord : texCoords_)
+			texCoords.push_back(decoderTexCoord(texCoord));
+
+		Conteneur<Couleur> couleurs;
+		couleurs.reserve(couleurs_.size());
+		for (CouleurCompacte couleur : couleurs_)
+			couleurs.push_back(decoderCouleur(couleur));
+
+		Conteneur<Face> faces;
+		faces.reserve(obtenirNombreFaces());
+		for (std::size_t i{ 0 }; i < obtenirNombreFaces(); ++i)
+			faces.push_back(obtenirFace(i));
+
+		return Mesh{ sommets_, std::move(normales), std::move(texCoords),
+			std::move(couleurs), std::move(faces), materiau_, nom_ };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::Rapport MeshCompact::comparer(Mesh const& mesh) const
+	///
+	/// Cette fonction compare les donnes compactes  celles du mesh dont
+	/// elles proviennent: mmoire occupe de part et d'autre et erreur
+	/// maximale de reconstruction de chaque type de donnes.  Les normales
+	/// nulles du mesh d'origine sont ignores.
+	///
+	/// @param[in] mesh : Le mesh d'origine
+	///
+	/// @return Le rapport de compaction.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::Rapport MeshCompact::comparer(Mesh const& mesh) const
+	{
+		Rapport rapport;
+		rapport.octetsOriginaux =
+			mesh.obtenirSommets().size() * sizeof(Vertex) +
+			mesh.obtenirNormales().size() * sizeof(Normale) +
+			mesh.obtenirTexCoords().size() * sizeof(TexCoord) +
+			mesh.obtenirCouleurs().size() * sizeof(Couleur) +
+			mesh.obtenirFaces().size() * sizeof(Face);
+		rapport.octetsCompacts = obtenirMemoire();
+
+		const Etendue<Normale> normales{ mesh.obtenirNormales() };
+		for (std::size_t i{ 0 }; i < normales.size() && i < normales_.size(); ++i) {
+			const float longueur{ glm::length(normales[i]) };
+			if (longueur == 0.0f)
+				continue;
+			const float erreur{ angle(normales[i] / longueur, obtenirNormale(i)) };
+			rapport.erreurNormales = rapport.erreurNormales < erreur ? erreur : rapport.erreurNormales;
+		}
+
+		const Etendue<TexCoord> texCoords{ mesh.obtenirTexCoords() };
+		for (std::size_t i{ 0 }; i < texCoords.size() && i < texCoords_.size(); ++i) {
+			const float erreur{ erreurComposantes(texCoords[i], obtenirTexCoord(i)) };
+			rapport.erreurTexCoords = rapport.erreurTexCoords < erreur ? erreur : rapport.erreurTexCoords;
+		}
+
+		const Etendue<Couleur> couleurs{ mesh.obtenirCouleurs() };
+		for (std::size_t i{ 0 }; i < couleurs.size() && i < couleurs_.size(); ++i) {
+			const float erreur{ erreurComposantes(couleurs[i], obtenirCouleur(i)) };
+			rapport.erreurCouleurs = rapport.erreurCouleurs < erreur ? erreur : rapport.erreurCouleurs;
+		}
+
+		return rapport;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::Rapport MeshCompact::evaluer(Noeud const& noeud)
+	///
+	/// Cette fonction compacte chacun des meshes d'un noeud et de ses
+	/// enfants et cumule leurs rapports.  Appele sur la racine d'un
+	/// modle, elle donne la mmoire que ce modle conomiserait et
+	/// l'erreur maximale de reconstruction de ses donnes.
+	///
+	/// @param[in] noeud : Le noeud  valuer
+	///
+	/// @return Le rapport cumul.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::Rapport MeshCompact::evaluer(Noeud const& noeud)
+	{
+		Rapport rapport;
+		for (Mesh const& mesh : noeud.obtenirMeshes())
+			rapport += MeshCompact{ mesh }.comparer(mesh);
+		for (Noeud const& enfant : noeud.obtenirEnfants())
+			rapport += evaluer(enfant);
+		return rapport;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::size_t MeshCompact::obtenirMemoire() const
+	///
+	/// Cette fonction retourne le nombre d'octets occups par les donnes
+	/// du mesh, sans compter le matriau ni le nom.
+	///
+	/// @return Le nombre d'octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::size_t MeshCompact::obtenirMemoire() const
+	{
+		return sommets_.size() * sizeof(Vertex) +
+			indicesCourts_.size() * sizeof(std::uint16_t) +
+			indicesLongs_.size() * sizeof(std::uint32_t) +
+			normales_.size() * sizeof(NormaleCompacte) +
+			texCoords_.size() * sizeof(TexCoordCompacte) +
+			couleurs_.size() * sizeof(CouleurCompacte);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::Face MeshCompact::obtenirFace(std::size_t indice) const
+	///
+	/// Cette fonction retourne une face du mesh, quelle que soit la
+	/// taille de ses indices.
+	///
+	/// @param[in] indice : L'indice de la face.
+	///
+	/// @return La face.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::Face MeshCompact::obtenirFace(std::size_t indice) const
+	{
+		if (possedeIndicesCourts()) {
+			return Face{ indicesCourts_[3 * indice], indicesCourts_[3 * indice + 1],
+				indicesCourts_[3 * indice + 2] };
+		}
+		return Face{ static_cast<int>(indicesLongs_[3 * indice]),
+			static_cast<int>(indicesLongs_[3 * indice + 1]),
+			static_cast<int>(indicesLongs_[3 * indice + 2]) };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::NormaleCompacte MeshCompact::encoderNormale(Normale const& normale)
+	///
+	/// Cette fonction projette une normale sur l'octadre et quantifie ses
+	/// deux coordonnes sur 16 bits.  Plutt que d'arrondir chaque
+	/// coordonne sparment, les quatre voisins de la projection sont
+	/// essays et celui dont la normale dcode est la plus proche est
+	/// retenu, ce qui rduit l'erreur angulaire maximale.
+	///
+	/// @param[in] normale : La normale, normalise au besoin
+	///
+	/// @return La normale encode.  Une normale nulle donne (0, 0, 1).
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::NormaleCompacte MeshCompact::encoderNormale(Normale const& normale)
+	{
+		const float longueur{ glm::length(normale) };
+		if (longueur == 0.0f)
+			return glm::packSnorm2x16(glm::vec2{ 0.0f });
+
+		const Normale unitaire{ normale / longueur };
+		const glm::vec2 base{ glm::floor(projeterOctaedre(unitaire) / PAS_SNORM16) * PAS_SNORM16 };
+
+		NormaleCompacte meilleure{ 0 };
+		float meilleurAngle{ 4.0f };
+		for (int i{ 0 }; i < 4; ++i) {
+			const glm::vec2 voisin{ glm::clamp(
+				base + glm::vec2{ static_cast<float>(i & 1), static_cast<float>(i >> 1) } * PAS_SNORM16,
+				-1.0f, 1.0f) };
+			const NormaleCompacte encodee{ glm::packSnorm2x16(voisin) };
+			const float ecart{ angle(unitaire, decoderNormale(encodee)) };
+			if (ecart < meilleurAngle) {
+				meilleure = encodee;
+				meilleurAngle = ecart;
+			}
+		}
+		return meilleure;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::Normale MeshCompact::decoderNormale(NormaleCompacte normale)
+	///
+	/// Cette fonction dcode une normale projete sur l'octadre.
+	///
+	/// @param[in] normale : La normale encode
+	///
+	/// @return La normale unitaire.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::Normale MeshCompact::decoderNormale(NormaleCompacte normale)
+	{
+		return deplierOctaedre(glm::unpackSnorm2x16(normale));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::TexCoordCompacte MeshCompact::encoderTexCoord(TexCoord const& texCoord)
+	///
+	/// Cette fonction encode des coordonnes de texture en demi-flottants.
+	/// Leur prcision relative est de 2^-11, soit moins de 2,5e-4 dans
+	/// l'intervalle [0, 1].
+	///
+	/// @param[in] texCoord : Les coordonnes de texture
+	///
+	/// @return Les coordonnes encodes.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::TexCoordCompacte MeshCompact::encoderTexCoord(TexCoord const& texCoord)
+	{
+		return glm::packHalf2x16(texCoord);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::TexCoord MeshCompact::decoderTexCoord(TexCoordCompacte texCoord)
+	///
+	/// Cette fonction dcode des coordonnes de texture en demi-flottants.
+	///
+	/// @param[in] texCoord : Les coordonnes encodes
+	///
+	/// @return Les coordonnes de texture.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::TexCoord MeshCompact::decoderTexCoord(TexCoordCompacte texCoord)
+	{
+		return glm::unpackHalf2x16(texCoord);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::CouleurCompacte MeshCompact::encoderCouleur(Couleur const& couleur)
+	///
+	/// Cette fonction encode une couleur en RGBA sur 8 bits.  Les
+	/// composantes sont limites  [0, 1].
+	///
+	/// @param[in] couleur : La couleur
+	///
+	/// @return La couleur encode.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::CouleurCompacte MeshCompact::encoderCouleur(Couleur const& couleur)
+	{
+		return glm::packUnorm4x8(couleur);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn MeshCompact::Couleur MeshCompact::decoderCouleur(CouleurCompacte couleur)
+	///
+	/// Cette fonction dcode une couleur en RGBA sur 8 bits.
+	///
+	/// @param[in] couleur : La couleur encode
+	///
+	/// @return La couleur.
+	///
+	////////////////////////////////////////////////////////////////////////
+	MeshCompact::Couleur MeshCompact::decoderCouleur(CouleurCompacte couleur)
+	{
+		return glm::unpackUnorm4x8(couleur);
+	}
+
+} /// fin de modele
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,381 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file MeshCompact.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __RENDERING_MESHCOMPACT_H__
+#define __RENDERING_MESHCOMPACT_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Mesh.h"
+#include "Noeud.h"
+
+namespace modele{
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class MeshCompact
+	/// @brief Reprsentation compacte et optionnelle des donnes d'un mesh.
+	///
+	///		   Les sommets restent en virgule flottante, mais les autres
+	///		   donnes sont quantifies:
+	///
+	///		   - les indices des faces sont sur 16 bits lorsque le mesh a
+	///		     au plus 65536 sommets, sur 32 bits sinon;
+	///		   - les normales sont projetes sur un octadre, dont les deux
+	///		     coordonnes sont normalises sur 16 bits (4 octets au lieu
+	///		     de 12);
+	///		   - les coordonnes de texture sont des demi-flottants (4 octets
+	///		     au lieu de 8), qui acceptent les textures rptes;
+	///		   - les couleurs sont en RGBA sur 8 bits (4 octets au lieu de 16).
+	///
+	///		   Les indices sont conservs exactement; les autres donnes sont
+	///		   dcodes  la demande, lment par lment, ou toutes  la
+	///		   fois par decompresser() pour les utilisateurs qui attendent un
+	///		   mesh ordinaire.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class MeshCompact{
+	public:
+		/// Alias de type
+		template <typename T> using Conteneur = Mesh::Conteneur<T>;
+		template <typename T> using Etendue = Mesh::Etendue<T>;
+		using Vertex	= Mesh::Vertex;
+		using Normale	= Mesh::Normale;
+		using TexCoord	= Mesh::TexCoord;
+		using Couleur	= Mesh::Couleur;
+		using Face		= Mesh::Face;
+		/// Normale projete sur un octadre, deux composantes de 16 bits
+		using NormaleCompacte	= std::uint32_t;
+		/// Coordonnes de texture, deux demi-flottants
+		using TexCoordCompacte	= std::uint32_t;
+		/// Couleur RGBA, quatre composantes de 8 bits
+		using CouleurCompacte	= std::uint32_t;
+
+		///////////////////////////////////////////////////////////////////////
+		/// @struct Rapport
+		/// @brief Mmoire conomise et erreur maximale de reconstruction.
+		///////////////////////////////////////////////////////////////////////
+		struct Rapport{
+			/// Nombre d'octets des donnes originales
+			std::size_t octetsOriginaux{ 0 };
+			/// Nombre d'octets des donnes compactes
+			std::size_t octetsCompacts{ 0 };
+			/// Erreur angulaire maximale des normales, en radians
+			float erreurNormales{ 0.0f };
+			/// Erreur maximale d'une composante des coordonnes de texture
+			float erreurTexCoords{ 0.0f };
+			/// Erreur maximale d'une composante des couleurs
+			float erreurCouleurs{ 0.0f };
+
+			/// Obtient le nombre d'octets conomiss
+			inline std::size_t obtenirOctetsEconomises() const;
+			/// Cumule le rapport d'un autre mesh
+			inline Rapport& operator+=(Rapport const& rapport);
+		};
+
+		MeshCompact() = default;
+		/// Constructeur  partir d'un mesh, dont les donnes sont quantifies
+		explicit MeshCompact(Mesh const& mesh);
+
+		/// Reconstruit un mesh ordinaire  partir des donnes compactes
+		Mesh decompresser() const;
+		/// Compare les donnes compactes  celles du mesh d'origine
+		Rapport comparer(Mesh const& mesh) const;
+		/// value la compaction des meshes d'un noeud et de ses enfants
+		static Rapport evaluer(Noeud const& noeud);
+
+		/// Obtient le nombre de sommets
+		inline std::size_t obtenirNombreSommets() const;
+		/// Obtient le nombre de faces
+		inline std::size_t obtenirNombreFaces() const;
+		/// Vrifie si les indices des faces sont sur 16 bits
+		inline bool possedeIndicesCourts() const;
+		/// Obtient le nombre d'octets occups par les donnes
+		std::size_t obtenirMemoire() const;
+
+		/// Obtient les sommets, conservs sans perte
+		inline Etendue<Vertex> obtenirSommets() const;
+		/// Obtient une face
+		Face obtenirFace(std::size_t indice) const;
+		/// Obtient une normale dcode
+		inline Normale obtenirNormale(std::size_t indice) const;
+		/// Obtient des coordonnes de texture dcodes
+		inline TexCoord obtenirTexCoord(std::size_t indice) const;
+		/// Obtient une couleur dcode
+		inline Couleur obtenirCouleur(std::size_t indice) const;
+		/// Obtient le matriau
+		inline Materiau const& obtenirMateriau() const;
+		/// Obtient le nom
+		inline std::string const& obtenirNom() const;
+
+		/// Vrifier si le mesh contient des normales
+		inline bool possedeNormales() const;
+		/// Vrifier si le mesh contient des coordonnes de texture
+		inline bool possedeTexCoords() const;
+		/// Vrifier si le mesh contient des couleurs de vertex
+		inline bool possedeCouleurs() const;
+
+		/// Encode une normale unitaire sur un octadre
+		static NormaleCompacte encoderNormale(Normale const& normale);
+		/// Dcode une normale projete sur un octadre
+		static Normale decoderNormale(NormaleCompacte normale);
+		/// Encode des coordonnes de texture en demi-flottants
+		static TexCoordCompacte encoderTexCoord(TexCoord const& texCoord);
+		/// Dcode des coordonnes de texture en demi-flottants
+		static TexCoord decoderTexCoord(TexCoordCompacte texCoord);
+		/// Encode une couleur en RGBA sur 8 bits
+		static CouleurCompacte encoderCouleur(Couleur const& couleur);
+		/// Dcode une couleur en RGBA sur 8 bits
+		static Couleur decoderCouleur(CouleurCompacte couleur);
+
+	private:
+		/// Les sommets
+		Conteneur<Vertex> sommets_;
+		/// Les indices des faces, lorsqu'ils tiennent sur 16 bits
+		Conteneur<std::uint16_t> indicesCourts_;
+		/// Les indices des faces, sinon
+		Conteneur<std::uint32_t> indicesLongs_;
+		/// Les normales
+		Conteneur<NormaleCompacte> normales_;
+		/// Les coordonnes de texture
+		Conteneur<TexCoordCompacte> texCoords_;
+		/// Les couleurs des sommets
+		Conteneur<CouleurCompacte> couleurs_;
+		/// Le matriau
+		Materiau materiau_;
+		/// Le nom
+		std::string nom_;
+	};
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t MeshCompact::Rapport::obtenirOctetsEconomises() const
+	///
+	/// Cette fonction retourne le nombre d'octets conomiss par la
+	/// reprsentation compacte.
+	///
+	/// @return Les octets conomiss, ou 0 s'il n'y en a aucun.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t MeshCompact::Rapport::obtenirOctetsEconomises() const
+	{
+		return octetsOriginaux > octetsCompacts ? octetsOriginaux - octetsCompacts : 0;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline MeshCompact::Rapport& MeshCompact::Rapport::operator+=(Rapport const& rapport)
+	///
+	/// Cette fonction cumule le rapport d'un autre mesh, par exemple pour
+	/// obtenir celui de tous les meshes d'un modle: les octets sont
+	/// additionns et les erreurs maximales conserves.
+	///
+	/// @param[in] rapport : Le rapport  cumuler
+	///
+	/// @return Le rapport courant.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline MeshCompact::Rapport& MeshCompact::Rapport::operator+=(Rapport const& rapport)
+	{
+		octetsOriginaux += rapport.octetsOriginaux;
+		octetsCompacts += rapport.octetsCompacts;
+		erreurNormales = erreurNormales < rapport.erreurNormales ? rapport.erreurNormales : erreurNormales;
+		erreurTexCoords = erreurTexCoords < rapport.erreurTexCoords ? rapport.erreurTexCoords : erreurTexCoords;
+		erreurCouleurs = erreurCouleurs < rapport.erreurCouleurs ? rapport.erreurCouleurs : erreurCouleurs;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t MeshCompact::obtenirNombreSommets() const
+	///
+	/// Cette fonction retourne le nombre de sommets du mesh.
+	///
+	/// @return Le nombre de sommets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t MeshCompact::obtenirNombreSommets() const
+	{
+		return sommets_.size();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t MeshCompact::obtenirNombreFaces() const
+	///
+	/// Cette fonction retourne le nombre de faces du mesh.
+	///
+	/// @return Le nombre de faces.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t MeshCompact::obtenirNombreFaces() const
+	{
+		return (indicesCourts_.size() + indicesLongs_.size()) / 3;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool MeshCompact::possedeIndicesCourts() const
+	///
+	/// Cette fonction indique si les indices des faces sont sur 16 bits.
+	///
+	/// @return Vrai si les indices sont sur 16 bits.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool MeshCompact::possedeIndicesCourts() const
+	{
+		return indicesLongs_.empty();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline MeshCompact::Etendue<MeshCompact::Vertex> MeshCompact::obtenirSommets() const
+	///
+	/// Cette fonction retourne les sommets du mesh, qui ne sont pas
+	/// quantifis.
+	///
+	/// @return L'tendue des sommets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline MeshCompact::Etendue<MeshCompact::Vertex> MeshCompact::obtenirSommets() const
+	{
+		return Etendue<Vertex>{ sommets_ };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline MeshCompact::Normale MeshCompact::obtenirNormale(std::size_t indice) const
+	///
+	/// Cette fonction retourne une normale du mesh, dcode.
+	///
+	/// @param[in] indice : L'indice du sommet.
+	///
+	/// @return La normale unitaire.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline MeshCompact::Normale MeshCompact::obtenirNormale(std::size_t indice) const
+	{
+		return decoderNormale(normales_[indice]);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline MeshCompact::TexCoord MeshCompact::obtenirTexCoord(std::size_t indice) const
+	///
+	/// Cette fonction retourne les coordonnes de texture d'un sommet du
+	/// mesh, dcodes.
+	///
+	/// @param[in] indice : L'indice du sommet.
+	///
+	/// @return Les coordonnes de texture.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline MeshCompact::TexCoord MeshCompact::obtenirTexCoord(std::size_t indice) const
+	{
+		return decoderTexCoord(texCoords_[indice]);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline MeshCompact::Couleur MeshCompact::obtenirCouleur(std::size_t indice) const
+	///
+	/// Cette fonction retourne la couleur d'un sommet du mesh, dcode.
+	///
+	/// @param[in] indice : L'indice du sommet.
+	///
+	/// @return La couleur.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline MeshCompact::Couleur MeshCompact::obtenirCouleur(std::size_t indice) const
+	{
+		return decoderCouleur(couleurs_[indice]);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline Materiau const& MeshCompact::obtenirMateriau() const
+	///
+	/// Cette fonction retourne le matriau du mesh.
+	///
+	/// @return Le matriau.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline Materiau const& MeshCompact::obtenirMateriau() const
+	{
+		return materiau_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::string const& MeshCompact::obtenirNom() const
+	///
+	/// Cette fonction retourne le nom du mesh.
+	///
+	/// @return Le nom.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::string const& MeshCompact::obtenirNom() const
+	{
+		return nom_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool MeshCompact::possedeNormales() const
+	///
+	/// Cette fonction indique si le mesh contient des normales.
+	///
+	/// @return Vrai si le mesh contient des normales.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool MeshCompact::possedeNormales() const
+	{
+		return !normales_.empty();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool MeshCompact::possedeTexCoords() const
+	///
+	/// Cette fonction indique si le mesh contient des coordonnes de
+	/// texture.
+	///
+	/// @return Vrai si le mesh contient des coordonnes de texture.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool MeshCompact::possedeTexCoords() const
+	{
+		return !texCoords_.empty();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool MeshCompact::possedeCouleurs() const
+	///
+	/// Cette fonction indique si le mesh contient des couleurs de vertex.
+	///
+	/// @return Vrai si le mesh contient des couleurs de vertex.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool MeshCompact::possedeCouleurs() const
+	{
+		return !couleurs_.empty();
+	}
+
+} /// fin de modele
+
+#endif /// __RENDERING_MESHCOMPACT_H__
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
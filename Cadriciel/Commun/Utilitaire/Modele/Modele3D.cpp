@@ -8,6 +8,7 @@
 /// @{
 ///////////////////////////////////////////////////////////////////////////////
 #include "Modele3D.h"
+#include "CacheModele.h"
 
 #include "GL/glew.h"
 #include "utilitaire.h"		// Afficher les erreurs dans un message box
@@ -19,6 +20,28 @@
 
 namespace modele{
 
+	/// Drapeaux de post-traitement de l'importation "assimp".  Le flag
+	/// aiProcess_Triangulate, inclus dans aiProcessPreset_TargetRealtime_Quality,
+	/// fera en sorte que les mesh ne comporteront que des triangles.
+	static const unsigned int DRAPEAUX_IMPORTATION{ aiProcessPreset_TargetRealtime_Quality };
+
+	/// Primitives retires lors de l'importation : les lignes et les points.
+	static const int PRIMITIVES_RETIREES{ aiPrimitiveType_LINE | aiPrimitiveType_POINT };
+
+	/// Drapeaux identifiant l'importation dans le cache des modles.  Ils
+	/// doivent changer avec tout paramtre de l'importateur qui modifie le
+	/// rsultat de l'importation.
+	static const std::uint64_t DRAPEAUX_CACHE{
+		(static_cast<std::uint64_t>(PRIMITIVES_RETIREES) << 32) | DRAPEAUX_IMPORTATION };
+
+	/// Drapeau ajout aux drapeaux du cache lorsque les meshes sont
+	/// optimiss, pour qu'un cache non optimis ne soit pas lu, et
+	/// inversement.
+	static const std::uint64_t DRAPEAU_OPTIMISATION{ static_cast<std::uint64_t>(1) << 63 };
+
+	/// Les meshes imports sont optimiss par dfaut.
+	bool Modele3D::optimisationMeshes_{ true };
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn Modele3D::Modele3D(Modele3D && modele)
@@ -52,6 +75,10 @@ namespace modele{
 			mapTextures_ = std::move(modele.mapTextures_);
 			racine_ = std::move(modele.racine_);
 			cheminFichier_ = std::move(modele.cheminFichier_);
+			arbreTriangles_ = std::move(modele.arbreTriangles_);
+			memoireTextures_ = modele.memoireTextures_;
+			modele.memoireTextures_ = 0;
+			rapportOptimisation_ = modele.rapportOptimisation_;
 		}
 		return *this;
 	}
@@ -70,13 +97,64 @@ namespace modele{
 		libererTextures();
 	}
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::uint64_t Modele3D::obtenirDrapeauxImportation()
+	///
+	/// Cette fonction retourne les drapeaux qui identifient l'importation:
+	/// deux modles imports du mme fichier avec les mmes drapeaux sont
+	/// identiques.
+	///
+	/// @return Les drapeaux d'importation.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::uint64_t Modele3D::obtenirDrapeauxImportation()
+	{
+		return optimisationMeshes_ ? DRAPEAUX_CACHE | DRAPEAU_OPTIMISATION : DRAPEAUX_CACHE;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void Modele3D::assignerOptimisationMeshes(bool optimisation)
+	///
+	/// Cette fonction active ou dsactive l'optimisation des meshes
+	/// imports par 'assimp' (voir OptimiseurMesh).  Elle ne doit pas tre
+	/// appele pendant un chargement.  Les modles dj chargs ne sont
+	/// pas modifis.
+	///
+	/// @param[in] optimisation : Vrai pour optimiser les meshes imports
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void Modele3D::assignerOptimisationMeshes(bool optimisation)
+	{
+		optimisationMeshes_ = optimisation;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool Modele3D::obtenirOptimisationMeshes()
+	///
+	/// Cette fonction vrifie si les meshes imports par 'assimp' sont
+	/// optimiss.
+	///
+	/// @return Vrai si les meshes imports sont optimiss.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool Modele3D::obtenirOptimisationMeshes()
+	{
+		return optimisationMeshes_;
+	}
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn void Modele3D::charger(Path cheminFichier)
 	///
 	/// Cette fonction charge un modle 3D  partir d'un fichier support
 	/// par la librairie 'assimp'. Les textures OpenGL affrentes sont
-	/// galement charges.
+	/// galement charges.  Elle enchane importer() et chargerTextures()
+	/// et doit donc tre appele sur le fil OpenGL.
 	///
 	/// @param[in] nomFichier : nom du fichier modle (normalement .obj
 	///	ou .dae)
@@ -90,39 +168,100 @@ namespace modele{
 		if (cheminFichier_ == cheminFichier)
 			return;
 
+		importer(std::move(cheminFichier));
+		chargerTextures();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool Modele3D::importer(Path cheminFichier)
+	///
+	/// Cette fonction importe la gomtrie d'un modle 3D et relve le nom
+	/// de ses textures, sans faire aucun appel OpenGL.  Elle peut donc
+	/// s'excuter sur un fil de travail, pourvu que le modle ne soit pas
+	/// utilis ailleurs pendant ce temps.  Les textures sont ensuite
+	/// charges par chargerTextures(), sur le fil OpenGL.
+	///
+	/// Les meshes imports par 'assimp' sont optimiss pour la carte
+	/// graphique,  moins que l'optimisation ne soit dsactive (voir
+	/// assignerOptimisationMeshes()).
+	///
+	/// Le rsultat de la premire importation est conserv dans le cache
+	/// des modles (voir CacheModele).  Les chargements suivants lisent le
+	/// cache, projet en mmoire, tant que le fichier et les drapeaux
+	/// d'importation n'ont pas chang.  Les meshes lus du cache sont
+	/// eux-mmes projets: leurs sommets et leurs faces ne sont pas copis
+	/// et le cache reste ouvert tant que le modle est charg.
+	///
+	/// @param[in] nomFichier : nom du fichier modle (normalement .obj
+	///	ou .dae)
+	///
+	/// @return Faux si le fichier n'a pu tre import.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool Modele3D::importer(Path cheminFichier)
+	{
 		cheminFichier_ = std::move(cheminFichier);
 
-		/// Ne pas conserver les identifiants de texture d'un ancien modle
-		libererTextures();
+		/// Ne pas conserver les textures d'un ancien modle.  Leurs
+		/// identifiants OpenGL sont relchs par chargerTextures().
+		mapTextures_.clear();
+		rapportOptimisation_ = OptimiseurMesh::Rapport{};
 
-		Assimp::Importer importer;
+		/// Utiliser le cache s'il correspond toujours au fichier
+		const Path cheminCache{ CacheModele::obtenirChemin(cheminFichier_) };
+		std::vector<std::string> textures;
+		const std::uint64_t drapeaux{ obtenirDrapeauxImportation() };
+		if (CacheModele::lire(cheminCache, cheminFichier_, drapeaux, racine_, textures, true)) {
+			for (std::string const& texture : textures)
+				mapTextures_[texture] = nullptr;
+		}
+		else {
+			Assimp::Importer importer;
 
-		/// Lors de l'importation, ne pas conserver les lignes et les points.
-		importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_LINE | aiPrimitiveType_POINT);
+			/// Lors de l'importation, ne pas conserver les lignes et les points.
+			importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, PRIMITIVES_RETIREES);
 
-		/// Le flag aiProcess_Triangulate, inclus dans aiProcessPreset_TargetRealtime_Quality,
-		/// fera en sorte que les mesh ne comporteront que des triangles.
-		const aiScene* scene{ importer.ReadFile(cheminFichier_, aiProcessPreset_TargetRealtime_Quality) };
+			const aiScene* scene{ importer.ReadFile(cheminFichier_, DRAPEAUX_IMPORTATION) };
 
-		if (scene == nullptr) {
-			utilitaire::afficherErreur(std::string{ "Impossible de charger l'objet 3d : " } +cheminFichier.filename() + std::string{ "." });
-			return;
-		}
+			if (scene == nullptr) {
+				utilitaire::afficherErreur(std::string{ "Impossible de charger l'objet 3d : " } +cheminFichier_.filename() + std::string{ "." });
+				return false;
+			}
+
+			/// Relever l'ensemble des textures contenues dans le modle :
+			chargerTexturesExternes(scene);
+			chargerTexturesIntegrees(scene);
 
-		/// Charger l'ensemble des textures contenues dans le modle :
-		chargerTexturesExternes(scene);
-		chargerTexturesIntegrees(scene);
+			/// Chargement des donnes du modle 3D
+			racine_ = Noeud{ scene, scene->mRootNode };
 
-		/// Chargement des donnes du modle 3D
-		racine_ = Noeud{ scene, scene->mRootNode };
+			/// Optimiser les meshes avant de les conserver dans le cache
+			if ((drapeaux & DRAPEAU_OPTIMISATION) != 0)
+				racine_ = OptimiseurMesh::optimiser(racine_, &rapportOptimisation_);
+
+			/// Les textures intgres ne sont pas conserves dans le cache :
+			/// un tel modle est toujours import.
+			if (!scene->HasTextures()) {
+				for (auto const& texture : mapTextures_)
+					textures.push_back(texture.first);
+				CacheModele::ecrire(cheminCache, cheminFichier_, drapeaux, racine_, textures);
+			}
+		}
+
+		/// Les triangles ne changent plus : la hirarchie servant aux
+		/// collisions est construite une seule fois, ici.
+		arbreTriangles_.construire(racine_);
+		return true;
 	}
 
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn void Modele3D::chargerTexturesExternes()
 	///
-	/// Cette fonction charge les textures OpenGL associes au modle
-	/// 'assimp' pralablement charg,  partir des fichiers de textures.
+	/// Cette fonction relve les noms des fichiers de textures associs au
+	/// modle 'assimp' pralablement charg.  Les textures OpenGL sont
+	/// cres plus tard par chargerTextures().
 	///
 	/// @return Aucune.
 	///
@@ -158,7 +297,24 @@ namespace modele{
 				idTexture++;
 			}
 		}
-		// Pour chaque texture trouve, procder au chargement
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void Modele3D::chargerTextures()
+	///
+	/// Cette fonction gnre les textures OpenGL et charge les fichiers de
+	/// textures dont les noms ont t placs dans mapTextures_ par
+	/// importer(), que ce soit  partir de la scne 'assimp' ou du cache
+	/// des modles.  Les textures d'un modle import prcdemment sont
+	/// d'abord relches.  Elle doit tre appele sur le fil OpenGL.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void Modele3D::chargerTextures()
+	{
+		libererTextures();
 
 		// Nombre de textures
 		unsigned int nombreTextures{ static_cast<unsigned int>(mapTextures_.size()) };
@@ -179,6 +335,15 @@ namespace modele{
 
 				// Charger la texture
 				aidegl::glLoadTexture(std::string{ "media/" } +nomFichier, identificateursTextures_[j], false);
+
+				// Mesurer la texture, cre en 32 bits par pixel avec ses
+				// mipmaps (un tiers de plus que le premier niveau)
+				GLint largeur{ 0 }, hauteur{ 0 };
+				glBindTexture(GL_TEXTURE_2D, identificateursTextures_[j]);
+				glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &largeur);
+				glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &hauteur);
+				const std::size_t memoireNiveau{ static_cast<std::size_t>(largeur) * static_cast<std::size_t>(hauteur) * 4 };
+				memoireTextures_ += memoireNiveau + memoireNiveau / 3;
 			}
 		}
 	}
@@ -204,8 +369,9 @@ namespace modele{
 	///
 	/// @fn void Modele3D::libererTextures()
 	///
-	/// Cette fonction libre les textures de la mmoire de la carte graphique
-	/// et vide les conteneurs conservant les handles.
+	/// Cette fonction libre les textures de la mmoire de la carte graphique.
+	/// Les noms des textures sont conservs, pour que chargerTextures() leur
+	/// associe de nouveaux identifiants.
 	///
 	/// @return Aucune.
 	///
@@ -218,10 +384,7 @@ namespace modele{
 			glDeleteTextures(static_cast<GLsizei>(identificateursTextures_.size()), &identificateursTextures_[0]);
 			identificateursTextures_.clear();
 		}
-		if (!mapTextures_.empty())
-		{
-			mapTextures_.clear();
-		}
+		memoireTextures_ = 0;
 	}
 
 } /// fin de rendering
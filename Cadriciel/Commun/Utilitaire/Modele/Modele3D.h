@@ -11,11 +11,14 @@
 #ifndef __RENDERING_MODELE3D_H__
 #define __RENDERING_MODELE3D_H__
 
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <string>
 #include <filesystem>	/// std::tr2::sys::path
 #include "Noeud.h"
+#include "ArbreTriangles.h"
+#include "OptimiseurMesh.h"
 #include "Utilitaire.h"
 
 struct aiScene;			/// Dclaration avance de Assimp
@@ -35,6 +38,15 @@ namespace modele{
 	/// puisqu'OpenGL offre plusieurs mthodes de chargement des donnes sur la
 	/// carte graphique et de dessin.
 	///
+	/// @note Le chargement se fait en deux tapes: importer() ne fait aucun
+	/// appel OpenGL et peut donc s'excuter sur un fil de travail (voir
+	/// ChargeurModeles), alors que chargerTextures() doit s'excuter sur le
+	/// fil qui possde le contexte OpenGL.
+	///
+	/// @note Les meshes imports par 'assimp' sont optimiss pour la carte
+	/// graphique (voir OptimiseurMesh) avant d'tre conservs dans le
+	/// cache,  moins que l'optimisation ne soit dsactive.
+	///
 	///
 	/// @author Martin Paradis
 	/// @date 2014-08-16
@@ -61,6 +73,10 @@ namespace modele{
 
 		/// Charger le modle 3d  partir d'un fichier
 		void charger(Path nomFichier);
+		/// Importer le modle 3d  partir d'un fichier, sans appel OpenGL
+		bool importer(Path nomFichier);
+		/// Charger les textures du modle import vers la mmoire gpu
+		void chargerTextures();
 		
 		/// Permet de vrifier si la texture existe pour ce modle
 		inline bool possedeTexture(std::string const& nomTexture) const;
@@ -74,8 +90,25 @@ namespace modele{
 		/// Mthode d'obtention du chemin du fichier charg
 		inline Path const& obtenirCheminFichier() const;
 
+		/// Mthode d'obtention de la hirarchie des triangles, pour les collisions
+		inline ArbreTriangles const& obtenirArbreTriangles() const;
+
+		/// Mthode d'obtention de la mmoire gpu occupe par les textures
+		inline std::size_t obtenirMemoireTextures() const;
+
+		/// Mthode d'obtention du rapport d'optimisation des meshes
+		inline OptimiseurMesh::Rapport const& obtenirRapportOptimisation() const;
+
+		/// Mthode d'obtention des drapeaux qui identifient l'importation
+		static std::uint64_t obtenirDrapeauxImportation();
+
+		/// Active ou dsactive l'optimisation des meshes imports
+		static void assignerOptimisationMeshes(bool optimisation);
+		/// Vrifie si les meshes imports sont optimiss
+		static bool obtenirOptimisationMeshes();
+
 	private:
-		/// Permet de charger les textures du modle vers en mmoire gpu
+		/// Permet de relever les textures du modle, charges ensuite par chargerTextures()
 		void chargerTexturesExternes (aiScene const* scene);	///  partir d'un fichier externe (jpg, bmp, png, etc.)
 		void chargerTexturesIntegrees(aiScene const* scene);	/// Contenues directement dans le fichier du modle
 		/// Permet de librer les textures du modle de la mmoire de la carte graphique
@@ -92,6 +125,18 @@ namespace modele{
 
 		/// Chemin du fichier
 		Path cheminFichier_;
+
+		/// Hirarchie des triangles, construite une fois au chargement
+		ArbreTriangles arbreTriangles_;
+
+		/// Mmoire gpu occupe par les textures, en octets
+		std::size_t memoireTextures_{ 0 };
+
+		/// Rapport de l'optimisation des meshes, faite  l'importation
+		OptimiseurMesh::Rapport rapportOptimisation_;
+
+		/// Optimisation des meshes imports, commune  tous les modles
+		static bool optimisationMeshes_;
 	};
 
 	////////////////////////////////////////////////////////////////////////
@@ -162,6 +207,55 @@ namespace modele{
 		return cheminFichier_;
 	}
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline ArbreTriangles const& Modele3D::obtenirArbreTriangles() const
+	///
+	/// Cette fonction permet de rcuprer la hirarchie des triangles du
+	/// modle, construite au chargement, pour calculer les collisions
+	/// contre sa gomtrie.
+	///
+	/// @return La hirarchie des triangles du modle.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline ArbreTriangles const& Modele3D::obtenirArbreTriangles() const
+	{
+		return arbreTriangles_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t Modele3D::obtenirMemoireTextures() const
+	///
+	/// Cette fonction permet de rcuprer la mmoire de la carte graphique
+	/// occupe par les textures du modle, mipmaps comprises, telle que
+	/// mesure par chargerTextures().
+	///
+	/// @return La mmoire des textures, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t Modele3D::obtenirMemoireTextures() const
+	{
+		return memoireTextures_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline OptimiseurMesh::Rapport const& Modele3D::obtenirRapportOptimisation() const
+	///
+	/// Cette fonction permet de rcuprer l'efficacit de la cache des
+	/// sommets avant et aprs l'optimisation des meshes.  Le rapport n'est
+	/// rempli que si le modle vient d'tre import par 'assimp': un modle
+	/// lu du cache est dj optimis.
+	///
+	/// @return Le rapport d'optimisation.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline OptimiseurMesh::Rapport const& Modele3D::obtenirRapportOptimisation() const
+	{
+		return rapportOptimisation_;
+	}
+
 } /// fin de rendering
 
 #endif /// __RENDERING_MODELE3D_H__
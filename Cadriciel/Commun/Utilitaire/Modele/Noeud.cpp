@@ -56,6 +56,30 @@ namespace modele{
 		}
 	}
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Noeud::Noeud(std::string nom, glm::mat4x4 const& transformation, Conteneur<Mesh> meshes, Conteneur<Noeud> enfants)
+	///
+	/// Construit un noeud  partir de meshes et de noeuds enfants dj
+	/// construits, par exemple lus du cache des modles.
+	///
+	/// @param[in] nom            : Le nom du noeud
+	/// @param[in] transformation : La transformation du noeud
+	/// @param[in] meshes         : Les meshes du noeud
+	/// @param[in] enfants        : Les noeuds enfants
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	Noeud::Noeud(std::string nom, glm::mat4x4 const& transformation,
+		Conteneur<Mesh> meshes, Conteneur<Noeud> enfants)
+		: meshes_{ std::move(meshes) }
+		, enfants_{ std::move(enfants) }
+		, transform_(transformation)
+		, nom_{ std::move(nom) }
+	{
+	}
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn Noeud::Noeud(Noeud && noeud)
@@ -37,6 +37,9 @@ namespace modele{
 		Noeud() = default;
 		/// Constructeur  partir d'une scne et d'un noeud assimp
 		Noeud(aiScene const* scene, aiNode const* noeud);
+		/// Constructeur  partir de meshes et de noeuds enfants
+		Noeud(std::string nom, glm::mat4x4 const& transformation,
+			Conteneur<Mesh> meshes, Conteneur<Noeud> enfants);
 		/// Constructeur par transfert ("Move")
 		Noeud(Noeud && noeud);
 		/// Assignation par transfert ("move")
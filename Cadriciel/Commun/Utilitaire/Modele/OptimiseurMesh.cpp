@@ -0,0 +1,559 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file OptimiseurMesh.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#include "OptimiseurMesh.h"
+
+#include <algorithm>
+
+#include "glm/glm.hpp"
+
+namespace modele{
+
+	const unsigned int OptimiseurMesh::TAILLE_CACHE;
+
+	/// Tolrance sur l'ACMR d'une grappe de faces, par rapport  celui de
+	/// la grappe d'origine, lors du dcoupage pour le surdessin.  Plus elle
+	/// est grande, plus les grappes sont petites et mieux elles sont
+	/// tries, au prix d'une cache moins efficace.
+	static const double SEUIL_SURDESSIN{ 1.05 };
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @class CacheSommets
+	/// @brief Simulation d'une cache FIFO de sommets transforms.
+	///
+	///		   Chaque sommet reoit l'horodatage de sa dernire entre dans
+	///		   la cache: il y est toujours si moins de 'taille' sommets y sont
+	///		   entrs depuis.
+	///
+	////////////////////////////////////////////////////////////////////////
+	class CacheSommets{
+	public:
+		/// Constructeur  partir du nombre de sommets et de la taille de la cache
+		CacheSommets(std::size_t nombreSommets, unsigned int taille)
+			: horodatages_(nombreSommets, 0), horloge_{ taille + 1u }, taille_{ taille }
+		{}
+
+		/// Vrifie si un sommet est dans la cache
+		bool contient(int sommet) const
+		{
+			return horloge_ - horodatages_[sommet] <= taille_;
+		}
+
+		/// Transforme un sommet et retourne vrai s'il n'tait pas dans la cache
+		bool transformer(int sommet)
+		{
+			if (contient(sommet))
+				return false;
+			horodatages_[sommet] = horloge_++;
+			return true;
+		}
+
+		/// Transforme les sommets d'une face et retourne le nombre d'checs
+		unsigned int transformer(Mesh::Face const& face)
+		{
+			unsigned int echecs{ 0 };
+			for (glm::length_t i{ 0 }; i < face.length(); ++i)
+				echecs += transformer(face[i]) ? 1 : 0;
+			return echecs;
+		}
+
+		/// Vide la cache
+		void vider()
+		{
+			horloge_ += taille_ + 1;
+		}
+
+		/// Obtient l'horloge, soit le nombre de sommets entrs dans la cache
+		std::size_t obtenirHorloge() const
+		{
+			return horloge_;
+		}
+
+		/// Obtient l'horodatage d'un sommet
+		std::size_t obtenirHorodatage(int sommet) const
+		{
+			return horodatages_[sommet];
+		}
+
+	private:
+		/// Horodatage de la dernire entre de chaque sommet dans la cache
+		std::vector<std::size_t> horodatages_;
+		/// Horloge, incrmente  chaque entre dans la cache
+		std::size_t horloge_;
+		/// Nombre de sommets que contient la cache
+		unsigned int taille_;
+	};
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool indicesValides(Mesh::Etendue<Mesh::Face> faces, std::size_t nombreSommets)
+	///
+	/// Cette fonction vrifie que toutes les faces dsignent des sommets
+	/// existants.
+	///
+	/// @param[in] faces         : Les faces
+	/// @param[in] nombreSommets : Le nombre de sommets
+	///
+	/// @return Vrai si tous les indices sont valides.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static bool indicesValides(Mesh::Etendue<Mesh::Face> faces, std::size_t nombreSommets)
+	{
+		for (Mesh::Face const& face : faces) {
+			for (glm::length_t i{ 0 }; i < face.length(); ++i) {
+				if (face[i] < 0 || static_cast<std::size_t>(face[i]) >= nombreSommets)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static std::vector<T> copier(Mesh::Etendue<T> source)
+	///
+	/// Cette fonction copie les lments d'une tendue dans un vecteur.
+	///
+	/// @param[in] source : Les lments  copier
+	///
+	/// @return Le vecteur.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	static std::vector<T> copier(Mesh::Etendue<T> source)
+	{
+		return std::vector<T>(source.begin(), source.end());
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static std::vector<T> permuter(Mesh::Etendue<T> source, std::vector<int> const& renumerotation)
+	///
+	/// Cette fonction copie les attributs des sommets  leur nouvelle
+	/// position.
+	///
+	/// @param[in] source         : Les attributs, vide ou un par sommet
+	/// @param[in] renumerotation : La nouvelle position de chaque sommet
+	///
+	/// @return Les attributs permuts.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	static std::vector<T> permuter(Mesh::Etendue<T> source, std::vector<int> const& renumerotation)
+	{
+		std::vector<T> resultat(source.size());
+		for (std::size_t i{ 0 }; i < source.size(); ++i)
+			resultat[renumerotation[i]] = source[i];
+		return resultat;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static int sauterImpasse(std::vector<std::size_t> const& vivants, std::vector<int>& impasses, std::size_t& curseur)
+	///
+	/// Cette fonction choisit le prochain sommet pivot de "Tipsify" lorsque
+	/// aucun sommet du dernier ventail ne convient: le plus rcent sommet
+	/// utilis qui a encore des faces  mettre, ou  dfaut le prochain
+	/// sommet, dans l'ordre, qui en a.
+	///
+	/// @param[in]     vivants  : Le nombre de faces  mettre de chaque sommet
+	/// @param[in,out] impasses : La pile des sommets utiliss
+	/// @param[in,out] curseur  : Le premier sommet qui peut avoir des faces  mettre
+	///
+	/// @return Le prochain pivot, ou -1 si toutes les faces sont mises.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static int sauterImpasse(std::vector<std::size_t> const& vivants,
+		std::vector<int>& impasses, std::size_t& curseur)
+	{
+		while (!impasses.empty()) {
+			const int sommet{ impasses.back() };
+			impasses.pop_back();
+			if (vivants[sommet] > 0)
+				return sommet;
+		}
+
+		for (; curseur < vivants.size(); ++curseur) {
+			if (vivants[curseur] > 0)
+				return static_cast<int>(curseur);
+		}
+		return -1;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Mesh OptimiseurMesh::optimiser(Mesh const& mesh, Rapport* rapport)
+	///
+	/// Cette fonction retourne une copie optimise d'un mesh: ses faces
+	/// sont ordonnes pour la cache des sommets, puis pour le surdessin, et
+	/// ses sommets renumrots dans l'ordre de leur premire utilisation.
+	/// Les attributs des sommets suivent leur renumrotation, de sorte que
+	/// le mesh dessine exactement les mmes triangles.
+	///
+	/// Le mesh est copi tel quel si ses indices sont invalides ou si
+	/// l'optimisation n'amliore pas l'efficacit de la cache, par exemple
+	/// s'il est dj optimis.
+	///
+	/// @param[in]     mesh    : Le mesh  optimiser
+	/// @param[in,out] rapport : Le rapport auquel ajouter les statistiques
+	///                          du mesh, s'il est non nul
+	///
+	/// @return Le mesh optimis.
+	///
+	////////////////////////////////////////////////////////////////////////
+	Mesh OptimiseurMesh::optimiser(Mesh const& mesh, Rapport* rapport)
+	{
+		const Mesh::Etendue<Face> faces{ mesh.obtenirFaces() };
+		const Mesh::Etendue<Vertex> sommets{ mesh.obtenirSommets() };
+		const Statistiques avant{ mesurer(faces) };
+
+		if (indicesValides(faces, sommets.size())) {
+			std::vector<Face> ordonnees{ ordonnerCache(faces, sommets.size(), TAILLE_CACHE) };
+			ordonnerSurdessin(ordonnees, sommets, TAILLE_CACHE);
+
+			/// La renumrotation ne change pas l'ordre des faces, ni donc
+			/// l'efficacit de la cache
+			const Statistiques apres{ mesurer(ordonnees) };
+			if (apres.echecs < avant.echecs) {
+				const std::vector<int> renumerotation{ ordonnerLecture(ordonnees, sommets.size()) };
+				if (rapport != nullptr) {
+					rapport->avant += avant;
+					rapport->apres += apres;
+				}
+				return Mesh{
+					permuter(sommets, renumerotation),
+					permuter(mesh.obtenirNormales(), renumerotation),
+					permuter(mesh.obtenirTexCoords(), renumerotation),
+					permuter(mesh.obtenirCouleurs(), renumerotation),
+					std::move(ordonnees), mesh.obtenirMateriau(), mesh.obtenirNom() };
+			}
+		}
+
+		if (rapport != nullptr) {
+			rapport->avant += avant;
+			rapport->apres += avant;
+		}
+		return Mesh{
+			copier(sommets), copier(mesh.obtenirNormales()),
+			copier(mesh.obtenirTexCoords()), copier(mesh.obtenirCouleurs()),
+			copier(faces), mesh.obtenirMateriau(), mesh.obtenirNom() };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Noeud OptimiseurMesh::optimiser(Noeud const& noeud, Rapport* rapport)
+	///
+	/// Cette fonction retourne une copie d'un noeud et de ses enfants dont
+	/// tous les meshes sont optimiss (voir optimiser(Mesh const&)).
+	///
+	/// @param[in]     noeud   : Le noeud  optimiser
+	/// @param[in,out] rapport : Le rapport auquel ajouter les statistiques
+	///                          des meshes, s'il est non nul
+	///
+	/// @return Le noeud optimis.
+	///
+	////////////////////////////////////////////////////////////////////////
+	Noeud OptimiseurMesh::optimiser(Noeud const& noeud, Rapport* rapport)
+	{
+		Noeud::Conteneur<Mesh> meshes;
+		meshes.reserve(noeud.obtenirMeshes().size());
+		for (Mesh const& mesh : noeud.obtenirMeshes())
+			meshes.push_back(optimiser(mesh, rapport));
+
+		Noeud::Conteneur<Noeud> enfants;
+		enfants.reserve(noeud.obtenirEnfants().size());
+		for (Noeud const& enfant : noeud.obtenirEnfants())
+			enfants.push_back(optimiser(enfant, rapport));
+
+		return Noeud{ noeud.obtenirNom(), noeud.obtenirTransformation(),
+			std::move(meshes), std::move(enfants) };
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn OptimiseurMesh::Statistiques OptimiseurMesh::mesurer(Mesh::Etendue<Face> faces, unsigned int tailleCache)
+	///
+	/// Cette fonction simule le dessin des faces, dans l'ordre, avec une
+	/// cache FIFO de sommets transforms initialement vide.
+	///
+	/// @param[in] faces       : Les faces, dans l'ordre du dessin
+	/// @param[in] tailleCache : Le nombre de sommets de la cache
+	///
+	/// @return Les statistiques de la cache.
+	///
+	////////////////////////////////////////////////////////////////////////
+	OptimiseurMesh::Statistiques OptimiseurMesh::mesurer(Mesh::Etendue<Face> faces,
+		unsigned int tailleCache)
+	{
+		int indiceMaximal{ -1 };
+		for (Face const& face : faces)
+			indiceMaximal = std::max(indiceMaximal, std::max(face.x, std::max(face.y, face.z)));
+
+		Statistiques statistiques;
+		statistiques.triangles = faces.size();
+
+		const std::size_t nombreSommets{ static_cast<std::size_t>(indiceMaximal + 1) };
+		if (!indicesValides(faces, nombreSommets))
+			return statistiques;
+
+		CacheSommets cache{ nombreSommets, tailleCache };
+		std::vector<char> utilises(nombreSommets, 0);
+		for (Face const& face : faces) {
+			statistiques.echecs += cache.transformer(face);
+			for (glm::length_t i{ 0 }; i < face.length(); ++i)
+				utilises[face[i]] = 1;
+		}
+		statistiques.sommets = static_cast<std::size_t>(std::count(utilises.begin(), utilises.end(), 1));
+		return statistiques;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::vector<OptimiseurMesh::Face> OptimiseurMesh::ordonnerCache(Mesh::Etendue<Face> faces, std::size_t nombreSommets, unsigned int tailleCache)
+	///
+	/// Cette fonction ordonne les faces pour la cache des sommets selon
+	/// l'algorithme "Tipsify".  Les faces sont mises en ventails autour
+	/// d'un sommet pivot; le pivot suivant est choisi parmi les sommets de
+	/// l'ventail qui seront encore dans la cache une fois leurs propres
+	/// faces mises, en privilgiant le plus ancien.  Le temps de calcul
+	/// est linaire.
+	///
+	/// @param[in] faces         : Les faces  ordonner, aux indices valides
+	/// @param[in] nombreSommets : Le nombre de sommets
+	/// @param[in] tailleCache   : Le nombre de sommets de la cache
+	///
+	/// @return Les faces ordonnes.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::vector<OptimiseurMesh::Face> OptimiseurMesh::ordonnerCache(Mesh::Etendue<Face> faces,
+		std::size_t nombreSommets, unsigned int tailleCache)
+	{
+		/// Faces adjacentes  chaque sommet, ranges conscutivement
+		std::vector<std::size_t> debuts(nombreSommets + 1, 0);
+		for (Face const& face : faces) {
+			for (glm::length_t i{ 0 }; i < face.length(); ++i)
+				++debuts[face[i] + 1];
+		}
+		for (std::size_t sommet{ 0 }; sommet < nombreSommets; ++sommet)
+			debuts[sommet + 1] += debuts[sommet];
+
+		std::vector<std::size_t> adjacence(debuts.back());
+		std::vector<std::size_t> positions(debuts.begin(), debuts.end() - 1);
+		for (std::size_t indiceFace{ 0 }; indiceFace < faces.size(); ++indiceFace) {
+			for (glm::length_t i{ 0 }; i < faces[indiceFace].length(); ++i)
+				adjacence[positions[faces[indiceFace][i]]++] = indiceFace;
+		}
+
+		/// Nombre de faces encore  mettre de chaque sommet
+		std::vector<std::size_t> vivants(nombreSommets);
+		for (std::size_t sommet{ 0 }; sommet < nombreSommets; ++sommet)
+			vivants[sommet] = debuts[sommet + 1] - debuts[sommet];
+
+		CacheSommets cache{ nombreSommets, tailleCache };
+		std::vector<char> emises(faces.size(), 0);
+		std::vector<int> impasses;
+		std::vector<int> candidats;
+		std::size_t curseur{ 0 };
+
+		std::vector<Face> resultat;
+		resultat.reserve(faces.size());
+
+		int pivot{ sauterImpasse(vivants, impasses, curseur) };
+		while (pivot >= 0) {
+			/// mettre l'ventail du pivot
+			candidats.clear();
+			for (std::size_t k{ debuts[pivot] }; k < debuts[pivot + 1]; ++k) {
+				const std::size_t indiceFace{ adjacence[k] };
+				if (emises[indiceFace])
+					continue;
+
+				Face const& face{ faces[indiceFace] };
+				for (glm::length_t i{ 0 }; i < face.length(); ++i) {
+					impasses.push_back(face[i]);
+					candidats.push_back(face[i]);
+					--vivants[face[i]];
+					cache.transformer(face[i]);
+				}
+				emises[indiceFace] = 1;
+				resultat.push_back(face);
+			}
+
+			/// Choisir le plus ancien candidat qui restera dans la cache
+			/// pendant l'mission de son ventail
+			int suivant{ -1 };
+			std::size_t meilleurAge{ 0 };
+			for (int candidat : candidats) {
+				if (vivants[candidat] == 0)
+					continue;
+
+				const std::size_t age{ cache.obtenirHorloge() - cache.obtenirHorodatage(candidat) };
+				if (age + 2 * vivants[candidat] <= tailleCache && age > meilleurAge) {
+					meilleurAge = age;
+					suivant = candidat;
+				}
+			}
+
+			pivot = suivant >= 0 ? suivant : sauterImpasse(vivants, impasses, curseur);
+		}
+
+		return resultat;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void OptimiseurMesh::ordonnerSurdessin(std::vector<Face>& faces, Mesh::Etendue<Vertex> sommets, unsigned int tailleCache)
+	///
+	/// Cette fonction rordonne des faces dj ordonnes pour la cache afin
+	/// de rduire le surdessin.  Les faces sont d'abord dcoupes en
+	/// grappes: une grappe commence l o la cache repart de zro (trois
+	/// checs sur une mme face), puis est redcoupe ds que l'ACMR de son
+	/// dbut reste prs de celui de la grappe entire.  Les grappes sont
+	/// ensuite tries de celle qui fait le plus face  l'extrieur du mesh,
+	/// donc la plus susceptible d'en cacher d'autres,  celle qui y fait le
+	/// moins.  L'ordre  l'intrieur d'une grappe est conserv.
+	///
+	/// @param[in,out] faces       : Les faces  rordonner, aux indices valides
+	/// @param[in]     sommets     : Les sommets du mesh
+	/// @param[in]     tailleCache : Le nombre de sommets de la cache
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void OptimiseurMesh::ordonnerSurdessin(std::vector<Face>& faces,
+		Mesh::Etendue<Vertex> sommets, unsigned int tailleCache)
+	{
+		if (faces.empty())
+			return;
+
+		/// Frontires dures: la cache ne contient aucun sommet de la face
+		std::vector<std::size_t> frontieresDures;
+		CacheSommets cache{ sommets.size(), tailleCache };
+		for (std::size_t i{ 0 }; i < faces.size(); ++i) {
+			if (cache.transformer(faces[i]) == 3 || i == 0)
+				frontieresDures.push_back(i);
+		}
+		frontieresDures.push_back(faces.size());
+
+		/// Frontires douces: redcouper chaque grappe dure, cache vide 
+		/// chaque nouvelle grappe
+		std::vector<std::size_t> frontieres;
+		for (std::size_t g{ 0 }; g + 1 < frontieresDures.size(); ++g) {
+			const std::size_t debut{ frontieresDures[g] };
+			const std::size_t fin{ frontieresDures[g + 1] };
+
+			cache.vider();
+			std::size_t echecsGrappe{ 0 };
+			for (std::size_t i{ debut }; i < fin; ++i)
+				echecsGrappe += cache.transformer(faces[i]);
+			const double seuil{ SEUIL_SURDESSIN * echecsGrappe / (fin - debut) };
+
+			cache.vider();
+			frontieres.push_back(debut);
+			std::size_t debutCourant{ debut };
+			std::size_t echecs{ 0 };
+			for (std::size_t i{ debut }; i < fin; ++i) {
+				echecs += cache.transformer(faces[i]);
+				if (i + 1 < fin && static_cast<double>(echecs) / (i + 1 - debutCourant) <= seuil) {
+					frontieres.push_back(i + 1);
+					debutCourant = i + 1;
+					echecs = 0;
+					cache.vider();
+				}
+			}
+		}
+		frontieres.push_back(faces.size());
+
+		/// Centre et normale de chaque grappe, pondrs par l'aire des faces
+		const std::size_t nombreGrappes{ frontieres.size() - 1 };
+		std::vector<glm::vec3> centres(nombreGrappes);
+		std::vector<glm::vec3> normales(nombreGrappes);
+		glm::vec3 centreMesh{ 0.0f };
+		float aireMesh{ 0.0f };
+		for (std::size_t g{ 0 }; g < nombreGrappes; ++g) {
+			glm::vec3 centre{ 0.0f };
+			glm::vec3 normale{ 0.0f };
+			float aire{ 0.0f };
+			for (std::size_t i{ frontieres[g] }; i < frontieres[g + 1]; ++i) {
+				Vertex const& a{ sommets[faces[i].x] };
+				Vertex const& b{ sommets[faces[i].y] };
+				Vertex const& c{ sommets[faces[i].z] };
+				const glm::vec3 produit{ glm::cross(b - a, c - a) };
+				const float aireFace{ glm::length(produit) };
+				centre += (a + b + c) * (aireFace / 3.0f);
+				normale += produit;
+				aire += aireFace;
+			}
+			centreMesh += centre;
+			aireMesh += aire;
+			centres[g] = aire > 0.0f ? centre / aire : centre;
+			normales[g] = glm::length(normale) > 0.0f ? glm::normalize(normale) : normale;
+		}
+		if (aireMesh > 0.0f)
+			centreMesh /= aireMesh;
+
+		std::vector<float> orientations(nombreGrappes);
+		std::vector<std::size_t> ordre(nombreGrappes);
+		for (std::size_t g{ 0 }; g < nombreGrappes; ++g) {
+			orientations[g] = glm::dot(centres[g] - centreMesh, normales[g]);
+			ordre[g] = g;
+		}
+		std::stable_sort(ordre.begin(), ordre.end(), [&orientations](std::size_t g1, std::size_t g2) {
+			return orientations[g1] > orientations[g2];
+		});
+
+		std::vector<Face> resultat;
+		resultat.reserve(faces.size());
+		for (std::size_t g : ordre)
+			resultat.insert(resultat.end(), faces.begin() + frontieres[g], faces.begin() + frontieres[g + 1]);
+		faces.swap(resultat);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::vector<int> OptimiseurMesh::ordonnerLecture(std::vector<Face>& faces, std::size_t nombreSommets)
+	///
+	/// Cette fonction renumrote les sommets dans l'ordre de leur premire
+	/// utilisation par les faces, pour que les sommets soient lus
+	/// squentiellement lors du dessin.  Les sommets inutiliss sont placs
+	///  la fin.  Les indices des faces sont mis  jour.
+	///
+	/// @param[in,out] faces         : Les faces, aux indices valides
+	/// @param[in]     nombreSommets : Le nombre de sommets
+	///
+	/// @return La nouvelle position de chaque sommet,  appliquer  leurs
+	///         attributs.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::vector<int> OptimiseurMesh::ordonnerLecture(std::vector<Face>& faces,
+		std::size_t nombreSommets)
+	{
+		std::vector<int> renumerotation(nombreSommets, -1);
+		int prochain{ 0 };
+		for (Face& face : faces) {
+			for (glm::length_t i{ 0 }; i < face.length(); ++i) {
+				int& nouveau{ renumerotation[face[i]] };
+				if (nouveau < 0)
+					nouveau = prochain++;
+				face[i] = nouveau;
+			}
+		}
+
+		for (int& nouveau : renumerotation) {
+			if (nouveau < 0)
+				nouveau = prochain++;
+		}
+		return renumerotation;
+	}
+
+} /// fin de modele
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file OptimiseurMesh.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __RENDERING_OPTIMISEURMESH_H__
+#define __RENDERING_OPTIMISEURMESH_H__
+
+#include <cstddef>
+#include <vector>
+
+#include "Mesh.h"
+#include "Noeud.h"
+
+namespace modele{
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class OptimiseurMesh
+	/// @brief Rordonnancement des faces et des sommets d'un mesh pour la
+	///		   carte graphique.
+	///
+	///		   Les faces importes par 'assimp' restent dans l'ordre du
+	///		   fichier, ce qui fait souvent transformer plusieurs fois le mme
+	///		   sommet.  L'optimisation se fait en trois tapes:
+	///
+	///		   - l'ordre des faces est choisi pour la cache des sommets
+	///		     transforms, selon l'algorithme "Tipsify" (Sander, Nehab et
+	///		     Barczak, 2007), qui simule une cache FIFO;
+	///		   - les faces sont ensuite regroupes en grappes, qui sont
+	///		     tries pour dessiner d'abord celles qui font face 
+	///		     l'extrieur du mesh, afin de rduire le surdessin;
+	///		   - enfin, les sommets sont renumrots dans l'ordre de leur
+	///		     premire utilisation, pour que leur lecture soit squentielle.
+	///
+	///		   L'efficacit de la cache est mesure par l'ACMR (checs de cache
+	///		   par triangle, idalement prs de 0,5) et l'ATVR (checs de cache
+	///		   par sommet, idalement 1).
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class OptimiseurMesh{
+	public:
+		using Face = Mesh::Face;
+		using Vertex = Mesh::Vertex;
+
+		/// Taille de la cache FIFO des sommets transforms simule
+		static const unsigned int TAILLE_CACHE{ 16 };
+
+		///////////////////////////////////////////////////////////////////////
+		/// @struct Statistiques
+		/// @brief Efficacit de la cache des sommets pour un ordre de faces.
+		///////////////////////////////////////////////////////////////////////
+		struct Statistiques{
+			/// Nombre de triangles dessins
+			std::size_t triangles{ 0 };
+			/// Nombre de sommets distincts utiliss par les triangles
+			std::size_t sommets{ 0 };
+			/// Nombre de sommets transforms, soit d'checs de cache
+			std::size_t echecs{ 0 };
+
+			/// Obtient le nombre moyen d'checs de cache par triangle
+			inline double obtenirACMR() const;
+			/// Obtient le nombre moyen d'checs de cache par sommet
+			inline double obtenirATVR() const;
+			/// Cumule les statistiques d'un autre ordre de faces
+			inline Statistiques& operator+=(Statistiques const& statistiques);
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		/// @struct Rapport
+		/// @brief Efficacit de la cache avant et aprs l'optimisation.
+		///////////////////////////////////////////////////////////////////////
+		struct Rapport{
+			/// Statistiques de l'ordre original
+			Statistiques avant;
+			/// Statistiques de l'ordre optimis
+			Statistiques apres;
+		};
+
+		/// Optimise un mesh, dont une copie rordonne est retourne
+		static Mesh optimiser(Mesh const& mesh, Rapport* rapport = nullptr);
+		/// Optimise les meshes d'un noeud et de ses enfants
+		static Noeud optimiser(Noeud const& noeud, Rapport* rapport = nullptr);
+
+		/// Mesure l'efficacit de la cache des sommets pour un ordre de faces
+		static Statistiques mesurer(Mesh::Etendue<Face> faces,
+			unsigned int tailleCache = TAILLE_CACHE);
+
+		/// Ordonne les faces pour la cache des sommets ("Tipsify")
+		static std::vector<Face> ordonnerCache(Mesh::Etendue<Face> faces,
+			std::size_t nombreSommets, unsigned int tailleCache);
+		/// Ordonne les grappes de faces pour rduire le surdessin
+		static void ordonnerSurdessin(std::vector<Face>& faces,
+			Mesh::Etendue<Vertex> sommets, unsigned int tailleCache);
+		/// Renumrote les sommets dans l'ordre de leur premire utilisation
+		static std::vector<int> ordonnerLecture(std::vector<Face>& faces,
+			std::size_t nombreSommets);
+	};
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double OptimiseurMesh::Statistiques::obtenirACMR() const
+	///
+	/// Cette fonction retourne le nombre moyen de sommets transforms par
+	/// triangle ("average cache miss ratio"), entre 0,5 environ pour un
+	/// grand maillage rgulier et 3 sans aucune rutilisation.
+	///
+	/// @return L'ACMR, ou 0 s'il n'y a aucun triangle.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double OptimiseurMesh::Statistiques::obtenirACMR() const
+	{
+		return triangles > 0 ? static_cast<double>(echecs) / triangles : 0.0;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double OptimiseurMesh::Statistiques::obtenirATVR() const
+	///
+	/// Cette fonction retourne le nombre moyen de transformations par
+	/// sommet ("average transformed vertex ratio"), qui vaut 1 lorsque
+	/// chaque sommet n'est transform qu'une fois.
+	///
+	/// @return L'ATVR, ou 0 s'il n'y a aucun sommet.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double OptimiseurMesh::Statistiques::obtenirATVR() const
+	{
+		return sommets > 0 ? static_cast<double>(echecs) / sommets : 0.0;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline OptimiseurMesh::Statistiques& OptimiseurMesh::Statistiques::operator+=(Statistiques const& statistiques)
+	///
+	/// Cette fonction cumule les statistiques d'un autre ordre de faces,
+	/// par exemple pour obtenir celles de tous les meshes d'un modle.
+	///
+	/// @param[in] statistiques : Les statistiques  cumuler
+	///
+	/// @return Les statistiques courantes.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline OptimiseurMesh::Statistiques& OptimiseurMesh::Statistiques::operator+=(Statistiques const& statistiques)
+	{
+		triangles += statistiques.triangles;
+		sommets += statistiques.sommets;
+		echecs += statistiques.echecs;
+		return *this;
+	}
+
+} /// fin de modele
+
+#endif /// __RENDERING_OPTIMISEURMESH_H__
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,355 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file RegistreModeles.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#include <windows.h>
+
+#include "RegistreModeles.h"
+#include "ChargeurModeles.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace modele{
+
+	/// Pointeur vers l'instance unique de la classe.
+	RegistreModeles* RegistreModeles::instance_{ nullptr };
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static void mesurerNoeud(Noeud const& noeud, std::size_t& memoireCPU, std::size_t& memoireGPU)
+	///
+	/// Cette fonction accumule la mmoire occupe par les meshes d'un
+	/// noeud et de ses enfants.  En mmoire centrale, chaque tableau compte
+	/// pour sa taille, qu'il soit copi ou projet depuis le cache.  Sur la
+	/// carte graphique, la liste d'affichage conserve chaque sommet de
+	/// chaque face avec les attributs que le mesh possde (voir
+	/// opengl_storage::CPU_Local).
+	///
+	/// @param[in]     noeud      : Le noeud  mesurer
+	/// @param[in,out] memoireCPU : La mmoire centrale accumule, en octets
+	/// @param[in,out] memoireGPU : La mmoire graphique accumule, en octets
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	static void mesurerNoeud(Noeud const& noeud, std::size_t& memoireCPU, std::size_t& memoireGPU)
+	{
+		for (Mesh const& mesh : noeud.obtenirMeshes()) {
+			memoireCPU += mesh.obtenirSommets().size() * sizeof(Mesh::Vertex)
+				+ mesh.obtenirNormales().size() * sizeof(Mesh::Normale)
+				+ mesh.obtenirTexCoords().size() * sizeof(Mesh::TexCoord)
+				+ mesh.obtenirCouleurs().size() * sizeof(Mesh::Couleur)
+				+ mesh.obtenirFaces().size() * sizeof(Mesh::Face);
+
+			std::size_t tailleSommet{ 0 };
+			if (mesh.possedeSommets())
+				tailleSommet += sizeof(Mesh::Vertex);
+			if (mesh.possedeNormales())
+				tailleSommet += sizeof(Mesh::Normale);
+			if (mesh.possedeTexCoords())
+				tailleSommet += sizeof(Mesh::TexCoord);
+			if (mesh.possedeCouleurs())
+				tailleSommet += sizeof(Mesh::Couleur);
+			memoireGPU += mesh.obtenirFaces().size() * 3 * tailleSommet;
+		}
+
+		for (Noeud const& enfant : noeud.obtenirEnfants())
+			mesurerNoeud(enfant, memoireCPU, memoireGPU);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn ModelePartage::ModelePartage(Modele3D modele, std::string chemin, std::uint64_t drapeaux)
+	///
+	/// Ce constructeur prend possession d'un modle import.  La liste
+	/// d'affichage n'est pas encore charge.
+	///
+	/// @param[in] modele   : Le modle import
+	/// @param[in] chemin   : Le chemin normalis du fichier du modle
+	/// @param[in] drapeaux : Les drapeaux d'importation du modle
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	ModelePartage::ModelePartage(Modele3D modele, std::string chemin, std::uint64_t drapeaux)
+		: modele_(std::move(modele))
+		, liste_{ &modele_ }
+		, chemin_(std::move(chemin))
+		, drapeaux_{ drapeaux }
+	{
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn RegistreModeles* RegistreModeles::obtenirInstance()
+	///
+	/// Cette fonction retourne l'instance unique de la classe.  Si
+	/// l'instance n'existe pas, elle est cre.  Cette fonction n'est pas
+	/// "thread-safe".
+	///
+	/// @return L'instance unique de la classe.
+	///
+	////////////////////////////////////////////////////////////////////////
+	RegistreModeles* RegistreModeles::obtenirInstance()
+	{
+		if (instance_ == nullptr)
+			instance_ = new RegistreModeles;
+
+		return instance_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void RegistreModeles::libererInstance()
+	///
+	/// Cette fonction libre l'instance unique de la classe.  Les modles
+	/// dont il reste des poignes ne sont pas dtruits: ils le seront  la
+	/// disparition de leur dernire poigne, qui doit prcder la
+	/// destruction du contexte OpenGL.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void RegistreModeles::libererInstance()
+	{
+		delete instance_;
+		instance_ = nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn RegistreModeles::Poignee RegistreModeles::obtenir(Path const& chemin)
+	///
+	/// Cette fonction retourne le modle d'un fichier.  S'il n'est pas dj
+	/// charg, il est import puis charg sur la carte graphique.  Un
+	/// modle qui n'a pu tre import est vide, comme aprs un appel 
+	/// Modele3D::charger() qui choue.
+	///
+	/// @param[in] chemin : Le chemin du fichier du modle
+	///
+	/// @return Une poigne vers le modle.
+	///
+	////////////////////////////////////////////////////////////////////////
+	RegistreModeles::Poignee RegistreModeles::obtenir(Path const& chemin)
+	{
+		const Cle cle{ normaliserChemin(chemin), Modele3D::obtenirDrapeauxImportation() };
+
+		Poignee poignee{ trouver(cle) };
+		if (poignee) {
+			++nombreSucces_;
+			return poignee;
+		}
+
+		++nombreEchecs_;
+		Modele3D modele;
+		modele.importer(chemin);
+		return ajouter(std::move(modele), cle);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::vector<RegistreModeles::Poignee> RegistreModeles::obtenirLot(std::vector<Path> const& chemins)
+	///
+	/// Cette fonction retourne les modles d'un lot de fichiers.  Les
+	/// modles qui ne sont pas dj chargs sont imports en parallle, une
+	/// seule fois mme si leur fichier apparat plusieurs fois dans le lot,
+	/// puis chargs sur la carte graphique sur le fil appelant.
+	///
+	/// @param[in] chemins : Les chemins des fichiers des modles
+	///
+	/// @return Les poignes vers les modles, dans l'ordre des chemins.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::vector<RegistreModeles::Poignee> RegistreModeles::obtenirLot(std::vector<Path> const& chemins)
+	{
+		const std::uint64_t drapeaux{ Modele3D::obtenirDrapeauxImportation() };
+
+		std::vector<Poignee> poignees(chemins.size());
+		std::vector<Cle> cles;
+		cles.reserve(chemins.size());
+
+		/// Relever les modles manquants, sans doublon
+		std::vector<Cle> clesManquantes;
+		std::vector<Path> cheminsManquants;
+		for (std::size_t i{ 0 }; i < chemins.size(); ++i) {
+			cles.emplace_back(normaliserChemin(chemins[i]), drapeaux);
+
+			poignees[i] = trouver(cles[i]);
+			if (poignees[i] || std::find(clesManquantes.begin(), clesManquantes.end(), cles[i]) != clesManquantes.end()) {
+				++nombreSucces_;
+				continue;
+			}
+
+			++nombreEchecs_;
+			clesManquantes.push_back(cles[i]);
+			cheminsManquants.push_back(chemins[i]);
+		}
+
+		/// Importer les modles manquants en parallle, puis les charger sur
+		/// la carte graphique sur ce fil
+		std::vector<Modele3D> modeles(cheminsManquants.size());
+		ChargeurModeles::importer(modeles, cheminsManquants);
+
+		std::vector<Poignee> nouveaux;
+		nouveaux.reserve(modeles.size());
+		for (std::size_t i{ 0 }; i < modeles.size(); ++i)
+			nouveaux.push_back(ajouter(std::move(modeles[i]), clesManquantes[i]));
+
+		/// Les nouveaux modles sont maintenant retenus par 'nouveaux'
+		for (std::size_t i{ 0 }; i < chemins.size(); ++i) {
+			if (!poignees[i])
+				poignees[i] = trouver(cles[i]);
+		}
+
+		return poignees;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::vector<RegistreModeles::Poignee> RegistreModeles::obtenirModeles() const
+	///
+	/// Cette fonction retourne des poignes vers tous les modles
+	/// prsentement chargs, pour en consulter la mmoire occupe.  Les
+	/// poignes retournes retiennent les modles: elles ne devraient pas
+	/// tre conserves.
+	///
+	/// @return Les poignes, dans l'ordre des chemins normaliss.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::vector<RegistreModeles::Poignee> RegistreModeles::obtenirModeles() const
+	{
+		std::vector<Poignee> poignees;
+		poignees.reserve(modeles_.size());
+		for (auto const& entree : modeles_) {
+			Poignee poignee{ entree.second.lock() };
+			if (poignee)
+				poignees.push_back(std::move(poignee));
+		}
+		return poignees;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::string RegistreModeles::normaliserChemin(Path const& chemin)
+	///
+	/// Cette fonction normalise le chemin d'un fichier de modle pour que
+	/// les diffrentes faons de dsigner un mme fichier donnent la mme
+	/// cl: le chemin est rendu absolu (ce qui rsout aussi les "." et les
+	/// ".." et uniformise les sparateurs), puis mis en minuscules puisque
+	/// le systme de fichiers ne distingue pas la casse.
+	///
+	/// @param[in] chemin : Le chemin  normaliser
+	///
+	/// @return Le chemin normalis.
+	///
+	////////////////////////////////////////////////////////////////////////
+	std::string RegistreModeles::normaliserChemin(Path const& chemin)
+	{
+		const std::string original{ chemin.string() };
+
+		std::string normalise(MAX_PATH, '\0');
+		DWORD taille{ GetFullPathNameA(original.c_str(), static_cast<DWORD>(normalise.size()), &normalise[0], nullptr) };
+		if (taille >= normalise.size()) {
+			normalise.resize(taille);
+			taille = GetFullPathNameA(original.c_str(), static_cast<DWORD>(normalise.size()), &normalise[0], nullptr);
+		}
+
+		if (taille == 0 || taille >= normalise.size())
+			normalise = original;
+		else
+			normalise.resize(taille);
+
+		for (char& caractere : normalise)
+			caractere = static_cast<char>(std::tolower(static_cast<unsigned char>(caractere)));
+		return normalise;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn RegistreModeles::Poignee RegistreModeles::trouver(Cle const& cle) const
+	///
+	/// Cette fonction retourne le modle d'une cl, s'il est prsentement
+	/// charg.
+	///
+	/// @param[in] cle : La cl du modle
+	///
+	/// @return Une poigne vers le modle, ou une poigne vide.
+	///
+	////////////////////////////////////////////////////////////////////////
+	RegistreModeles::Poignee RegistreModeles::trouver(Cle const& cle) const
+	{
+		auto iter = modeles_.find(cle);
+		return iter != modeles_.end() ? iter->second.lock() : Poignee{};
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn RegistreModeles::Poignee RegistreModeles::ajouter(Modele3D modele, Cle const& cle)
+	///
+	/// Cette fonction charge les textures et la liste d'affichage d'un
+	/// modle import, mesure la mmoire qu'il occupe puis l'ajoute au
+	/// registre.  Elle doit tre appele sur le fil OpenGL.
+	///
+	/// @param[in] modele : Le modle import
+	/// @param[in] cle    : La cl du modle
+	///
+	/// @return Une poigne vers le modle, seule  le retenir.
+	///
+	////////////////////////////////////////////////////////////////////////
+	RegistreModeles::Poignee RegistreModeles::ajouter(Modele3D modele, Cle const& cle)
+	{
+		ModelePartage* partage{ new ModelePartage{ std::move(modele), cle.first, cle.second } };
+		Poignee poignee{ partage, &RegistreModeles::relacher };
+
+		partage->modele_.chargerTextures();
+		partage->liste_.storageCharger();
+
+		mesurerNoeud(partage->modele_.obtenirNoeudRacine(), partage->memoireCPU_, partage->memoireGPU_);
+		partage->memoireCPU_ += partage->modele_.obtenirArbreTriangles().obtenirMemoire();
+		partage->memoireGPU_ += partage->modele_.obtenirMemoireTextures();
+
+		memoireCPU_ += partage->memoireCPU_;
+		memoireGPU_ += partage->memoireGPU_;
+		modeles_[cle] = poignee;
+		return poignee;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void RegistreModeles::relacher(ModelePartage const* modele)
+	///
+	/// Cette fonction est appele  la disparition de la dernire poigne
+	/// d'un modle.  Elle retire le modle du registre, s'il existe
+	/// encore, puis le dtruit, ce qui relche sa liste d'affichage et ses
+	/// textures.
+	///
+	/// @param[in] modele : Le modle  relcher
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void RegistreModeles::relacher(ModelePartage const* modele)
+	{
+		if (instance_ != nullptr) {
+			auto iter = instance_->modeles_.find(Cle{ modele->chemin_, modele->drapeaux_ });
+			if (iter != instance_->modeles_.end() && iter->second.expired()) {
+				instance_->modeles_.erase(iter);
+				instance_->memoireCPU_ -= modele->memoireCPU_;
+				instance_->memoireGPU_ -= modele->memoireGPU_;
+			}
+		}
+
+		delete modele;
+	}
+
+} /// fin de modele
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
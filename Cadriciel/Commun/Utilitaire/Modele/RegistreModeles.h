@@ -0,0 +1,325 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file RegistreModeles.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup rendering Rendering
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __RENDERING_REGISTREMODELES_H__
+#define __RENDERING_REGISTREMODELES_H__
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Modele3D.h"
+#include "OpenGL_Storage/ModeleStorage_Liste.h"
+
+namespace modele{
+
+	class RegistreModeles;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class ModelePartage
+	/// @brief Modle 3D charg une seule fois et partag entre ses
+	///		   utilisateurs (usines, arbres), avec sa liste d'affichage.
+	///
+	///		   Un modle partag n'est cr que par le registre des modles
+	///		   et n'est accessible qu'en lecture, par une poigne
+	///		   (RegistreModeles::Poignee).  Il est dtruit, avec ses textures
+	///		   et sa liste d'affichage, lorsque la dernire poigne disparat.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class ModelePartage{
+	public:
+		/// Obtient le modle 3D
+		inline Modele3D const& obtenirModele() const;
+		/// Obtient la liste d'affichage du modle
+		inline opengl_storage::OpenGL_Liste const& obtenirListe() const;
+		/// Obtient le chemin normalis du fichier du modle
+		inline std::string const& obtenirChemin() const;
+		/// Obtient la mmoire centrale occupe par le modle, en octets
+		inline std::size_t obtenirMemoireCPU() const;
+		/// Obtient la mmoire de la carte graphique occupe par le modle, en octets
+		inline std::size_t obtenirMemoireGPU() const;
+
+	private:
+		/// Constructeur  partir d'un modle import et de son chemin normalis
+		ModelePartage(Modele3D modele, std::string chemin, std::uint64_t drapeaux);
+
+		/// Pas de copie, la liste d'affichage pointe vers le modle
+		ModelePartage(ModelePartage const&) = delete;
+		/// Pas d'assignation, la liste d'affichage pointe vers le modle
+		ModelePartage& operator=(ModelePartage const&) = delete;
+
+		/// Modle 3D, dclar avant la liste pour lui survivre
+		Modele3D modele_;
+		/// Liste d'affichage du modle
+		opengl_storage::OpenGL_Liste liste_;
+		/// Chemin normalis du fichier du modle
+		std::string chemin_;
+		/// Drapeaux d'importation du modle
+		std::uint64_t drapeaux_;
+		/// Mmoire centrale occupe, en octets
+		std::size_t memoireCPU_{ 0 };
+		/// Mmoire de la carte graphique occupe, en octets
+		std::size_t memoireGPU_{ 0 };
+
+		friend class RegistreModeles;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class RegistreModeles
+	/// @brief Registre des modles 3D partags par toute l'application.
+	///
+	///		   Les modles sont identifis par le chemin normalis de leur
+	///		   fichier (absolu, en minuscules) et par leurs drapeaux
+	///		   d'importation: deux usines, ou deux arbres, qui demandent le
+	///		   mme fichier obtiennent une poigne vers le mme modle, qui
+	///		   n'est import et charg sur la carte graphique qu'une fois.
+	///
+	///		   Le registre ne garde qu'une rfrence faible vers chaque
+	///		   modle.  Un modle est donc relch, textures et liste
+	///		   d'affichage comprises, ds que sa dernire poigne disparat,
+	///		   et sera charg  nouveau s'il est redemand.
+	///
+	///		   Le registre, comme les poignes, ne doit tre utilis que sur
+	///		   le fil qui possde le contexte OpenGL.  Les importations d'un
+	///		   mme lot sont toutefois faites en parallle (voir
+	///		   ChargeurModeles).
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class RegistreModeles{
+	public:
+		using Path = Modele3D::Path;
+		/// Poigne partage vers un modle du registre
+		using Poignee = std::shared_ptr<ModelePartage const>;
+
+		/// Obtient l'instance unique de la classe
+		static RegistreModeles* obtenirInstance();
+		/// Libre l'instance unique de la classe
+		static void libererInstance();
+
+		/// Obtient le modle d'un fichier, charg au besoin
+		Poignee obtenir(Path const& chemin);
+		/// Obtient les modles d'un lot de fichiers, chargs au besoin en parallle
+		std::vector<Poignee> obtenirLot(std::vector<Path> const& chemins);
+
+		/// Obtient des poignes vers tous les modles prsentement chargs
+		std::vector<Poignee> obtenirModeles() const;
+
+		/// Obtient le nombre de demandes servies par un modle dj charg
+		inline unsigned int obtenirNombreSucces() const;
+		/// Obtient le nombre de demandes qui ont ncessit un chargement
+		inline unsigned int obtenirNombreEchecs() const;
+		/// Obtient le nombre de modles prsentement chargs
+		inline std::size_t obtenirNombreModeles() const;
+		/// Obtient la mmoire centrale occupe par les modles, en octets
+		inline std::size_t obtenirMemoireCPU() const;
+		/// Obtient la mmoire de la carte graphique occupe par les modles, en octets
+		inline std::size_t obtenirMemoireGPU() const;
+
+		/// Normalise le chemin d'un fichier de modle
+		static std::string normaliserChemin(Path const& chemin);
+
+	private:
+		/// Cl d'un modle: chemin normalis et drapeaux d'importation
+		using Cle = std::pair<std::string, std::uint64_t>;
+
+		RegistreModeles() = default;
+		~RegistreModeles() = default;
+
+		/// Constructeur copie dsactiv.
+		RegistreModeles(RegistreModeles const&) = delete;
+		/// Oprateur d'assignation dsactiv.
+		RegistreModeles& operator=(RegistreModeles const&) = delete;
+
+		/// Obtient le modle d'une cl s'il est prsentement charg
+		Poignee trouver(Cle const& cle) const;
+		/// Ajoute au registre un modle import, aprs l'avoir charg sur la carte graphique
+		Poignee ajouter(Modele3D modele, Cle const& cle);
+		/// Retire un modle du registre et le dtruit,  la disparition de sa dernire poigne
+		static void relacher(ModelePartage const* modele);
+
+		/// Pointeur vers l'instance unique de la classe.
+		static RegistreModeles* instance_;
+
+		/// Modles chargs, par cl
+		std::map<Cle, std::weak_ptr<ModelePartage const>> modeles_;
+		/// Nombre de demandes servies par un modle dj charg
+		unsigned int nombreSucces_{ 0 };
+		/// Nombre de demandes qui ont ncessit un chargement
+		unsigned int nombreEchecs_{ 0 };
+		/// Mmoire centrale occupe par les modles, en octets
+		std::size_t memoireCPU_{ 0 };
+		/// Mmoire de la carte graphique occupe par les modles, en octets
+		std::size_t memoireGPU_{ 0 };
+	};
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline Modele3D const& ModelePartage::obtenirModele() const
+	///
+	/// Cette fonction retourne le modle 3D partag.
+	///
+	/// @return Le modle 3D (const).
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline Modele3D const& ModelePartage::obtenirModele() const
+	{
+		return modele_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline opengl_storage::OpenGL_Liste const& ModelePartage::obtenirListe() const
+	///
+	/// Cette fonction retourne la liste d'affichage du modle, compile
+	/// lors de son chargement.
+	///
+	/// @return La liste d'affichage (const).
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline opengl_storage::OpenGL_Liste const& ModelePartage::obtenirListe() const
+	{
+		return liste_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::string const& ModelePartage::obtenirChemin() const
+	///
+	/// Cette fonction retourne le chemin normalis du fichier du modle,
+	/// tel qu'utilis comme cl par le registre.
+	///
+	/// @return Le chemin normalis.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::string const& ModelePartage::obtenirChemin() const
+	{
+		return chemin_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t ModelePartage::obtenirMemoireCPU() const
+	///
+	/// Cette fonction retourne la mmoire centrale occupe par le modle:
+	/// ses donnes gomtriques, copies ou projetes depuis le cache, et
+	/// sa hirarchie de triangles.
+	///
+	/// @return La mmoire centrale, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t ModelePartage::obtenirMemoireCPU() const
+	{
+		return memoireCPU_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t ModelePartage::obtenirMemoireGPU() const
+	///
+	/// Cette fonction retourne une estimation de la mmoire de la carte
+	/// graphique occupe par le modle: ses textures et les sommets
+	/// compils dans sa liste d'affichage.
+	///
+	/// @return La mmoire de la carte graphique, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t ModelePartage::obtenirMemoireGPU() const
+	{
+		return memoireGPU_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int RegistreModeles::obtenirNombreSucces() const
+	///
+	/// Cette fonction retourne le nombre de demandes servies par un modle
+	/// dj charg, y compris les doublons d'un mme lot.
+	///
+	/// @return Le nombre de succs.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline unsigned int RegistreModeles::obtenirNombreSucces() const
+	{
+		return nombreSucces_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int RegistreModeles::obtenirNombreEchecs() const
+	///
+	/// Cette fonction retourne le nombre de demandes qui ont ncessit
+	/// l'importation et le chargement d'un modle.
+	///
+	/// @return Le nombre d'checs.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline unsigned int RegistreModeles::obtenirNombreEchecs() const
+	{
+		return nombreEchecs_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t RegistreModeles::obtenirNombreModeles() const
+	///
+	/// Cette fonction retourne le nombre de modles prsentement chargs,
+	/// c'est--dire pour lesquels il existe encore une poigne.
+	///
+	/// @return Le nombre de modles.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t RegistreModeles::obtenirNombreModeles() const
+	{
+		return modeles_.size();
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t RegistreModeles::obtenirMemoireCPU() const
+	///
+	/// Cette fonction retourne la mmoire centrale occupe par l'ensemble
+	/// des modles chargs.
+	///
+	/// @return La mmoire centrale, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t RegistreModeles::obtenirMemoireCPU() const
+	{
+		return memoireCPU_;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t RegistreModeles::obtenirMemoireGPU() const
+	///
+	/// Cette fonction retourne la mmoire de la carte graphique occupe par
+	/// l'ensemble des modles chargs.
+	///
+	/// @return La mmoire de la carte graphique, en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t RegistreModeles::obtenirMemoireGPU() const
+	{
+		return memoireGPU_;
+	}
+
+} /// fin de modele
+
+#endif /// __RENDERING_REGISTREMODELES_H__
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
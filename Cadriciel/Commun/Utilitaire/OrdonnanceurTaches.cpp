@@ -0,0 +1,345 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file OrdonnanceurTaches.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#include "OrdonnanceurTaches.h"
+
+#include <cassert>
+
+
+namespace utilitaire {
+
+
+	/// Pointeur vers l'instance unique de la classe.
+	OrdonnanceurTaches* OrdonnanceurTaches::instance_{ nullptr };
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn GroupeTaches::GroupeTaches()
+	///
+	/// Ce constructeur cre un groupe sans tche.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	GroupeTaches::GroupeTaches()
+		: tachesRestantes_(0)
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void GroupeTaches::retenirErreur(std::exception_ptr erreur)
+	///
+	/// Cette fonction retient l'exception lance par une tche du groupe,
+	///  moins qu'une autre tche en ait dj lanc une.
+	///
+	/// @param[in] erreur : L'exception lance par la tche.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void GroupeTaches::retenirErreur(std::exception_ptr erreur)
+	{
+		std::lock_guard<std::mutex> verrou(mutexErreur_);
+		if (!erreur_)
+			erreur_ = erreur;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn OrdonnanceurTaches* OrdonnanceurTaches::obtenirInstance()
+	///
+	/// Cette fonction retourne l'instance unique de la classe.  Si
+	/// l'instance n'existe pas, elle est cre avec un fil de travail par
+	/// coeur, moins celui du fil appelant.  Cette fonction n'est pas
+	/// "thread-safe".
+	///
+	/// @return L'instance unique de la classe.
+	///
+	////////////////////////////////////////////////////////////////////////
+	OrdonnanceurTaches* OrdonnanceurTaches::obtenirInstance()
+	{
+		if (instance_ == nullptr) {
+			const unsigned int nombreCoeurs{ std::thread::hardware_concurrency() };
+			instance_ = new OrdonnanceurTaches{ nombreCoeurs > 1 ? nombreCoeurs - 1 : 0 };
+		}
+
+		return instance_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void OrdonnanceurTaches::libererInstance()
+	///
+	/// Cette fonction libre l'instance unique de la classe et termine ses
+	/// fils de travail.  Elle doit tre appele explicitement, avant le
+	/// dchargement de la bibliothque, puisque les fils ne peuvent tre
+	/// joints de faon sre pendant celui-ci.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void OrdonnanceurTaches::libererInstance()
+	{
+		delete instance_;
+		instance_ = nullptr;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn OrdonnanceurTaches::OrdonnanceurTaches(unsigned int nombreTravailleurs)
+	///
+	/// Ce constructeur cre les files de tches et dmarre les fils de
+	/// travail.
+	///
+	/// @param[in] nombreTravailleurs : Le nombre de fils de travail.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	OrdonnanceurTaches::OrdonnanceurTaches(unsigned int nombreTravailleurs)
+		: tachesEnAttente_(0), arret_(false), monoFil_(false)
+	{
+		for (unsigned int i{ 0 }; i <= nombreTravailleurs; ++i)
+			files_.push_back(std::make_unique<File>());
+
+		for (unsigned int i{ 1 }; i <= nombreTravailleurs; ++i)
+			travailleurs_.push_back(std::thread{ &OrdonnanceurTaches::travailler, this, i });
+
+		for (std::thread const& travailleur : travailleurs_)
+			identifiants_.push_back(travailleur.get_id());
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn OrdonnanceurTaches::~OrdonnanceurTaches()
+	///
+	/// Ce destructeur termine les fils de travail.  Aucune tche ne doit
+	/// tre en cours.
+	///
+	/// @return Aucune (destructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	OrdonnanceurTaches::~OrdonnanceurTaches()
+	{
+		assert(tachesEnAttente_.load() == 0 && "Des tches sont en attente  la destruction de l'ordonnanceur.");
+
+		{
+			std::lock_guard<std::mutex> verrou(mutexSommeil_);
+			arret_ = true;
+		}
+		reveil_.notify_all();
+
+		for (std::thread& travailleur : travailleurs_)
+			travailleur.join();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void OrdonnanceurTaches::lancer(GroupeTaches& groupe, Tache tache)
+	///
+	/// Cette fonction lance une tche dans un groupe.  En mode mono-fil, la
+	/// tche est excute immdiatement, et une exception qu'elle lance est
+	/// retenue par le groupe comme en mode parallle.  Sinon, elle est
+	/// place dans la file du fil courant, o elle pourra tre vole par un
+	/// fil inactif.
+	///
+	/// @param[in] groupe : Le groupe auquel appartient la tche.
+	/// @param[in] tache  : La tche  excuter.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void OrdonnanceurTaches::lancer(GroupeTaches& groupe, Tache tache)
+	{
+		if (monoFil_.load()) {
+			try {
+				tache();
+			}
+			catch (...) {
+				groupe.retenirErreur(std::current_exception());
+			}
+			return;
+		}
+
+		++groupe.tachesRestantes_;
+
+		File& file = *files_[obtenirIndiceFil()];
+		{
+			std::lock_guard<std::mutex> verrou(file.mutex);
+			file.travaux.push_back(Travail{ std::move(tache), &groupe });
+		}
+		++tachesEnAttente_;
+
+		// Le verrou garantit qu'un fil qui vient de vrifier la condition
+		// de rveil est bien endormi avant d'tre notifi.
+		{
+			std::lock_guard<std::mutex> verrou(mutexSommeil_);
+		}
+		reveil_.notify_one();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void OrdonnanceurTaches::attendre(GroupeTaches& groupe)
+	///
+	/// Cette fonction attend la fin de toutes les tches d'un groupe.  Le
+	/// fil appelant excute des tches en attendant, ce qui vite qu'une
+	/// tche qui attend ses propres sous-tches bloque un fil de travail.
+	///
+	/// Si une tche du groupe a lanc une exception, elle est relance une
+	/// fois toutes les tches termines, et le groupe peut tre rutilis.
+	///
+	/// @param[in] groupe : Le groupe dont il faut attendre les tches.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void OrdonnanceurTaches::attendre(GroupeTaches& groupe)
+	{
+		const unsigned int indice{ obtenirIndiceFil() };
+		while (!groupe.estTermine()) {
+			if (!executerTache(indice))
+				std::this_thread::yield();
+		}
+
+		std::exception_ptr erreur;
+		{
+			std::lock_guard<std::mutex> verrou(groupe.mutexErreur_);
+			erreur.swap(groupe.erreur_);
+		}
+		if (erreur)
+			std::rethrow_exception(erreur);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int OrdonnanceurTaches::obtenirIndiceFil() const
+	///
+	/// Cette fonction retourne l'indice de la file associe au fil courant.
+	/// Les fils qui ne sont pas des fils de travail partagent la premire.
+	///
+	/// @return L'indice de la file du fil courant.
+	///
+	////////////////////////////////////////////////////////////////////////
+	unsigned int OrdonnanceurTaches::obtenirIndiceFil() const
+	{
+		const std::thread::id courant{ std::this_thread::get_id() };
+		for (unsigned int i{ 0 }; i < identifiants_.size(); ++i) {
+			if (identifiants_[i] == courant)
+				return i + 1;
+		}
+		return 0;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool OrdonnanceurTaches::executerTache(unsigned int indice)
+	///
+	/// Cette fonction excute une tche.  Elle prend la tche la plus
+	/// rcente de la file du fil courant ou, si celle-ci est vide, la plus
+	/// ancienne de la premire file non vide parmi celles des autres fils.
+	///
+	/// Une exception lance par la tche est retenue par son groupe.  La
+	/// tche est compte comme termine seulement aprs, pour que
+	/// attendre() voie l'exception ds que le groupe est termin.
+	///
+	/// @param[in] indice : L'indice de la file du fil courant.
+	///
+	/// @return Vrai si une tche a t excute.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool OrdonnanceurTaches::executerTache(unsigned int indice)
+	{
+		if (tachesEnAttente_.load() == 0)
+			return false;
+
+		Travail travail{ nullptr, nullptr };
+		const unsigned int nombreFiles{ static_cast<unsigned int>(files_.size()) };
+		for (unsigned int i{ 0 }; i < nombreFiles && travail.groupe == nullptr; ++i) {
+			File& file = *files_[(indice + i) % nombreFiles];
+			std::lock_guard<std::mutex> verrou(file.mutex);
+			if (file.travaux.empty())
+				continue;
+
+			if (i == 0) {
+				travail = std::move(file.travaux.back());
+				file.travaux.pop_back();
+			}
+			else {
+				travail = std::move(file.travaux.front());
+				file.travaux.pop_front();
+			}
+		}
+
+		if (travail.groupe == nullptr)
+			return false;
+
+		--tachesEnAttente_;
+
+		// Compte la tche comme termine  la sortie, quoi qu'il arrive.
+		struct FinTache {
+			GroupeTaches& groupe;
+			~FinTache() { --groupe.tachesRestantes_; }
+		} fin{ *travail.groupe };
+
+		try {
+			travail.tache();
+		}
+		catch (...) {
+			travail.groupe->retenirErreur(std::current_exception());
+		}
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void OrdonnanceurTaches::travailler(unsigned int indice)
+	///
+	/// Cette fonction est la boucle principale d'un fil de travail.  Le fil
+	/// excute des tches tant qu'il en trouve, puis s'endort jusqu' ce
+	/// qu'une tche soit lance ou que l'ordonnanceur soit dtruit.
+	///
+	/// @param[in] indice : L'indice de la file du fil de travail.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void OrdonnanceurTaches::travailler(unsigned int indice)
+	{
+		while (!arret_.load()) {
+			if (executerTache(indice))
+				continue;
+
+			std::unique_lock<std::mutex> verrou(mutexSommeil_);
+			reveil_.wait(verrou, [this] {
+				return arret_.load() || tachesEnAttente_.load() > 0;
+			});
+		}
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,244 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file OrdonnanceurTaches.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_ORDONNANCEURTACHES_H__
+#define __UTILITAIRE_ORDONNANCEURTACHES_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class GroupeTaches
+	/// @brief Ensemble de tches lances ensemble, dont on peut attendre la
+	///        fin  l'aide de OrdonnanceurTaches::attendre().
+	///
+	///        Un groupe doit survivre  toutes les tches qui y sont lances.
+	///        Il retient la premire exception lance par l'une d'elles.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class GroupeTaches
+	{
+	public:
+		/// Constructeur par dfaut.
+		GroupeTaches();
+
+		/// Vrifie si toutes les tches du groupe sont termines.
+		inline bool estTermine() const;
+
+	private:
+		/// Constructeur copie dsactiv.
+		GroupeTaches(const GroupeTaches&) = delete;
+		/// Oprateur d'assignation dsactiv.
+		GroupeTaches& operator =(const GroupeTaches&) = delete;
+
+		/// Retient une exception lance par une tche, si c'est la premire.
+		void retenirErreur(std::exception_ptr erreur);
+
+		/// Nombre de tches du groupe qui ne sont pas encore termines.
+		std::atomic<int> tachesRestantes_;
+		/// Mutex protgeant l'exception retenue.
+		std::mutex mutexErreur_;
+		/// Premire exception lance par une tche du groupe, ou nulle.
+		std::exception_ptr erreur_;
+
+		friend class OrdonnanceurTaches;
+	};
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class OrdonnanceurTaches
+	/// @brief Ordonnanceur de tches  vol de travail ("work stealing").
+	///
+	///        Chaque fil d'excution possde sa propre file de tches.  Un
+	///        fil excute d'abord les tches qu'il a lui-mme lances, en
+	///        commenant par la plus rcente, puis vole les plus anciennes
+	///        tches des autres fils lorsque sa file est vide.  Un fil qui
+	///        attend la fin d'un groupe excute des tches en attendant, ce
+	///        qui permet de lancer des tches  partir d'une tche.
+	///
+	///        En mode mono-fil, chaque tche est excute immdiatement par
+	///        le fil qui la lance, dans l'ordre des lancements.  Ce mode
+	///        permet de comparer les rsultats avec une excution parallle.
+	///
+	///        Une exception lance par une tche est retenue par son groupe
+	///        et relance par attendre(), une fois toutes les tches du
+	///        groupe termines.  Seule la premire est relance.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class OrdonnanceurTaches
+	{
+	public:
+		/// Type d'une tche.
+		using Tache = std::function<void()>;
+
+		/// Obtient l'instance unique de la classe.
+		static OrdonnanceurTaches* obtenirInstance();
+		/// Libre l'instance unique de la classe.
+		static void libererInstance();
+
+		/// Lance une tche dans un groupe.
+		void lancer(GroupeTaches& groupe, Tache tache);
+		/// Attend la fin de toutes les tches d'un groupe.
+		void attendre(GroupeTaches& groupe);
+
+		/// Force ou non l'excution de toutes les tches sur un seul fil.
+		inline void assignerMonoFil(bool monoFil);
+		/// Vrifie si les tches sont excutes sur un seul fil.
+		inline bool estMonoFil() const;
+		/// Obtient le nombre de fils pouvant excuter des tches.
+		inline unsigned int obtenirNombreFils() const;
+
+	private:
+		/// Constructeur  partir du nombre de fils de travail  crer.
+		explicit OrdonnanceurTaches(unsigned int nombreTravailleurs);
+		/// Destructeur.
+		~OrdonnanceurTaches();
+		/// Constructeur copie dsactiv.
+		OrdonnanceurTaches(const OrdonnanceurTaches&) = delete;
+		/// Oprateur d'assignation dsactiv.
+		OrdonnanceurTaches& operator =(const OrdonnanceurTaches&) = delete;
+
+		/// Tche en attente, avec le groupe auquel elle appartient.
+		struct Travail {
+			Tache tache;
+			GroupeTaches* groupe;
+		};
+
+		/// File de tches d'un fil d'excution.
+		struct File {
+			std::mutex mutex;
+			std::deque<Travail> travaux;
+		};
+
+		/// Obtient l'indice de la file du fil courant.
+		unsigned int obtenirIndiceFil() const;
+		/// Excute une tche de sa file ou vole  un autre fil.
+		bool executerTache(unsigned int indice);
+		/// Boucle principale d'un fil de travail.
+		void travailler(unsigned int indice);
+
+		/// Pointeur vers l'instance unique de la classe.
+		static OrdonnanceurTaches* instance_;
+
+		/// Files de tches.  La premire est partage par les fils externes,
+		/// les suivantes appartiennent aux fils de travail.
+		std::vector<std::unique_ptr<File>> files_;
+		/// Fils de travail.
+		std::vector<std::thread> travailleurs_;
+		/// Identifiants des fils de travail, dans l'ordre de leurs files.
+		std::vector<std::thread::id> identifiants_;
+
+		/// Nombre de tches lances qui n'ont pas encore t prises.
+		std::atomic<int> tachesEnAttente_;
+		/// Vrai lorsque les fils de travail doivent se terminer.
+		std::atomic<bool> arret_;
+		/// Mutex protgeant la mise en sommeil des fils de travail.
+		std::mutex mutexSommeil_;
+		/// Condition de rveil des fils de travail.
+		std::condition_variable reveil_;
+
+		/// Vrai si les tches sont excutes sur le fil qui les lance.  Il
+		/// est lu par les fils de travail, d'o l'accs atomique.
+		std::atomic<bool> monoFil_;
+	};
+
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool GroupeTaches::estTermine() const
+	///
+	/// Cette fonction indique si toutes les tches lances dans le groupe
+	/// sont termines.
+	///
+	/// @return Vrai si aucune tche du groupe n'est en cours.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool GroupeTaches::estTermine() const
+	{
+		return tachesRestantes_.load() == 0;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void OrdonnanceurTaches::assignerMonoFil(bool monoFil)
+	///
+	/// Cette fonction force ou non l'excution de toutes les tches sur le
+	/// fil qui les lance.  Elle ne doit pas tre appele pendant que des
+	/// tches sont en cours.
+	///
+	/// @param[in] monoFil : Vrai pour excuter les tches sur un seul fil.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline void OrdonnanceurTaches::assignerMonoFil(bool monoFil)
+	{
+		monoFil_.store(monoFil);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool OrdonnanceurTaches::estMonoFil() const
+	///
+	/// Cette fonction indique si les tches sont excutes sur le fil qui
+	/// les lance.
+	///
+	/// @return Vrai si le mode mono-fil est actif.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool OrdonnanceurTaches::estMonoFil() const
+	{
+		return monoFil_.load();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int OrdonnanceurTaches::obtenirNombreFils() const
+	///
+	/// Cette fonction retourne le nombre de fils pouvant excuter des
+	/// tches, soit les fils de travail et le fil qui attend.
+	///
+	/// @return Le nombre de fils.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline unsigned int OrdonnanceurTaches::obtenirNombreFils() const
+	{
+		return monoFil_.load() ? 1 : static_cast<unsigned int>(files_.size());
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_ORDONNANCEURTACHES_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,513 @@
+/////////////////////////////////////////////////////////////////////////////////
+/// @file PhaseLarge.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "PhaseLarge.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+namespace aidecollision {
+
+
+	/// Identifiant ne dsignant aucune sphre.
+	const PhaseLarge::Identifiant PhaseLarge::AUCUN;
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn std::unique_ptr<PhaseLarge> PhaseLarge::creer(Methode methode, double tailleCellule)
+	///
+	/// Cette fonction cre une phase large qui utilise la mthode de calcul
+	/// des paires demande.
+	///
+	/// @param[in] methode       : La mthode de calcul des paires.
+	/// @param[in] tailleCellule : La taille des cellules, utilise seulement
+	///                            par la grille spatiale.
+	///
+	/// @return La phase large cre, ou nullptr si la mthode est inconnue.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	std::unique_ptr<PhaseLarge> PhaseLarge::creer(Methode methode, double tailleCellule)
+	{
+		switch (methode) {
+		case BALAYAGE_ET_ELAGAGE:
+			return std::make_unique<BalayageEtElagage>();
+		case GRILLE_SPATIALE:
+			return std::make_unique<GrilleSpatiale>(tailleCellule);
+		}
+		return nullptr;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn PhaseLarge::Identifiant PhaseLarge::ajouter(const glm::dvec3& centre, double rayon)
+	///
+	/// Cette fonction ajoute une sphre  la phase large.  Elle ne fera
+	/// partie des paires qu' la prochaine mise  jour.
+	///
+	/// @param[in] centre : Le centre de la sphre.
+	/// @param[in] rayon  : Le rayon de la sphre.
+	///
+	/// @return L'identifiant de la sphre.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	PhaseLarge::Identifiant PhaseLarge::ajouter(const glm::dvec3& centre, double rayon)
+	{
+		Identifiant identifiant;
+		if (libres_.empty()) {
+			identifiant = static_cast<Identifiant>(objets_.size());
+			objets_.push_back(Objet{});
+		}
+		else {
+			identifiant = libres_.back();
+			libres_.pop_back();
+		}
+
+		objets_[identifiant].actif = true;
+		deplacer(identifiant, centre, rayon);
+		signalerAjout(identifiant);
+		return identifiant;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::retirer(Identifiant identifiant)
+	///
+	/// Cette fonction retire une sphre de la phase large.  Ses paires
+	/// seront signales comme disparues  la prochaine mise  jour.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::retirer(Identifiant identifiant)
+	{
+		if (!contient(identifiant))
+			return;
+
+		signalerRetrait(identifiant);
+		objets_[identifiant].actif = false;
+		retires_.push_back(identifiant);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::deplacer(Identifiant identifiant, const glm::dvec3& centre, double rayon)
+	///
+	/// Cette fonction assigne une nouvelle position et un nouveau rayon 
+	/// une sphre.  Les paires ne sont recalcules qu' la prochaine mise 
+	/// jour.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre.
+	/// @param[in] centre      : Le nouveau centre de la sphre.
+	/// @param[in] rayon       : Le nouveau rayon de la sphre.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::deplacer(Identifiant identifiant, const glm::dvec3& centre, double rayon)
+	{
+		Objet& objet{ objets_[identifiant] };
+		objet.centre = centre;
+		objet.rayon = rayon;
+		objet.coinMin = centre - glm::dvec3{ rayon };
+		objet.coinMax = centre + glm::dvec3{ rayon };
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::vider()
+	///
+	/// Cette fonction retire toutes les sphres et oublie les paires de la
+	/// dernire mise  jour, sans les signaler comme disparues.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::vider()
+	{
+		objets_.clear();
+		libres_.clear();
+		retires_.clear();
+		paires_.clear();
+		pairesAjoutees_.clear();
+		pairesRetirees_.clear();
+		statistiques_ = Statistiques{};
+		signalerVidage();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::mettreAJour()
+	///
+	/// Cette fonction calcule les paires candidates pour les positions
+	/// courantes des sphres, puis les compare  celles de la mise  jour
+	/// prcdente.  Comme les deux listes sont tries, la comparaison se
+	/// fait en un temps linaire.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::mettreAJour()
+	{
+		const auto debut = std::chrono::high_resolution_clock::now();
+
+		tampon_.clear();
+		unsigned int nombreTests{ 0 };
+		calculerPaires(tampon_, nombreTests);
+		std::sort(tampon_.begin(), tampon_.end());
+		tampon_.erase(std::unique(tampon_.begin(), tampon_.end()), tampon_.end());
+
+		pairesAjoutees_.clear();
+		pairesRetirees_.clear();
+		std::set_difference(tampon_.begin(), tampon_.end(), paires_.begin(), paires_.end(),
+			std::back_inserter(pairesAjoutees_));
+		std::set_difference(paires_.begin(), paires_.end(), tampon_.begin(), tampon_.end(),
+			std::back_inserter(pairesRetirees_));
+		paires_.swap(tampon_);
+
+		// Les paires des sphres retires ont maintenant t signales.
+		libres_.insert(libres_.end(), retires_.begin(), retires_.end());
+		retires_.clear();
+
+		const auto fin = std::chrono::high_resolution_clock::now();
+
+		statistiques_.nombreObjets = static_cast<unsigned int>(objets_.size() - libres_.size());
+		statistiques_.nombrePaires = static_cast<unsigned int>(paires_.size());
+		statistiques_.nombrePairesAjoutees = static_cast<unsigned int>(pairesAjoutees_.size());
+		statistiques_.nombrePairesRetirees = static_cast<unsigned int>(pairesRetirees_.size());
+		statistiques_.nombreTests = nombreTests;
+		statistiques_.dureeMiseAJour = std::chrono::duration<double, std::milli>(fin - debut).count();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn DetailsCollision PhaseLarge::calculerCollision(const Paire& paire) const
+	///
+	/// Cette fonction passe les deux sphres d'une paire candidate  la
+	/// phase troite.  La direction obtenue est celle qui loigne la
+	/// seconde sphre de la premire.
+	///
+	/// @param[in] paire : La paire candidate.
+	///
+	/// @return Structure contenant de l'information sur la collision.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	DetailsCollision PhaseLarge::calculerCollision(const Paire& paire) const
+	{
+		const Objet& premier{ objets_[paire.first] };
+		const Objet& second{ objets_[paire.second] };
+		return calculerCollisionSphere(premier.centre, premier.rayon, second.centre, second.rayon);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::signalerAjout(Identifiant identifiant)
+	///
+	/// Cette fonction permet aux classes drives de ragir  l'ajout d'une
+	/// sphre.  Par dfaut, elle ne fait rien.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre ajoute.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::signalerAjout(Identifiant /*identifiant*/)
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::signalerRetrait(Identifiant identifiant)
+	///
+	/// Cette fonction permet aux classes drives de ragir au retrait d'une
+	/// sphre, qui est encore active lors de l'appel.  Par dfaut, elle ne
+	/// fait rien.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre retire.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::signalerRetrait(Identifiant /*identifiant*/)
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PhaseLarge::signalerVidage()
+	///
+	/// Cette fonction permet aux classes drives de ragir au retrait de
+	/// toutes les sphres.  Par dfaut, elle ne fait rien.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void PhaseLarge::signalerVidage()
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void BalayageEtElagage::signalerAjout(Identifiant identifiant)
+	///
+	/// Cette fonction ajoute une sphre  la fin de la liste trie.  Elle
+	/// sera mise  sa place par le tri de la prochaine mise  jour.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre ajoute.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void BalayageEtElagage::signalerAjout(Identifiant identifiant)
+	{
+		ordre_.push_back(identifiant);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void BalayageEtElagage::signalerRetrait(Identifiant identifiant)
+	///
+	/// Cette fonction retire une sphre de la liste trie, qui demeure
+	/// trie.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre retire.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void BalayageEtElagage::signalerRetrait(Identifiant identifiant)
+	{
+		ordre_.erase(std::find(ordre_.begin(), ordre_.end(), identifiant));
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void BalayageEtElagage::signalerVidage()
+	///
+	/// Cette fonction vide la liste trie.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void BalayageEtElagage::signalerVidage()
+	{
+		ordre_.clear();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void BalayageEtElagage::calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests)
+	///
+	/// Cette fonction remet la liste en ordre selon le dbut des intervalles
+	/// sur l'axe de tri, puis la balaie: chaque sphre n'est compare
+	/// qu'aux sphres suivantes dont l'intervalle commence avant la fin du
+	/// sien.
+	///
+	/// Lorsque l'axe de tri change, la liste est trie au complet; sinon,
+	/// elle est presque en ordre et un tri par insertion suffit.
+	///
+	/// @param[out]    paires      : Les paires dont les botes se chevauchent.
+	/// @param[in,out] nombreTests : Le nombre de comparaisons de botes.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void BalayageEtElagage::calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests)
+	{
+		const int axe{ choisirAxe() };
+		if (axe != axe_) {
+			axe_ = axe;
+			std::sort(ordre_.begin(), ordre_.end(), [this](Identifiant gauche, Identifiant droite) {
+				return objets_[gauche].coinMin[axe_] < objets_[droite].coinMin[axe_];
+			});
+		}
+		else {
+			for (size_t i = 1; i < ordre_.size(); ++i) {
+				const Identifiant courant{ ordre_[i] };
+				const double debut{ objets_[courant].coinMin[axe_] };
+				size_t j{ i };
+				for (; j > 0 && objets_[ordre_[j - 1]].coinMin[axe_] > debut; --j)
+					ordre_[j] = ordre_[j - 1];
+				ordre_[j] = courant;
+			}
+		}
+
+		for (size_t i = 0; i < ordre_.size(); ++i) {
+			const Objet& objet{ objets_[ordre_[i]] };
+			for (size_t j = i + 1; j < ordre_.size(); ++j) {
+				const Objet& autre{ objets_[ordre_[j]] };
+				if (autre.coinMin[axe_] > objet.coinMax[axe_])
+					break;
+
+				++nombreTests;
+				if (chevauchent(objet, autre))
+					paires.push_back(construirePaire(ordre_[i], ordre_[j]));
+			}
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn int BalayageEtElagage::choisirAxe() const
+	///
+	/// Cette fonction choisit l'axe de tri selon la variance des centres des
+	/// sphres.  L'axe courant n'est abandonn que si un autre axe est
+	/// nettement plus dispers, pour viter de trier la liste au complet 
+	/// chaque image quand deux axes sont semblables.
+	///
+	/// @return L'axe de tri  utiliser.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	int BalayageEtElagage::choisirAxe() const
+	{
+		if (ordre_.size() < 2)
+			return axe_;
+
+		glm::dvec3 somme{ 0.0 }, sommeCarres{ 0.0 };
+		for (Identifiant identifiant : ordre_) {
+			const glm::dvec3& centre{ objets_[identifiant].centre };
+			somme += centre;
+			sommeCarres += centre * centre;
+		}
+		const double nombre{ static_cast<double>(ordre_.size()) };
+		const glm::dvec3 variance{ sommeCarres / nombre - (somme / nombre) * (somme / nombre) };
+
+		int axe{ axe_ };
+		for (int i = 0; i < 3; ++i) {
+			if (variance[i] > 1.25 * variance[axe])
+				axe = i;
+		}
+		return axe;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn GrilleSpatiale::GrilleSpatiale(double tailleCellule)
+	///
+	/// Ce constructeur assigne la taille des cellules de la grille.  Une
+	/// taille invalide est remplace par une taille unitaire.
+	///
+	/// @param[in] tailleCellule : La taille des cellules.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////////
+	GrilleSpatiale::GrilleSpatiale(double tailleCellule)
+		: tailleCellule_{ tailleCellule > 0.0 ? tailleCellule : 1.0 }
+	{
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void GrilleSpatiale::signalerVidage()
+	///
+	/// Cette fonction retire toutes les cellules de la grille.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void GrilleSpatiale::signalerVidage()
+	{
+		cellules_.clear();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void GrilleSpatiale::calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests)
+	///
+	/// Cette fonction ajoute les sphres une  une aux cellules que couvre
+	/// leur bote, en les comparant aux sphres dj prsentes.  Une paire
+	/// n'est compare que dans la cellule qui contient le coin minimal de
+	/// l'intersection des deux botes: si les botes se chevauchent, ce
+	/// coin appartient aux deux et la paire est compare exactement une
+	/// fois.
+	///
+	/// Les cellules restes vides depuis la dernire mise  jour sont
+	/// retires de la table; les autres sont vides, mais conserves.
+	///
+	/// @param[out]    paires      : Les paires dont les botes se chevauchent.
+	/// @param[in,out] nombreTests : Le nombre de comparaisons de botes.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void GrilleSpatiale::calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests)
+	{
+		for (auto iter = cellules_.begin(); iter != cellules_.end();) {
+			if (iter->second.empty()) {
+				iter = cellules_.erase(iter);
+			}
+			else {
+				iter->second.clear();
+				++iter;
+			}
+		}
+
+		for (Identifiant identifiant = 0; identifiant < objets_.size(); ++identifiant) {
+			const Objet& objet{ objets_[identifiant] };
+			if (!objet.actif)
+				continue;
+
+			const long long xMin{ calculerCellule(objet.coinMin.x) }, xMax{ calculerCellule(objet.coinMax.x) };
+			const long long yMin{ calculerCellule(objet.coinMin.y) }, yMax{ calculerCellule(objet.coinMax.y) };
+			const long long zMin{ calculerCellule(objet.coinMin.z) }, zMax{ calculerCellule(objet.coinMax.z) };
+
+			for (long long x = xMin; x <= xMax; ++x) {
+				for (long long y = yMin; y <= yMax; ++y) {
+					for (long long z = zMin; z <= zMax; ++z) {
+						std::vector<Identifiant>& cellule{ cellules_[calculerCle(x, y, z)] };
+						for (Identifiant autre : cellule) {
+							const Objet& objetAutre{ objets_[autre] };
+							const glm::dvec3 coin{
+								objet.coinMin.x > objetAutre.coinMin.x ? objet.coinMin.x : objetAutre.coinMin.x,
+								objet.coinMin.y > objetAutre.coinMin.y ? objet.coinMin.y : objetAutre.coinMin.y,
+								objet.coinMin.z > objetAutre.coinMin.z ? objet.coinMin.z : objetAutre.coinMin.z
+							};
+							if (calculerCellule(coin.x) != x || calculerCellule(coin.y) != y || calculerCellule(coin.z) != z)
+								continue;
+
+							++nombreTests;
+							if (chevauchent(objet, objetAutre))
+								paires.push_back(construirePaire(identifiant, autre));
+						}
+						cellule.push_back(identifiant);
+					}
+				}
+			}
+		}
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
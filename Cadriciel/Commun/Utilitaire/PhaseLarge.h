@@ -0,0 +1,488 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file PhaseLarge.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_PHASELARGE_H__
+#define __UTILITAIRE_PHASELARGE_H__
+
+#include "AideCollision.h"
+
+#include <cmath>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aidecollision {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class PhaseLarge
+	/// @brief Phase large de la dtection des collisions entre des sphres.
+	///
+	/// Cette classe conserve d'une image  l'autre un ensemble de sphres et
+	/// produit les paires de sphres dont les botes englobantes se
+	/// chevauchent.  Seules ces paires candidates doivent ensuite tre
+	/// passes aux fonctions de la phase troite, comme
+	/// calculerCollisionSphere(), plutt que de tester toutes les paires.
+	///
+	///  chaque mise  jour, les paires apparues et disparues depuis la
+	/// mise  jour prcdente sont aussi calcules, de sorte qu'un
+	/// utilisateur peut ne traiter que les changements.
+	///
+	/// Les classes drives fournissent la faon de calculer les paires.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class PhaseLarge
+	{
+	public:
+		/// Identifiant d'une sphre.
+		using Identifiant = unsigned int;
+		/// Paire candidate, dont le premier identifiant est le plus petit.
+		using Paire = std::pair<Identifiant, Identifiant>;
+
+		/// Mthodes de calcul des paires disponibles.
+		enum Methode {
+			BALAYAGE_ET_ELAGAGE = 0, ///< Tri des intervalles sur un axe.
+			GRILLE_SPATIALE          ///< Grille uniforme adresse par hachage.
+		};
+
+		/// Identifiant ne dsignant aucune sphre.
+		static const Identifiant AUCUN{ 0xFFFFFFFF };
+
+		/// Statistiques de la dernire mise  jour.
+		class Statistiques {
+		public:
+			/// Nombre de sphres.
+			unsigned int nombreObjets{ 0 };
+			/// Nombre de paires candidates.
+			unsigned int nombrePaires{ 0 };
+			/// Nombre de paires apparues depuis la mise  jour prcdente.
+			unsigned int nombrePairesAjoutees{ 0 };
+			/// Nombre de paires disparues depuis la mise  jour prcdente.
+			unsigned int nombrePairesRetirees{ 0 };
+			/// Nombre de comparaisons de botes effectues.
+			unsigned int nombreTests{ 0 };
+			/// Dure de la mise  jour, en millisecondes.
+			double dureeMiseAJour{ 0.0 };
+		};
+
+		/// Cre une phase large utilisant la mthode demande.
+		static std::unique_ptr<PhaseLarge> creer(Methode methode, double tailleCellule);
+
+		/// Destructeur.
+		virtual ~PhaseLarge() = default;
+
+		/// Ajoute une sphre.
+		Identifiant ajouter(const glm::dvec3& centre, double rayon);
+		/// Retire une sphre.
+		void retirer(Identifiant identifiant);
+		/// Dplace une sphre.
+		void deplacer(Identifiant identifiant, const glm::dvec3& centre, double rayon);
+		/// Retire toutes les sphres.
+		void vider();
+
+		/// Calcule les paires candidates pour les positions courantes.
+		void mettreAJour();
+
+		/// Obtient les paires candidates, en ordre croissant.
+		inline const std::vector<Paire>& obtenirPaires() const;
+		/// Obtient les paires apparues lors de la dernire mise  jour.
+		inline const std::vector<Paire>& obtenirPairesAjoutees() const;
+		/// Obtient les paires disparues lors de la dernire mise  jour.
+		inline const std::vector<Paire>& obtenirPairesRetirees() const;
+		/// Obtient les statistiques de la dernire mise  jour.
+		inline const Statistiques& obtenirStatistiques() const;
+
+		/// Vrifie si un identifiant dsigne une sphre prsente.
+		inline bool contient(Identifiant identifiant) const;
+		/// Obtient le centre d'une sphre.
+		inline const glm::dvec3& obtenirCentre(Identifiant identifiant) const;
+		/// Obtient le rayon d'une sphre.
+		inline double obtenirRayon(Identifiant identifiant) const;
+
+		/// Calcule la collision entre les deux sphres d'une paire.
+		DetailsCollision calculerCollision(const Paire& paire) const;
+
+
+	protected:
+		/// Sphre conserve par la phase large, avec sa bote englobante.
+		class Objet {
+		public:
+			/// Centre de la sphre.
+			glm::dvec3 centre;
+			/// Rayon de la sphre.
+			double rayon;
+			/// Coin minimal de la bote englobante.
+			glm::dvec3 coinMin;
+			/// Coin maximal de la bote englobante.
+			glm::dvec3 coinMax;
+			/// Vrai si l'objet est utilis.
+			bool actif;
+		};
+
+		/// Constructeur par dfaut.
+		PhaseLarge() = default;
+
+		/// Signale qu'une sphre vient d'tre ajoute.
+		virtual void signalerAjout(Identifiant identifiant);
+		/// Signale qu'une sphre va tre retire.
+		virtual void signalerRetrait(Identifiant identifiant);
+		/// Signale que toutes les sphres ont t retires.
+		virtual void signalerVidage();
+		/// Calcule les paires dont les botes se chevauchent, sans ordre.
+		virtual void calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests) = 0;
+
+		/// Vrifie si les botes de deux objets se chevauchent.
+		static inline bool chevauchent(const Objet& objet1, const Objet& objet2);
+		/// Construit une paire ordonne.
+		static inline Paire construirePaire(Identifiant identifiant1, Identifiant identifiant2);
+
+		/// Sphres, selon leur identifiant.
+		std::vector<Objet> objets_;
+
+
+	private:
+		/// Constructeur copie dsactiv.
+		PhaseLarge(const PhaseLarge&) = delete;
+		/// Oprateur d'assignation dsactiv.
+		PhaseLarge& operator =(const PhaseLarge&) = delete;
+
+		/// Identifiants librs, rutiliss par les prochains ajouts.
+		std::vector<Identifiant> libres_;
+		/// Identifiants retirs depuis la dernire mise  jour.  Ils ne sont
+		/// rutiliss qu'aprs celle-ci, pour que leurs paires soient
+		/// signales comme disparues.
+		std::vector<Identifiant> retires_;
+		/// Paires candidates de la dernire mise  jour.
+		std::vector<Paire> paires_;
+		/// Paires en cours de calcul, conserves pour viter des allocations.
+		std::vector<Paire> tampon_;
+		/// Paires apparues lors de la dernire mise  jour.
+		std::vector<Paire> pairesAjoutees_;
+		/// Paires disparues lors de la dernire mise  jour.
+		std::vector<Paire> pairesRetirees_;
+		/// Statistiques de la dernire mise  jour.
+		Statistiques statistiques_;
+
+	};
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class BalayageEtElagage
+	/// @brief Phase large qui trie les intervalles des botes sur un axe.
+	///
+	/// La liste des sphres trie selon le dbut de leur intervalle est
+	/// conserve d'une image  l'autre.  Comme les objets bougent peu entre
+	/// deux images, un tri par insertion la remet en ordre en un temps
+	/// presque linaire.  L'axe de tri est celui o les centres sont le plus
+	/// disperss, ce qui limite les chevauchements  examiner.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class BalayageEtElagage : public PhaseLarge
+	{
+	protected:
+		/// Ajoute la sphre  la liste trie.
+		virtual void signalerAjout(Identifiant identifiant);
+		/// Retire la sphre de la liste trie.
+		virtual void signalerRetrait(Identifiant identifiant);
+		/// Vide la liste trie.
+		virtual void signalerVidage();
+		/// Trie les intervalles et balaie la liste.
+		virtual void calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests);
+
+
+	private:
+		/// Choisit l'axe o les centres sont le plus disperss.
+		int choisirAxe() const;
+
+		/// Sphres tries selon le dbut de leur intervalle sur l'axe.
+		std::vector<Identifiant> ordre_;
+		/// Axe de tri courant.
+		int axe_{ 0 };
+
+	};
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class GrilleSpatiale
+	/// @brief Phase large qui rpartit les botes dans une grille uniforme.
+	///
+	/// Seules les cellules occupes existent, dans une table de hachage.
+	/// Deux sphres ne sont compares que si elles partagent une cellule, et
+	/// une paire n'est compare que dans une seule des cellules qu'elle
+	/// partage.  La taille des cellules devrait tre de l'ordre du diamtre
+	/// des sphres.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class GrilleSpatiale : public PhaseLarge
+	{
+	public:
+		/// Constructeur  partir de la taille des cellules.
+		GrilleSpatiale(double tailleCellule);
+
+		/// Obtient la taille des cellules.
+		inline double obtenirTailleCellule() const;
+
+
+	protected:
+		/// Vide la grille.
+		virtual void signalerVidage();
+		/// Rpartit les sphres dans la grille.
+		virtual void calculerPaires(std::vector<Paire>& paires, unsigned int& nombreTests);
+
+
+	private:
+		/// Cl d'une cellule de la grille.
+		using Cle = unsigned long long;
+
+		/// Calcule la coordonne de la cellule qui contient une valeur.
+		inline long long calculerCellule(double valeur) const;
+		/// Calcule la cl d'une cellule.
+		static inline Cle calculerCle(long long x, long long y, long long z);
+
+		/// Taille des cellules.
+		double tailleCellule_;
+		/// Sphres prsentes dans chaque cellule occupe.  Les listes sont
+		/// conserves d'une image  l'autre pour viter des allocations.
+		std::unordered_map< Cle, std::vector<Identifiant> > cellules_;
+
+	};
+
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const std::vector<PhaseLarge::Paire>& PhaseLarge::obtenirPaires() const
+	///
+	/// Cette fonction retourne les paires candidates calcules lors de la
+	/// dernire mise  jour, tries en ordre croissant.
+	///
+	/// @return Les paires candidates.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const std::vector<PhaseLarge::Paire>& PhaseLarge::obtenirPaires() const
+	{
+		return paires_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const std::vector<PhaseLarge::Paire>& PhaseLarge::obtenirPairesAjoutees() const
+	///
+	/// Cette fonction retourne les paires qui sont devenues candidates lors
+	/// de la dernire mise  jour.
+	///
+	/// @return Les paires apparues.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const std::vector<PhaseLarge::Paire>& PhaseLarge::obtenirPairesAjoutees() const
+	{
+		return pairesAjoutees_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const std::vector<PhaseLarge::Paire>& PhaseLarge::obtenirPairesRetirees() const
+	///
+	/// Cette fonction retourne les paires qui ont cess d'tre candidates
+	/// lors de la dernire mise  jour, y compris celles dont une sphre a
+	/// t retire.
+	///
+	/// @return Les paires disparues.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const std::vector<PhaseLarge::Paire>& PhaseLarge::obtenirPairesRetirees() const
+	{
+		return pairesRetirees_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const PhaseLarge::Statistiques& PhaseLarge::obtenirStatistiques() const
+	///
+	/// Cette fonction retourne les statistiques de la dernire mise  jour.
+	///
+	/// @return Les statistiques.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const PhaseLarge::Statistiques& PhaseLarge::obtenirStatistiques() const
+	{
+		return statistiques_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool PhaseLarge::contient(Identifiant identifiant) const
+	///
+	/// Cette fonction vrifie si un identifiant dsigne une sphre prsente
+	/// dans la phase large.
+	///
+	/// @param[in] identifiant : L'identifiant  vrifier.
+	///
+	/// @return Vrai si la sphre est prsente.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool PhaseLarge::contient(Identifiant identifiant) const
+	{
+		return identifiant < objets_.size() && objets_[identifiant].actif;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const glm::dvec3& PhaseLarge::obtenirCentre(Identifiant identifiant) const
+	///
+	/// Cette fonction retourne le centre d'une sphre prsente.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre.
+	///
+	/// @return Le centre de la sphre.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const glm::dvec3& PhaseLarge::obtenirCentre(Identifiant identifiant) const
+	{
+		return objets_[identifiant].centre;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double PhaseLarge::obtenirRayon(Identifiant identifiant) const
+	///
+	/// Cette fonction retourne le rayon d'une sphre prsente.
+	///
+	/// @param[in] identifiant : L'identifiant de la sphre.
+	///
+	/// @return Le rayon de la sphre.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double PhaseLarge::obtenirRayon(Identifiant identifiant) const
+	{
+		return objets_[identifiant].rayon;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool PhaseLarge::chevauchent(const Objet& objet1, const Objet& objet2)
+	///
+	/// Cette fonction vrifie si les botes englobantes de deux objets se
+	/// chevauchent, en incluant le contact.
+	///
+	/// @param[in] objet1 : Le premier objet.
+	/// @param[in] objet2 : Le second objet.
+	///
+	/// @return Vrai si les botes se chevauchent.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline bool PhaseLarge::chevauchent(const Objet& objet1, const Objet& objet2)
+	{
+		return objet1.coinMin.x <= objet2.coinMax.x && objet2.coinMin.x <= objet1.coinMax.x
+			&& objet1.coinMin.y <= objet2.coinMax.y && objet2.coinMin.y <= objet1.coinMax.y
+			&& objet1.coinMin.z <= objet2.coinMax.z && objet2.coinMin.z <= objet1.coinMax.z;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline PhaseLarge::Paire PhaseLarge::construirePaire(Identifiant identifiant1, Identifiant identifiant2)
+	///
+	/// Cette fonction construit une paire dont le premier identifiant est
+	/// le plus petit, pour qu'une paire n'ait qu'une seule reprsentation.
+	///
+	/// @param[in] identifiant1 : Le premier identifiant.
+	/// @param[in] identifiant2 : Le second identifiant.
+	///
+	/// @return La paire ordonne.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline PhaseLarge::Paire PhaseLarge::construirePaire(Identifiant identifiant1, Identifiant identifiant2)
+	{
+		return identifiant1 < identifiant2 ?
+			Paire{ identifiant1, identifiant2 } : Paire{ identifiant2, identifiant1 };
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double GrilleSpatiale::obtenirTailleCellule() const
+	///
+	/// Cette fonction retourne la taille des cellules de la grille.
+	///
+	/// @return La taille des cellules.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double GrilleSpatiale::obtenirTailleCellule() const
+	{
+		return tailleCellule_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline long long GrilleSpatiale::calculerCellule(double valeur) const
+	///
+	/// Cette fonction calcule la coordonne, sur un axe, de la cellule qui
+	/// contient une valeur.
+	///
+	/// @param[in] valeur : La valeur sur l'axe.
+	///
+	/// @return La coordonne de la cellule.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline long long GrilleSpatiale::calculerCellule(double valeur) const
+	{
+		return static_cast<long long>(std::floor(valeur / tailleCellule_));
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline GrilleSpatiale::Cle GrilleSpatiale::calculerCle(long long x, long long y, long long z)
+	///
+	/// Cette fonction combine les coordonnes d'une cellule en une cl, en
+	/// conservant 21 bits par coordonne.  Deux cellules trs loignes
+	/// peuvent partager une cl, ce qui ne cause que des tests de plus.
+	///
+	/// @param[in] x : La coordonne x de la cellule.
+	/// @param[in] y : La coordonne y de la cellule.
+	/// @param[in] z : La coordonne z de la cellule.
+	///
+	/// @return La cl de la cellule.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline GrilleSpatiale::Cle GrilleSpatiale::calculerCle(long long x, long long y, long long z)
+	{
+		const Cle masque{ 0x1FFFFF };
+		return ((static_cast<Cle>(x) & masque) << 42)
+			| ((static_cast<Cle>(y) & masque) << 21)
+			| (static_cast<Cle>(z) & masque);
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+#endif // __UTILITAIRE_PHASELARGE_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
@@ -15,7 +15,7 @@ namespace math {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn Plan3D::Plan3D(const glm::dvec3& normale, const glm::dvec3& pointDuPlan)
+	/// @fn Plan3Dt<T>::Plan3Dt(const Vecteur& normale, const Vecteur& pointDuPlan)
 	///
 	/// Permet de construire un plan  partir d'une normale au plan et d'un
 	/// point sur le plan.  La normale doit tre non nulle.
@@ -26,7 +26,8 @@ namespace math {
 	/// @return Aucune (constructeur).
 	///
 	////////////////////////////////////////////////////////////////////////
-	Plan3D::Plan3D(const glm::dvec3& normale, const glm::dvec3& pointDuPlan)
+	template <class T>
+	Plan3Dt<T>::Plan3Dt(const Vecteur& normale, const Vecteur& pointDuPlan)
 		: normale_{ normale },
 		d_{ -(normale[0] * pointDuPlan[0] + normale[1] * pointDuPlan[1] + normale[2] * pointDuPlan[2]) }
 	{
@@ -37,7 +38,7 @@ namespace math {
 
 	////////////////////////////////////////////////////////////////////////
 	///
-	/// @fn void Plan3D::lireParam(double& a, double& b, double& c, double& d) const
+	/// @fn void Plan3Dt<T>::lireParam(T& a, T& b, T& c, T& d) const
 	///
 	/// Lire les 4 coefficients qui dfinissent un plan en 3D.
 	/// \f$ Ax + By + Cz + D = 0 \f$
@@ -50,7 +51,8 @@ namespace math {
 	/// @return Aucune.
 	///
 	////////////////////////////////////////////////////////////////////////
-	void Plan3D::lireParam(double& a, double& b, double& c, double& d) const
+	template <class T>
+	void Plan3Dt<T>::lireParam(T& a, T& b, T& c, T& d) const
 	{
 		a = normale_[0];
 		b = normale_[1];
@@ -59,6 +61,11 @@ namespace math {
 	}
 
 
+	// Instanciations explicites pour les deux prcisions.
+	template class Plan3Dt<float>;
+	template class Plan3Dt<double>;
+
+
 } // Fin de l'espace de nom math.
 
 
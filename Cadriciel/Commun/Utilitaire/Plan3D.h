@@ -25,42 +25,55 @@ namespace math {
    /// Un plan est dfini par \f$ Ax + By + Cz + D = 0 \f$ o \f$ A, B \f$ et \f$ C  \f$ sont les
    /// composantes en  \f$ x, y \f$ et \f$ z  \f$ d'un vecteur normal au plan.
    ///
+   /// Plan3D est le plan en double prcision et Plan3Df, celui en simple
+   /// prcision.
+   ///
    /// @author DGI-2990
    /// @date 2005-09-27
    ///////////////////////////////////////////////////////////////////////////
-   class Plan3D
+   template <class T>
+   class Plan3Dt
    {
    public:
+      /// Vecteur du type de rel du plan.
+      using Vecteur = glm::detail::tvec3<T, glm::defaultp>;
+
       /// Constructeur.
-      Plan3D(const glm::dvec3& normale, const glm::dvec3& pointDuPlan);
+      Plan3Dt(const Vecteur& normale, const Vecteur& pointDuPlan);
 
       /// Lire la normale du plan.
-      inline const glm::dvec3& lireNormale() const;
+      inline const Vecteur& lireNormale() const;
 
       /// Lire les 4 paramtres qui dfinissent un plan en 3D.
-      void lireParam(double& a, double& b, double& c, double& d) const;
+      void lireParam(T& a, T& b, T& c, T& d) const;
 
 
    private:
       /// La normale du plan.
-      const glm::dvec3 normale_;
+      const Vecteur normale_;
 
       /// Le dcalage du plan.
-      const double   d_;
+      const T   d_;
 
    };
 
+   /// Plan en double prcision.
+   using Plan3D = Plan3Dt<double>;
+   /// Plan en simple prcision.
+   using Plan3Df = Plan3Dt<float>;
+
 
    ///////////////////////////////////////////////////////////////////////////////
    ///
-   /// @fn inline const glm::dvec3& Plan3D::lireNormale() const
+   /// @fn inline const typename Plan3Dt<T>::Vecteur& Plan3Dt<T>::lireNormale() const
    ///
    /// Cette fonction retourne le vecteur normal au plan.
    ///
    /// @return Le vecteur normal au plan.
    ///
    ///////////////////////////////////////////////////////////////////////////////
-   inline const glm::dvec3& Plan3D::lireNormale() const
+   template <class T>
+   inline const typename Plan3Dt<T>::Vecteur& Plan3Dt<T>::lireNormale() const
    {
       return normale_;
    }
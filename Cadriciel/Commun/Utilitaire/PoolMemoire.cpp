@@ -0,0 +1,168 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file PoolMemoire.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#include "PoolMemoire.h"
+
+#include <cassert>
+#include <new>
+
+
+namespace utilitaire {
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn PoolMemoire::PoolMemoire(std::size_t tailleBloc, std::size_t blocsParPlaque)
+	///
+	/// Ce constructeur ne fait qu'initialiser les paramtres du pool.  Aucune
+	/// plaque n'est alloue avant la premire allocation.
+	///
+	/// @param[in] tailleBloc     : La taille minimale de chacun des blocs.
+	/// @param[in] blocsParPlaque : Le nombre de blocs dans chaque plaque.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	PoolMemoire::PoolMemoire(std::size_t tailleBloc, std::size_t blocsParPlaque)
+		: blocsParPlaque_{ blocsParPlaque > 0 ? blocsParPlaque : 1 }
+	{
+		if (tailleBloc < sizeof(BlocLibre))
+			tailleBloc = sizeof(BlocLibre);
+
+		// On arrondit au multiple suprieur de l'alignement.
+		tailleBloc_ = (tailleBloc + ALIGNEMENT - 1) / ALIGNEMENT * ALIGNEMENT;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn PoolMemoire::~PoolMemoire()
+	///
+	/// Ce destructeur libre toutes les plaques.  Les objets encore allous
+	/// dans le pool deviennent alors invalides: le pool doit survivre 
+	/// tous les objets qu'il a allous.
+	///
+	/// @return Aucune (destructeur).
+	///
+	////////////////////////////////////////////////////////////////////////
+	PoolMemoire::~PoolMemoire()
+	{
+		assert(obtenirNombreBlocsUtilises() == 0 && "Des blocs sont encore utiliss  la destruction du pool.");
+
+		for (char* plaque : plaques_)
+			::operator delete(plaque);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void* PoolMemoire::allouer()
+	///
+	/// Cette fonction retourne un bloc libre, en allouant une nouvelle
+	/// plaque au besoin.  Le bloc le plus rcemment libr est rutilis en
+	/// premier, puisqu'il a le plus de chances d'tre encore en cache.
+	///
+	/// @return Le bloc allou.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void* PoolMemoire::allouer()
+	{
+		if (blocsLibres_ == nullptr)
+			ajouterPlaque();
+
+		BlocLibre* bloc{ blocsLibres_ };
+		blocsLibres_ = bloc->suivant;
+		++nombreAllocations_;
+
+		return bloc;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PoolMemoire::liberer(void* bloc)
+	///
+	/// Cette fonction remet un bloc dans la liste des blocs libres.  Le bloc
+	/// doit avoir t allou par ce pool.
+	///
+	/// @param[in] bloc : Le bloc  librer.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void PoolMemoire::liberer(void* bloc)
+	{
+		if (bloc == nullptr)
+			return;
+
+		BlocLibre* libre{ static_cast<BlocLibre*>(bloc) };
+		libre->suivant = blocsLibres_;
+		blocsLibres_ = libre;
+		++nombreLiberations_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool PoolMemoire::relacher()
+	///
+	/// Cette fonction relche d'un coup toutes les plaques du pool, 
+	/// condition qu'aucun bloc ne soit encore utilis.  Elle permet de
+	/// rendre au systme la mmoire d'une scne complte aprs que tous
+	/// ses objets ont t dtruits.
+	///
+	/// @return Vrai si les plaques ont t relches, faux si des blocs
+	///         taient encore utiliss.
+	///
+	////////////////////////////////////////////////////////////////////////
+	bool PoolMemoire::relacher()
+	{
+		if (obtenirNombreBlocsUtilises() != 0)
+			return false;
+
+		for (char* plaque : plaques_)
+			::operator delete(plaque);
+
+		plaques_.clear();
+		blocsLibres_ = nullptr;
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void PoolMemoire::ajouterPlaque()
+	///
+	/// Cette fonction alloue une nouvelle plaque et chane ses blocs dans la
+	/// liste des blocs libres, de faon  ce que les blocs soient ensuite
+	/// distribus dans l'ordre des adresses croissantes.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void PoolMemoire::ajouterPlaque()
+	{
+		char* plaque{ static_cast<char*>(::operator new(tailleBloc_ * blocsParPlaque_)) };
+		plaques_.push_back(plaque);
+
+		for (std::size_t i{ blocsParPlaque_ }; i > 0; --i) {
+			BlocLibre* bloc{ reinterpret_cast<BlocLibre*>(plaque + (i - 1) * tailleBloc_) };
+			bloc->suivant = blocsLibres_;
+			blocsLibres_ = bloc;
+		}
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
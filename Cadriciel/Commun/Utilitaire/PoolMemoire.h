@@ -0,0 +1,183 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file PoolMemoire.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_POOLMEMOIRE_H__
+#define __UTILITAIRE_POOLMEMOIRE_H__
+
+#include <cstddef>
+#include <vector>
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class PoolMemoire
+	/// @brief Allocateur de blocs de taille fixe regroups en plaques
+	///        contigus.
+	///
+	///        Les blocs librs sont recycls (dernier libr, premier
+	///        rallou) et toutes les plaques peuvent tre relches d'un
+	///        coup lorsqu'aucun bloc n'est plus utilis.  Les objets de mme
+	///        type allous par un mme pool sont ainsi voisins en mmoire.
+	///
+	///        Cette classe n'est pas "thread-safe".
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class PoolMemoire
+	{
+	public:
+		/// Alignement garanti pour chacun des blocs.
+		static const std::size_t ALIGNEMENT{ 16 };
+
+		/// Constructeur  partir de la taille des blocs.
+		PoolMemoire(std::size_t tailleBloc, std::size_t blocsParPlaque = 256);
+		/// Destructeur.
+		~PoolMemoire();
+
+		/// Alloue un bloc.
+		void* allouer();
+		/// Remet un bloc dans la liste des blocs libres.
+		void liberer(void* bloc);
+		/// Relche toutes les plaques si aucun bloc n'est utilis.
+		bool relacher();
+
+		/// Obtient la taille (aligne) des blocs.
+		inline std::size_t obtenirTailleBloc() const;
+		/// Obtient le nombre total d'allocations effectues.
+		inline std::size_t obtenirNombreAllocations() const;
+		/// Obtient le nombre total de librations effectues.
+		inline std::size_t obtenirNombreLiberations() const;
+		/// Obtient le nombre de blocs prsentement utiliss.
+		inline std::size_t obtenirNombreBlocsUtilises() const;
+		/// Obtient le nombre de plaques prsentement alloues.
+		inline std::size_t obtenirNombrePlaques() const;
+
+	private:
+		/// Constructeur copie dsactiv.
+		PoolMemoire(const PoolMemoire&) = delete;
+		/// Oprateur d'assignation dsactiv.
+		PoolMemoire& operator =(const PoolMemoire&) = delete;
+
+		/// Alloue une nouvelle plaque et ajoute ses blocs  la liste libre.
+		void ajouterPlaque();
+
+		/// Bloc libre, chan  mme la mmoire du bloc.
+		struct BlocLibre {
+			BlocLibre* suivant;
+		};
+
+		/// Taille de chacun des blocs, arrondie  l'alignement.
+		std::size_t tailleBloc_;
+		/// Nombre de blocs dans chaque plaque.
+		std::size_t blocsParPlaque_;
+
+		/// Plaques alloues.
+		std::vector<char*> plaques_;
+		/// Tte de la liste des blocs libres.
+		BlocLibre* blocsLibres_{ nullptr };
+
+		/// Nombre total d'allocations.
+		std::size_t nombreAllocations_{ 0 };
+		/// Nombre total de librations.
+		std::size_t nombreLiberations_{ 0 };
+	};
+
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t PoolMemoire::obtenirTailleBloc() const
+	///
+	/// Cette fonction retourne la taille des blocs, arrondie  l'alignement.
+	///
+	/// @return La taille des blocs en octets.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t PoolMemoire::obtenirTailleBloc() const
+	{
+		return tailleBloc_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t PoolMemoire::obtenirNombreAllocations() const
+	///
+	/// Cette fonction retourne le nombre total d'allocations effectues
+	/// depuis la cration du pool.
+	///
+	/// @return Le nombre d'allocations.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t PoolMemoire::obtenirNombreAllocations() const
+	{
+		return nombreAllocations_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t PoolMemoire::obtenirNombreLiberations() const
+	///
+	/// Cette fonction retourne le nombre total de librations effectues
+	/// depuis la cration du pool.
+	///
+	/// @return Le nombre de librations.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t PoolMemoire::obtenirNombreLiberations() const
+	{
+		return nombreLiberations_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t PoolMemoire::obtenirNombreBlocsUtilises() const
+	///
+	/// Cette fonction retourne le nombre de blocs prsentement allous et
+	/// non librs.
+	///
+	/// @return Le nombre de blocs utiliss.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t PoolMemoire::obtenirNombreBlocsUtilises() const
+	{
+		return nombreAllocations_ - nombreLiberations_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t PoolMemoire::obtenirNombrePlaques() const
+	///
+	/// Cette fonction retourne le nombre de plaques prsentement alloues.
+	///
+	/// @return Le nombre de plaques.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t PoolMemoire::obtenirNombrePlaques() const
+	{
+		return plaques_.size();
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_POOLMEMOIRE_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,296 @@
+/////////////////////////////////////////////////////////////////////////////////
+/// @file SimulationPhysique.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "SimulationPhysique.h"
+#include "OrdonnanceurTaches.h"
+
+#include <chrono>
+
+namespace aidecollision {
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int SimulationPhysique::ajouter(const Corps& corps)
+	///
+	/// Cette fonction ajoute un corps  la simulation.
+	///
+	/// @param[in] corps : Le corps  ajouter.
+	///
+	/// @return L'indice du corps, utilis dans les paires.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	unsigned int SimulationPhysique::ajouter(const Corps& corps)
+	{
+		corps_.push_back(corps);
+		return static_cast<unsigned int>(corps_.size() - 1);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void SimulationPhysique::vider()
+	///
+	/// Cette fonction retire tous les corps et oublie les lots.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void SimulationPhysique::vider()
+	{
+		corps_.clear();
+		corpsIlots_.clear();
+		pairesIlots_.clear();
+		ilots_.clear();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void SimulationPhysique::avancer(double temps, unsigned int calculsParImage, const std::vector<Paire>& paires)
+	///
+	/// Cette fonction avance la simulation d'une image, divise en
+	/// calculsParImage sous-pas comme le demande la configuration de la
+	/// scne.  Les lots sont construits une fois pour toute l'image 
+	/// partir des paires candidates: celles-ci doivent donc couvrir les
+	/// dplacements de l'image entire, ce que permet la marge des botes
+	/// de la phase large.
+	///
+	/// @param[in] temps           : Dure de l'image, en secondes.
+	/// @param[in] calculsParImage : Nombre de sous-pas de l'image.
+	/// @param[in] paires          : Paires de corps pouvant interagir.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void SimulationPhysique::avancer(double temps, unsigned int calculsParImage, const std::vector<Paire>& paires)
+	{
+		const auto debut = std::chrono::high_resolution_clock::now();
+
+		construireIlots(paires);
+		forces_.resize(corps_.size());
+
+		const unsigned int nombrePas{ calculsParImage > 0 ? calculsParImage : 1 };
+		const double pas{ temps / nombrePas };
+
+		// Les petits lots conscutifs sont regroups pour que chaque tche
+		// ait assez de travail.
+		utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+		utilitaire::GroupeTaches groupe;
+		const unsigned int nombreIlots{ static_cast<unsigned int>(ilots_.size()) };
+		unsigned int premier{ 0 };
+		unsigned int tailleLot{ 0 };
+		for (unsigned int i{ 0 }; i < nombreIlots; ++i) {
+			tailleLot += ilots_[i].nombreCorps;
+			if (tailleLot >= tailleLot_ || i + 1 == nombreIlots) {
+				const unsigned int fin{ i + 1 };
+				ordonnanceur->lancer(groupe, [this, premier, fin, pas, nombrePas] {
+					for (unsigned int j{ premier }; j < fin; ++j)
+						simulerIlot(ilots_[j], pas, nombrePas);
+				});
+				premier = fin;
+				tailleLot = 0;
+			}
+		}
+		ordonnanceur->attendre(groupe);
+
+		const auto fin = std::chrono::high_resolution_clock::now();
+		dureeImage_ = std::chrono::duration<double, std::milli>(fin - debut).count();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int SimulationPhysique::trouver(unsigned int indice)
+	///
+	/// Cette fonction trouve le reprsentant de l'ensemble d'un corps, en
+	/// raccourcissant au passage le chemin vers celui-ci.
+	///
+	/// @param[in] indice : L'indice du corps.
+	///
+	/// @return L'indice du reprsentant.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	unsigned int SimulationPhysique::trouver(unsigned int indice)
+	{
+		while (parents_[indice] != indice) {
+			parents_[indice] = parents_[parents_[indice]];
+			indice = parents_[indice];
+		}
+		return indice;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void SimulationPhysique::construireIlots(const std::vector<Paire>& paires)
+	///
+	/// Cette fonction regroupe les corps mobiles relis par les paires en
+	/// lots.  Le reprsentant d'un ensemble est toujours son plus petit
+	/// indice, de sorte que les lots, leurs corps et leurs paires sont
+	/// rangs dans un ordre qui ne dpend que des donnes.
+	///
+	/// @param[in] paires : Paires de corps pouvant interagir.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void SimulationPhysique::construireIlots(const std::vector<Paire>& paires)
+	{
+		const unsigned int nombreCorps{ static_cast<unsigned int>(corps_.size()) };
+
+		parents_.resize(nombreCorps);
+		for (unsigned int i{ 0 }; i < nombreCorps; ++i)
+			parents_[i] = i;
+
+		for (const Paire& paire : paires) {
+			if (corps_[paire.first].masse <= 0.0 || corps_[paire.second].masse <= 0.0)
+				continue;
+			const unsigned int racine1{ trouver(paire.first) };
+			const unsigned int racine2{ trouver(paire.second) };
+			if (racine1 < racine2)
+				parents_[racine2] = racine1;
+			else if (racine2 < racine1)
+				parents_[racine1] = racine2;
+		}
+
+		// Numrotation des lots, dans l'ordre de leur reprsentant, qui est
+		// aussi leur premier corps.  Les corps immobiles n'en ont pas.
+		std::vector<unsigned int> ilotCorps(nombreCorps, 0);
+		ilots_.clear();
+		for (unsigned int i{ 0 }; i < nombreCorps; ++i) {
+			if (corps_[i].masse <= 0.0)
+				continue;
+			const unsigned int racine{ trouver(i) };
+			if (racine == i) {
+				ilotCorps[i] = static_cast<unsigned int>(ilots_.size());
+				ilots_.push_back(Ilot{ 0, 0, 0, 0, 0.0 });
+			}
+			else {
+				ilotCorps[i] = ilotCorps[racine];
+			}
+			++ilots_[ilotCorps[i]].nombreCorps;
+		}
+
+		for (const Paire& paire : paires) {
+			const unsigned int mobile{ corps_[paire.first].masse > 0.0 ? paire.first : paire.second };
+			if (corps_[mobile].masse > 0.0)
+				++ilots_[ilotCorps[mobile]].nombrePaires;
+		}
+
+		// Tri par dnombrement des corps et des paires selon leur lot.
+		unsigned int premierCorps{ 0 };
+		unsigned int premierePaire{ 0 };
+		for (Ilot& ilot : ilots_) {
+			ilot.premierCorps = premierCorps;
+			ilot.premierePaire = premierePaire;
+			premierCorps += ilot.nombreCorps;
+			premierePaire += ilot.nombrePaires;
+		}
+
+		corpsIlots_.resize(premierCorps);
+		pairesIlots_.resize(premierePaire);
+		std::vector<unsigned int> prochainCorps(ilots_.size());
+		std::vector<unsigned int> prochainePaire(ilots_.size());
+		for (std::size_t i{ 0 }; i < ilots_.size(); ++i) {
+			prochainCorps[i] = ilots_[i].premierCorps;
+			prochainePaire[i] = ilots_[i].premierePaire;
+		}
+		for (unsigned int i{ 0 }; i < nombreCorps; ++i) {
+			if (corps_[i].masse > 0.0)
+				corpsIlots_[prochainCorps[ilotCorps[i]]++] = i;
+		}
+		for (const Paire& paire : paires) {
+			const unsigned int mobile{ corps_[paire.first].masse > 0.0 ? paire.first : paire.second };
+			if (corps_[mobile].masse > 0.0)
+				pairesIlots_[prochainePaire[ilotCorps[mobile]]++] = paire;
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void SimulationPhysique::simulerIlot(Ilot& ilot, double pas, unsigned int nombrePas)
+	///
+	/// Cette fonction simule un lot pendant plusieurs sous-pas.   chaque
+	/// sous-pas, les forces de rebondissement et d'amortissement de chaque
+	/// paire en collision sont accumules, puis les corps sont intgrs
+	/// par la mthode d'Euler semi-implicite.
+	///
+	/// La direction de la collision est normalise avant le calcul des
+	/// forces, puisque calculerCollisionSphere() la retourne telle quelle.
+	///
+	/// @param[in,out] ilot      : L'lot, dont la dure est mise  jour.
+	/// @param[in]     pas       : Dure d'un sous-pas.
+	/// @param[in]     nombrePas : Nombre de sous-pas.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void SimulationPhysique::simulerIlot(Ilot& ilot, double pas, unsigned int nombrePas)
+	{
+		const auto debut = std::chrono::high_resolution_clock::now();
+
+		const unsigned int* const corps{ corpsIlots_.data() + ilot.premierCorps };
+		const Paire* const paires{ pairesIlots_.data() + ilot.premierePaire };
+
+		for (unsigned int etape{ 0 }; etape < nombrePas; ++etape) {
+			for (unsigned int i{ 0 }; i < ilot.nombreCorps; ++i)
+				forces_[corps[i]] = gravite_ * corps_[corps[i]].masse;
+
+			for (unsigned int i{ 0 }; i < ilot.nombrePaires; ++i) {
+				const Corps& corps1 = corps_[paires[i].first];
+				const Corps& corps2 = corps_[paires[i].second];
+
+				DetailsCollision details{ calculerCollisionSphere(
+					corps2.position, corps2.rayon, corps1.position, corps1.rayon
+					) };
+				if (details.type == COLLISION_AUCUNE)
+					continue;
+
+				const double distance{ glm::length(details.direction) };
+				if (distance > 0.0)
+					details.direction /= distance;
+
+				const double rebondissement{ calculerCombinaisonRebondissement(
+					corps1.constanteRebondissement, corps2.constanteRebondissement
+					) };
+				const double amortissement{ calculerCombinaisonAmortissement(
+					corps1.constanteAmortissement, corps2.constanteAmortissement
+					) };
+				const glm::dvec3 force{
+					calculerForceRebondissement3D(details, rebondissement) +
+					calculerForceAmortissement3D(details, corps1.vitesse - corps2.vitesse, amortissement)
+				};
+
+				if (corps1.masse > 0.0)
+					forces_[paires[i].first] += force;
+				if (corps2.masse > 0.0)
+					forces_[paires[i].second] -= force;
+			}
+
+			for (unsigned int i{ 0 }; i < ilot.nombreCorps; ++i) {
+				Corps& mobile = corps_[corps[i]];
+				mobile.vitesse += forces_[corps[i]] * (pas / mobile.masse);
+				mobile.position += mobile.vitesse * pas;
+			}
+		}
+
+		const auto fin = std::chrono::high_resolution_clock::now();
+		ilot.duree = std::chrono::duration<double, std::milli>(fin - debut).count();
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
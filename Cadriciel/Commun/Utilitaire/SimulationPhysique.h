@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file SimulationPhysique.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_SIMULATIONPHYSIQUE_H__
+#define __UTILITAIRE_SIMULATIONPHYSIQUE_H__
+
+#include "AideCollision.h"
+
+#include <utility>
+#include <vector>
+
+namespace aidecollision {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class SimulationPhysique
+	/// @brief Simulation de corps sphriques qui rebondissent les uns sur
+	///        les autres, dcoupe en lots indpendants.
+	///
+	///  chaque image, les corps relis par une paire candidate, normalement
+	/// fournie par la phase large, sont regroups en lots par union et
+	/// recherche.  Les corps d'lots diffrents ne peuvent pas interagir
+	/// pendant l'image: chaque lot effectue donc tous les sous-pas de
+	/// l'image de faon indpendante, et les lots sont rpartis en tches
+	/// sur l'ordonnanceur.
+	///
+	/// Les calculs d'un lot se font toujours dans le mme ordre et chaque
+	/// lot n'crit que dans ses propres corps.  Les rsultats sont donc
+	/// identiques, au bit prs, que l'ordonnanceur soit en mode mono-fil ou
+	/// non.
+	///
+	/// Un corps de masse nulle est immobile.  Il ne relie pas les lots:
+	/// plusieurs lots peuvent le toucher, puisqu'ils ne font que le lire.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class SimulationPhysique
+	{
+	public:
+		/// Paire de corps pouvant interagir.
+		using Paire = std::pair<unsigned int, unsigned int>;
+
+		/// Corps sphrique simul.
+		class Corps {
+		public:
+			/// Position du centre.
+			glm::dvec3 position;
+			/// Vitesse.
+			glm::dvec3 vitesse;
+			/// Rayon.
+			double rayon;
+			/// Masse, nulle pour un corps immobile.
+			double masse;
+			/// Constante de rebondissement.
+			double constanteRebondissement;
+			/// Constante d'amortissement.
+			double constanteAmortissement;
+		};
+
+		/// lot de corps simuls ensemble lors de la dernire image.
+		class Ilot {
+		public:
+			/// Premier corps de l'lot dans la liste des corps des lots.
+			unsigned int premierCorps;
+			/// Nombre de corps mobiles de l'lot.
+			unsigned int nombreCorps;
+			/// Premire paire de l'lot dans la liste des paires des lots.
+			unsigned int premierePaire;
+			/// Nombre de paires de l'lot.
+			unsigned int nombrePaires;
+			/// Dure de la simulation de l'lot, en millisecondes.
+			double duree;
+		};
+
+		/// Ajoute un corps et retourne son indice.
+		unsigned int ajouter(const Corps& corps);
+		/// Retire tous les corps.
+		void vider();
+
+		/// Obtient un corps.
+		inline Corps& obtenirCorps(unsigned int indice);
+		/// Obtient un corps (version constante).
+		inline const Corps& obtenirCorps(unsigned int indice) const;
+		/// Obtient le nombre de corps.
+		inline unsigned int obtenirNombreCorps() const;
+
+		/// Assigne l'acclration applique  tous les corps mobiles.
+		inline void assignerGravite(const glm::dvec3& gravite);
+		/// Assigne le nombre minimal de corps simuls par une tche.
+		inline void assignerTailleLot(unsigned int tailleLot);
+
+		/// Avance la simulation d'une image.
+		void avancer(double temps, unsigned int calculsParImage, const std::vector<Paire>& paires);
+
+		/// Obtient les lots de la dernire image.
+		inline const std::vector<Ilot>& obtenirIlots() const;
+		/// Obtient les indices des corps, regroups par lot.
+		inline const std::vector<unsigned int>& obtenirCorpsIlots() const;
+		/// Obtient la dure de la dernire image, en millisecondes.
+		inline double obtenirDureeImage() const;
+
+
+	private:
+		/// Trouve le reprsentant de l'ensemble d'un corps.
+		unsigned int trouver(unsigned int indice);
+		/// Regroupe les corps et les paires en lots.
+		void construireIlots(const std::vector<Paire>& paires);
+		/// Simule un lot pendant plusieurs sous-pas.
+		void simulerIlot(Ilot& ilot, double pas, unsigned int nombrePas);
+
+		/// Corps simuls.
+		std::vector<Corps> corps_;
+		/// Forces accumules sur chaque corps pendant un sous-pas.
+		std::vector<glm::dvec3> forces_;
+		/// Parent de chaque corps pour l'union et recherche.
+		std::vector<unsigned int> parents_;
+		/// Indices des corps mobiles, regroups par lot.
+		std::vector<unsigned int> corpsIlots_;
+		/// Paires, regroupes par lot.
+		std::vector<Paire> pairesIlots_;
+		/// lots de la dernire image.
+		std::vector<Ilot> ilots_;
+		/// Acclration applique aux corps mobiles.
+		glm::dvec3 gravite_{ 0.0, 0.0, 0.0 };
+		/// Nombre minimal de corps simuls par une tche.
+		unsigned int tailleLot_{ 64 };
+		/// Dure de la dernire image, en millisecondes.
+		double dureeImage_{ 0.0 };
+
+	};
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline SimulationPhysique::Corps& SimulationPhysique::obtenirCorps(unsigned int indice)
+	///
+	/// Cette fonction retourne un corps de la simulation.
+	///
+	/// @param[in] indice : L'indice du corps.
+	///
+	/// @return Le corps.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline SimulationPhysique::Corps& SimulationPhysique::obtenirCorps(unsigned int indice)
+	{
+		return corps_[indice];
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const SimulationPhysique::Corps& SimulationPhysique::obtenirCorps(unsigned int indice) const
+	///
+	/// Cette fonction retourne un corps de la simulation (version
+	/// constante).
+	///
+	/// @param[in] indice : L'indice du corps.
+	///
+	/// @return Le corps.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const SimulationPhysique::Corps& SimulationPhysique::obtenirCorps(unsigned int indice) const
+	{
+		return corps_[indice];
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int SimulationPhysique::obtenirNombreCorps() const
+	///
+	/// Cette fonction retourne le nombre de corps de la simulation.
+	///
+	/// @return Le nombre de corps.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline unsigned int SimulationPhysique::obtenirNombreCorps() const
+	{
+		return static_cast<unsigned int>(corps_.size());
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void SimulationPhysique::assignerGravite(const glm::dvec3& gravite)
+	///
+	/// Cette fonction assigne l'acclration applique  tous les corps
+	/// mobiles.
+	///
+	/// @param[in] gravite : L'acclration.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline void SimulationPhysique::assignerGravite(const glm::dvec3& gravite)
+	{
+		gravite_ = gravite;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void SimulationPhysique::assignerTailleLot(unsigned int tailleLot)
+	///
+	/// Cette fonction assigne le nombre minimal de corps simuls par une
+	/// tche.  Les petits lots conscutifs sont regroups dans une mme
+	/// tche jusqu' atteindre ce nombre.
+	///
+	/// @param[in] tailleLot : Le nombre minimal de corps d'une tche.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline void SimulationPhysique::assignerTailleLot(unsigned int tailleLot)
+	{
+		tailleLot_ = tailleLot;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const std::vector<SimulationPhysique::Ilot>& SimulationPhysique::obtenirIlots() const
+	///
+	/// Cette fonction retourne les lots de la dernire image, en ordre
+	/// croissant de leur premier corps, avec la dure de leur simulation.
+	///
+	/// @return Les lots.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const std::vector<SimulationPhysique::Ilot>& SimulationPhysique::obtenirIlots() const
+	{
+		return ilots_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const std::vector<unsigned int>& SimulationPhysique::obtenirCorpsIlots() const
+	///
+	/// Cette fonction retourne les indices des corps mobiles, regroups
+	/// par lot et dsigns par Ilot::premierCorps et Ilot::nombreCorps.
+	///
+	/// @return Les indices des corps.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const std::vector<unsigned int>& SimulationPhysique::obtenirCorpsIlots() const
+	{
+		return corpsIlots_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline double SimulationPhysique::obtenirDureeImage() const
+	///
+	/// Cette fonction retourne la dure totale de la dernire image, lots
+	/// et construction des lots compris.
+	///
+	/// @return La dure, en millisecondes.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline double SimulationPhysique::obtenirDureeImage() const
+	{
+		return dureeImage_;
+	}
+
+
+} // Fin de l'espace de nom aidecollision.
+
+
+#endif // __UTILITAIRE_SIMULATIONPHYSIQUE_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
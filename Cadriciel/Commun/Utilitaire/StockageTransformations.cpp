@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file StockageTransformations.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#include "StockageTransformations.h"
+
+#include <cassert>
+
+
+namespace utilitaire {
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void StockageTransformations::reserver(std::size_t nombre)
+	///
+	/// Cette fonction rserve de l'espace dans les tableaux de composantes
+	/// afin d'viter les rallocations lors de l'ajout de nombreux objets.
+	///
+	/// @param[in] nombre : Le nombre de transformations  prvoir.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void StockageTransformations::reserver(std::size_t nombre)
+	{
+		positions_.reserve(nombre);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn StockageTransformations::Indice StockageTransformations::allouer(const glm::dvec3& position)
+	///
+	/// Cette fonction alloue une transformation, en rutilisant au besoin
+	/// l'indice libr le plus rcemment.
+	///
+	/// @param[in] position : La position initiale.
+	///
+	/// @return L'indice de la transformation alloue.
+	///
+	////////////////////////////////////////////////////////////////////////
+	StockageTransformations::Indice StockageTransformations::allouer(const glm::dvec3& position)
+	{
+		if (!indicesLibres_.empty()) {
+			const Indice indice{ indicesLibres_.back() };
+			indicesLibres_.pop_back();
+			positions_[indice] = position;
+			return indice;
+		}
+
+		positions_.push_back(position);
+		return static_cast<Indice>(positions_.size() - 1);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void StockageTransformations::liberer(Indice indice)
+	///
+	/// Cette fonction libre une transformation.  Son indice pourra tre
+	/// rutilis par une allocation subsquente.
+	///
+	/// @param[in] indice : L'indice de la transformation  librer.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void StockageTransformations::liberer(Indice indice)
+	{
+		assert(indice < positions_.size());
+		indicesLibres_.push_back(indice);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void StockageTransformations::translater(const glm::dvec3& deplacement)
+	///
+	/// Cette fonction dplace toutes les positions d'un mme vecteur en un
+	/// seul parcours du tableau contigu.  Les cases libres sont aussi
+	/// dplaces, ce qui est sans consquence et vite un test par case.
+	/// La version du stockage est incrmente.
+	///
+	/// @param[in] deplacement : Le dplacement  appliquer.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	void StockageTransformations::translater(const glm::dvec3& deplacement)
+	{
+		modifierPositions([&deplacement](glm::dvec3* positions, std::size_t taille) {
+			for (std::size_t i = 0; i < taille; ++i)
+				positions[i] += deplacement;
+		});
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
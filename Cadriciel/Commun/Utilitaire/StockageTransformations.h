@@ -0,0 +1,239 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file StockageTransformations.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_STOCKAGETRANSFORMATIONS_H__
+#define __UTILITAIRE_STOCKAGETRANSFORMATIONS_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "glm\glm.hpp"
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class StockageTransformations
+	/// @brief Stockage contigu ("structure de tableaux") des transformations
+	///        d'un ensemble d'objets.
+	///
+	///        Chaque objet reoit un indice stable dans les tableaux de
+	///        composantes.  Les traitements de masse peuvent alors parcourir
+	///        directement les tableaux au lieu de visiter chacun des objets.
+	///        Seules les positions sont stockes pour l'instant; d'autres
+	///        composantes (rotation, chelle) s'ajoutent sous la forme de
+	///        tableaux parallles indexs de la mme faon.
+	///
+	///        Les indices librs sont rutiliss.  Les cases libres restent
+	///        dans les tableaux et peuvent tre modifies sans consquence
+	///        par les traitements de masse.
+	///
+	///        Chaque modification en masse incrmente la version du
+	///        stockage.  Les objets qui conservent des donnes drives des
+	///        positions (par exemple des matrices monde) retiennent la
+	///        version  laquelle ils les ont calcules et les recalculent
+	///        lorsqu'elle change, sans qu'il soit ncessaire de les visiter.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class StockageTransformations
+	{
+	public:
+		/// Type des indices des transformations.
+		using Indice = unsigned int;
+		/// Type de la version des positions.
+		using Version = std::uint64_t;
+
+		/// Constructeur par dfaut.
+		StockageTransformations() = default;
+
+		/// Rserve de l'espace pour un certain nombre de transformations.
+		void reserver(std::size_t nombre);
+		/// Alloue une transformation et retourne son indice.
+		Indice allouer(const glm::dvec3& position);
+		/// Libre une transformation.
+		void liberer(Indice indice);
+
+		/// Obtient une position.
+		inline const glm::dvec3& obtenirPosition(Indice indice) const;
+		/// Assigne une position.
+		inline void assignerPosition(Indice indice, const glm::dvec3& position);
+
+		/// Obtient le tableau contigu des positions.
+		inline const glm::dvec3* obtenirPositions() const;
+		/// Modifie en masse le tableau contigu des positions.
+		template <class Fonction>
+		void modifierPositions(Fonction fonction);
+		/// Obtient la taille des tableaux, cases libres comprises.
+		inline std::size_t obtenirTaille() const;
+		/// Obtient le nombre de transformations alloues.
+		inline std::size_t obtenirNombreTransformations() const;
+
+		/// Obtient la version des positions, incrmente  chaque
+		/// modification en masse.
+		inline Version obtenirVersion() const;
+
+		/// Dplace toutes les positions d'un mme vecteur.
+		void translater(const glm::dvec3& deplacement);
+
+	private:
+		/// Constructeur copie dsactiv.
+		StockageTransformations(const StockageTransformations&) = delete;
+		/// Oprateur d'assignation dsactiv.
+		StockageTransformations& operator =(const StockageTransformations&) = delete;
+
+		/// Positions, indexes par les indices des transformations.
+		std::vector<glm::dvec3> positions_;
+		/// Indices librs,  rutiliser.
+		std::vector<Indice> indicesLibres_;
+		/// Version des positions.
+		Version version_{ 0 };
+	};
+
+
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const glm::dvec3& StockageTransformations::obtenirPosition(Indice indice) const
+	///
+	/// Cette fonction retourne la position associe  un indice.
+	///
+	/// @param[in] indice : L'indice de la transformation.
+	///
+	/// @return La position.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const glm::dvec3& StockageTransformations::obtenirPosition(Indice indice) const
+	{
+		return positions_[indice];
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline void StockageTransformations::assignerPosition(Indice indice, const glm::dvec3& position)
+	///
+	/// Cette fonction assigne la position associe  un indice.
+	///
+	/// @param[in] indice   : L'indice de la transformation.
+	/// @param[in] position : La nouvelle position.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline void StockageTransformations::assignerPosition(Indice indice, const glm::dvec3& position)
+	{
+		positions_[indice] = position;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const glm::dvec3* StockageTransformations::obtenirPositions() const
+	///
+	/// Cette fonction retourne le tableau contigu des positions, de taille
+	/// obtenirTaille().  Le pointeur est invalid par la prochaine
+	/// allocation.
+	///
+	/// @return Le tableau des positions.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const glm::dvec3* StockageTransformations::obtenirPositions() const
+	{
+		return positions_.data();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void StockageTransformations::modifierPositions(Fonction fonction)
+	///
+	/// Cette fonction donne accs en criture au tableau contigu des
+	/// positions pour une modification en masse, puis incrmente la
+	/// version du stockage.  C'est la seule faon de modifier plusieurs
+	/// positions sans passer par les objets, ce qui garantit que leurs
+	/// donnes drives seront recalcules.
+	///
+	/// @param[in] fonction : Fonction appele avec le tableau des positions
+	///                       (glm::dvec3*) et sa taille (std::size_t).
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class Fonction>
+	void StockageTransformations::modifierPositions(Fonction fonction)
+	{
+		fonction(positions_.data(), positions_.size());
+		++version_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline StockageTransformations::Version StockageTransformations::obtenirVersion() const
+	///
+	/// Cette fonction retourne la version des positions, qui change 
+	/// chaque modification en masse (translater(), modifierPositions()).
+	/// Les assignations individuelles ne la changent pas: elles passent
+	/// par les objets, qui s'en chargent eux-mmes.
+	///
+	/// @return La version des positions.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline StockageTransformations::Version StockageTransformations::obtenirVersion() const
+	{
+		return version_;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t StockageTransformations::obtenirTaille() const
+	///
+	/// Cette fonction retourne la taille des tableaux de composantes, en
+	/// comptant les cases libres.
+	///
+	/// @return La taille des tableaux.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t StockageTransformations::obtenirTaille() const
+	{
+		return positions_.size();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline std::size_t StockageTransformations::obtenirNombreTransformations() const
+	///
+	/// Cette fonction retourne le nombre de transformations prsentement
+	/// alloues.
+	///
+	/// @return Le nombre de transformations.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline std::size_t StockageTransformations::obtenirNombreTransformations() const
+	{
+		return positions_.size() - indicesLibres_.size();
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_STOCKAGETRANSFORMATIONS_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,355 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file TableCreneaux.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_TABLECRENEAUX_H__
+#define __UTILITAIRE_TABLECRENEAUX_H__
+
+#include <vector>
+
+
+namespace utilitaire {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @struct Poignee
+	/// @brief Rfrence  un lment d'une TableCreneaux, forme de l'indice
+	///        de son crneau et de la gnration de ce crneau.
+	///
+	///        Une poigne construite par dfaut est nulle et ne dsigne
+	///        jamais aucun lment.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	struct Poignee
+	{
+		/// Indice du crneau.
+		unsigned int indice{ 0 };
+		/// Gnration du crneau au moment de l'insertion.
+		unsigned int generation{ 0 };
+
+		/// Vrifie si la poigne est nulle.
+		inline bool estNulle() const { return generation == 0; }
+		/// Compare deux poignes.
+		inline bool operator==(const Poignee& autre) const
+		{
+			return indice == autre.indice && generation == autre.generation;
+		}
+		/// Compare deux poignes.
+		inline bool operator!=(const Poignee& autre) const { return !(*this == autre); }
+	};
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class TableCreneaux
+	/// @brief Table d'lments dsigns par des poignes gnrationnelles
+	///        ("slot map").
+	///
+	///        Chaque lment insr reoit une poigne qui permet de le
+	///        retrouver en temps constant.  Lorsqu'un lment est retir, la
+	///        gnration de son crneau est incrmente: les poignes qui le
+	///        dsignaient deviennent primes et sont dtectes comme telles,
+	///        mme si le crneau est rutilis par la suite.
+	///
+	///        Les lments sont conservs de manire contigu, sans trou: un
+	///        retrait dplace le dernier lment  la place de l'lment
+	///        retir.  Les lments peuvent donc tre parcourus directement,
+	///        dans un ordre qui n'est toutefois pas prserv.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	template <class T>
+	class TableCreneaux
+	{
+	public:
+		/// Itrateur sur les lments.
+		using iterator = typename std::vector<T>::iterator;
+		/// Itrateur constant sur les lments.
+		using const_iterator = typename std::vector<T>::const_iterator;
+
+		/// Insre un lment et retourne sa poigne.
+		Poignee inserer(const T& valeur);
+		/// Retire l'lment dsign par une poigne.
+		bool retirer(Poignee poignee);
+		/// Retire tous les lments, en primant toutes les poignes.
+		void vider();
+		/// Libre la mmoire inutilise des lments.
+		void compacter();
+
+		/// Obtient l'lment dsign par une poigne.
+		T* obtenir(Poignee poignee);
+		/// Obtient l'lment dsign par une poigne (version constante).
+		const T* obtenir(Poignee poignee) const;
+		/// Vrifie si une poigne dsigne un lment de la table.
+		inline bool contient(Poignee poignee) const;
+
+		/// Obtient le nombre d'lments.
+		inline unsigned int obtenirTaille() const;
+		/// Obtient le nombre de crneaux, occups ou non.
+		inline unsigned int obtenirNombreCreneaux() const;
+
+		/// Dbut des lments.
+		inline iterator begin() { return valeurs_.begin(); }
+		/// Fin des lments.
+		inline iterator end() { return valeurs_.end(); }
+		/// Dbut des lments (version constante).
+		inline const_iterator begin() const { return valeurs_.begin(); }
+		/// Fin des lments (version constante).
+		inline const_iterator end() const { return valeurs_.end(); }
+
+	private:
+		/// Indique la fin de la liste des crneaux libres.
+		static const unsigned int AUCUN{ 0xFFFFFFFF };
+
+		/// Un crneau: position de son lment (ou prochain crneau libre)
+		/// et gnration courante.  Un crneau est occup si sa gnration
+		/// est impaire.
+		struct Creneau {
+			unsigned int position;
+			unsigned int generation;
+		};
+
+		/// Crneaux, selon leur indice.
+		std::vector<Creneau> creneaux_;
+		/// lments, contigus.
+		std::vector<T> valeurs_;
+		/// Indice du crneau de chaque lment.
+		std::vector<unsigned int> proprietaires_;
+		/// Premier crneau libre.
+		unsigned int premierLibre_{ AUCUN };
+	};
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Poignee TableCreneaux<T>::inserer(const T& valeur)
+	///
+	/// Cette fonction insre un lment  la fin des lments contigus, dans
+	/// un crneau libre s'il en existe un ou dans un nouveau crneau sinon.
+	///
+	/// @param[in] valeur : L'lment  insrer.
+	///
+	/// @return La poigne de l'lment.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	Poignee TableCreneaux<T>::inserer(const T& valeur)
+	{
+		unsigned int indice;
+		if (premierLibre_ != AUCUN) {
+			indice = premierLibre_;
+			premierLibre_ = creneaux_[indice].position;
+		}
+		else {
+			indice = static_cast<unsigned int>(creneaux_.size());
+			creneaux_.push_back(Creneau{ AUCUN, 0 });
+		}
+
+		Creneau& creneau = creneaux_[indice];
+		creneau.position = static_cast<unsigned int>(valeurs_.size());
+		++creneau.generation;
+		valeurs_.push_back(valeur);
+		proprietaires_.push_back(indice);
+
+		Poignee poignee;
+		poignee.indice = indice;
+		poignee.generation = creneau.generation;
+		return poignee;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool TableCreneaux<T>::retirer(Poignee poignee)
+	///
+	/// Cette fonction retire l'lment dsign par une poigne.  Le dernier
+	/// lment prend sa place, et le crneau est libr pour une prochaine
+	/// insertion avec une nouvelle gnration.
+	///
+	/// @param[in] poignee : La poigne de l'lment.
+	///
+	/// @return Faux si la poigne tait nulle ou prime.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	bool TableCreneaux<T>::retirer(Poignee poignee)
+	{
+		if (!contient(poignee))
+			return false;
+
+		Creneau& creneau = creneaux_[poignee.indice];
+		const unsigned int position{ creneau.position };
+		const unsigned int derniere{ static_cast<unsigned int>(valeurs_.size()) - 1 };
+		if (position != derniere) {
+			valeurs_[position] = valeurs_[derniere];
+			proprietaires_[position] = proprietaires_[derniere];
+			creneaux_[proprietaires_[position]].position = position;
+		}
+		valeurs_.pop_back();
+		proprietaires_.pop_back();
+
+		++creneau.generation;
+		creneau.position = premierLibre_;
+		premierLibre_ = poignee.indice;
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void TableCreneaux<T>::vider()
+	///
+	/// Cette fonction retire tous les lments.  Les crneaux sont
+	/// conservs et leur gnration incrmente, de sorte que toutes les
+	/// poignes distribues jusqu'ici deviennent primes.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void TableCreneaux<T>::vider()
+	{
+		for (unsigned int indice : proprietaires_) {
+			Creneau& creneau = creneaux_[indice];
+			++creneau.generation;
+			creneau.position = premierLibre_;
+			premierLibre_ = indice;
+		}
+		valeurs_.clear();
+		proprietaires_.clear();
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void TableCreneaux<T>::compacter()
+	///
+	/// Cette fonction libre la capacit inutilise des tableaux d'lments,
+	/// par exemple aprs le retrait d'un grand nombre d'lments.  Les
+	/// crneaux ne sont jamais librs, car leur gnration doit survivre
+	/// pour dtecter les poignes primes.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	void TableCreneaux<T>::compacter()
+	{
+		std::vector<T>(valeurs_).swap(valeurs_);
+		std::vector<unsigned int>(proprietaires_).swap(proprietaires_);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn T* TableCreneaux<T>::obtenir(Poignee poignee)
+	///
+	/// Cette fonction retourne l'lment dsign par une poigne, en temps
+	/// constant.  Le pointeur retourn n'est valide que jusqu' la
+	/// prochaine insertion ou au prochain retrait.
+	///
+	/// @param[in] poignee : La poigne de l'lment.
+	///
+	/// @return L'lment, ou nullptr si la poigne est nulle ou prime.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	T* TableCreneaux<T>::obtenir(Poignee poignee)
+	{
+		if (!contient(poignee))
+			return nullptr;
+		return &valeurs_[creneaux_[poignee.indice].position];
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn const T* TableCreneaux<T>::obtenir(Poignee poignee) const
+	///
+	/// Cette fonction retourne l'lment dsign par une poigne, en temps
+	/// constant (version constante).
+	///
+	/// @param[in] poignee : La poigne de l'lment.
+	///
+	/// @return L'lment, ou nullptr si la poigne est nulle ou prime.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	const T* TableCreneaux<T>::obtenir(Poignee poignee) const
+	{
+		if (!contient(poignee))
+			return nullptr;
+		return &valeurs_[creneaux_[poignee.indice].position];
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline bool TableCreneaux<T>::contient(Poignee poignee) const
+	///
+	/// Cette fonction vrifie si une poigne dsigne un lment prsent
+	/// dans la table, c'est--dire si elle n'est ni nulle ni prime.
+	///
+	/// @param[in] poignee : La poigne  vrifier.
+	///
+	/// @return Vrai si la poigne dsigne un lment.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline bool TableCreneaux<T>::contient(Poignee poignee) const
+	{
+		return poignee.indice < creneaux_.size() &&
+			(poignee.generation & 1) != 0 &&
+			creneaux_[poignee.indice].generation == poignee.generation;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int TableCreneaux<T>::obtenirTaille() const
+	///
+	/// Cette fonction retourne le nombre d'lments de la table.
+	///
+	/// @return Le nombre d'lments.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline unsigned int TableCreneaux<T>::obtenirTaille() const
+	{
+		return static_cast<unsigned int>(valeurs_.size());
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline unsigned int TableCreneaux<T>::obtenirNombreCreneaux() const
+	///
+	/// Cette fonction retourne le nombre de crneaux de la table, occups
+	/// ou libres.
+	///
+	/// @return Le nombre de crneaux.
+	///
+	////////////////////////////////////////////////////////////////////////
+	template <class T>
+	inline unsigned int TableCreneaux<T>::obtenirNombreCreneaux() const
+	{
+		return static_cast<unsigned int>(creneaux_.size());
+	}
+
+
+} // Fin de l'espace de nom utilitaire.
+
+
+#endif // __UTILITAIRE_TABLECRENEAUX_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -12,6 +12,8 @@
 #include <GL/glu.h>
 #include "Utilitaire.h"
 #include "Camera.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/type_ptr.hpp"
 
 
 namespace vue {
@@ -134,20 +136,40 @@ namespace vue {
 	}
 
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn glm::dmat4 Camera::obtenirMatrice() const
+	///
+	/// Calcule, sans appel OpenGL, la matrice de visualisation de la
+	/// camra.  Il s'agit de la mme matrice que celle construite par
+	/// gluLookAt().
+	///
+	/// @return La matrice de visualisation.
+	///
+	////////////////////////////////////////////////////////////////////////
+	glm::dmat4 Camera::obtenirMatrice() const
+	{
+		return glm::lookAt(position_, pointVise_, directionHaut_);
+	}
+
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn void Camera::positionner() const
 	///
-	/// Positionne la camra dans la scne  l'aide de gluLookAt().
+	/// Positionne la camra dans la scne en multipliant la matrice
+	/// courante par la matrice de visualisation, comme le ferait
+	/// gluLookAt().  Utiliser la matrice calcule par obtenirMatrice()
+	/// garantit que les conversions faites sur le CPU correspondent
+	/// exactement  l'affichage.
 	///
 	/// @return Aucune.
 	///
 	////////////////////////////////////////////////////////////////////////
 	void Camera::positionner() const
 	{
-		gluLookAt(position_[0], position_[1], position_[2],
-			pointVise_[0], pointVise_[1], pointVise_[2],
-			directionHaut_[0], directionHaut_[1], directionHaut_[2]);
+		const glm::dmat4 matrice{ obtenirMatrice() };
+		glMultMatrixd(glm::value_ptr(matrice));
 	}
 
 
@@ -64,7 +64,10 @@ namespace vue {
 
 
 
-		/// Positionner la camra (appel  gluLookAt).
+		/// Obtenir la matrice de visualisation de la camra.
+		glm::dmat4 obtenirMatrice() const;
+
+		/// Positionner la camra (quivalent de gluLookAt).
 		void positionner() const;
 
 
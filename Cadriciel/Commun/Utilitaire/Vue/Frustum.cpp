@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////////
+/// @file Frustum.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "Frustum.h"
+
+namespace vue {
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Frustum::Frustum(const glm::dmat4& matriceDecoupage)
+	///
+	/// Ce constructeur extrait les plans du frustum de la matrice de
+	/// dcoupage donne.  Par dfaut, le frustum est le cube unitaire
+	/// [-1, 1] des coordonnes normalises.
+	///
+	/// @param[in] matriceDecoupage : Le produit de la matrice de projection
+	///                               et de la matrice de modlisation.
+	///
+	/// @return Aucune (constructeur).
+	///
+	////////////////////////////////////////////////////////////////////////////
+	Frustum::Frustum(const glm::dmat4& matriceDecoupage)
+	{
+		extrairePlans(matriceDecoupage);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn void Frustum::extrairePlans(const glm::dmat4& matriceDecoupage)
+	///
+	/// Cette fonction calcule les six plans du frustum  partir des lignes
+	/// de la matrice de dcoupage: un point est visible si chacune de ses
+	/// coordonnes de dcoupage x, y et z est comprise entre -w et w.
+	///
+	/// @param[in] matriceDecoupage : Le produit de la matrice de projection
+	///                               et de la matrice de modlisation.
+	///
+	/// @return Aucune.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	void Frustum::extrairePlans(const glm::dmat4& matriceDecoupage)
+	{
+		// Les matrices glm sont ranges par colonnes.
+		const glm::dmat4 lignes{ glm::transpose(matriceDecoupage) };
+
+		plans_[0] = lignes[3] + lignes[0]; // Gauche
+		plans_[1] = lignes[3] - lignes[0]; // Droite
+		plans_[2] = lignes[3] + lignes[1]; // Bas
+		plans_[3] = lignes[3] - lignes[1]; // Haut
+		plans_[4] = lignes[3] + lignes[2]; // Avant
+		plans_[5] = lignes[3] - lignes[2]; // Arrire
+
+		for (auto& plan : plans_) {
+			const double norme{ glm::length(glm::dvec3{ plan }) };
+			if (norme > 0.0)
+				plan /= norme;
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Frustum::Position Frustum::classerSphere(const glm::dvec3& centre, double rayon) const
+	///
+	/// Cette fonction situe une sphre par rapport au frustum.  Le test est
+	/// conservateur: une sphre prs d'un coin peut tre dclare en
+	/// intersection alors qu'elle est  l'extrieur, mais jamais l'inverse.
+	///
+	/// @param[in] centre : Le centre de la sphre.
+	/// @param[in] rayon  : Le rayon de la sphre.
+	///
+	/// @return La position de la sphre.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	Frustum::Position Frustum::classerSphere(const glm::dvec3& centre, double rayon) const
+	{
+		Position position{ INTERIEUR };
+		for (const auto& plan : plans_) {
+			const double distance{ glm::dot(glm::dvec3{ plan }, centre) + plan.w };
+			if (distance < -rayon)
+				return EXTERIEUR;
+			if (distance < rayon)
+				position = INTERSECTION;
+		}
+		return position;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn Frustum::Position Frustum::classerBoite(const glm::dvec3& coinMin, const glm::dvec3& coinMax) const
+	///
+	/// Cette fonction situe une bote aligne sur les axes par rapport au
+	/// frustum.  Pour chaque plan, seuls les deux coins les plus loigns
+	/// le long de la normale sont tests.
+	///
+	/// @param[in] coinMin : Le coin minimal de la bote.
+	/// @param[in] coinMax : Le coin maximal de la bote.
+	///
+	/// @return La position de la bote.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	Frustum::Position Frustum::classerBoite(const glm::dvec3& coinMin, const glm::dvec3& coinMax) const
+	{
+		Position position{ INTERIEUR };
+		for (const auto& plan : plans_) {
+			// Coin le plus loin dans la direction de la normale, et son oppos.
+			glm::dvec3 positif{ coinMin }, negatif{ coinMax };
+			for (int i = 0; i < 3; ++i) {
+				if (plan[i] >= 0.0) {
+					positif[i] = coinMax[i];
+					negatif[i] = coinMin[i];
+				}
+			}
+
+			if (glm::dot(glm::dvec3{ plan }, positif) + plan.w < 0.0)
+				return EXTERIEUR;
+			if (glm::dot(glm::dvec3{ plan }, negatif) + plan.w < 0.0)
+				position = INTERSECTION;
+		}
+		return position;
+	}
+
+
+} // Fin de l'espace de nom vue.
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file Frustum.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup utilitaire Utilitaire
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+#ifndef __UTILITAIRE_FRUSTUM_H__
+#define __UTILITAIRE_FRUSTUM_H__
+
+#include "glm/glm.hpp"
+
+namespace vue {
+
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @class Frustum
+	/// @brief Volume visible d'une vue, dlimit par six plans.
+	///
+	/// Les plans sont extraits de la matrice qui transforme les coordonnes
+	/// du monde en coordonnes de dcoupage (projection * modlisation),
+	/// selon la mthode de Gribb et Hartmann.  Ils sont normaliss et leur
+	/// normale pointe vers l'intrieur du volume, de sorte que la distance
+	/// signe d'un point  un plan s'obtient directement.  La mthode
+	/// s'applique autant  une projection orthogonale qu'en perspective.
+	///
+	/// @author DGI-INF2990
+	/// @date 2026-10-17
+	///////////////////////////////////////////////////////////////////////////
+	class Frustum
+	{
+	public:
+		/// Position d'un volume par rapport au frustum.
+		enum Position {
+			EXTERIEUR,    ///< Le volume est entirement  l'extrieur.
+			INTERSECTION, ///< Le volume traverse au moins un plan.
+			INTERIEUR     ///< Le volume est entirement  l'intrieur.
+		};
+
+		/// Constructeur  partir de la matrice de dcoupage.
+		Frustum(const glm::dmat4& matriceDecoupage = glm::dmat4{ 1.0 });
+
+		/// Extrait les plans d'une matrice de dcoupage.
+		void extrairePlans(const glm::dmat4& matriceDecoupage);
+
+		/// Situe une sphre par rapport au frustum.
+		Position classerSphere(const glm::dvec3& centre, double rayon) const;
+		/// Situe une bote aligne sur les axes par rapport au frustum.
+		Position classerBoite(const glm::dvec3& coinMin, const glm::dvec3& coinMax) const;
+
+		/// Retourne un des six plans, sous la forme (a, b, c, d).
+		inline const glm::dvec4& obtenirPlan(int indice) const;
+
+		/// Nombre de plans dlimitant le frustum.
+		static const int NOMBRE_PLANS{ 6 };
+
+
+	private:
+		/// Plans du frustum: gauche, droite, bas, haut, avant et arrire.
+		glm::dvec4 plans_[NOMBRE_PLANS];
+
+	};
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline const glm::dvec4& Frustum::obtenirPlan(int indice) const
+	///
+	/// Cette fonction retourne un des plans du frustum, dont les trois
+	/// premires composantes forment la normale unitaire oriente vers
+	/// l'intrieur.
+	///
+	/// @param[in] indice : L'indice du plan, entre 0 et NOMBRE_PLANS - 1.
+	///
+	/// @return Le plan demand.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline const glm::dvec4& Frustum::obtenirPlan(int indice) const
+	{
+		return plans_[indice];
+	}
+
+
+} // Fin de l'espace de nom vue.
+
+
+#endif // __UTILITAIRE_FRUSTUM_H__
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////
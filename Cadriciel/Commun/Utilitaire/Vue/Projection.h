@@ -50,6 +50,8 @@ namespace vue {
 			const glm::ivec2& coinMax) = 0;
 		/// Application de la projection.
 		virtual void appliquer() const = 0;
+		/// Obtention de la matrice de projection.
+		virtual glm::dmat4 obtenirMatrice() const = 0;
 
 
 		/// Application de la fentre de clture (appel  glViewport).
@@ -63,6 +65,8 @@ namespace vue {
 		inline void obtenirCoordonneesCloture(
 			int& xMin, int& xMax, int& yMin, int& yMax
 			) const;
+		/// Obtention de la clture dans le format de glViewport.
+		inline glm::ivec4 obtenirCloture() const;
 
 		/// Vrification de si la projection est perspective.
 		inline bool estPerspective() const;
@@ -138,6 +142,25 @@ namespace vue {
 	}
 
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn inline glm::ivec4 Projection::obtenirCloture() const
+	///
+	/// Cette fonction retourne la fentre de clture associe  cette
+	/// projection dans le format de glViewport(), c'est--dire le coin
+	/// infrieur gauche suivi de la largeur et de la hauteur.
+	///
+	/// @return La fentre de clture.
+	///
+	////////////////////////////////////////////////////////////////////////
+	inline glm::ivec4 Projection::obtenirCloture() const
+	{
+		return glm::ivec4{
+			xMinCloture_, yMinCloture_,
+			xMaxCloture_ - xMinCloture_, yMaxCloture_ - yMinCloture_ };
+	}
+
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn inline bool Projection::estPerspective() const
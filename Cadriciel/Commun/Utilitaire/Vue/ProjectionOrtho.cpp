@@ -11,6 +11,8 @@
 #include <windows.h>
 #include <GL/gl.h>
 #include "ProjectionOrtho.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/type_ptr.hpp"
 
 
 namespace vue {
@@ -115,6 +117,12 @@ namespace vue {
 	void ProjectionOrtho::redimensionnerFenetre(const glm::ivec2& coinMin,
 		const glm::ivec2& coinMax)
 	{
+		// La clture est conserve pour les conversions faites sur le CPU.
+		xMinCloture_ = coinMin[0];
+		xMaxCloture_ = coinMax[0];
+		yMinCloture_ = coinMin[1];
+		yMaxCloture_ = coinMax[1];
+
 		//  IMPLANTER.
 	}
 
@@ -132,7 +140,25 @@ namespace vue {
 	////////////////////////////////////////////////////////////////////////
 	void ProjectionOrtho::appliquer() const
 	{
-		glOrtho(xMinFenetre_, xMaxFenetre_,
+		const glm::dmat4 matrice{ obtenirMatrice() };
+		glMultMatrixd(glm::value_ptr(matrice));
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn glm::dmat4 ProjectionOrtho::obtenirMatrice() const
+	///
+	/// Cette fonction calcule, sans appel OpenGL, la matrice de projection
+	/// orthogonale de la fentre virtuelle.  Il s'agit de la mme matrice
+	/// que celle construite par glOrtho().
+	///
+	/// @return La matrice de projection.
+	///
+	////////////////////////////////////////////////////////////////////////
+	glm::dmat4 ProjectionOrtho::obtenirMatrice() const
+	{
+		return glm::ortho(xMinFenetre_, xMaxFenetre_,
 			yMinFenetre_, yMaxFenetre_,
 			zAvant_, zArriere_);
 	}
@@ -51,6 +51,8 @@ namespace vue {
 			const glm::ivec2& coinMax);
 		/// Application de la projection.
 		virtual void appliquer() const;
+		/// Obtention de la matrice de projection.
+		virtual glm::dmat4 obtenirMatrice() const;
 
 
 		/// Zoom out lastique, sur un rectangle.
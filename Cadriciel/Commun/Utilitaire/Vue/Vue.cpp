@@ -8,13 +8,10 @@
 /// @{
 /////////////////////////////////////////////////////////////////////////////////
 
-#include <windows.h>
-#include <GL/glu.h>
-
 #include "Vue.h"
+#include "Projection.h"
 #include "Plan3D.h"
 #include "Droite3D.h"
-#include "glm/gtc/type_ptr.hpp"
 
 namespace vue {
 
@@ -36,14 +33,85 @@ namespace vue {
 	}
 
 
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool deprojeter(const glm::dmat4& inverse, const glm::ivec4& cloture, double x, double y, double z, glm::dvec3& point)
+	///
+	/// Cette fonction transforme un point en coordonnes de fentre en
+	/// coordonnes virtuelles, de la mme faon que gluUnProject().
+	///
+	/// @param[in]  inverse : L'inverse du produit de la matrice de projection
+	///                       et de la matrice de visualisation.
+	/// @param[in]  cloture : La clture, dans le format de glViewport().
+	/// @param[in]  x       : La position @a X du point dans la fentre.
+	/// @param[in]  y       : La position @a Y du point dans la fentre,
+	///                        partir du bas.
+	/// @param[in]  z       : La profondeur du point, entre 0 et 1.
+	/// @param[out] point   : Le point en coordonnes virtuelles.
+	///
+	/// @return Faux si le point est  l'infini, vrai autrement.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	static bool deprojeter(const glm::dmat4& inverse, const glm::ivec4& cloture,
+		double x, double y, double z, glm::dvec3& point)
+	{
+		// Coordonnes normalises entre -1 et 1.
+		const glm::dvec4 normalise{
+			(x - cloture[0]) / cloture[2] * 2.0 - 1.0,
+			(y - cloture[1]) / cloture[3] * 2.0 - 1.0,
+			z * 2.0 - 1.0,
+			1.0 };
+
+		const glm::dvec4 resultat{ inverse * normalise };
+		if (resultat[3] == 0.0)
+			return false;
+
+		point = glm::dvec3{ resultat } / resultat[3];
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn static bool calculerExtremites(const glm::dmat4& inverse, const glm::ivec4& cloture, int x, int y, glm::dvec3& point1, glm::dvec3& point2)
+	///
+	/// Cette fonction trouve les points virtuels, sur les plans avant et
+	/// arrire du volume de visualisation, qui correspondent  un point de
+	/// clture.
+	///
+	/// @param[in]  inverse : L'inverse du produit de la matrice de projection
+	///                       et de la matrice de visualisation.
+	/// @param[in]  cloture : La clture, dans le format de glViewport().
+	/// @param[in]  x       : La position @a X du point en coordonne
+	///                       d'affichage.
+	/// @param[in]  y       : La position @a Y du point en coordonne
+	///                       d'affichage.
+	/// @param[out] point1  : Le point sur le plan avant.
+	/// @param[out] point2  : Le point sur le plan arrire.
+	///
+	/// @return Faux si un des points est  l'infini, vrai autrement.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	static bool calculerExtremites(const glm::dmat4& inverse, const glm::ivec4& cloture,
+		int x, int y, glm::dvec3& point1, glm::dvec3& point2)
+	{
+		// L'axe des Y d'affichage est invers par rapport  celui d'OpenGL.
+		const double yFenetre{ static_cast<double>(cloture[3] - y) };
+
+		return deprojeter(inverse, cloture, x, yFenetre, 0.0, point1) &&
+			deprojeter(inverse, cloture, x, yFenetre, 1.0, point2);
+	}
+
+
 	////////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn bool Vue::convertirClotureAVirtuelle(int x, int y, const math::Plan3D& plan, glm::dvec3& point) const
 	///
 	/// Cette fonction permet de transformer un point (donn en coordonnes
 	/// d'affichage) en coordonnes virtuelles tant donn un certain plan sur
-	/// lequel doit se trouver le point.  Elle utilise les fonction d'OpenGL
-	/// donc cette fonction s'applique peu importe la position de la camra.
+	/// lequel doit se trouver le point.  Elle utilise les matrices de la
+	/// camra et de la projection, donc cette fonction s'applique peu importe
+	/// la position de la camra, sans interroger OpenGL.
 	///
 	/// @param[in]      x     : La position @a X du point en coordonne
 	///                         d'affichage.
@@ -61,37 +129,10 @@ namespace vue {
 	////////////////////////////////////////////////////////////////////////////
 	bool Vue::convertirClotureAVirtuelle(int x, int y, const math::Plan3D& plan, glm::dvec3& point) const
 	{
-		//Initialisation de variables.
-		const GLdouble MinZ{ 0.0 };
-		const GLdouble MaxZ{ 1.0 };
-
-		// Lire la matrice de modlisation et de visualisation.
-		glm::dmat4 matriceModelisation;
-		glGetDoublev(GL_MODELVIEW_MATRIX, glm::value_ptr(matriceModelisation));
-
-		// Lire la matrice de projection.
-		glm::dmat4 matriceProjection;
-		glGetDoublev(GL_PROJECTION_MATRIX, glm::value_ptr(matriceProjection));
-
-		// Lire la clture.
-		glm::ivec4 cloture;
-		glGetIntegerv(GL_VIEWPORT, glm::value_ptr(cloture));
-
-		// Premier point.
-		glm::dvec3 point1;
-		gluUnProject(
-			x, cloture[3] - y, MinZ,
-			glm::value_ptr(matriceModelisation), glm::value_ptr(matriceProjection), glm::value_ptr(cloture),
-			&point1[0], &point1[1], &point1[2]
-			);
-
-		// Deuxime point.
-		glm::dvec3 point2;
-		gluUnProject(
-			x, cloture[3] - y, MaxZ,
-			glm::value_ptr(matriceModelisation), glm::value_ptr(matriceProjection), glm::value_ptr(cloture),
-			&point2[0], &point2[1], &point2[2]
-			);
+		glm::dvec3 point1, point2;
+		if (!calculerExtremites(obtenirMatriceDeprojection(),
+			obtenirProjection().obtenirCloture(), x, y, point1, point2))
+			return false;
 
 		// On construit la droite.
 		math::Droite3D DroiteCoupe{ point1, point2 };
@@ -100,6 +141,99 @@ namespace vue {
 	}
 
 
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn unsigned int Vue::convertirClotureAVirtuelle(const std::vector<glm::ivec2>& clotures, const math::Plan3D& plan, std::vector<glm::dvec3>& points, std::vector<bool>& valides) const
+	///
+	/// Cette fonction transforme un lot de points (donns en coordonnes
+	/// d'affichage) en coordonnes virtuelles sur un plan donn.  La
+	/// matrice inverse et la clture ne sont calcules qu'une seule fois
+	/// pour tout le lot.
+	///
+	/// @param[in]  clotures : Les points en coordonnes d'affichage.
+	/// @param[in]  plan     : Le plan sur lequel on veut trouver les positions
+	///                        correspondantes en virtuel.
+	/// @param[out] points   : Les points transforms, dans le mme ordre.
+	/// @param[out] valides  : Vrai pour chaque point qui a pu tre converti.
+	///
+	/// @return Le nombre de points convertis.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	unsigned int Vue::convertirClotureAVirtuelle(const std::vector<glm::ivec2>& clotures,
+		const math::Plan3D& plan, std::vector<glm::dvec3>& points, std::vector<bool>& valides) const
+	{
+		const glm::dmat4 inverse{ obtenirMatriceDeprojection() };
+		const glm::ivec4 cloture{ obtenirProjection().obtenirCloture() };
+
+		points.resize(clotures.size());
+		valides.assign(clotures.size(), false);
+
+		unsigned int nombreConvertis{ 0 };
+		for (std::size_t i = 0; i < clotures.size(); ++i) {
+			glm::dvec3 point1, point2;
+			if (!calculerExtremites(inverse, cloture,
+				clotures[i][0], clotures[i][1], point1, point2))
+				continue;
+
+			math::Droite3D droite{ point1, point2 };
+			if (droite.intersection(plan, points[i])) {
+				valides[i] = true;
+				++nombreConvertis;
+			}
+		}
+
+		return nombreConvertis;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn bool Vue::obtenirRayon(int x, int y, glm::dvec3& origine, glm::dvec3& deplacement) const
+	///
+	/// Cette fonction calcule le rayon virtuel qui passe par un point donn
+	/// en coordonnes d'affichage.  Le rayon part du plan avant du volume de
+	/// visualisation et se rend jusqu'au plan arrire, ce qui convient
+	/// directement  modele::ArbreTriangles::calculerImpactRayon().
+	///
+	/// @param[in]  x           : La position @a X du point en coordonne
+	///                           d'affichage.
+	/// @param[in]  y           : La position @a Y du point en coordonne
+	///                           d'affichage.
+	/// @param[out] origine     : Le point du rayon sur le plan avant.
+	/// @param[out] deplacement : Le dplacement du plan avant au plan arrire.
+	///
+	/// @return Faux si le rayon ne peut tre calcul, vrai autrement.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	bool Vue::obtenirRayon(int x, int y, glm::dvec3& origine, glm::dvec3& deplacement) const
+	{
+		glm::dvec3 extremite;
+		if (!calculerExtremites(obtenirMatriceDeprojection(),
+			obtenirProjection().obtenirCloture(), x, y, origine, extremite))
+			return false;
+
+		deplacement = extremite - origine;
+		return true;
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn glm::dmat4 Vue::obtenirMatriceDeprojection() const
+	///
+	/// Cette fonction calcule l'inverse du produit de la matrice de
+	/// projection et de la matrice de visualisation de la camra, qui
+	/// ramne les coordonnes normalises en coordonnes virtuelles.
+	///
+	/// @return La matrice inverse.
+	///
+	////////////////////////////////////////////////////////////////////////////
+	glm::dmat4 Vue::obtenirMatriceDeprojection() const
+	{
+		return glm::inverse(obtenirProjection().obtenirMatrice() * camera_.obtenirMatrice());
+	}
+
+
 	////////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn bool Vue::convertirClotureAVirtuelle(int x, int y, glm::dvec3& point) const
@@ -13,8 +13,11 @@
 
 #include "Camera.h"
 
+#include <vector>
+
 namespace math {
-	class Plan3D;
+	template <class T> class Plan3Dt;
+	using Plan3D = Plan3Dt<double>;
 }
 
 
@@ -36,6 +39,10 @@ namespace vue {
 	/// Elle offre galement certaines fonctionnalits communes  toutes les
 	/// vues, comme la possibilit de trouver  quel point correspond, en
 	/// coordonnes virtuelles, un point donn en coordonnes de clture.
+	/// Ces conversions utilisent les matrices conserves par la camra et la
+	/// projection plutt que l'tat d'OpenGL: elles peuvent donc tre faites
+	///  partir de n'importe quel fil, tant que la vue n'est pas modifie en
+	/// mme temps.
 	///
 	/// @author Martin Bisson
 	/// @date 2006-12-16
@@ -52,6 +59,14 @@ namespace vue {
 		bool convertirClotureAVirtuelle(int x, int y, glm::dvec3& point) const;
 		/// Conversion de coordonnes de clture  coordonnes virtuelles sur un plan donn
 		bool convertirClotureAVirtuelle(int x, int y, const math::Plan3D& plan, glm::dvec3& point) const;
+		/// Conversion d'un lot de points de clture  coordonnes virtuelles sur un plan donn
+		unsigned int convertirClotureAVirtuelle(const std::vector<glm::ivec2>& clotures,
+			const math::Plan3D& plan, std::vector<glm::dvec3>& points, std::vector<bool>& valides) const;
+		/// Calcul du rayon virtuel passant par un point de clture
+		bool obtenirRayon(int x, int y, glm::dvec3& origine, glm::dvec3& deplacement) const;
+
+		/// Obtention de la matrice inverse de la projection et de la camra
+		glm::dmat4 obtenirMatriceDeprojection() const;
 
 		/// Obtient la camra associe  cette vue.
 		inline Camera& obtenirCamera();
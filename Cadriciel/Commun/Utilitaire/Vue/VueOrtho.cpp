@@ -70,13 +70,16 @@ namespace vue {
 	///
 	/// @fn void VueOrtho::appliquerProjection() const
 	///
-	/// Applique la matrice de projection correspondant  cette vue.
+	/// Applique la clture et la matrice de projection correspondant 
+	/// cette vue.  La clture d'OpenGL suit ainsi celle conserve par la
+	/// projection, utilise par les conversions faites sur le CPU.
 	///
 	/// @return Aucune.
 	///
 	////////////////////////////////////////////////////////////////////////
 	void VueOrtho::appliquerProjection() const
 	{
+		projection_.mettreAJourCloture();
 		projection_.mettreAJourProjection();
 	}
 
@@ -34,6 +34,8 @@
 
 #include "ConfigScene.h"
 #include "CompteurAffichage.h"
+#include "OrdonnanceurTaches.h"
+#include "RegistreModeles.h"
 
 // Remlacement de EnveloppeXML/XercesC par TinyXML
 // Julien Gascon-Samson, t 2011
@@ -129,6 +131,14 @@ void FacadeModele::initialiserOpenGL(HWND hWnd)
 	// Initialisation de la configuration
 	chargerConfiguration();
 
+	// Configuration de l'animation parallle de la scne
+	utilitaire::OrdonnanceurTaches::obtenirInstance()->assignerMonoFil(ConfigScene::ANIMATION_MONO_FIL);
+	if (ConfigScene::SEUIL_ANIMATION_PARALLELE > 0) {
+		NoeudComposite::assignerSeuilAnimationParallele(
+			static_cast<unsigned int>(ConfigScene::SEUIL_ANIMATION_PARALLELE)
+			);
+	}
+
 	// FreeImage, utilise par le chargeur, doit tre initialise
 	FreeImage_Initialise();
 
@@ -161,6 +171,14 @@ void FacadeModele::initialiserOpenGL(HWND hWnd)
 	// l'arbre aprs avoir cr le contexte OpenGL.
 	arbre_ = new ArbreRenduINF2990;
 	arbre_->initialiser();
+	arbre_->assignerEliminationHorsChamp(ConfigScene::ELIMINATION_HORS_CHAMP);
+	if (ConfigScene::PHASE_LARGE == aidecollision::PhaseLarge::BALAYAGE_ET_ELAGAGE ||
+		ConfigScene::PHASE_LARGE == aidecollision::PhaseLarge::GRILLE_SPATIALE) {
+		arbre_->assignerPhaseLarge(aidecollision::PhaseLarge::creer(
+			static_cast<aidecollision::PhaseLarge::Methode>(ConfigScene::PHASE_LARGE),
+			ConfigScene::TAILLE_CELLULE_PHASE_LARGE
+			));
+	}
 
 	// On cre une vue par dfaut.
 	vue_ = new vue::VueOrtho{
@@ -243,6 +261,8 @@ void FacadeModele::enregistrerConfiguration() const
 void FacadeModele::libererOpenGL()
 {
 	utilitaire::CompteurAffichage::libererInstance();
+	utilitaire::OrdonnanceurTaches::libererInstance();
+	modele::RegistreModeles::libererInstance();
 
 	// On libre les instances des diffrentes configurations.
 	ConfigScene::libererInstance();
@@ -305,7 +325,7 @@ void FacadeModele::afficherBase() const
 	glLightfv(GL_LIGHT0, GL_POSITION, glm::value_ptr(position));
 
 	// Afficher la scne.
-	arbre_->afficher();
+	arbre_->afficher(*vue_);
 }
 
 
@@ -342,6 +362,7 @@ void FacadeModele::animer(float temps)
 {
 	// Mise  jour des objets.
 	arbre_->animer(temps);
+	arbre_->mettreAJourVolumes();
 
 	// Mise  jour de la vue.
 	vue_->animer(temps);
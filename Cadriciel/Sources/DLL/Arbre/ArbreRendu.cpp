@@ -10,8 +10,112 @@
 #include "ArbreRendu.h"
 #include "UsineNoeud.h"
 #include "NoeudAbstrait.h"
+#include "ParcoursArbre.h"
+#include "Frustum.h"
+#include "Vue.h"
+#include "Projection.h"
 
 #include <GL/glu.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "glm/gtx/norm.hpp"
+
+
+/// Marge des botes de la hirarchie des volumes: un noeud peut se
+/// dplacer de cette distance sans tre rinsr.
+const double ArbreRendu::MARGE_VOLUMES{ 5.0 };
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VisiteurVolumesEnglobants
+/// @brief Visiteur qui met  jour les sphres englobantes des noeuds,
+///        chaque noeud aprs ses enfants.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class VisiteurVolumesEnglobants : public VisiteurNoeud<const NoeudAbstrait>
+{
+public:
+	/// Calcule le volume d'un noeud  partir de ceux de ses enfants.
+	ParcoursArbre::Decision visiterApres(const NoeudAbstrait* noeud)
+	{
+		noeud->calculerVolumeEnglobant();
+		return ParcoursArbre::CONTINUER;
+	}
+};
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VisiteurAffichage
+/// @brief Visiteur qui affiche les noeuds en liminant les sous-arbres
+///        hors d'un frustum.
+///
+///        Sous un noeud entirement  l'intrieur du frustum, les
+///        descendants ne sont plus tests.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class VisiteurAffichage : public VisiteurNoeud<const NoeudAbstrait>
+{
+public:
+	/// Constructeur  partir du frustum, nul pour tout afficher, et de la
+	/// matrice de vue.
+	VisiteurAffichage(const vue::Frustum* frustum, const glm::dmat4& matriceVue)
+		: frustum_{ frustum }, matriceVue_( matriceVue )
+	{
+	}
+	/// Affiche le noeud, ou limine son sous-arbre.
+	ParcoursArbre::Decision visiterAvant(const NoeudAbstrait* noeud)
+	{
+		if (!noeud->estAffiche())
+			return ParcoursArbre::IGNORER_ENFANTS;
+
+		if (frustum_ != nullptr && interieur_ == nullptr &&
+			noeud->obtenirRayonVolumeEnglobant() >= 0.0) {
+			const vue::Frustum::Position position{ frustum_->classerSphere(
+				noeud->obtenirCentreVolumeEnglobant(), noeud->obtenirRayonVolumeEnglobant()
+				) };
+			if (position == vue::Frustum::EXTERIEUR) {
+				nombreElimines_ += 1 + noeud->obtenirNombreDescendants();
+				return ParcoursArbre::IGNORER_ENFANTS;
+			}
+			if (position == vue::Frustum::INTERIEUR)
+				interieur_ = noeud;
+		}
+
+		noeud->afficherNoeud(matriceVue_);
+		++nombreAffiches_;
+		return ParcoursArbre::CONTINUER;
+	}
+	/// Reprend les tests  la sortie d'un sous-arbre intrieur.
+	ParcoursArbre::Decision visiterApres(const NoeudAbstrait* noeud)
+	{
+		if (noeud == interieur_)
+			interieur_ = nullptr;
+		return ParcoursArbre::CONTINUER;
+	}
+	/// Obtient le nombre de noeuds affichs.
+	unsigned int obtenirNombreAffiches() const { return nombreAffiches_; }
+	/// Obtient le nombre de noeuds limins.
+	unsigned int obtenirNombreElimines() const { return nombreElimines_; }
+
+private:
+	/// Frustum contre lequel les noeuds sont tests, ou nullptr.
+	const vue::Frustum* frustum_;
+	/// Matrice de vue de l'affichage.
+	const glm::dmat4& matriceVue_;
+	/// Noeud entirement dans le frustum dont le sous-arbre est en cours
+	/// de visite, ou nullptr.
+	const NoeudAbstrait* interieur_{ nullptr };
+	/// Nombre de noeuds affichs.
+	unsigned int nombreAffiches_{ 0 };
+	/// Nombre de noeuds limins.
+	unsigned int nombreElimines_{ 0 };
+};
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -24,7 +128,7 @@
 ///
 ////////////////////////////////////////////////////////////////////////
 ArbreRendu::ArbreRendu()
-: NoeudComposite{ "racine" }
+: NoeudComposite{ "racine" }, volumes_{ MARGE_VOLUMES }
 {
 	// On ne veut pas que ce noeud soit slectionnable.
 	assignerEstSelectionnable(false);
@@ -35,13 +139,15 @@ ArbreRendu::ArbreRendu()
 ///
 /// @fn ArbreRendu::~ArbreRendu()
 ///
-/// Dtruit les usines des noeuds de l'arbre.
+/// Dtruit les noeuds de l'arbre pendant que le stockage de leurs
+/// transformations existe encore.
 ///
 /// @return Aucune (destructeur).
 ///
 ////////////////////////////////////////////////////////////////////////
 ArbreRendu::~ArbreRendu()
 {
+	vider();
 }
 
 
@@ -61,20 +167,35 @@ NoeudAbstrait* ArbreRendu::creerNoeud(
 	const std::string& typeNouveauNoeud
 	) const
 {
-	if (usines_.find(typeNouveauNoeud) == usines_.end()) {
+	return creerNoeud(RegistreTypes::obtenirIdentifiant(typeNouveauNoeud));
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn NoeudAbstrait* ArbreRendu::creerNoeud(RegistreTypes::Identifiant typeNouveauNoeud) const
+///
+/// Cette fonction permet de crer un nouveau noeud  partir de
+/// l'identifiant de son type, sans l'ajouter directement  l'arbre de
+/// rendu.  L'usine est trouve par un simple accs au tableau des
+/// usines.
+///
+/// @param[in] typeNouveauNoeud : L'identifiant du type du nouveau noeud.
+///
+/// @return Le noeud nouvellement cr, ou nullptr si le type n'a pas
+///         d'usine.
+///
+////////////////////////////////////////////////////////////////////////
+NoeudAbstrait* ArbreRendu::creerNoeud(
+	RegistreTypes::Identifiant typeNouveauNoeud
+	) const
+{
+	if (typeNouveauNoeud >= usines_.size() || usines_[typeNouveauNoeud] == nullptr) {
 		// Incapable de trouver l'usine
 		return nullptr;
 	}
 
-	// Pour une raison que je ne comprends pas, la ligne suivante ne
-	// compile pas:
-	//
-	// const UsineNoeud* usine = usines_[typeNouveauNoeud];
-	//
-	// On utilisera donc:
-	const UsineNoeud* usine{ (*(usines_.find(typeNouveauNoeud))).second };
-
-	return usine->creerNoeud();
+	return usines_[typeNouveauNoeud]->creerNoeud();
 }
 
 
@@ -96,7 +217,7 @@ NoeudAbstrait* ArbreRendu::ajouterNouveauNoeud(
 	const std::string& typeNouveauNoeud
 	)
 {
-	NoeudAbstrait* parent{ chercher(typeParent) };
+	NoeudAbstrait* parent{ obtenirPremierNoeud(typeParent) };
 	if (parent == nullptr) {
 		// Incapable de trouver le parent
 		return nullptr;
@@ -138,6 +259,962 @@ unsigned int ArbreRendu::calculerProfondeurMaximale()
 }
 
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::relacherMemoireUsines() const
+///
+/// Cette fonction relche d'un coup la mmoire des pools des usines dont
+/// tous les noeuds ont t dtruits, par exemple aprs avoir vid
+/// l'arbre.  Les pools dont des noeuds sont encore vivants sont laisss
+/// intacts.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::relacherMemoireUsines() const
+{
+	for (const UsineNoeud* usine : usines_) {
+		if (usine != nullptr)
+			usine->relacherMemoire();
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn NoeudAbstrait* ArbreRendu::obtenirPremierNoeud(const std::string& type)
+///
+/// Cette fonction retourne le premier noeud d'un type donn prsent dans
+/// l'arbre, c'est--dire le plus ancien noeud de ce type encore prsent.
+/// Contrairement  chercher() sur un NoeudComposite, elle ne parcourt pas
+/// l'arbre et s'excute donc en temps constant.
+///
+/// @param[in] type : Le type du noeud cherch.
+///
+/// @return Le noeud trouv ou nullptr si aucun noeud n'est de ce type.
+///
+////////////////////////////////////////////////////////////////////////
+NoeudAbstrait* ArbreRendu::obtenirPremierNoeud(const std::string& type)
+{
+	const RegistreTypes::Identifiant identifiant{ RegistreTypes::obtenirIdentifiant(type) };
+	if (identifiant == type_)
+		return this;
+
+	const std::vector<NoeudAbstrait*>& noeuds = obtenirNoeuds(identifiant);
+	if (noeuds.empty())
+		return nullptr;
+
+	return noeuds.front();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn const NoeudAbstrait* ArbreRendu::obtenirPremierNoeud(const std::string& type) const
+///
+/// Cette fonction retourne le premier noeud d'un type donn prsent dans
+/// l'arbre (version constante de la fonction).
+///
+/// @param[in] type : Le type du noeud cherch.
+///
+/// @return Le noeud trouv ou nullptr si aucun noeud n'est de ce type.
+///
+////////////////////////////////////////////////////////////////////////
+const NoeudAbstrait* ArbreRendu::obtenirPremierNoeud(const std::string& type) const
+{
+	const RegistreTypes::Identifiant identifiant{ RegistreTypes::obtenirIdentifiant(type) };
+	if (identifiant == type_)
+		return this;
+
+	const std::vector<NoeudAbstrait*>& noeuds = obtenirNoeuds(identifiant);
+	if (noeuds.empty())
+		return nullptr;
+
+	return noeuds.front();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn const std::vector<NoeudAbstrait*>& ArbreRendu::obtenirNoeuds(const std::string& type) const
+///
+/// Cette fonction retourne la liste de tous les noeuds d'un type donn
+/// prsents dans l'arbre, en ordre d'insertion.  La liste retourne
+/// reste valide jusqu' la prochaine modification de l'arbre.
+///
+/// @param[in] type : Le type des noeuds cherchs.
+///
+/// @return La liste des noeuds de ce type (possiblement vide).
+///
+////////////////////////////////////////////////////////////////////////
+const std::vector<NoeudAbstrait*>& ArbreRendu::obtenirNoeuds(const std::string& type) const
+{
+	return obtenirNoeuds(RegistreTypes::obtenirIdentifiant(type));
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn const std::vector<NoeudAbstrait*>& ArbreRendu::obtenirNoeuds(RegistreTypes::Identifiant type) const
+///
+/// Cette fonction retourne la liste de tous les noeuds d'un type donn
+/// par son identifiant, en ordre d'insertion.  La liste est obtenue par
+/// un simple accs  l'index, sans aucune comparaison de chanes.
+///
+/// @param[in] type : L'identifiant du type des noeuds cherchs.
+///
+/// @return La liste des noeuds de ce type (possiblement vide).
+///
+////////////////////////////////////////////////////////////////////////
+const std::vector<NoeudAbstrait*>& ArbreRendu::obtenirNoeuds(RegistreTypes::Identifiant type) const
+{
+	static const std::vector<NoeudAbstrait*> AUCUN_NOEUD;
+
+	if (type >= indexTypes_.size())
+		return AUCUN_NOEUD;
+
+	return indexTypes_[type];
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn const NoeudAbstrait* ArbreRendu::chercher(const std::string& typeNoeud) const
+///
+/// Recherche un noeud d'un type donn dans l'arbre  l'aide de l'index
+/// des types plutt que par un parcours de l'arbre.  Version constante
+/// de la fonction.
+///
+/// @param[in] typeNoeud : Le type du noeud cherch.
+///
+/// @return Noeud recherch ou nullptr si le noeud n'est pas trouv.
+///
+////////////////////////////////////////////////////////////////////////
+const NoeudAbstrait* ArbreRendu::chercher(const std::string& typeNoeud) const
+{
+	return obtenirPremierNoeud(typeNoeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn NoeudAbstrait* ArbreRendu::chercher(const std::string& typeNoeud)
+///
+/// Recherche un noeud d'un type donn dans l'arbre  l'aide de l'index
+/// des types plutt que par un parcours de l'arbre.
+///
+/// @param[in] typeNoeud : Le type du noeud cherch.
+///
+/// @return Noeud recherch ou nullptr si le noeud n'est pas trouv.
+///
+////////////////////////////////////////////////////////////////////////
+NoeudAbstrait* ArbreRendu::chercher(const std::string& typeNoeud)
+{
+	return obtenirPremierNoeud(typeNoeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::vider()
+///
+/// Cette fonction vide l'arbre de tous ses noeuds.  L'index, la
+/// slection et la table des poignes sont vids en un seul coup avant
+/// la destruction des noeuds, ce qui vite de retirer les noeuds de
+/// l'index un  un.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::vider()
+{
+	indexTypes_.clear();
+	selection_.clear();
+	volumes_.vider();
+	feuillesVolumes_.clear();
+	if (phaseLarge_ != nullptr)
+		phaseLarge_->vider();
+	spheresPhaseLarge_.clear();
+	noeudsPhaseLarge_.clear();
+	for (NoeudAbstrait* noeud : poignees_)
+		noeud->assignerPoignee(utilitaire::Poignee{});
+	poignees_.vider();
+	NoeudComposite::vider();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn NoeudAbstrait* ArbreRendu::obtenirNoeud(utilitaire::Poignee poignee)
+///
+/// Cette fonction retourne le noeud de l'arbre dsign par une poigne,
+/// en temps constant.  Une poigne conserve aprs le retrait ou la
+/// destruction de son noeud est prime et ne dsigne plus aucun noeud,
+/// mme si son crneau a t rutilis depuis.
+///
+/// @param[in] poignee : La poigne du noeud.
+///
+/// @return Le noeud, ou nullptr si la poigne est nulle ou prime.
+///
+////////////////////////////////////////////////////////////////////////
+NoeudAbstrait* ArbreRendu::obtenirNoeud(utilitaire::Poignee poignee)
+{
+	NoeudAbstrait** noeud{ poignees_.obtenir(poignee) };
+	return noeud != nullptr ? *noeud : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn const NoeudAbstrait* ArbreRendu::obtenirNoeud(utilitaire::Poignee poignee) const
+///
+/// Cette fonction retourne le noeud de l'arbre dsign par une poigne,
+/// en temps constant (version constante de la fonction).
+///
+/// @param[in] poignee : La poigne du noeud.
+///
+/// @return Le noeud, ou nullptr si la poigne est nulle ou prime.
+///
+////////////////////////////////////////////////////////////////////////
+const NoeudAbstrait* ArbreRendu::obtenirNoeud(utilitaire::Poignee poignee) const
+{
+	NoeudAbstrait* const* noeud{ poignees_.obtenir(poignee) };
+	return noeud != nullptr ? *noeud : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn bool ArbreRendu::effacer(utilitaire::Poignee poignee)
+///
+/// Cette fonction efface de son parent le noeud dsign par une poigne,
+/// sans parcourir l'arbre pour le trouver.  Une poigne prime est
+/// ignore, ce qui rend l'opration sre mme si le noeud a dj t
+/// effac.
+///
+/// @param[in] poignee : La poigne du noeud  effacer.
+///
+/// @return Vrai si un noeud a t effac.
+///
+////////////////////////////////////////////////////////////////////////
+bool ArbreRendu::effacer(utilitaire::Poignee poignee)
+{
+	NoeudAbstrait* noeud{ obtenirNoeud(poignee) };
+	if (noeud == nullptr || noeud->obtenirParent() == nullptr)
+		return false;
+
+	noeud->obtenirParent()->effacer(noeud);
+	return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::activerStockageTransformations(bool actif)
+///
+/// Cette fonction active ou dsactive le stockage contigu des
+/// transformations des noeuds de l'arbre.  Lorsqu'il est actif, les
+/// positions de tous les noeuds sous la racine sont regroupes dans des
+/// tableaux contigus, qui peuvent tre parcourus directement par les
+/// traitements de masse.  Les noeuds ajouts par la suite y sont placs
+/// automatiquement.  Les positions sont prserves dans les deux sens.
+///
+/// @param[in] actif : Vrai pour activer le stockage contigu.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::activerStockageTransformations(bool actif)
+{
+	if (actif == (stockageNoeuds_ != nullptr))
+		return;
+
+	const unsigned int nombreEnfants{ obtenirNombreEnfants() };
+	if (actif) {
+		stockageNoeuds_ = std::make_unique<utilitaire::StockageTransformations>();
+		for (unsigned int i{ 0 }; i < nombreEnfants; ++i)
+			assignerStockageSousArbre(chercher(i), stockageNoeuds_.get());
+	}
+	else {
+		for (unsigned int i{ 0 }; i < nombreEnfants; ++i)
+			assignerStockageSousArbre(chercher(i), nullptr);
+		stockageNoeuds_.reset();
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::translaterPositions(const glm::dvec3& deplacement)
+///
+/// Cette fonction ajoute un mme dplacement  la position relative de
+/// tous les noeuds sous la racine.  Si le stockage contigu est actif,
+/// les positions sont modifies en un seul parcours des tableaux, et la
+/// nouvelle version du stockage rend primes toutes les matrices monde;
+/// sinon, chaque noeud est dplac individuellement.
+///
+/// Comme aprs l'animation, mettreAJourVolumes() doit ensuite tre
+/// appele pour dplacer les noeuds dans la hirarchie des volumes.
+///
+/// @param[in] deplacement : Le dplacement  appliquer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::translaterPositions(const glm::dvec3& deplacement)
+{
+	if (stockageNoeuds_ != nullptr) {
+		stockageNoeuds_->translater(deplacement);
+		return;
+	}
+
+	for (NoeudAbstrait* noeud : poignees_)
+		noeud->assignerPositionRelative(noeud->obtenirPositionRelative() + deplacement);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::signalerAjout(NoeudAbstrait* noeud)
+///
+/// Cette fonction est appele lorsqu'un noeud est ajout n'importe o
+/// dans l'arbre.  Elle met  jour le nombre de descendants de la racine,
+/// puis ajoute le noeud et tous ses descendants  l'index des types, 
+/// la slection s'ils sont slectionns et, s'il est activ, au stockage
+/// contigu des transformations.
+///
+/// @param[in] noeud : Le noeud ajout.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::signalerAjout(NoeudAbstrait* noeud)
+{
+	NoeudComposite::signalerAjout(noeud);
+	indexerSousArbre(noeud);
+
+	if (stockageNoeuds_)
+		assignerStockageSousArbre(noeud, stockageNoeuds_.get());
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds)
+///
+/// Cette fonction est appele lorsque des noeuds sont retirs de l'arbre,
+/// avant leur destruction.  Elle met  jour le nombre de descendants de
+/// la racine, puis retire ces noeuds et tous leurs descendants de la
+/// slection, de la table des poignes et de l'index des types.  Leurs
+/// transformations seront libres du stockage contigu par leur
+/// destructeur.  Chaque liste touche n'est parcourue qu'une seule fois,
+/// peu importe le nombre de noeuds retirs, et l'ordre d'insertion des
+/// noeuds restants est prserv.
+///
+/// @param[in] noeuds : Les noeuds retirs.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds)
+{
+	NoeudComposite::signalerRetrait(noeuds);
+
+	// L'index peut dj avoir t vid d'un coup, par exemple par vider().
+	if (indexTypes_.empty())
+		return;
+
+	for (NoeudAbstrait* noeud : noeuds) {
+		ParcoursArbre::parcourirPrefixe(noeud, [this](NoeudAbstrait* descendant) {
+			if (descendant->estSelectionne())
+				selection_.erase(descendant);
+			retirerVolume(descendant);
+			retirerPhaseLarge(descendant);
+			poignees_.retirer(descendant->obtenirPoignee());
+			descendant->assignerPoignee(utilitaire::Poignee{});
+			return ParcoursArbre::CONTINUER;
+		});
+	}
+
+	EnsemblesParType aRetirer;
+	for (NoeudAbstrait const* noeud : noeuds)
+		collecterSousArbre(noeud, aRetirer);
+
+	for (EnsemblesParType::value_type const& paire : aRetirer) {
+		if (paire.first >= indexTypes_.size())
+			continue;
+
+		const std::unordered_set<const NoeudAbstrait*>& ensemble = paire.second;
+		std::vector<NoeudAbstrait*>& liste = indexTypes_[paire.first];
+		liste.erase(
+			std::remove_if(liste.begin(), liste.end(),
+				[&ensemble](NoeudAbstrait* noeud) { return ensemble.count(noeud) != 0; }),
+			liste.end());
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::signalerSelection(NoeudAbstrait* noeud)
+///
+/// Cette fonction est appele lorsque l'tat de slection d'un noeud de
+/// l'arbre change.  Elle ajoute le noeud  l'ensemble des noeuds
+/// slectionns ou l'en retire, en temps constant.
+///
+/// @param[in] noeud : Le noeud dont la slection a chang.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::signalerSelection(NoeudAbstrait* noeud)
+{
+	NoeudComposite::signalerSelection(noeud);
+
+	if (noeud->estSelectionne())
+		selection_.insert(noeud);
+	else
+		selection_.erase(noeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn bool ArbreRendu::selectionExiste() const
+///
+/// Cette fonction vrifie si un noeud de l'arbre est slectionn.
+/// Contrairement  la version de NoeudComposite, elle ne parcourt pas
+/// l'arbre, mais consulte l'ensemble des noeuds slectionns.
+///
+/// @return Vrai s'il existe un noeud slectionn, faux autrement.
+///
+////////////////////////////////////////////////////////////////////////
+bool ArbreRendu::selectionExiste() const
+{
+	return !selection_.empty();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::deselectionnerTout()
+///
+/// Cette fonction dslectionne tous les noeuds de l'arbre.  Seuls les
+/// noeuds de l'ensemble des noeuds slectionns sont visits, plutt que
+/// l'arbre au complet.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::deselectionnerTout()
+{
+	// L'ensemble est mis de ct, car chaque dslection le modifie.
+	EnsembleSelection selection;
+	selection.swap(selection_);
+	for (NoeudAbstrait* noeud : selection)
+		noeud->assignerSelection(false);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::afficher(const vue::Vue& vue) const
+///
+/// Cette fonction affiche l'arbre dans une vue.  Le frustum est calcul
+///  partir des matrices de la camra et de la projection de la vue
+/// plutt que relu d'OpenGL, ce qui vite de synchroniser le pilote 
+/// chaque image.  La matrice de la camra sert de matrice de vue aux
+/// noeuds.
+///
+/// @param[in] vue : La vue dans laquelle l'arbre est affich.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::afficher(const vue::Vue& vue) const
+{
+	const glm::dmat4 matriceVue{ vue.obtenirCamera().obtenirMatrice() };
+	const glm::dmat4 projection{ vue.obtenirProjection().obtenirMatrice() };
+
+	afficherVisibles(vue::Frustum{ projection * matriceVue }, matriceVue);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::afficherVisibles(const vue::Frustum& frustum, const glm::dmat4& matriceVue) const
+///
+/// Cette fonction affiche les noeuds de l'arbre en ordre prfixe, comme
+/// NoeudAbstrait::afficher(), mais sans afficher les sous-arbres dont la
+/// sphre englobante est hors du frustum.  Les sphres sont d'abord
+/// mises  jour en ordre suffixe, puisque celle d'un noeud contient
+/// celles de ses enfants.  Les nombres de noeuds affichs et limins
+/// sont retenus pour le dernier affichage.
+///
+/// @param[in] frustum    : Le frustum de la vue, exprim dans le mme
+///                         repre que les matrices monde des noeuds.
+/// @param[in] matriceVue : La matrice de vue, dans laquelle sont
+///                         exprimes les matrices monde des noeuds.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::afficherVisibles(const vue::Frustum& frustum, const glm::dmat4& matriceVue) const
+{
+	if (eliminationHorsChamp_) {
+		VisiteurVolumesEnglobants volumes;
+		ParcoursArbre::parcourir<const NoeudAbstrait>(this, volumes);
+	}
+
+	VisiteurAffichage visiteur{ eliminationHorsChamp_ ? &frustum : nullptr, matriceVue };
+	ParcoursArbre::parcourir<const NoeudAbstrait>(this, visiteur);
+
+	nombreNoeudsAffiches_ = visiteur.obtenirNombreAffiches();
+	nombreNoeudsElimines_ = visiteur.obtenirNombreElimines();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::mettreAJourVolumes()
+///
+/// Cette fonction met  jour la bote de chaque noeud dans la hirarchie
+/// des volumes, par exemple aprs l'animation de la scne.  Seuls les
+/// noeuds sortis de leur bote agrandie sont rinsrs: les autres ne
+/// cotent que la comparaison de leur bote.
+///
+/// Les ajouts et les retraits de noeuds sont suivis automatiquement;
+/// seuls les dplacements doivent tre signals par cette fonction.
+///
+/// Si une phase large est assigne, les sphres des noeuds y sont aussi
+/// dplaces et les paires candidates sont recalcules.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::mettreAJourVolumes()
+{
+	for (const NoeudAbstrait* noeud : poignees_) {
+		deplacerVolume(noeud);
+		deplacerPhaseLarge(noeud);
+	}
+
+	if (phaseLarge_ != nullptr)
+		phaseLarge_->mettreAJour();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::mettreAJourVolumes(NoeudAbstrait* noeud)
+///
+/// Cette fonction met  jour la bote d'un noeud et de ses descendants
+/// dans la hirarchie des volumes, aprs le dplacement de ce seul
+/// sous-arbre.  Leurs sphres sont aussi dplaces dans la phase large,
+/// mais les paires candidates ne sont pas recalcules.
+///
+/// @param[in] noeud : La racine du sous-arbre dplac.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::mettreAJourVolumes(NoeudAbstrait* noeud)
+{
+	ParcoursArbre::parcourirPrefixe<const NoeudAbstrait>(noeud, [this](const NoeudAbstrait* descendant) {
+		deplacerVolume(descendant);
+		deplacerPhaseLarge(descendant);
+		return ParcoursArbre::CONTINUER;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn NoeudAbstrait* ArbreRendu::chercherNoeudSurRayon(const glm::dvec3& origine, const glm::dvec3& direction) const
+///
+/// Cette fonction cherche le noeud dont la sphre englobante est touche
+/// en premier par un rayon, par exemple pour la slection par un clic.
+/// Seules les feuilles de la hirarchie traverses par le rayon sont
+/// testes, et la recherche se restreint aux noeuds plus proches que le
+/// meilleur trouv.
+///
+/// @param[in] origine   : L'origine du rayon, dans le repre de la racine.
+/// @param[in] direction : La direction du rayon, non nulle.
+///
+/// @return Le noeud touch, ou nullptr si aucun noeud n'est touch.
+///
+////////////////////////////////////////////////////////////////////////
+NoeudAbstrait* ArbreRendu::chercherNoeudSurRayon(
+	const glm::dvec3& origine, const glm::dvec3& direction
+	) const
+{
+	const glm::dvec3 unitaire{ glm::normalize(direction) };
+	NoeudAbstrait* plusProche{ nullptr };
+
+	volumes_.lancerRayon(origine, unitaire, (std::numeric_limits<double>::max)(),
+		[&origine, &unitaire, &plusProche](NoeudAbstrait* noeud, double distanceMax) -> double {
+		// Intersection du rayon avec la sphre englobante du noeud.
+		const glm::dvec3 ecart{ origine - glm::dvec3{ noeud->obtenirMatriceMonde()[3] } };
+		const double rayon{ noeud->obtenirRayonEnglobant() };
+		const double b{ glm::dot(ecart, unitaire) };
+		const double c{ glm::length2(ecart) - rayon * rayon };
+		const double discriminant{ b * b - c };
+		if ((c > 0.0 && b > 0.0) || discriminant < 0.0)
+			return distanceMax;
+
+		double distance{ -b - sqrt(discriminant) };
+		if (distance < 0.0)
+			distance = 0.0;
+		if (distance >= distanceMax)
+			return distanceMax;
+
+		plusProche = noeud;
+		// Une distance nulle arrterait la recherche: l'origine est dans la
+		// sphre, et aucun noeud ne peut tre plus proche.
+		return distance;
+	});
+
+	return plusProche;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::chercherNoeudsDansBoite(const utilitaire::BoiteEnglobante& boite, std::vector<NoeudAbstrait*>& noeuds) const
+///
+/// Cette fonction cherche les noeuds dont la sphre englobante touche
+/// une bote, par exemple pour la slection par un rectangle lastique.
+///
+/// @param[in]  boite  : La bote, dans le repre de la racine.
+/// @param[out] noeuds : Les noeuds trouvs, ajouts dans un ordre
+///                      quelconque.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::chercherNoeudsDansBoite(
+	const utilitaire::BoiteEnglobante& boite, std::vector<NoeudAbstrait*>& noeuds
+	) const
+{
+	volumes_.chercherDansBoite(boite, [&boite, &noeuds](NoeudAbstrait* noeud) {
+		const glm::dvec3 centre{ noeud->obtenirMatriceMonde()[3] };
+		if (ArbreVolumesNoeuds::calculerDistance(centre, boite) <= noeud->obtenirRayonEnglobant())
+			noeuds.push_back(noeud);
+		return true;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::chercherNoeudsPlusProches(const glm::dvec3& point, unsigned int nombre, std::vector<NoeudAbstrait*>& noeuds) const
+///
+/// Cette fonction cherche les noeuds dont la sphre englobante est la
+/// plus proche d'un point.
+///
+/// @param[in]  point  : Le point, dans le repre de la racine.
+/// @param[in]  nombre : Le nombre de noeuds recherchs.
+/// @param[out] noeuds : Les noeuds trouvs, ajouts du plus proche au plus
+///                      loign.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::chercherNoeudsPlusProches(
+	const glm::dvec3& point, unsigned int nombre, std::vector<NoeudAbstrait*>& noeuds
+	) const
+{
+	volumes_.chercherPlusProches(point, nombre, [&point](NoeudAbstrait* noeud) {
+		const double distance{
+			glm::length(point - glm::dvec3{ noeud->obtenirMatriceMonde()[3] }) - noeud->obtenirRayonEnglobant()
+		};
+		return distance > 0.0 ? distance : 0.0;
+	}, noeuds);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::assignerPhaseLarge(std::unique_ptr<aidecollision::PhaseLarge> phaseLarge)
+///
+/// Cette fonction assigne la phase large qui produit les paires de
+/// noeuds candidates  une collision.  Les noeuds dj prsents qui
+/// affichent quelque chose y sont ajouts; les ajouts et les retraits
+/// suivants sont ensuite suivis automatiquement, et les paires sont
+/// recalcules par mettreAJourVolumes().
+///
+/// @param[in] phaseLarge : La phase large, vide, ou nullptr pour ne plus
+///                         en utiliser.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::assignerPhaseLarge(std::unique_ptr<aidecollision::PhaseLarge> phaseLarge)
+{
+	phaseLarge_ = std::move(phaseLarge);
+	spheresPhaseLarge_.clear();
+	noeudsPhaseLarge_.clear();
+
+	if (phaseLarge_ == nullptr)
+		return;
+
+	phaseLarge_->vider();
+	for (NoeudAbstrait* noeud : poignees_)
+		insererPhaseLarge(noeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::indexerSousArbre(NoeudAbstrait* noeud)
+///
+/// Cette fonction ajoute un noeud, puis tous ses descendants en ordre
+/// prfixe,  la fin de la liste correspondant  leur type.  Chaque
+/// noeud reoit une poigne, les noeuds slectionns sont aussi ajouts
+///  la slection et ceux qui affichent quelque chose,  la hirarchie
+/// des volumes.
+///
+/// @param[in] noeud : La racine du sous-arbre  indexer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::indexerSousArbre(NoeudAbstrait* noeud)
+{
+	ParcoursArbre::parcourirPrefixe(noeud, [this](NoeudAbstrait* descendant) {
+		const RegistreTypes::Identifiant type{ descendant->obtenirIdentifiantType() };
+		if (type >= indexTypes_.size())
+			indexTypes_.resize(type + 1);
+		indexTypes_[type].push_back(descendant);
+		if (descendant->estSelectionne())
+			selection_.insert(descendant);
+		descendant->assignerPoignee(poignees_.inserer(descendant));
+		insererVolume(descendant);
+		insererPhaseLarge(descendant);
+		return ParcoursArbre::CONTINUER;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::collecterSousArbre(const NoeudAbstrait* noeud, EnsemblesParType& ensembles)
+///
+/// Cette fonction ajoute un noeud, puis tous ses descendants, 
+/// l'ensemble correspondant  leur type.
+///
+/// @param[in]     noeud     : La racine du sous-arbre  parcourir.
+/// @param[in,out] ensembles : Les ensembles de noeuds par type.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::collecterSousArbre(const NoeudAbstrait* noeud, EnsemblesParType& ensembles)
+{
+	ParcoursArbre::parcourirPrefixe(noeud, [&ensembles](const NoeudAbstrait* descendant) {
+		ensembles[descendant->obtenirIdentifiantType()].insert(descendant);
+		return ParcoursArbre::CONTINUER;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::assignerStockageSousArbre(NoeudAbstrait* noeud, utilitaire::StockageTransformations* stockage)
+///
+/// Cette fonction assigne un stockage des transformations  un noeud,
+/// puis  tous ses descendants.
+///
+/// @param[in] noeud    : La racine du sous-arbre.
+/// @param[in] stockage : Le stockage  assigner, ou nullptr.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::assignerStockageSousArbre(NoeudAbstrait* noeud, utilitaire::StockageTransformations* stockage)
+{
+	ParcoursArbre::parcourirPrefixe(noeud, [stockage](NoeudAbstrait* descendant) {
+		descendant->assignerStockageTransformations(stockage);
+		return ParcoursArbre::CONTINUER;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::insererVolume(NoeudAbstrait* noeud)
+///
+/// Cette fonction ajoute un noeud qui vient de recevoir sa poigne  la
+/// hirarchie des volumes.  Les noeuds qui n'affichent rien, comme les
+/// groupes, n'y sont pas ajouts.
+///
+/// @param[in] noeud : Le noeud  ajouter.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::insererVolume(NoeudAbstrait* noeud)
+{
+	if (noeud->obtenirRayonEnglobant() < 0.0)
+		return;
+
+	const unsigned int indice{ noeud->obtenirPoignee().indice };
+	if (indice >= feuillesVolumes_.size())
+		feuillesVolumes_.resize(indice + 1, ArbreVolumesNoeuds::AUCUN);
+	feuillesVolumes_[indice] = volumes_.inserer(calculerBoiteMonde(noeud), noeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::retirerVolume(const NoeudAbstrait* noeud)
+///
+/// Cette fonction retire un noeud de la hirarchie des volumes, s'il y
+/// est.  Elle doit tre appele avant que le noeud perde sa poigne.
+///
+/// @param[in] noeud : Le noeud  retirer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::retirerVolume(const NoeudAbstrait* noeud)
+{
+	const unsigned int indice{ noeud->obtenirPoignee().indice };
+	if (indice >= feuillesVolumes_.size() || feuillesVolumes_[indice] == ArbreVolumesNoeuds::AUCUN)
+		return;
+
+	volumes_.retirer(feuillesVolumes_[indice]);
+	feuillesVolumes_[indice] = ArbreVolumesNoeuds::AUCUN;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::deplacerVolume(const NoeudAbstrait* noeud)
+///
+/// Cette fonction met  jour la bote d'un noeud dans la hirarchie des
+/// volumes, s'il y est.
+///
+/// @param[in] noeud : Le noeud dont la position a pu changer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::deplacerVolume(const NoeudAbstrait* noeud)
+{
+	const unsigned int indice{ noeud->obtenirPoignee().indice };
+	if (indice >= feuillesVolumes_.size() || feuillesVolumes_[indice] == ArbreVolumesNoeuds::AUCUN)
+		return;
+
+	volumes_.deplacer(feuillesVolumes_[indice], calculerBoiteMonde(noeud));
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::insererPhaseLarge(NoeudAbstrait* noeud)
+///
+/// Cette fonction ajoute la sphre englobante d'un noeud qui vient de
+/// recevoir sa poigne  la phase large, si elle est utilise.  Comme
+/// pour la hirarchie des volumes, les noeuds qui n'affichent rien n'y
+/// sont pas ajouts.
+///
+/// @param[in] noeud : Le noeud  ajouter.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::insererPhaseLarge(NoeudAbstrait* noeud)
+{
+	if (phaseLarge_ == nullptr || noeud->obtenirRayonEnglobant() < 0.0)
+		return;
+
+	const aidecollision::PhaseLarge::Identifiant identifiant{
+		phaseLarge_->ajouter(glm::dvec3{ noeud->obtenirMatriceMonde()[3] }, noeud->obtenirRayonEnglobant())
+	};
+
+	const unsigned int indice{ noeud->obtenirPoignee().indice };
+	if (indice >= spheresPhaseLarge_.size())
+		spheresPhaseLarge_.resize(indice + 1, aidecollision::PhaseLarge::AUCUN);
+	spheresPhaseLarge_[indice] = identifiant;
+
+	if (identifiant >= noeudsPhaseLarge_.size())
+		noeudsPhaseLarge_.resize(identifiant + 1, nullptr);
+	noeudsPhaseLarge_[identifiant] = noeud;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::retirerPhaseLarge(const NoeudAbstrait* noeud)
+///
+/// Cette fonction retire la sphre d'un noeud de la phase large, s'il y
+/// est.  Elle doit tre appele avant que le noeud perde sa poigne.
+///
+/// @param[in] noeud : Le noeud  retirer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::retirerPhaseLarge(const NoeudAbstrait* noeud)
+{
+	const unsigned int indice{ noeud->obtenirPoignee().indice };
+	if (indice >= spheresPhaseLarge_.size() || spheresPhaseLarge_[indice] == aidecollision::PhaseLarge::AUCUN)
+		return;
+
+	// Les paires disparues de la prochaine mise  jour dsigneront encore
+	// cette sphre, mais le noeud pourra avoir t dtruit.
+	phaseLarge_->retirer(spheresPhaseLarge_[indice]);
+	spheresPhaseLarge_[indice] = aidecollision::PhaseLarge::AUCUN;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRendu::deplacerPhaseLarge(const NoeudAbstrait* noeud)
+///
+/// Cette fonction met  jour la sphre d'un noeud dans la phase large,
+/// s'il y est.
+///
+/// @param[in] noeud : Le noeud dont la position a pu changer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRendu::deplacerPhaseLarge(const NoeudAbstrait* noeud)
+{
+	const unsigned int indice{ noeud->obtenirPoignee().indice };
+	if (indice >= spheresPhaseLarge_.size() || spheresPhaseLarge_[indice] == aidecollision::PhaseLarge::AUCUN)
+		return;
+
+	phaseLarge_->deplacer(
+		spheresPhaseLarge_[indice],
+		glm::dvec3{ noeud->obtenirMatriceMonde()[3] },
+		noeud->obtenirRayonEnglobant()
+		);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn utilitaire::BoiteEnglobante ArbreRendu::calculerBoiteMonde(const NoeudAbstrait* noeud)
+///
+/// Cette fonction calcule la bote englobant la sphre englobante d'un
+/// noeud, dans le repre de la racine.
+///
+/// @param[in] noeud : Le noeud.
+///
+/// @return La bote englobante du noeud.
+///
+////////////////////////////////////////////////////////////////////////
+utilitaire::BoiteEnglobante ArbreRendu::calculerBoiteMonde(const NoeudAbstrait* noeud)
+{
+	const glm::dvec3 centre{ noeud->obtenirMatriceMonde()[3] };
+	const glm::dvec3 rayon{ noeud->obtenirRayonEnglobant() };
+	return utilitaire::BoiteEnglobante{ centre - rayon, centre + rayon };
+}
+
+
 ////////////////////////////////////////////////
 /// @}
 ////////////////////////////////////////////////
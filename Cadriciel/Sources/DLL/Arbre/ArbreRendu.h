@@ -12,13 +12,22 @@
 
 
 #include "NoeudComposite.h"
+#include "ArbreVolumes.h"
+#include "PhaseLarge.h"
 
 #include <string>
-#include <map>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 
 class NoeudAbstrait;
 class UsineNoeud;
+namespace vue {
+   class Frustum;
+   class Vue;
+}
 
 
 ///////////////////////////////////////////////////////////////////////////
@@ -40,6 +49,9 @@ class UsineNoeud;
 class ArbreRendu : public NoeudComposite
 {
 public:
+   /// Dfinition du type pour l'ensemble des noeuds slectionns.
+   using EnsembleSelection = std::unordered_set<NoeudAbstrait*>;
+
    /// Constructeur par dfaut.
    ArbreRendu();
    /// Destructeur.
@@ -54,6 +66,10 @@ public:
    NoeudAbstrait* creerNoeud(
       const std::string& typeNouveauNoeud
       ) const;
+   /// Cre un nouveau noeud  partir de l'identifiant de son type.
+   NoeudAbstrait* creerNoeud(
+      RegistreTypes::Identifiant typeNouveauNoeud
+      ) const;
 
    /// Cre et ajoute un nouveau noeud  l'arbre.
    NoeudAbstrait* ajouterNouveauNoeud(
@@ -64,14 +80,180 @@ public:
    /// Calcule la profondeur maximale possible pour l'arbre de rendu.
    static unsigned int calculerProfondeurMaximale();
 
+   /// Relche la mmoire des usines dont aucun noeud n'est encore allou.
+   void relacherMemoireUsines() const;
+
+   /// Obtient le premier noeud d'un type donn, en temps constant.
+   NoeudAbstrait* obtenirPremierNoeud(const std::string& type);
+   /// Obtient le premier noeud d'un type donn (version constante).
+   const NoeudAbstrait* obtenirPremierNoeud(const std::string& type) const;
+   /// Obtient tous les noeuds d'un type donn, en temps constant.
+   const std::vector<NoeudAbstrait*>& obtenirNoeuds(const std::string& type) const;
+   /// Obtient tous les noeuds d'un type donn par son identifiant.
+   const std::vector<NoeudAbstrait*>& obtenirNoeuds(RegistreTypes::Identifiant type) const;
+
+   /// Cherche un noeud par le type  l'aide de l'index (sur un noeud constant).
+   virtual const NoeudAbstrait* chercher(const std::string& typeNoeud) const;
+   /// Cherche un noeud par le type  l'aide de l'index.
+   virtual NoeudAbstrait* chercher(const std::string& typeNoeud);
+   // On garde visibles les versions par indice de la classe de base.
+   using NoeudComposite::chercher;
+
+   /// Vide l'arbre de ses enfants.
+   virtual void vider();
+
+   /// Obtient le noeud dsign par une poigne, en temps constant.
+   NoeudAbstrait* obtenirNoeud(utilitaire::Poignee poignee);
+   /// Obtient le noeud dsign par une poigne (version constante).
+   const NoeudAbstrait* obtenirNoeud(utilitaire::Poignee poignee) const;
+   /// Efface le noeud dsign par une poigne.
+   bool effacer(utilitaire::Poignee poignee);
+   // On garde visible la version par pointeur de la classe de base.
+   using NoeudComposite::effacer;
+   /// Libre la mmoire inutilise de la table des poignes.
+   inline void compacterPoignees();
+
+   /// Active ou dsactive le stockage contigu des transformations des noeuds.
+   void activerStockageTransformations(bool actif);
+   /// Obtient le stockage contigu des transformations des noeuds.
+   inline utilitaire::StockageTransformations* obtenirStockageTransformations();
+   /// Dplace en masse les positions relatives de tous les noeuds.
+   void translaterPositions(const glm::dvec3& deplacement);
+
+   /// Indexe un sous-arbre qui vient d'tre ajout  l'arbre.
+   virtual void signalerAjout(NoeudAbstrait* noeud);
+   /// Retire de l'index des sous-arbres qui viennent d'tre retirs de l'arbre.
+   virtual void signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds);
+   /// Ajoute ou retire un noeud de l'ensemble des noeuds slectionns.
+   virtual void signalerSelection(NoeudAbstrait* noeud);
+
+   /// Obtient l'ensemble des noeuds slectionns, en temps constant.
+   inline const EnsembleSelection& obtenirSelection() const;
+   /// Vrifie en temps constant si un noeud de l'arbre est slectionn.
+   virtual bool selectionExiste() const;
+   /// Dslectionne seulement les noeuds slectionns.
+   virtual void deselectionnerTout();
+
+   using NoeudAbstrait::afficher;
+   /// Affiche les noeuds de l'arbre qui sont dans le champ d'une vue.
+   void afficher(const vue::Vue& vue) const;
+   /// Affiche les noeuds de l'arbre qui sont dans un frustum donn.
+   void afficherVisibles(const vue::Frustum& frustum, const glm::dmat4& matriceVue) const;
+   /// Active ou dsactive l'limination des noeuds hors du champ de la vue.
+   inline void assignerEliminationHorsChamp(bool active);
+   /// Vrifie si les noeuds hors du champ de la vue sont limins.
+   inline bool estEliminationHorsChamp() const;
+   /// Obtient le nombre de noeuds affichs lors du dernier affichage.
+   inline unsigned int obtenirNombreNoeudsAffiches() const;
+   /// Obtient le nombre de noeuds limins lors du dernier affichage.
+   inline unsigned int obtenirNombreNoeudsElimines() const;
+
+   /// Met  jour la hirarchie des volumes aprs le dplacement de noeuds.
+   void mettreAJourVolumes();
+   /// Met  jour la hirarchie des volumes aprs le dplacement d'un sous-arbre.
+   void mettreAJourVolumes(NoeudAbstrait* noeud);
+   /// Obtient la hirarchie des volumes englobants des noeuds.
+   inline const utilitaire::ArbreVolumes<NoeudAbstrait*>& obtenirArbreVolumes() const;
+   /// Cherche le noeud le plus proche touch par un rayon.
+   NoeudAbstrait* chercherNoeudSurRayon(
+      const glm::dvec3& origine, const glm::dvec3& direction
+      ) const;
+   /// Cherche les noeuds qui touchent une bote.
+   void chercherNoeudsDansBoite(
+      const utilitaire::BoiteEnglobante& boite, std::vector<NoeudAbstrait*>& noeuds
+      ) const;
+   /// Cherche les noeuds les plus proches d'un point.
+   void chercherNoeudsPlusProches(
+      const glm::dvec3& point, unsigned int nombre, std::vector<NoeudAbstrait*>& noeuds
+      ) const;
+
+   /// Assigne la phase large de la dtection des collisions entre les noeuds.
+   void assignerPhaseLarge(std::unique_ptr<aidecollision::PhaseLarge> phaseLarge);
+   /// Obtient la phase large de la dtection des collisions, ou nullptr.
+   inline aidecollision::PhaseLarge* obtenirPhaseLarge();
+   /// Obtient la phase large de la dtection des collisions (version constante).
+   inline const aidecollision::PhaseLarge* obtenirPhaseLarge() const;
+   /// Obtient le noeud correspondant  une sphre de la phase large.
+   inline NoeudAbstrait* obtenirNoeudPhaseLarge(aidecollision::PhaseLarge::Identifiant identifiant) const;
+
 
 private:
-   /// Dfinition du type pour l'association du nom d'un type vers l'usine
-   /// correspondante.
-	using RegistreUsines = std::map< std::string, const UsineNoeud* >;
-   /// Association du nom d'un type vers l'usine correspondante.
+   /// Dfinition du type pour l'association du nom d'un type vers un
+   /// ensemble de noeuds de ce type.
+   using EnsemblesParType = std::unordered_map< RegistreTypes::Identifiant, std::unordered_set<const NoeudAbstrait*> >;
+
+   /// Ajoute un noeud et ses descendants  l'index des types.
+   void indexerSousArbre(NoeudAbstrait* noeud);
+   /// Regroupe par type un noeud et ses descendants.
+   static void collecterSousArbre(const NoeudAbstrait* noeud, EnsemblesParType& ensembles);
+   /// Assigne un stockage des transformations  un noeud et ses descendants.
+   static void assignerStockageSousArbre(NoeudAbstrait* noeud, utilitaire::StockageTransformations* stockage);
+   /// Ajoute un noeud  la hirarchie des volumes, s'il affiche quelque chose.
+   void insererVolume(NoeudAbstrait* noeud);
+   /// Retire un noeud de la hirarchie des volumes.
+   void retirerVolume(const NoeudAbstrait* noeud);
+   /// Met  jour la bote d'un noeud dans la hirarchie des volumes.
+   void deplacerVolume(const NoeudAbstrait* noeud);
+   /// Ajoute un noeud  la phase large, s'il affiche quelque chose.
+   void insererPhaseLarge(NoeudAbstrait* noeud);
+   /// Retire un noeud de la phase large.
+   void retirerPhaseLarge(const NoeudAbstrait* noeud);
+   /// Met  jour la sphre d'un noeud dans la phase large.
+   void deplacerPhaseLarge(const NoeudAbstrait* noeud);
+   /// Calcule la bote englobant un noeud dans le repre de la racine.
+   static utilitaire::BoiteEnglobante calculerBoiteMonde(const NoeudAbstrait* noeud);
+
+
+   /// Dfinition du type pour l'association de l'identifiant d'un type
+   /// vers l'usine correspondante, qui est nulle si le type n'a pas
+   /// d'usine.
+   using RegistreUsines = std::vector< const UsineNoeud* >;
+   /// Association de l'identifiant d'un type vers l'usine correspondante.
    RegistreUsines usines_;
 
+   /// Dfinition du type pour l'association de l'identifiant d'un type
+   /// vers la liste des noeuds de ce type prsents dans l'arbre, en ordre
+   /// d'insertion.
+   using IndexTypes = std::vector< std::vector<NoeudAbstrait*> >;
+   /// Index des noeuds de l'arbre selon leur type.
+   IndexTypes indexTypes_;
+
+   /// Stockage contigu des transformations des noeuds, s'il est activ.
+   std::unique_ptr<utilitaire::StockageTransformations> stockageNoeuds_;
+
+   /// Ensemble des noeuds de l'arbre qui sont slectionns.
+   EnsembleSelection selection_;
+
+   /// Table des noeuds de l'arbre, dsigns par leur poigne.
+   utilitaire::TableCreneaux<NoeudAbstrait*> poignees_;
+
+   /// Vrai si les noeuds hors du champ de la vue ne sont pas affichs.
+   bool eliminationHorsChamp_{ true };
+   /// Nombre de noeuds affichs lors du dernier affichage.
+   mutable unsigned int nombreNoeudsAffiches_{ 0 };
+   /// Nombre de noeuds limins lors du dernier affichage, parce qu'ils
+   /// taient hors du champ de la vue.
+   mutable unsigned int nombreNoeudsElimines_{ 0 };
+
+   /// Dfinition du type de la hirarchie des volumes englobants.
+   using ArbreVolumesNoeuds = utilitaire::ArbreVolumes<NoeudAbstrait*>;
+   /// Marge des botes de la hirarchie des volumes.
+   static const double MARGE_VOLUMES;
+   /// Hirarchie des botes englobantes des noeuds qui affichent quelque
+   /// chose, dans le repre de la racine.
+   ArbreVolumesNoeuds volumes_;
+   /// Feuille de chaque noeud dans la hirarchie des volumes, selon
+   /// l'indice de sa poigne, ou AUCUN.
+   std::vector<ArbreVolumesNoeuds::Identifiant> feuillesVolumes_;
+
+   /// Phase large de la dtection des collisions entre les noeuds, si elle
+   /// est utilise.
+   std::unique_ptr<aidecollision::PhaseLarge> phaseLarge_;
+   /// Sphre de chaque noeud dans la phase large, selon l'indice de sa
+   /// poigne, ou AUCUN.
+   std::vector<aidecollision::PhaseLarge::Identifiant> spheresPhaseLarge_;
+   /// Noeud de chaque sphre de la phase large, selon son identifiant.
+   std::vector<NoeudAbstrait*> noeudsPhaseLarge_;
 };
 
 
@@ -82,6 +264,9 @@ private:
 /// Cette fonction permet d'ajouter une usine qui sera ensuite utilise
 /// pour crer de nouveaux noeuds.
 ///
+/// Le type est enregistr dans le registre des types, et son
+/// identifiant sert d'indice dans le tableau des usines.
+///
 /// @param[in] type  : La chane qui identifie le type de noeuds  crer
 ///                    avec cette usine.
 /// @param[in] usine : L'usine ajoute.
@@ -93,7 +278,200 @@ inline void ArbreRendu::ajouterUsine(
    const std::string& type, const UsineNoeud* usine
    )
 {
-   usines_[type] = usine;
+   const RegistreTypes::Identifiant identifiant{ RegistreTypes::enregistrer(type) };
+   if (identifiant >= usines_.size())
+      usines_.resize(identifiant + 1, nullptr);
+   usines_[identifiant] = usine;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline utilitaire::StockageTransformations* ArbreRendu::obtenirStockageTransformations()
+///
+/// Cette fonction retourne le stockage contigu des transformations des
+/// noeuds de l'arbre, sur lequel peuvent s'effectuer des traitements de
+/// masse.  Aprs un tel traitement, invaliderMatriceMonde() doit tre
+/// appele sur l'arbre afin que les matrices monde soient recalcules.
+///
+/// @return Le stockage, ou nullptr s'il n'est pas activ.
+///
+////////////////////////////////////////////////////////////////////////
+inline utilitaire::StockageTransformations* ArbreRendu::obtenirStockageTransformations()
+{
+   return stockageNoeuds_.get();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const ArbreRendu::EnsembleSelection& ArbreRendu::obtenirSelection() const
+///
+/// Cette fonction retourne l'ensemble des noeuds slectionns de l'arbre,
+/// tenu  jour lors des changements de slection, des ajouts et des
+/// retraits.  Il peut servir aux oprations de masse sur la slection,
+/// mais doit tre copi avant toute opration qui modifie la slection
+/// ou la structure de l'arbre, qui l'invaliderait.
+///
+/// @return L'ensemble des noeuds slectionns.
+///
+////////////////////////////////////////////////////////////////////////
+inline const ArbreRendu::EnsembleSelection& ArbreRendu::obtenirSelection() const
+{
+   return selection_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline void ArbreRendu::compacterPoignees()
+///
+/// Cette fonction libre la mmoire inutilise de la table des poignes,
+/// par exemple aprs l'effacement d'une grande partie de l'arbre.  Les
+/// poignes existantes restent valides.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+inline void ArbreRendu::compacterPoignees()
+{
+   poignees_.compacter();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline void ArbreRendu::assignerEliminationHorsChamp(bool active)
+///
+/// Cette fonction active ou dsactive l'limination des noeuds hors du
+/// champ de la vue lors de l'affichage.  Lorsqu'elle est dsactive, tous
+/// les noeuds affichables sont affichs.
+///
+/// @param[in] active : Vrai pour liminer les noeuds hors du champ.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+inline void ArbreRendu::assignerEliminationHorsChamp(bool active)
+{
+   eliminationHorsChamp_ = active;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline bool ArbreRendu::estEliminationHorsChamp() const
+///
+/// Cette fonction indique si les noeuds hors du champ de la vue sont
+/// limins lors de l'affichage.
+///
+/// @return Vrai si l'limination est active.
+///
+////////////////////////////////////////////////////////////////////////
+inline bool ArbreRendu::estEliminationHorsChamp() const
+{
+   return eliminationHorsChamp_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline unsigned int ArbreRendu::obtenirNombreNoeudsAffiches() const
+///
+/// Cette fonction retourne le nombre de noeuds affichs lors du dernier
+/// affichage de l'arbre.
+///
+/// @return Le nombre de noeuds affichs.
+///
+////////////////////////////////////////////////////////////////////////
+inline unsigned int ArbreRendu::obtenirNombreNoeudsAffiches() const
+{
+   return nombreNoeudsAffiches_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline unsigned int ArbreRendu::obtenirNombreNoeudsElimines() const
+///
+/// Cette fonction retourne le nombre de noeuds qui n'ont pas t
+/// affichs lors du dernier affichage de l'arbre parce qu'ils taient
+/// hors du champ de la vue.
+///
+/// @return Le nombre de noeuds limins.
+///
+////////////////////////////////////////////////////////////////////////
+inline unsigned int ArbreRendu::obtenirNombreNoeudsElimines() const
+{
+   return nombreNoeudsElimines_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const utilitaire::ArbreVolumes<NoeudAbstrait*>& ArbreRendu::obtenirArbreVolumes() const
+///
+/// Cette fonction retourne la hirarchie des botes englobantes des
+/// noeuds de l'arbre, pour des requtes spatiales autres que celles
+/// offertes par l'arbre.
+///
+/// @return La hirarchie des volumes.
+///
+////////////////////////////////////////////////////////////////////////
+inline const utilitaire::ArbreVolumes<NoeudAbstrait*>& ArbreRendu::obtenirArbreVolumes() const
+{
+   return volumes_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline aidecollision::PhaseLarge* ArbreRendu::obtenirPhaseLarge()
+///
+/// Cette fonction retourne la phase large qui produit les paires de
+/// noeuds candidates  une collision.
+///
+/// @return La phase large, ou nullptr si aucune n'est assigne.
+///
+////////////////////////////////////////////////////////////////////////
+inline aidecollision::PhaseLarge* ArbreRendu::obtenirPhaseLarge()
+{
+   return phaseLarge_.get();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const aidecollision::PhaseLarge* ArbreRendu::obtenirPhaseLarge() const
+///
+/// Cette fonction retourne la phase large qui produit les paires de
+/// noeuds candidates  une collision (version constante).
+///
+/// @return La phase large, ou nullptr si aucune n'est assigne.
+///
+////////////////////////////////////////////////////////////////////////
+inline const aidecollision::PhaseLarge* ArbreRendu::obtenirPhaseLarge() const
+{
+   return phaseLarge_.get();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline NoeudAbstrait* ArbreRendu::obtenirNoeudPhaseLarge(aidecollision::PhaseLarge::Identifiant identifiant) const
+///
+/// Cette fonction retourne le noeud reprsent par une sphre de la
+/// phase large, par exemple pour traiter une paire candidate.  Le noeud
+/// d'une paire disparue parce qu'il a t retir peut avoir t dtruit.
+///
+/// @param[in] identifiant : L'identifiant de la sphre.
+///
+/// @return Le noeud correspondant.
+///
+////////////////////////////////////////////////////////////////////////
+inline NoeudAbstrait* ArbreRendu::obtenirNoeudPhaseLarge(aidecollision::PhaseLarge::Identifiant identifiant) const
+{
+   return noeudsPhaseLarge_[identifiant];
 }
 
 
@@ -11,6 +11,7 @@
 #include "Usines/UsineNoeudAraignee.h"
 #include "Usines/UsineNoeudConeCube.h"
 #include "EtatOpenGL.h"
+#include "RegistreModeles.h"
 
 
 /// La chane reprsentant le type des araignes.
@@ -18,6 +19,11 @@ const std::string ArbreRenduINF2990::NOM_ARAIGNEE{ "araignee" };
 /// La chane reprsentant le type des cones-cubes.
 const std::string ArbreRenduINF2990::NOM_CONECUBE{ "conecube" };
 
+/// Le fichier du modle des araignes.
+static const std::string FICHIER_ARAIGNEE{ "media/spider.obj" };
+/// Le fichier du modle des cones-cubes.
+static const std::string FICHIER_CONECUBE{ "media/cubecone.obj" };
+
 
 ////////////////////////////////////////////////////////////////////////
 ///
@@ -28,14 +34,22 @@ const std::string ArbreRenduINF2990::NOM_CONECUBE{ "conecube" };
 /// Il cre galement la structure de base de l'arbre de rendu, c'est--dire
 /// avec les noeuds structurants.
 ///
+/// Les modles des usines sont obtenus du registre des modles: ceux qui
+/// ne sont pas dj chargs, par exemple par un autre arbre, sont imports
+/// en parallle, puis les usines les reoivent prts  tre affichs.
+///
 /// @return Aucune (constructeur).
 ///
 ////////////////////////////////////////////////////////////////////////
 ArbreRenduINF2990::ArbreRenduINF2990()
 {
+	// Chargement des modles, dans l'ordre des usines
+	std::vector<modele::RegistreModeles::Poignee> modeles{
+		modele::RegistreModeles::obtenirInstance()->obtenirLot({ FICHIER_ARAIGNEE, FICHIER_CONECUBE }) };
+
 	// Construction des usines
-	ajouterUsine(NOM_ARAIGNEE, new UsineNoeudAraignee{ NOM_ARAIGNEE });
-	ajouterUsine(NOM_CONECUBE, new UsineNoeudConeCube{ NOM_CONECUBE });
+	ajouterUsine(NOM_ARAIGNEE, new UsineNoeudAraignee{ NOM_ARAIGNEE, modeles[0] });
+	ajouterUsine(NOM_CONECUBE, new UsineNoeudConeCube{ NOM_CONECUBE, modeles[1] });
 }
 
 
@@ -66,8 +80,10 @@ ArbreRenduINF2990::~ArbreRenduINF2990()
 ////////////////////////////////////////////////////////////////////////
 void ArbreRenduINF2990::initialiser()
 {
-	// On vide l'arbre
+	// On vide l'arbre, puis on rend au systme la mmoire de l'ancienne
+	// scne d'un seul coup.
 	vider();
+	relacherMemoireUsines();
 
 	// On ajoute un noeud bidon seulement pour que quelque chose s'affiche.
 	NoeudAbstrait* noeud{ creerNoeud(NOM_ARAIGNEE) };
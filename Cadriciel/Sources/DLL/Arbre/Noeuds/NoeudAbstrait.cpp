@@ -9,13 +9,22 @@
 
 #include "NoeudAbstrait.h"
 #include "Utilitaire.h"
+#include "PoolMemoire.h"
+#include "ParcoursArbre.h"
+
+#include "glm\gtc\matrix_transform.hpp"
+#include "glm\gtc\type_ptr.hpp"
+
+#include <cassert>
+#include <new>
 
 
 ////////////////////////////////////////////////////////////////////////
 ///
 /// @fn NoeudAbstrait::NoeudAbstrait(const std::string& type)
 ///
-/// Ne fait qu'initialiser les variables membres de la classe.
+/// Ne fait qu'initialiser les variables membres de la classe.  Le type
+/// est enregistr au besoin dans le registre des types.
 ///
 /// @param[in] type               : Le type du noeud.
 ///
@@ -25,7 +34,7 @@
 NoeudAbstrait::NoeudAbstrait(
 	const std::string& type //= std::string{ "" }
 	) :
-	type_( type )
+	type_( RegistreTypes::enregistrer(type) )
 {
 }
 
@@ -34,8 +43,9 @@ NoeudAbstrait::NoeudAbstrait(
 ///
 /// @fn NoeudAbstrait::~NoeudAbstrait()
 ///
-/// Destructeur vide dclar virtuel pour les classes drives.  La
-/// libration des afficheurs n'est pas la responsabilit de cette
+/// Destructeur dclar virtuel pour les classes drives.  Il libre la
+/// transformation du noeud si elle se trouve dans un stockage contigu.
+/// La libration des afficheurs n'est pas la responsabilit de cette
 /// classe.
 ///
 /// @return Aucune (destructeur).
@@ -43,6 +53,291 @@ NoeudAbstrait::NoeudAbstrait(
 ////////////////////////////////////////////////////////////////////////
 NoeudAbstrait::~NoeudAbstrait()
 {
+	if (stockageTransformations_ != nullptr)
+		stockageTransformations_->liberer(indiceTransformation_);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void* NoeudAbstrait::operator new(std::size_t taille)
+///
+/// Alloue un noeud sur le tas.  Une entte indiquant que le noeud ne
+/// provient d'aucun pool est place devant le noeud, afin que
+/// l'oprateur delete puisse retourner la mmoire au bon endroit.
+///
+/// @param[in] taille : La taille du noeud  allouer.
+///
+/// @return La mmoire o construire le noeud.
+///
+////////////////////////////////////////////////////////////////////////
+void* NoeudAbstrait::operator new(std::size_t taille)
+{
+	char* bloc{ static_cast<char*>(::operator new(calculerTailleAllocation(taille))) };
+	*reinterpret_cast<utilitaire::PoolMemoire**>(bloc) = nullptr;
+	return bloc + TAILLE_ENTETE;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void* NoeudAbstrait::operator new(std::size_t taille, utilitaire::PoolMemoire& pool)
+///
+/// Alloue un noeud dans un pool de mmoire.  Les usines s'en servent pour
+/// que les noeuds d'un mme type soient voisins en mmoire.  Le pool
+/// doit survivre au noeud allou.
+///
+/// @param[in] taille : La taille du noeud  allouer.
+/// @param[in] pool   : Le pool dans lequel allouer le noeud.
+///
+/// @return La mmoire o construire le noeud.
+///
+////////////////////////////////////////////////////////////////////////
+void* NoeudAbstrait::operator new(std::size_t taille, utilitaire::PoolMemoire& pool)
+{
+	assert(calculerTailleAllocation(taille) <= pool.obtenirTailleBloc() &&
+		"Les blocs du pool sont trop petits pour ce type de noeud.");
+
+	char* bloc{ static_cast<char*>(pool.allouer()) };
+	*reinterpret_cast<utilitaire::PoolMemoire**>(bloc) = &pool;
+	return bloc + TAILLE_ENTETE;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::operator delete(void* ptr)
+///
+/// Libre la mmoire d'un noeud en la retournant  son pool d'origine,
+/// ou au tas s'il n'a pas t allou dans un pool.
+///
+/// @param[in] ptr : Le noeud  librer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::operator delete(void* ptr)
+{
+	if (ptr == nullptr)
+		return;
+
+	char* bloc{ static_cast<char*>(ptr) - TAILLE_ENTETE };
+	utilitaire::PoolMemoire* pool{ *reinterpret_cast<utilitaire::PoolMemoire**>(bloc) };
+	if (pool != nullptr)
+		pool->liberer(bloc);
+	else
+		::operator delete(bloc);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::operator delete(void* ptr, utilitaire::PoolMemoire& pool)
+///
+/// Libre la mmoire d'un noeud dont le constructeur a lanc une
+/// exception lors d'une allocation dans un pool.
+///
+/// @param[in] ptr  : Le noeud  librer.
+/// @param[in] pool : Le pool dans lequel le noeud a t allou.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::operator delete(void* ptr, utilitaire::PoolMemoire& pool)
+{
+	NoeudAbstrait::operator delete(ptr);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn const glm::dmat4& NoeudAbstrait::obtenirMatriceMonde() const
+///
+/// Cette fonction retourne la matrice de transformation du noeud vers le
+/// repre de la racine de son arbre.  Elle n'est recalcule,  partir de
+/// celle du parent, que si la position du noeud ou d'un de ses anctres
+/// a chang depuis le dernier appel, que ce soit individuellement ou par
+/// une modification en masse du stockage contigu.
+///
+/// Comme les descendants d'un noeud prim sont eux aussi prims, les
+/// anctres prims forment une chane au-dessus du noeud.  Cette chane
+/// est recalcule de haut en bas, sans rcursion.
+///
+/// @return La matrice monde du noeud.
+///
+////////////////////////////////////////////////////////////////////////
+const glm::dmat4& NoeudAbstrait::obtenirMatriceMonde() const
+{
+	if (estMatriceMondeAJour())
+		return matriceMonde_;
+
+	// Cas usuel, par exemple lors de l'affichage en ordre prfixe: seul
+	// ce noeud est  recalculer.
+	if (parent_ == nullptr || parent_->estMatriceMondeAJour()) {
+		calculerMatriceMonde();
+		return matriceMonde_;
+	}
+
+	std::vector<const NoeudAbstrait*> chaine;
+	for (const NoeudAbstrait* noeud{ this };
+		noeud != nullptr && !noeud->estMatriceMondeAJour();
+		noeud = noeud->parent_) {
+		chaine.push_back(noeud);
+	}
+
+	for (auto it = chaine.rbegin(); it != chaine.rend(); ++it)
+		(*it)->calculerMatriceMonde();
+
+	return matriceMonde_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::calculerMatriceMonde() const
+///
+/// Cette fonction recalcule la matrice monde du noeud  partir de celle
+/// de son parent, qui doit tre  jour.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::calculerMatriceMonde() const
+{
+	const glm::dmat4 matriceLocale{
+		glm::translate(glm::dmat4{ 1.0 }, obtenirPositionRelative())
+	};
+	if (parent_ != nullptr)
+		matriceMonde_ = parent_->matriceMonde_ * matriceLocale;
+	else
+		matriceMonde_ = matriceLocale;
+	matriceMondeInvalide_ = false;
+	if (stockageTransformations_ != nullptr)
+		versionMatriceMonde_ = stockageTransformations_->obtenirVersion();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::invaliderMatriceMonde()
+///
+/// Cette fonction indique que la matrice monde du noeud et celles de ses
+/// descendants doivent tre recalcules.  Comme les descendants d'un
+/// noeud invalide sont eux aussi invalides, la propagation s'arrte aux
+/// sous-arbres dj invalides.
+///
+/// Elle est appele automatiquement lors d'un changement de position ou
+/// de parent.  Les modifications en masse des positions d'un stockage
+/// contigu n'ont pas  l'appeler: elles changent la version du stockage,
+/// que vrifie obtenirMatriceMonde().
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::invaliderMatriceMonde()
+{
+	ParcoursArbre::parcourirPrefixe<NoeudAbstrait>(this, [](NoeudAbstrait* noeud) -> ParcoursArbre::Decision {
+		if (noeud->matriceMondeInvalide_)
+			return ParcoursArbre::IGNORER_ENFANTS;
+		noeud->matriceMondeInvalide_ = true;
+		return ParcoursArbre::CONTINUER;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn double NoeudAbstrait::obtenirRayonEnglobant() const
+///
+/// Cette fonction retourne le rayon de la sphre, centre  l'origine du
+/// noeud, qui englobe tout ce que le noeud affiche lui-mme.  Par dfaut,
+/// il s'agit de la sphre englobante du modle assign par l'usine; un
+/// noeud qui dplace son modle lors de l'affichage doit l'agrandir.
+///
+/// @return Le rayon englobant, ngatif si le noeud n'affiche rien.
+///
+////////////////////////////////////////////////////////////////////////
+double NoeudAbstrait::obtenirRayonEnglobant() const
+{
+	return rayonEnglobant_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::calculerVolumeEnglobant() const
+///
+/// Cette fonction met  jour la sphre englobant le noeud et tous ses
+/// descendants, dans le repre de la racine.  Elle n'est pas rcursive:
+/// les volumes des enfants doivent dj tre  jour, ce qu'un parcours
+/// postfixe de l'arbre assure.  La sphre obtenue n'est pas minimale,
+/// mais elle contient toujours celles du noeud et de ses enfants.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::calculerVolumeEnglobant() const
+{
+	// Les matrices monde ne contiennent que des translations: la sphre
+	// du noeud est simplement dplace  sa position dans le monde.
+	centreVolumeEnglobant_ = glm::dvec3{ obtenirMatriceMonde()[3] };
+	rayonVolumeEnglobant_ = obtenirRayonEnglobant();
+
+	const unsigned int nombreEnfants{ obtenirNombreEnfants() };
+	for (unsigned int i = 0; i < nombreEnfants; ++i) {
+		const NoeudAbstrait* enfant{ chercher(i) };
+		const double rayonEnfant{ enfant->rayonVolumeEnglobant_ };
+		if (rayonEnfant < 0.0)
+			continue;
+
+		const glm::dvec3 ecart{ enfant->centreVolumeEnglobant_ - centreVolumeEnglobant_ };
+		const double distance{ glm::length(ecart) };
+		if (rayonVolumeEnglobant_ >= distance + rayonEnfant)
+			continue;
+
+		if (rayonVolumeEnglobant_ < 0.0 || rayonEnfant >= distance + rayonVolumeEnglobant_) {
+			// La sphre de l'enfant contient la sphre courante.
+			centreVolumeEnglobant_ = enfant->centreVolumeEnglobant_;
+			rayonVolumeEnglobant_ = rayonEnfant;
+		}
+		else {
+			// Plus petite sphre contenant les deux sphres.
+			const double rayon{ (distance + rayonVolumeEnglobant_ + rayonEnfant) / 2.0 };
+			centreVolumeEnglobant_ += ecart * ((rayon - rayonVolumeEnglobant_) / distance);
+			rayonVolumeEnglobant_ = rayon;
+		}
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::assignerStockageTransformations(utilitaire::StockageTransformations* stockage)
+///
+/// Cette fonction dplace la transformation du noeud dans un stockage
+/// contigu, ou la ramne dans le noeud si le stockage est nul.  La
+/// position courante est conserve.  Le stockage doit survivre au noeud
+/// ou lui tre retir avant sa destruction.
+///
+/// @param[in] stockage : Le nouveau stockage, ou nullptr.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::assignerStockageTransformations(utilitaire::StockageTransformations* stockage)
+{
+	if (stockage == stockageTransformations_)
+		return;
+
+	const glm::dvec3 position{ obtenirPositionRelative() };
+	if (stockageTransformations_ != nullptr)
+		stockageTransformations_->liberer(indiceTransformation_);
+
+	stockageTransformations_ = stockage;
+	if (stockage != nullptr)
+		indiceTransformation_ = stockage->allouer(position);
+	else
+		positionRelative_ = position;
 }
 
 
@@ -118,7 +413,7 @@ void NoeudAbstrait::effacer(const NoeudAbstrait* noeud)
 ////////////////////////////////////////////////////////////////////////
 const NoeudAbstrait* NoeudAbstrait::chercher(const std::string& typeNoeud) const
 {
-	if (typeNoeud == type_)
+	if (RegistreTypes::obtenirIdentifiant(typeNoeud) == type_)
 		return this;
 	else
 		return nullptr;
@@ -142,7 +437,7 @@ const NoeudAbstrait* NoeudAbstrait::chercher(const std::string& typeNoeud) const
 ////////////////////////////////////////////////////////////////////////
 NoeudAbstrait* NoeudAbstrait::chercher(const std::string& typeNoeud)
 {
-	if (typeNoeud == type_)
+	if (RegistreTypes::obtenirIdentifiant(typeNoeud) == type_)
 		return this;
 	else
 		return nullptr;
@@ -227,6 +522,95 @@ unsigned int NoeudAbstrait::obtenirNombreEnfants() const
 }
 
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn unsigned int NoeudAbstrait::obtenirNombreDescendants() const
+///
+/// Cette fonction retourne le nombre total de descendants du noeud,
+/// soit ses enfants, leurs enfants, etc.
+///
+/// Un noeud abstrait n'a pas de descendants, donc cette fonction
+/// retourne toujours 0.
+///
+/// @return Le nombre de descendants.
+///
+////////////////////////////////////////////////////////////////////////
+unsigned int NoeudAbstrait::obtenirNombreDescendants() const
+{
+	return 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::signalerAjout(NoeudAbstrait* noeud)
+///
+/// Cette fonction signale qu'un noeud, avec tous ses descendants, vient
+/// d'tre ajout dans le sous-arbre de ce noeud.
+///
+/// Par dfaut, le signal est simplement relay au parent, de sorte qu'il
+/// remonte jusqu' la racine de l'arbre, qui peut alors mettre  jour
+/// ses structures de recherche.
+///
+/// @param[in] noeud : Le noeud ajout.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::signalerAjout(NoeudAbstrait* noeud)
+{
+	if (parent_ != nullptr)
+		parent_->signalerAjout(noeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds)
+///
+/// Cette fonction signale qu'un lot de noeuds, avec tous leurs
+/// descendants, vient d'tre retir du sous-arbre de ce noeud.  Elle doit
+/// tre appele avant que les noeuds retirs soient dtruits.  Le fait de
+/// signaler les retraits par lot permet  la racine de mettre  jour ses
+/// structures en une seule passe.
+///
+/// Par dfaut, le signal est simplement relay au parent.
+///
+/// @param[in] noeuds : Les noeuds retirs.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds)
+{
+	if (parent_ != nullptr)
+		parent_->signalerRetrait(noeuds);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::signalerSelection(NoeudAbstrait* noeud)
+///
+/// Cette fonction signale que l'tat de slection d'un noeud, qui peut
+/// tre ce noeud lui-mme, vient de changer dans le sous-arbre de ce
+/// noeud.  Le nouvel tat est celui retourn par estSelectionne().
+///
+/// Par dfaut, le signal est simplement relay au parent, de sorte que
+/// la racine peut tenir  jour l'ensemble des noeuds slectionns.
+///
+/// @param[in] noeud : Le noeud dont la slection a chang.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::signalerSelection(NoeudAbstrait* noeud)
+{
+	if (parent_ != nullptr)
+		parent_->signalerSelection(noeud);
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///
 /// @fn void NoeudAbstrait::inverserSelection()
@@ -238,7 +622,7 @@ unsigned int NoeudAbstrait::obtenirNombreEnfants() const
 ////////////////////////////////////////////////////////////////////////
 void NoeudAbstrait::inverserSelection()
 {
-	selectionne_ = !selectionne_;
+	assignerSelection(!selectionne_);
 }
 
 
@@ -292,7 +676,7 @@ void NoeudAbstrait::selectionnerTout()
 ////////////////////////////////////////////////////////////////////////
 void NoeudAbstrait::deselectionnerTout()
 {
-	selectionne_ = false;
+	assignerSelection(false);
 }
 
 
@@ -365,35 +749,73 @@ void NoeudAbstrait::assignerModePolygones(GLenum modePolygones)
 
 ////////////////////////////////////////////////////////////////////////
 ///
-/// @fn void NoeudAbstrait::afficher() const
+/// @fn void NoeudAbstrait::afficher(const glm::dmat4& matriceVue) const
+///
+/// Cette fonction affiche le noeud et ses descendants en ordre prfixe,
+/// sans rcursion.  Chaque noeud est affich par afficherNoeud(), qui
+/// charge sa matrice monde prcalcule: l'affichage d'un noeud n'a donc
+/// pas  tre imbriqu dans celui de son parent.  Les descendants d'un
+/// noeud qui n'est pas affich ne le sont pas non plus.
+///
+/// Cette fonction n'est pas virtuelle: l'affichage d'un type de noeud se
+/// spcialise par afficherConcret().
+///
+/// @param[in] matriceVue : La matrice de vue, dans laquelle sont
+///                         exprimes les matrices monde des noeuds.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::afficher(const glm::dmat4& matriceVue) const
+{
+	ParcoursArbre::parcourirPrefixe<const NoeudAbstrait>(this, [&matriceVue](const NoeudAbstrait* noeud) -> ParcoursArbre::Decision {
+		if (!noeud->estAffiche())
+			return ParcoursArbre::IGNORER_ENFANTS;
+		noeud->afficherNoeud(matriceVue);
+		return ParcoursArbre::CONTINUER;
+	});
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::afficherNoeud(const glm::dmat4& matriceVue) const
 ///
-/// Cette fonction affiche le noeud comme tel.
+/// Cette fonction affiche le noeud comme tel, sans ses descendants.
 ///
 /// Elle consiste en une template method (dans le sens du patron de
 /// conception, et non les template C++) qui effectue ce qui est
 /// gnralement  faire pour l'affichage, c'est--dire:
 /// - Mise en pile de la matrice de transformation
-/// - Translation du noeud pour qu'il soit  sa position relative
+/// - Chargement de la matrice monde du noeud, prcalcule au besoin
 /// - Utilisation du mode d'affichage des polygones
 /// - ...
 /// - Restauration de l'tat.
 ///
 /// L'affichage comme tel est confi  la fonction afficherConcret(),
-/// appele par la fonction afficher().
+/// appele par la fonction afficherNoeud().  Comme la matrice monde est
+/// charge au complet, l'affichage d'un noeud ne dpend pas de celui de
+/// son parent.
+///
+/// La matrice de vue est fournie par l'appelant plutt que relue
+/// d'OpenGL, ce qui vite une synchronisation avec le pilote 
+/// chaque image.
+///
+/// @param[in] matriceVue : La matrice de vue, dans laquelle sont
+///                         exprimes les matrices monde des noeuds.
 ///
 /// @return Aucune.
 ///
 ////////////////////////////////////////////////////////////////////////
-void NoeudAbstrait::afficher() const
+void NoeudAbstrait::afficherNoeud(const glm::dmat4& matriceVue) const
 {
 	if (affiche_) {
 		glPushMatrix();
 		glPushAttrib(GL_CURRENT_BIT | GL_POLYGON_BIT);
 
-		// La translation de la position relative
-		glTranslated(
-			positionRelative_[0], positionRelative_[1], positionRelative_[2]
-			);
+		// Chargement de la transformation prcalcule du noeud
+		const glm::dmat4 matrice{ matriceVue * obtenirMatriceMonde() };
+		glLoadMatrixd(glm::value_ptr(matrice));
 
 		// Assignation du mode d'affichage des polygones
 		glPolygonMode(GL_FRONT_AND_BACK, modePolygones_);
@@ -414,7 +836,8 @@ void NoeudAbstrait::afficher() const
 ///
 /// Cette fonction effectue le vritable rendu de l'objet.  Elle est
 /// appele par la template method (dans le sens du patron de conception,
-/// et non des template C++) afficher() de la classe de base.
+/// et non des template C++) afficherNoeud() de la classe de base.  C'est
+/// la seule fonction d'affichage  redfinir dans les classes drives.
 ///
 /// @return Aucune.
 ///
@@ -428,18 +851,50 @@ void NoeudAbstrait::afficherConcret() const
 ///
 /// @fn void NoeudAbstrait::animer( float dt )
 ///
-/// Cette fonction effectue l'animation du noeud pour un certain
-/// intervalle de temps.
+/// Cette fonction effectue l'animation du noeud et de ses descendants
+/// pour un certain intervalle de temps.
+///
+/// Ce noeud n'ayant pas d'enfants, elle ne fait qu'appeler
+/// animerConcret().
+///
+/// @param[in] dt : Intervalle de temps sur lequel faire l'animation.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstrait::animer(float dt)
+{
+	animerConcret(dt);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstrait::animerConcret( float dt )
+///
+/// Cette fonction effectue l'animation du noeud seulement, sans ses
+/// enfants, pour un certain intervalle de temps.  Elle est appele par
+/// animer(), aprs l'animation des enfants.
 ///
 /// Elle ne fait rien pour cette classe et vise  tre surcharger par
 /// les classes drives.
 ///
+/// Lorsqu'un sous-arbre est assez grand, ses sous-arbres frres sont
+/// anims en parallle (voir NoeudComposite::animer()).  Une version
+/// drive peut donc modifier l'tat du noeud et de ses descendants,
+/// mais ne doit pas:
+/// - lire ou modifier l'tat d'un autre noeud (parent, frres, etc.), y
+///   compris par obtenirMatriceMonde(), qui met  jour les anctres;
+/// - ajouter, retirer ou dtruire des noeuds;
+/// - effectuer d'appels OpenGL;
+/// - modifier un tat global qui n'est pas protg.
+///
 /// @param[in] dt : Intervalle de temps sur lequel faire l'animation.
 ///
 /// @return Aucune.
 ///
 ////////////////////////////////////////////////////////////////////////
-void NoeudAbstrait::animer(float dt)
+void NoeudAbstrait::animerConcret(float dt)
 {
 }
 
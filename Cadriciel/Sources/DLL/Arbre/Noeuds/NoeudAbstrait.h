@@ -13,9 +13,14 @@
 
 #include <windows.h>
 #include <GL/gl.h>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "glm\glm.hpp"
+#include "StockageTransformations.h"
+#include "RegistreTypes.h"
+#include "TableCreneaux.h"
 
 /// Dclarations avances pour contenir un pointeur vers un modle3D et sa liste
 /// d'affichage
@@ -26,6 +31,10 @@ namespace modele{
 	}
 }
 
+namespace utilitaire{
+	class PoolMemoire;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 /// @class NoeudAbstrait
 /// @brief Classe de base du patron composite utilise pour crer l'arbre
@@ -35,6 +44,12 @@ namespace modele{
 ///        implanter tous les noeuds pouvant tre prsent dans l'arbre de
 ///        rendu.
 ///
+///        L'affichage d'un type de noeud se spcialise uniquement en
+///        redfinissant afficherConcret().  afficher() et afficherNoeud()
+///        ne sont pas virtuelles: le parcours de l'arbre appelle
+///        afficherNoeud() pour chaque noeud, et une redfinition de
+///        l'une d'elles serait ignore par ce parcours.
+///
 /// @author DGI-2990
 /// @date 2007-01-24
 ///////////////////////////////////////////////////////////////////////////
@@ -48,6 +63,17 @@ public:
 	/// Destructeur.
 	virtual ~NoeudAbstrait();
 
+	/// Alloue un noeud sur le tas.
+	static void* operator new(std::size_t taille);
+	/// Alloue un noeud dans un pool de mmoire.
+	static void* operator new(std::size_t taille, utilitaire::PoolMemoire& pool);
+	/// Libre un noeud, qu'il ait t allou sur le tas ou dans un pool.
+	static void operator delete(void* ptr);
+	/// Libre un noeud dont la construction dans un pool a chou.
+	static void operator delete(void* ptr, utilitaire::PoolMemoire& pool);
+	/// Calcule la taille des blocs d'un pool destin  un type de noeud.
+	static inline std::size_t calculerTailleAllocation(std::size_t tailleNoeud);
+
 	/// Obtient le parent de ce noeud.
 	inline NoeudAbstrait* obtenirParent();
 
@@ -57,14 +83,42 @@ public:
 	/// Assigne le parent de ce noeud.
 	inline void assignerParent(NoeudAbstrait* parent);
 
+	/// Obtient la matrice de transformation du noeud vers le repre de la racine.
+	const glm::dmat4& obtenirMatriceMonde() const;
+	/// Indique que la matrice monde du noeud et de ses descendants doit tre recalcule.
+	void invaliderMatriceMonde();
+
+	/// Obtient le rayon de la sphre englobant le rendu du noeud seul.
+	virtual double obtenirRayonEnglobant() const;
+	/// Met  jour la sphre englobant le noeud et ses descendants.
+	void calculerVolumeEnglobant() const;
+	/// Obtient le centre de la sphre englobant le noeud et ses descendants.
+	inline const glm::dvec3& obtenirCentreVolumeEnglobant() const;
+	/// Obtient le rayon de la sphre englobant le noeud et ses descendants.
+	inline double obtenirRayonVolumeEnglobant() const;
+
 	/// Obtient la position relative du noeud.
 	inline const glm::dvec3& obtenirPositionRelative() const;
 
 	/// Assigne la position relative du noeud.
 	inline void assignerPositionRelative(const glm::dvec3& positionRelative);
 
+	/// Dplace la transformation du noeud dans un stockage contigu.
+	void assignerStockageTransformations(utilitaire::StockageTransformations* stockage);
+	/// Obtient le stockage contigu de la transformation du noeud.
+	inline const utilitaire::StockageTransformations* obtenirStockageTransformations() const;
+	/// Obtient l'indice de la transformation du noeud dans son stockage.
+	inline utilitaire::StockageTransformations::Indice obtenirIndiceTransformation() const;
+
+	/// Obtient la poigne du noeud dans son arbre de rendu.
+	inline utilitaire::Poignee obtenirPoignee() const;
+	/// Assigne la poigne du noeud (rserv  l'arbre de rendu).
+	inline void assignerPoignee(utilitaire::Poignee poignee);
+
 	/// Obtient le type du noeud.
 	inline const std::string& obtenirType() const;
+	/// Obtient l'identifiant du type du noeud.
+	inline RegistreTypes::Identifiant obtenirIdentifiantType() const;
 
 	/// crit l'tat de l'affichage du du noeud.
 	inline void assignerAffiche(bool affiche);
@@ -84,8 +138,8 @@ public:
 	/// Vrifie si le noeud est enregistrable.
 	inline bool estEnregistrable() const;
 
-	/// Assigne le modle3D et la liste d'affichage du noeud courant
-	inline void assignerObjetRendu(modele::Modele3D const* modele, modele::opengl_storage::OpenGL_Liste const* liste);
+	/// Assigne le modle3D, la liste d'affichage et le rayon englobant du noeud courant
+	inline void assignerObjetRendu(modele::Modele3D const* modele, modele::opengl_storage::OpenGL_Liste const* liste, double rayonEnglobant);
 
 	// Interface d'un noeud
 
@@ -110,6 +164,15 @@ public:
 	virtual bool ajouter(NoeudAbstrait* enfant);
 	/// Obtient le nombre d'enfants du noeud.
 	virtual unsigned int obtenirNombreEnfants() const;
+	/// Obtient le nombre total de descendants du noeud.
+	virtual unsigned int obtenirNombreDescendants() const;
+
+	/// Signale qu'un noeud (et ses descendants) a t ajout sous ce noeud.
+	virtual void signalerAjout(NoeudAbstrait* noeud);
+	/// Signale que des noeuds (et leurs descendants) ont t retirs de sous ce noeud.
+	virtual void signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds);
+	/// Signale que l'tat de slection d'un noeud de ce sous-arbre a chang.
+	virtual void signalerSelection(NoeudAbstrait* noeud);
 
 	/// Changer la slection du noeud.
 	virtual void inverserSelection();
@@ -126,23 +189,56 @@ public:
 	virtual void changerModePolygones(bool estForce);
 	/// Assigne le mode d'affichage des polygones.
 	virtual void assignerModePolygones(GLenum modePolygones);
-	/// Affiche le noeud.
-	virtual void afficher() const;
+	/// Affiche le noeud et ses descendants dans une matrice de vue donne.
+	void afficher(const glm::dmat4& matriceVue) const;
+	/// Affiche le noeud seulement, sans ses descendants.
+	void afficherNoeud(const glm::dmat4& matriceVue) const;
 	/// Affiche le noeud de manire concrte.
 	virtual void afficherConcret() const;
-	/// Anime le noeud.
+	/// Anime le noeud et ses descendants.
 	virtual void animer(float dt);
+	/// Anime le noeud seulement.
+	virtual void animerConcret(float dt);
 
 protected:
-	/// Type du noeud.
-	std::string      type_;
+	/// Identifiant du type du noeud.
+	RegistreTypes::Identifiant type_;
 
 	/// Mode d'affichage des polygones.
 	GLenum           modePolygones_{ GL_FILL };
 
-	/// Position relative du noeud.
+	/// Position relative du noeud, lorsqu'il n'utilise pas de stockage
+	/// contigu.
 	glm::dvec3         positionRelative_;
 
+	/// Stockage contigu de la transformation du noeud, s'il y a lieu.
+	utilitaire::StockageTransformations* stockageTransformations_{ nullptr };
+	/// Indice de la transformation du noeud dans son stockage.
+	utilitaire::StockageTransformations::Indice indiceTransformation_{ 0 };
+
+	/// Poigne du noeud dans son arbre de rendu, nulle hors d'un arbre.
+	utilitaire::Poignee poignee_;
+
+	/// Matrice de transformation du noeud vers le repre de la racine,
+	/// calcule au besoin.
+	mutable glm::dmat4 matriceMonde_;
+	/// Vrai si la matrice monde doit tre recalcule.  Si un noeud est
+	/// invalide, tous ses descendants le sont aussi.
+	mutable bool     matriceMondeInvalide_{ true };
+	/// Version du stockage contigu lors du calcul de la matrice monde.  La
+	/// matrice est aussi  recalculer si le stockage a chang depuis.
+	mutable utilitaire::StockageTransformations::Version versionMatriceMonde_{ 0 };
+
+	/// Rayon de la sphre englobant le modle du noeud en coordonnes
+	/// locales, ngatif si le noeud n'a rien  afficher.
+	double           rayonEnglobant_{ -1.0 };
+	/// Centre de la sphre englobant le noeud et ses descendants, dans le
+	/// repre de la racine.
+	mutable glm::dvec3 centreVolumeEnglobant_;
+	/// Rayon de la sphre englobant le noeud et ses descendants, ngatif si
+	/// le sous-arbre n'a rien  afficher.
+	mutable double   rayonVolumeEnglobant_{ -1.0 };
+
 	/// Vrai si on doit afficher le noeud.
 	bool             affiche_{ true };
 
@@ -162,11 +258,39 @@ protected:
 	modele::Modele3D const* modele_;
 	/// Storage pour le dessin du modle
 	modele::opengl_storage::OpenGL_Liste const* liste_;
+
+private:
+	/// Vrifie si la matrice monde est  jour.
+	inline bool estMatriceMondeAJour() const;
+	/// Recalcule la matrice monde  partir de celle du parent.
+	void calculerMatriceMonde() const;
+
+	/// Taille de l'entte place avant chaque noeud allou, qui indique le
+	/// pool d'origine du noeud.  Elle prserve l'alignement du noeud.
+	static const std::size_t TAILLE_ENTETE{ 16 };
 };
 
 
 
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline std::size_t NoeudAbstrait::calculerTailleAllocation(std::size_t tailleNoeud)
+///
+/// Cette fonction retourne la taille des blocs qu'un pool doit offrir
+/// pour pouvoir contenir un noeud d'une taille donne, entte compris.
+///
+/// @param[in] tailleNoeud : La taille du type de noeud (sizeof).
+///
+/// @return La taille des blocs ncessaire.
+///
+////////////////////////////////////////////////////////////////////////
+inline std::size_t NoeudAbstrait::calculerTailleAllocation(std::size_t tailleNoeud)
+{
+	return tailleNoeud + TAILLE_ENTETE;
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///
 /// @fn inline NoeudAbstrait* NoeudAbstrait::obtenirParent()
@@ -202,7 +326,8 @@ inline const NoeudAbstrait* NoeudAbstrait::obtenirParent() const
 /// @fn inline void NoeudAbstrait::assignerParent( NoeudAbstrait* parent )
 ///
 /// Cette fonction assigne le parent du noeud afin qu'il soit possible
-/// de remonter dans l'arbre.
+/// de remonter dans l'arbre.  La matrice monde du noeud dpendant de
+/// son parent, elle est invalide.
 ///
 /// @param[in] parent : Le parent du noeud.
 ///
@@ -214,6 +339,29 @@ inline void NoeudAbstrait::assignerParent(
 	)
 {
 	parent_ = parent;
+	invaliderMatriceMonde();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline bool NoeudAbstrait::estMatriceMondeAJour() const
+///
+/// Cette fonction vrifie si la matrice monde du noeud est  jour: elle
+/// ne doit pas avoir t invalide, et les positions de son stockage
+/// contigu, s'il y a lieu, ne doivent pas avoir t modifies en masse
+/// depuis son calcul.  Comme tous les noeuds d'un arbre partagent le
+/// mme stockage, une modification en masse rend ainsi primes toutes
+/// leurs matrices, sans qu'il soit ncessaire de les visiter.
+///
+/// @return Vrai si la matrice monde est  jour.
+///
+////////////////////////////////////////////////////////////////////////
+inline bool NoeudAbstrait::estMatriceMondeAJour() const
+{
+	return !matriceMondeInvalide_ &&
+		(stockageTransformations_ == nullptr ||
+		versionMatriceMonde_ == stockageTransformations_->obtenirVersion());
 }
 
 
@@ -222,13 +370,16 @@ inline void NoeudAbstrait::assignerParent(
 /// @fn inline const glm::dvec3& NoeudAbstrait::obtenirPositionRelative() const
 ///
 /// Cette fonction retourne la position relative du noeud par rapport
-///  son parent.
+///  son parent.  Elle est lue dans le stockage contigu si le noeud en
+/// utilise un.
 ///
 /// @return La position relative.
 ///
 ////////////////////////////////////////////////////////////////////////
 inline const glm::dvec3& NoeudAbstrait::obtenirPositionRelative() const
 {
+	if (stockageTransformations_ != nullptr)
+		return stockageTransformations_->obtenirPosition(indiceTransformation_);
 	return positionRelative_;
 }
 
@@ -238,7 +389,9 @@ inline const glm::dvec3& NoeudAbstrait::obtenirPositionRelative() const
 /// @fn inline void NoeudAbstrait::assignerPositionRelative( const glm::dvec3& positionRelative )
 ///
 /// Cette fonction permet d'assigner la position relative du noeud par
-/// rapport  son parent.
+/// rapport  son parent.  Elle est crite dans le stockage contigu si le
+/// noeud en utilise un.  Les matrices monde du noeud et de ses
+/// descendants sont invalides.
 ///
 /// @param positionRelative : La position relative.
 ///
@@ -249,7 +402,82 @@ inline void NoeudAbstrait::assignerPositionRelative(
 	const glm::dvec3& positionRelative
 	)
 {
-	positionRelative_ = positionRelative;
+	if (stockageTransformations_ != nullptr)
+		stockageTransformations_->assignerPosition(indiceTransformation_, positionRelative);
+	else
+		positionRelative_ = positionRelative;
+
+	invaliderMatriceMonde();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const utilitaire::StockageTransformations* NoeudAbstrait::obtenirStockageTransformations() const
+///
+/// Cette fonction retourne le stockage contigu dans lequel se trouve la
+/// transformation du noeud.
+///
+/// @return Le stockage, ou nullptr si le noeud conserve lui-mme sa
+///         transformation.
+///
+////////////////////////////////////////////////////////////////////////
+inline const utilitaire::StockageTransformations* NoeudAbstrait::obtenirStockageTransformations() const
+{
+	return stockageTransformations_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline utilitaire::StockageTransformations::Indice NoeudAbstrait::obtenirIndiceTransformation() const
+///
+/// Cette fonction retourne l'indice de la transformation du noeud dans
+/// son stockage contigu.  Elle n'a de sens que si le noeud utilise un
+/// tel stockage.
+///
+/// @return L'indice de la transformation.
+///
+////////////////////////////////////////////////////////////////////////
+inline utilitaire::StockageTransformations::Indice NoeudAbstrait::obtenirIndiceTransformation() const
+{
+	return indiceTransformation_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline utilitaire::Poignee NoeudAbstrait::obtenirPoignee() const
+///
+/// Cette fonction retourne la poigne qui dsigne le noeud dans l'arbre
+/// de rendu qui le contient.  Contrairement  un pointeur, une poigne
+/// conserve aprs la destruction du noeud est dtecte comme prime
+/// par ArbreRendu::obtenirNoeud().
+///
+/// @return La poigne du noeud, nulle s'il n'est pas dans un arbre.
+///
+////////////////////////////////////////////////////////////////////////
+inline utilitaire::Poignee NoeudAbstrait::obtenirPoignee() const
+{
+	return poignee_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline void NoeudAbstrait::assignerPoignee(utilitaire::Poignee poignee)
+///
+/// Cette fonction assigne la poigne du noeud.  Elle est appele par
+/// l'arbre de rendu lors de l'ajout et du retrait du noeud.
+///
+/// @param[in] poignee : La nouvelle poigne.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+inline void NoeudAbstrait::assignerPoignee(utilitaire::Poignee poignee)
+{
+	poignee_ = poignee;
 }
 
 
@@ -263,6 +491,23 @@ inline void NoeudAbstrait::assignerPositionRelative(
 ///
 ////////////////////////////////////////////////////////////////////////
 inline const std::string& NoeudAbstrait::obtenirType() const
+{
+	return RegistreTypes::obtenirNom(type_);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline RegistreTypes::Identifiant NoeudAbstrait::obtenirIdentifiantType() const
+///
+/// Cette fonction retourne l'identifiant du type du noeud dans le
+/// registre des types.  Les comparaisons de types devraient se faire sur
+/// cet identifiant plutt que sur le nom.
+///
+/// @return L'identifiant du type du noeud.
+///
+////////////////////////////////////////////////////////////////////////
+inline RegistreTypes::Identifiant NoeudAbstrait::obtenirIdentifiantType() const
 {
 	return type_;
 }
@@ -307,6 +552,7 @@ inline bool NoeudAbstrait::estAffiche() const
 /// @fn inline void NoeudAbstrait::assignerSelection( bool selectionne )
 ///
 /// Cette fonction permet d'assigner l'tat d'tre slectionn ou non du noeud.
+/// Un changement d'tat est signal aux anctres.
 ///
 /// @param selectionne : L'tat slectionn ou non.
 ///
@@ -316,7 +562,11 @@ inline bool NoeudAbstrait::estAffiche() const
 inline void NoeudAbstrait::assignerSelection(bool selectionne)
 {
 	// Un objet non slectionnable n'est jamais slectionn.
-	selectionne_ = (selectionne && selectionnable_);
+	selectionne = (selectionne && selectionnable_);
+	if (selectionne != selectionne_) {
+		selectionne_ = selectionne;
+		signalerSelection(this);
+	}
 }
 
 
@@ -350,7 +600,8 @@ inline bool NoeudAbstrait::estSelectionne() const
 inline void NoeudAbstrait::assignerEstSelectionnable(bool selectionnable)
 {
 	selectionnable_ = selectionnable;
-	selectionne_ = selectionne_ && selectionnable_;
+	if (!selectionnable_)
+		assignerSelection(false);
 }
 
 
@@ -403,19 +654,55 @@ inline bool NoeudAbstrait::estEnregistrable() const
 
 ////////////////////////////////////////////////////////////////////////
 ///
-/// @fn inline void NoeudAbstrait::assignerObjetRendu(modele::Modele3D* modele, modele::opengl_storage::OpenGL_Liste* liste)
+/// @fn inline void NoeudAbstrait::assignerObjetRendu(modele::Modele3D* modele, modele::opengl_storage::OpenGL_Liste* liste, double rayonEnglobant)
 ///
 /// Cette fonction assigne l'objet de rendu au modle, c'est--dire son
-/// modle 3D et sa liste d'affichage
+/// modle 3D et sa liste d'affichage, de mme que le rayon de la sphre
+/// englobant le modle, calcul une seule fois par l'usine.
 ///
 /// @param modele : le modle 3D
 /// @param liste : la liste d'affichage OpenGL
+/// @param rayonEnglobant : le rayon de la sphre englobante du modle
 ///
 ////////////////////////////////////////////////////////////////////////
-inline void NoeudAbstrait::assignerObjetRendu(modele::Modele3D const* modele, modele::opengl_storage::OpenGL_Liste const* liste)
+inline void NoeudAbstrait::assignerObjetRendu(modele::Modele3D const* modele, modele::opengl_storage::OpenGL_Liste const* liste, double rayonEnglobant)
 {
 	modele_ = modele;
 	liste_ = liste;
+	rayonEnglobant_ = rayonEnglobant;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const glm::dvec3& NoeudAbstrait::obtenirCentreVolumeEnglobant() const
+///
+/// Cette fonction retourne le centre de la sphre englobant le noeud et
+/// ses descendants, telle que calcule par calculerVolumeEnglobant().
+///
+/// @return Le centre de la sphre, dans le repre de la racine.
+///
+////////////////////////////////////////////////////////////////////////
+inline const glm::dvec3& NoeudAbstrait::obtenirCentreVolumeEnglobant() const
+{
+	return centreVolumeEnglobant_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline double NoeudAbstrait::obtenirRayonVolumeEnglobant() const
+///
+/// Cette fonction retourne le rayon de la sphre englobant le noeud et
+/// ses descendants, telle que calcule par calculerVolumeEnglobant().
+///
+/// @return Le rayon de la sphre, ngatif si le sous-arbre n'a rien 
+///         afficher.
+///
+////////////////////////////////////////////////////////////////////////
+inline double NoeudAbstrait::obtenirRayonVolumeEnglobant() const
+{
+	return rayonVolumeEnglobant_;
 }
 #endif // __ARBRE_NOEUDS_NOEUDABSTRAIT_H__
 
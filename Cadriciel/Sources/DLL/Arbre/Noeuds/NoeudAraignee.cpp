@@ -60,9 +60,6 @@ NoeudAraignee::~NoeudAraignee()
 ////////////////////////////////////////////////////////////////////////
 void NoeudAraignee::afficherConcret() const
 {
-	// Appel  la version de la classe de base pour l'affichage des enfants.
-	NoeudComposite::afficherConcret();
-
 	// Sauvegarde de la matrice.
 	glPushMatrix();
 	// Rvolution autour du centre.
@@ -76,7 +73,7 @@ void NoeudAraignee::afficherConcret() const
 
 ////////////////////////////////////////////////////////////////////////
 ///
-/// @fn void NoeudCube::animer(float temps)
+/// @fn void NoeudAraignee::animerConcret(float temps)
 ///
 /// Cette fonction effectue l'animation du noeud pour un certain
 /// intervalle de temps.
@@ -86,15 +83,14 @@ void NoeudAraignee::afficherConcret() const
 /// @return Aucune.
 ///
 ////////////////////////////////////////////////////////////////////////
-void NoeudAraignee::animer(float temps)
+void NoeudAraignee::animerConcret(float temps)
 {
-	// Appel  la version de la classe de base pour l'animation des enfants.
-	NoeudComposite::animer(temps);
-
 	// L'araigne oscille selon une priode de 4 secondes.
 	angle_ = fmod(angle_ + temps / 4.0f * 360.0f, 360.0f);
-	positionRelative_[0] = 5 * cos(utilitaire::DEG_TO_RAD(angle_));
-	positionRelative_[1] = 40 * sin(utilitaire::DEG_TO_RAD(angle_));
+	glm::dvec3 position{ obtenirPositionRelative() };
+	position[0] = 5 * cos(utilitaire::DEG_TO_RAD(angle_));
+	position[1] = 40 * sin(utilitaire::DEG_TO_RAD(angle_));
+	assignerPositionRelative(position);
 }
 
 
@@ -33,7 +33,7 @@ public:
    /// Affiche le cube.
    virtual void afficherConcret() const;
    /// Effectue l'animation du cube.
-   virtual void animer( float temps );
+   virtual void animerConcret( float temps );
 
 
 private:
@@ -8,10 +8,152 @@
 ////////////////////////////////////////////////
 
 #include "NoeudComposite.h"
+#include "ParcoursArbre.h"
+#include "OrdonnanceurTaches.h"
 
 #include <cassert>
 
 
+/// Nombre de noeuds d'un sous-arbre  partir duquel ses enfants sont
+/// anims en parallle.
+unsigned int NoeudComposite::seuilAnimationParallele_{ 256 };
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VisiteurProfondeur
+/// @brief Visiteur qui mesure la profondeur maximale d'un sous-arbre.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class VisiteurProfondeur : public VisiteurNoeud<const NoeudAbstrait>
+{
+public:
+	/// Descend d'un niveau.
+	ParcoursArbre::Decision visiterAvant(const NoeudAbstrait*)
+	{
+		if (++profondeur_ > profondeurMaximale_)
+			profondeurMaximale_ = profondeur_;
+		return ParcoursArbre::CONTINUER;
+	}
+	/// Remonte d'un niveau.
+	ParcoursArbre::Decision visiterApres(const NoeudAbstrait*)
+	{
+		--profondeur_;
+		return ParcoursArbre::CONTINUER;
+	}
+	/// Obtient la profondeur maximale atteinte.
+	unsigned int obtenirProfondeurMaximale() const { return profondeurMaximale_; }
+
+private:
+	/// Profondeur du noeud courant.
+	unsigned int profondeur_{ 0 };
+	/// Profondeur maximale atteinte.
+	unsigned int profondeurMaximale_{ 0 };
+};
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VisiteurModePolygones
+/// @brief Visiteur qui change le mode d'affichage des polygones des
+///        noeuds, en forant le changement sous les noeuds slectionns.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class VisiteurModePolygones : public VisiteurNoeud<NoeudAbstrait>
+{
+public:
+	/// Constructeur  partir du forage demand pour la racine.
+	VisiteurModePolygones(bool estForce) : forces_( 1, estForce ) {}
+
+	/// Change le mode du noeud et retient le forage pour ses enfants.
+	ParcoursArbre::Decision visiterAvant(NoeudAbstrait* noeud)
+	{
+		const bool estForce{ forces_.back() };
+		noeud->NoeudAbstrait::changerModePolygones(estForce);
+		forces_.push_back(estForce || noeud->estSelectionne());
+		return ParcoursArbre::CONTINUER;
+	}
+	/// Oublie le forage des enfants du noeud.
+	ParcoursArbre::Decision visiterApres(NoeudAbstrait*)
+	{
+		forces_.pop_back();
+		return ParcoursArbre::CONTINUER;
+	}
+
+private:
+	/// Forage  appliquer aux enfants de chaque noeud en cours de visite.
+	std::vector<bool> forces_;
+};
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VisiteurAnimation
+/// @brief Visiteur qui anime les noeuds d'un sous-arbre, les enfants
+///        avant leur parent.
+///
+///        Les enfants d'un noeud dont le sous-arbre atteint le seuil
+///        d'animation parallle sont regroups en lots d'au moins ce
+///        nombre de noeuds, chacun anim par une tche.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class VisiteurAnimation : public VisiteurNoeud<NoeudAbstrait>
+{
+public:
+	/// Constructeur  partir de l'intervalle de temps.
+	VisiteurAnimation(float dt) :
+		dt_{ dt },
+		ordonnanceur_{ utilitaire::OrdonnanceurTaches::obtenirInstance() }
+	{}
+
+	/// Anime en parallle les enfants d'un grand sous-arbre.
+	ParcoursArbre::Decision visiterAvant(NoeudAbstrait* noeud)
+	{
+		const unsigned int seuil{ NoeudComposite::obtenirSeuilAnimationParallele() };
+		const unsigned int nombreEnfants{ noeud->obtenirNombreEnfants() };
+		if (noeud->obtenirNombreDescendants() < seuil || nombreEnfants < 2 ||
+			ordonnanceur_->obtenirNombreFils() < 2)
+			return ParcoursArbre::CONTINUER;
+
+		utilitaire::GroupeTaches groupe;
+		const float dt{ dt_ };
+		unsigned int debut{ 0 };
+		unsigned int tailleLot{ 0 };
+		for (unsigned int i{ 0 }; i < nombreEnfants; ++i) {
+			tailleLot += 1 + noeud->chercher(i)->obtenirNombreDescendants();
+			if ((tailleLot >= seuil && i + 1 < nombreEnfants) || i + 1 == nombreEnfants) {
+				const unsigned int fin{ i + 1 };
+				ordonnanceur_->lancer(groupe, [noeud, debut, fin, dt] {
+					for (unsigned int j{ debut }; j < fin; ++j)
+						noeud->chercher(j)->animer(dt);
+				});
+				debut = fin;
+				tailleLot = 0;
+			}
+		}
+
+		// Le fil courant excute des tches en attendant la fin du groupe.
+		ordonnanceur_->attendre(groupe);
+		return ParcoursArbre::IGNORER_ENFANTS;
+	}
+	/// Anime le noeud, une fois ses enfants anims.
+	ParcoursArbre::Decision visiterApres(NoeudAbstrait* noeud)
+	{
+		noeud->animerConcret(dt_);
+		return ParcoursArbre::CONTINUER;
+	}
+
+private:
+	/// Intervalle de temps sur lequel faire l'animation.
+	float dt_;
+	/// Ordonnanceur des tches d'animation.
+	utilitaire::OrdonnanceurTaches* ordonnanceur_;
+};
+
+
 ////////////////////////////////////////////////////////////////////////
 ///
 /// @fn NoeudComposite::NoeudComposite(const std::string& type)
@@ -54,23 +196,18 @@ NoeudComposite::~NoeudComposite()
 /// courant ainsi que tous ses enfants.
 ///
 /// Cette fonction retourne toujours 1 de plus que la profondeur de son
-/// enfants le plus profond.
+/// enfants le plus profond.  L'arbre est parcouru sans rcursion, peu
+/// importe sa profondeur.
 ///
 /// @return La profondeur de l'arbre sous ce noeud.
 ///
 ////////////////////////////////////////////////////////////////////////
 unsigned int NoeudComposite::calculerProfondeur() const
 {
-	unsigned int profondeurEnfantMax{ 0 };
+	VisiteurProfondeur visiteur;
+	ParcoursArbre::parcourir<const NoeudAbstrait>(this, visiteur);
 
-	for (NoeudAbstrait const* enfant : enfants_)
-	{
-		const unsigned int profondeurEnfant{ enfant->calculerProfondeur() };
-		if (profondeurEnfantMax < profondeurEnfant)
-			profondeurEnfantMax = profondeurEnfant;
-	}
-
-	return profondeurEnfantMax + 1;
+	return visiteur.obtenirProfondeurMaximale();
 }
 
 
@@ -78,26 +215,73 @@ unsigned int NoeudComposite::calculerProfondeur() const
 ///
 /// @fn void NoeudComposite::vider()
 ///
-/// Cette fonction vide le noeud de tous ses enfants.  Elle effectue une
-/// itration prudente sur les enfants afin d'tre assez robuste pour
-/// supporter la possibilit qu'un enfant en efface un autre dans son
-/// destructeur, par exemple si deux objets ne peuvent pas exister l'un
-/// sans l'autre.  Elle peut toutefois entrer en boucle infinie si un
-/// enfant ajoute un nouveau noeud lorsqu'il se fait effacer.
+/// Cette fonction vide le noeud de tous ses enfants.  Tous les enfants
+/// sont retirs du conteneur en une seule opration, puis dtruits en
+/// lot.  Elle reste assez robuste pour supporter la possibilit qu'un
+/// enfant en efface un autre dans son destructeur, par exemple si deux
+/// objets ne peuvent pas exister l'un sans l'autre, puisque le conteneur
+/// est dj vide au moment des destructions.  Elle peut toutefois entrer
+/// en boucle infinie si un enfant ajoute un nouveau noeud lorsqu'il se
+/// fait effacer.
 ///
 /// @return Aucune.
 ///
 ////////////////////////////////////////////////////////////////////////
 void NoeudComposite::vider()
 {
-	// L'itration doit tre faite ainsi pour viter les problmes lorsque
-	// le desctructeur d'un noeud modifie l'arbre, par exemple en retirant
-	// d'autres noeuds.  Il pourrait y avoir une boucle infinie si la
-	// desctruction d'un enfant entranerait l'ajout d'un autre.
+	// On recommence tant que des destructeurs ajoutent de nouveaux enfants.
+	// Il pourrait y avoir une boucle infinie si la desctruction d'un enfant
+	// entranait systmatiquement l'ajout d'un autre.
 	while (!enfants_.empty()) {
-		NoeudAbstrait* enfantAEffacer{ enfants_.front() };
-		enfants_.erase(enfants_.begin());
-		delete enfantAEffacer;
+		conteneur_enfants enfantsAEffacer;
+		enfantsAEffacer.swap(enfants_);
+		detruireEnfants(enfantsAEffacer);
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudComposite::detruireEnfants( const conteneur_enfants& enfants )
+///
+/// Dtruit des enfants qui viennent d'tre retirs du conteneur des
+/// enfants.  Les anctres sont d'abord avertis, en un seul signal, du
+/// retrait des sous-arbres complets.  Tous les noeuds de ces sous-arbres
+/// sont ensuite dtachs de leur parent et retirs des conteneurs, puis
+/// dtruits un  un.  Aucune destruction ne dclenche donc celle de ses
+/// enfants, et la profondeur des sous-arbres n'est pas limite par la
+/// pile d'excution.
+///
+/// @param[in] enfants : Les enfants  dtruire.
+///
+/// @return Aucune
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudComposite::detruireEnfants(const conteneur_enfants& enfants)
+{
+	if (enfants.empty())
+		return;
+
+	signalerRetrait(enfants);
+
+	// On aplatit les sous-arbres: les enfants de chaque composite sont
+	// ajouts  la liste des noeuds  dtruire, puis retirs de celui-ci.
+	conteneur_enfants noeuds{ enfants };
+	for (conteneur_enfants::size_type i{ 0 }; i < noeuds.size(); ++i) {
+		NoeudComposite* composite{ dynamic_cast<NoeudComposite*>(noeuds[i]) };
+		if (composite != nullptr && !composite->enfants_.empty()) {
+			conteneur_enfants petitsEnfants;
+			petitsEnfants.swap(composite->enfants_);
+			composite->nombreDescendants_ = 0;
+			noeuds.insert(noeuds.end(), petitsEnfants.begin(), petitsEnfants.end());
+		}
+	}
+
+	for (NoeudAbstrait * noeud : noeuds) {
+		noeud->assignerParent(nullptr);
+	}
+	for (NoeudAbstrait * noeud : noeuds) {
+		delete noeud;
 	}
 }
 
@@ -121,9 +305,9 @@ void NoeudComposite::effacer(const NoeudAbstrait* noeud)
 		it++) {
 		if (*it == noeud) {
 			// On a trouv le noeud  effacer
-			NoeudAbstrait* noeudAEffacer{ (*it) };
+			const conteneur_enfants noeudAEffacer{ *it };
 			enfants_.erase(it);
-			delete noeudAEffacer;
+			detruireEnfants(noeudAEffacer);
 			return;
 		}
 		else {
@@ -139,7 +323,7 @@ void NoeudComposite::effacer(const NoeudAbstrait* noeud)
 /// @fn const NoeudAbstrait* NoeudComposite::chercher( const std::string& typeNoeud ) const
 ///
 /// Recherche un noeud d'un type donn parmi le noeud courant et ses
-/// enfants.  Version constante de la fonction.
+/// descendants, en ordre prfixe.  Version constante de la fonction.
 ///
 /// @param[in] typeNoeud : Le type du noeud cherch.
 ///
@@ -150,20 +334,20 @@ const NoeudAbstrait* NoeudComposite::chercher(
 	const std::string& typeNoeud
 	) const
 {
-	if (typeNoeud == type_) {
-		return this;
-	}
-	else {
-		for (NoeudAbstrait const* enfant : enfants_)
-		{
-			NoeudAbstrait const* noeud{ enfant->chercher(typeNoeud) };
-			if (noeud != nullptr) {
-				return noeud;
-			}
-		}
-	}
+	// Un type qui n'a jamais t enregistr ne peut tre celui d'un noeud.
+	const RegistreTypes::Identifiant type{ RegistreTypes::obtenirIdentifiant(typeNoeud) };
+	if (type == RegistreTypes::INCONNU)
+		return nullptr;
+
+	const NoeudAbstrait* trouve{ nullptr };
+	ParcoursArbre::parcourirPrefixe<const NoeudAbstrait>(this, [&](const NoeudAbstrait* noeud) -> ParcoursArbre::Decision {
+		if (noeud->obtenirIdentifiantType() != type)
+			return ParcoursArbre::CONTINUER;
+		trouve = noeud;
+		return ParcoursArbre::ARRETER;
+	});
 
-	return nullptr;
+	return trouve;
 }
 
 
@@ -172,7 +356,7 @@ const NoeudAbstrait* NoeudComposite::chercher(
 /// @fn NoeudAbstrait* NoeudComposite::chercher( const std::string& typeNoeud )
 ///
 /// Recherche un noeud d'un type donn parmi le noeud courant et ses
-/// enfants.
+/// descendants, en ordre prfixe.
 ///
 /// @param[in] typeNoeud : Le type du noeud cherch.
 ///
@@ -181,20 +365,19 @@ const NoeudAbstrait* NoeudComposite::chercher(
 ////////////////////////////////////////////////////////////////////////
 NoeudAbstrait* NoeudComposite::chercher(const std::string& typeNoeud)
 {
-	if (typeNoeud == type_) {
-		return this;
-	}
-	else {
-		for (NoeudAbstrait * enfant : enfants_)
-		{
-			NoeudAbstrait * noeud{ enfant->chercher(typeNoeud) };
-			if (noeud != nullptr) {
-				return noeud;
-			}
-		}
-	}
+	const RegistreTypes::Identifiant type{ RegistreTypes::obtenirIdentifiant(typeNoeud) };
+	if (type == RegistreTypes::INCONNU)
+		return nullptr;
+
+	NoeudAbstrait* trouve{ nullptr };
+	ParcoursArbre::parcourirPrefixe<NoeudAbstrait>(this, [&](NoeudAbstrait* noeud) -> ParcoursArbre::Decision {
+		if (noeud->obtenirIdentifiantType() != type)
+			return ParcoursArbre::CONTINUER;
+		trouve = noeud;
+		return ParcoursArbre::ARRETER;
+	});
 
-	return nullptr;
+	return trouve;
 }
 
 
@@ -259,6 +442,9 @@ bool NoeudComposite::ajouter(NoeudAbstrait* enfant)
 	enfant->assignerParent(this);
 	enfants_.push_back(enfant);
 
+	// On avertit les anctres (et ultimement la racine) de l'ajout.
+	signalerAjout(enfant);
+
 	return true;
 }
 
@@ -284,6 +470,62 @@ unsigned int NoeudComposite::obtenirNombreEnfants() const
 }
 
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn unsigned int NoeudComposite::obtenirNombreDescendants() const
+///
+/// Retourne le nombre total de descendants de ce noeud.  Ce nombre est
+/// tenu  jour lors des ajouts et des retraits, et est donc obtenu en
+/// temps constant.
+///
+/// @return Le nombre de descendants.
+///
+////////////////////////////////////////////////////////////////////////
+unsigned int NoeudComposite::obtenirNombreDescendants() const
+{
+	return nombreDescendants_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudComposite::signalerAjout( NoeudAbstrait* noeud )
+///
+/// Ajoute au nombre de descendants le noeud ajout sous ce noeud et ses
+/// propres descendants, puis relaie le signal au parent.
+///
+/// @param[in] noeud : Le noeud ajout.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudComposite::signalerAjout(NoeudAbstrait* noeud)
+{
+	nombreDescendants_ += 1 + noeud->obtenirNombreDescendants();
+	NoeudAbstrait::signalerAjout(noeud);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudComposite::signalerRetrait( const std::vector<NoeudAbstrait*>& noeuds )
+///
+/// Retire du nombre de descendants les noeuds retirs de sous ce noeud et
+/// leurs propres descendants, puis relaie le signal au parent.
+///
+/// @param[in] noeuds : Les noeuds retirs.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudComposite::signalerRetrait(const std::vector<NoeudAbstrait*>& noeuds)
+{
+	for (NoeudAbstrait const* noeud : noeuds)
+		nombreDescendants_ -= 1 + noeud->obtenirNombreDescendants();
+	NoeudAbstrait::signalerRetrait(noeuds);
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///
 /// @fn void NoeudComposite::effacerSelection()
@@ -292,6 +534,12 @@ unsigned int NoeudComposite::obtenirNombreEnfants() const
 /// s'appelle donc rcursivement sur tous les enfants, avant de retirer
 /// les enfants slectionns.
 ///
+/// Les enfants conservs sont compacts en une seule passe, dans leur
+/// ordre d'origine, et les enfants slectionns sont dtruits en lot
+/// seulement une fois le conteneur remis dans un tat cohrent.  Le cot
+/// est donc linaire en nombre d'enfants, peu importe le nombre
+/// d'enfants effacs.
+///
 /// @return Aucune
 ///
 ////////////////////////////////////////////////////////////////////////
@@ -302,29 +550,22 @@ void NoeudComposite::effacerSelection()
 		enfant->effacerSelection();
 	}
 
-	// On efface les enfants slectionns.  On effectue ce traitement
-	// dans une seconde boucle pour viter de faire des assomptions
-	// sur la robustesse des itrateurs lorsque le conteneur est
-	// modifi pendant une itration.
-	for (conteneur_enfants::iterator it{ enfants_.begin() };
-		it != enfants_.end();
-		) {
-		if ((*it)->estSelectionne()) {
-			NoeudAbstrait* enfant{ (*it) };
-			enfants_.erase(it);
-			delete enfant;
-
-			// On ramne l'itration au dbut de la boucle, car le destructeur
-			// de l'enfant pourrait ventuellement avoir retir d'autres
-			// enfants de l'arbre, ce qui briserait l'itration.  Pourrait
-			// ventuellement tre vit avec des itrateurs plus robustes.
-			// Peut-tre une liste chane?
-			it = enfants_.begin();
-		}
-		else {
-			++it;
-		}
+	// On compacte les enfants conservs au dbut du conteneur et on met
+	// de ct les enfants slectionns.
+	conteneur_enfants enfantsAEffacer;
+	conteneur_enfants::iterator fin{ enfants_.begin() };
+	for (NoeudAbstrait * enfant : enfants_) {
+		if (enfant->estSelectionne())
+			enfantsAEffacer.push_back(enfant);
+		else
+			*fin++ = enfant;
 	}
+	enfants_.erase(fin, enfants_.end());
+
+	// La destruction est faite aprs la modification du conteneur, car
+	// le destructeur d'un enfant pourrait retirer d'autres noeuds de
+	// l'arbre, ce qui briserait l'itration.
+	detruireEnfants(enfantsAEffacer);
 }
 
 
@@ -340,11 +581,10 @@ void NoeudComposite::effacerSelection()
 ////////////////////////////////////////////////////////////////////////
 void NoeudComposite::selectionnerTout()
 {
-	NoeudAbstrait::selectionnerTout();
-
-	for (NoeudAbstrait * enfant : enfants_){
-		enfant->selectionnerTout();
-	}
+	ParcoursArbre::parcourirPrefixe<NoeudAbstrait>(this, [](NoeudAbstrait* noeud) {
+		noeud->NoeudAbstrait::selectionnerTout();
+		return ParcoursArbre::CONTINUER;
+	});
 }
 
 
@@ -360,11 +600,10 @@ void NoeudComposite::selectionnerTout()
 ////////////////////////////////////////////////////////////////////////
 void NoeudComposite::deselectionnerTout()
 {
-	selectionne_ = false;
-
-	for (NoeudAbstrait * enfant : enfants_){
-		enfant->deselectionnerTout();
-	}
+	ParcoursArbre::parcourirPrefixe<NoeudAbstrait>(this, [](NoeudAbstrait* noeud) {
+		noeud->NoeudAbstrait::deselectionnerTout();
+		return ParcoursArbre::CONTINUER;
+	});
 }
 
 
@@ -372,24 +611,18 @@ void NoeudComposite::deselectionnerTout()
 ///
 /// @fn bool NoeudComposite::selectionExiste() const
 ///
-/// Vrifie si le noeud ou un de ses descendants est slectionn en
-/// s'appelant de manire rcursive sur les enfants du noeud.
+/// Vrifie si le noeud ou un de ses descendants est slectionn.  Le
+/// parcours s'arrte au premier noeud slectionn trouv.
 ///
 /// @return Vrai s'il existe un noeud slectionn, faux autrement.
 ///
 ////////////////////////////////////////////////////////////////////////
 bool NoeudComposite::selectionExiste() const
 {
-	if (selectionne_) {
-		return true;
-	}
-
-	for (NoeudAbstrait const* enfant : enfants_){
-		if (enfant->selectionExiste())
-			return true;
-	}
-
-	return false;
+	// Le parcours est interrompu seulement si un noeud est slectionn.
+	return !ParcoursArbre::parcourirPrefixe<const NoeudAbstrait>(this, [](const NoeudAbstrait* noeud) {
+		return noeud->estSelectionne() ? ParcoursArbre::ARRETER : ParcoursArbre::CONTINUER;
+	});
 }
 
 
@@ -402,20 +635,16 @@ bool NoeudComposite::selectionExiste() const
 ///
 /// @param[in] estForce : Si vrai, le mode est chang pour ce noeud et
 ///                       tous ses descendants.  Sinon, seuls les noeuds
-///                       slectionns verront leur mode changer.
+///                       slectionns et leurs descendants verront leur
+///                       mode changer.
 ///
 /// @return Aucune
 ///
 ////////////////////////////////////////////////////////////////////////
 void NoeudComposite::changerModePolygones(bool estForce)
 {
-	NoeudAbstrait::changerModePolygones(estForce);
-	const bool forceEnfant = ((estForce) || (estSelectionne()));
-
-	// Applique le changement rcursivement aux enfants.
-	for (NoeudAbstrait * enfant : enfants_){
-		enfant->changerModePolygones(forceEnfant);
-	}
+	VisiteurModePolygones visiteur{ estForce };
+	ParcoursArbre::parcourir<NoeudAbstrait>(this, visiteur);
 }
 
 
@@ -424,43 +653,17 @@ void NoeudComposite::changerModePolygones(bool estForce)
 /// @fn void NoeudComposite::assignerModePolygones( GLenum modePolygones )
 ///
 /// Cette fonction assigne le mode de rendu des polygones du noeud et
-/// de ses enfants.
+/// de ses descendants.
 ///
 /// @return Aucune.
 ///
 ////////////////////////////////////////////////////////////////////////
 void NoeudComposite::assignerModePolygones(GLenum modePolygones)
 {
-	// Appel  la version de la classe de base.
-	NoeudAbstrait::assignerModePolygones(modePolygones);
-
-	// Applique le changement rcursivement aux enfants.
-	for (NoeudAbstrait * enfant : enfants_){
-		enfant->assignerModePolygones(modePolygones);
-	}
-}
-
-
-////////////////////////////////////////////////////////////////////////
-///
-/// @fn void NoeudComposite::afficherConcret() const
-///
-/// Cette fonction effectue le vritable rendu de l'objet.  Elle est
-/// appele par la template method (dans le sens du patron de conception,
-/// et non des template C++) afficher() de la classe de base.
-///
-/// Pour cette classe, elle affiche chacun des enfants du noeud.
-///
-/// @return Aucune.
-///
-////////////////////////////////////////////////////////////////////////
-void NoeudComposite::afficherConcret() const
-{
-	NoeudAbstrait::afficherConcret();
-
-	for (NoeudAbstrait const* enfant : enfants_){
-		enfant->afficher();
-	}
+	ParcoursArbre::parcourirPrefixe<NoeudAbstrait>(this, [modePolygones](NoeudAbstrait* noeud) {
+		noeud->NoeudAbstrait::assignerModePolygones(modePolygones);
+		return ParcoursArbre::CONTINUER;
+	});
 }
 
 
@@ -468,7 +671,14 @@ void NoeudComposite::afficherConcret() const
 ///
 /// @fn void NoeudComposite::animer( float dt )
 ///
-/// Anime tous les enfants de ce noeud.
+/// Anime ce noeud et tous ses descendants, sans rcursion.  Chaque noeud
+/// est anim par animerConcret() aprs ses enfants.
+///
+/// Si le sous-arbre d'un noeud atteint le seuil d'animation parallle,
+/// ses enfants conscutifs sont regroups en lots d'au moins ce nombre
+/// de noeuds, et chaque lot est anim par une tche.  Les implantations
+/// de animerConcret() doivent donc respecter le contrat dcrit dans
+/// NoeudAbstrait::animerConcret().
 ///
 /// @param[in] dt : Intervalle de temps sur lequel faire l'animation.
 ///
@@ -477,9 +687,8 @@ void NoeudComposite::afficherConcret() const
 ////////////////////////////////////////////////////////////////////////
 void NoeudComposite::animer(float dt)
 {
-	for (NoeudAbstrait * enfant : enfants_){
-		enfant->animer(dt);
-	}
+	VisiteurAnimation visiteur{ dt };
+	ParcoursArbre::parcourir<NoeudAbstrait>(this, visiteur);
 }
 
 
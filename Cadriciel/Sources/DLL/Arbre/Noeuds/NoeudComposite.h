@@ -61,6 +61,13 @@ public:
    virtual bool ajouter( NoeudAbstrait* enfant );
    /// Obtient le nombre d'enfants du noeud.
    virtual unsigned int obtenirNombreEnfants() const;
+   /// Obtient le nombre total de descendants du noeud.
+   virtual unsigned int obtenirNombreDescendants() const;
+
+   /// Compte les descendants ajouts, puis relaie le signal au parent.
+   virtual void signalerAjout( NoeudAbstrait* noeud );
+   /// Compte les descendants retirs, puis relaie le signal au parent.
+   virtual void signalerRetrait( const std::vector<NoeudAbstrait*>& noeuds );
 
    // Changer la slection du noeud: on prend la version de la classe de
    // base.
@@ -78,13 +85,17 @@ public:
    virtual void changerModePolygones( bool estForce );
    /// Assigne le mode d'affichage des polygones.
    virtual void assignerModePolygones( GLenum modePolygones );
-   // Affiche le noeud: on prend la version de la classe de base.
-   // virtual void afficher() const;
-   /// Affiche le noeud de manire concrte.
-   virtual void afficherConcret() const;
-   /// Anime le noeud.
+   // Affiche le noeud de manire concrte: on prend la version de la
+   // classe de base.
+   // virtual void afficherConcret() const;
+   /// Anime le noeud et ses descendants.
    virtual void animer( float dt );
 
+   /// Assigne la taille de sous-arbre  partir de laquelle l'animation est parallle.
+   static inline void assignerSeuilAnimationParallele( unsigned int seuil );
+   /// Obtient la taille de sous-arbre  partir de laquelle l'animation est parallle.
+   static inline unsigned int obtenirSeuilAnimationParallele();
+
 
 protected:
    /// Le choix du conteneur pour les enfants.
@@ -92,15 +103,62 @@ protected:
    /// La liste des enfants.
    conteneur_enfants enfants_;
 
+   /// Dtruit des enfants qui viennent d'tre retirs de la liste des enfants.
+   void detruireEnfants( const conteneur_enfants& enfants );
+
+   /// Nombre total de descendants du noeud.
+   unsigned int nombreDescendants_{ 0 };
+
 
 private:
    /// Constructeur copie dclar priv mais non dfini pour viter le
    /// constructeur copie gnr par le compilateur.
    NoeudComposite(const NoeudComposite&);
 
+   /// Nombre de noeuds d'un sous-arbre  partir duquel ses enfants sont
+   /// anims en parallle.
+   static unsigned int seuilAnimationParallele_;
+
 };
 
 
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline void NoeudComposite::assignerSeuilAnimationParallele( unsigned int seuil )
+///
+/// Cette fonction assigne le nombre de noeuds qu'un sous-arbre doit
+/// atteindre pour que ses enfants soient anims en parallle.  C'est
+/// aussi la taille minimale des lots d'enfants confis  une tche.
+///
+/// @param[in] seuil : Le nouveau seuil.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+inline void NoeudComposite::assignerSeuilAnimationParallele( unsigned int seuil )
+{
+   seuilAnimationParallele_ = seuil > 0 ? seuil : 1;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline unsigned int NoeudComposite::obtenirSeuilAnimationParallele()
+///
+/// Cette fonction retourne le nombre de noeuds qu'un sous-arbre doit
+/// atteindre pour que ses enfants soient anims en parallle.
+///
+/// @return Le seuil.
+///
+////////////////////////////////////////////////////////////////////////
+inline unsigned int NoeudComposite::obtenirSeuilAnimationParallele()
+{
+   return seuilAnimationParallele_;
+}
+
+
 #endif // __ARBRE_NOEUDS_NOEUDCOMPOSITE_H__
 
 
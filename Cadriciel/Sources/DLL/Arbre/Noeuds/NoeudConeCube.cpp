@@ -80,7 +80,7 @@ void NoeudConeCube::afficherConcret() const
 
 ////////////////////////////////////////////////////////////////////////
 ///
-/// @fn void NoeudCube::animer(float temps)
+/// @fn void NoeudConeCube::animerConcret(float temps)
 ///
 /// Cette fonction effectue l'animation du noeud pour un certain
 /// intervalle de temps.
@@ -90,7 +90,7 @@ void NoeudConeCube::afficherConcret() const
 /// @return Aucune.
 ///
 ////////////////////////////////////////////////////////////////////////
-void NoeudConeCube::animer(float temps)
+void NoeudConeCube::animerConcret(float temps)
 {
 	// Le cube effectue un tour  toutes les 7 secondes sur l'axe des X.
 	angleX_ = fmod(angleX_ + temps / 7.0f * 360.0f, 360.0f);
@@ -101,6 +101,26 @@ void NoeudConeCube::animer(float temps)
 }
 
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn double NoeudConeCube::obtenirRayonEnglobant() const
+///
+/// Cette fonction retourne le rayon de la sphre englobant le cube dans
+/// toutes les positions de son animation.  Le modle est affich  40
+/// units du centre de rvolution et recentr de 10 units, ce qui
+/// loigne chacun de ses points d'au plus 50 units de sa position de
+/// repos.
+///
+/// @return Le rayon englobant, ngatif si le noeud n'a pas de modle.
+///
+////////////////////////////////////////////////////////////////////////
+double NoeudConeCube::obtenirRayonEnglobant() const
+{
+	const double rayonModele{ NoeudAbstrait::obtenirRayonEnglobant() };
+	return rayonModele < 0.0 ? rayonModele : rayonModele + 40.0 + 10.0;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @}
 ///////////////////////////////////////////////////////////////////////////////
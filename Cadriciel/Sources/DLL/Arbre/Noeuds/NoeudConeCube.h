@@ -33,7 +33,9 @@ public:
    /// Affiche le cube.
    virtual void afficherConcret() const;
    /// Effectue l'animation du cube.
-   virtual void animer( float temps );
+   virtual void animerConcret( float temps );
+   /// Obtient le rayon englobant le cube dans toutes ses positions.
+   virtual double obtenirRayonEnglobant() const;
 
 
 private:
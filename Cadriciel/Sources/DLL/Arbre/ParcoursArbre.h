@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file ParcoursArbre.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __ARBRE_PARCOURSARBRE_H__
+#define __ARBRE_PARCOURSARBRE_H__
+
+
+#include <vector>
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class ParcoursArbre
+/// @brief Moteur de parcours en profondeur des noeuds de l'arbre de
+///        rendu,  l'aide d'une pile explicite plutt que d'appels
+///        rcursifs.
+///
+///        La profondeur de l'arbre parcouru n'est donc pas limite par
+///        la taille de la pile d'excution.  Un visiteur est avis de
+///        chaque noeud avant (prfixe) et aprs (suffixe) la visite de
+///        ses enfants.  Un visiteur est une classe offrant les fonctions
+///        suivantes, o Noeud est le type des noeuds parcourus
+///        (NoeudAbstrait ou const NoeudAbstrait):
+///
+///        - Decision visiterAvant(Noeud* noeud);
+///        - Decision visiterApres(Noeud* noeud);
+///
+///        La classe VisiteurNoeud offre des versions par dfaut de ces
+///        fonctions.  Les enfants sont obtenus par obtenirNombreEnfants()
+///        et chercher(indice); un visiteur ne doit donc pas modifier les
+///        enfants d'un noeud dont la visite suffixe n'a pas eu lieu.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class ParcoursArbre
+{
+public:
+	/// Dcision d'un visiteur quant  la suite du parcours.
+	enum Decision {
+		/// Continuer le parcours normalement.
+		CONTINUER,
+		/// Ne pas visiter les enfants du noeud (visite prfixe seulement).
+		IGNORER_ENFANTS,
+		/// Terminer immdiatement le parcours.
+		ARRETER
+	};
+
+	/// Parcourt un sous-arbre en profondeur avec un visiteur.
+	template <class Noeud, class Visiteur>
+	static bool parcourir(Noeud* racine, Visiteur& visiteur);
+
+	/// Parcourt un sous-arbre en ordre prfixe avec une fonction.
+	template <class Noeud, class Fonction>
+	static bool parcourirPrefixe(Noeud* racine, Fonction fonction);
+
+private:
+	/// Noeud en cours de visite, avec l'indice du prochain enfant  visiter.
+	template <class Noeud>
+	struct Cadre {
+		Noeud* noeud;
+		unsigned int prochainEnfant;
+	};
+
+	/// Adapte une fonction en visiteur prfixe.
+	template <class Noeud, class Fonction>
+	struct VisiteurPrefixe {
+		Fonction& fonction;
+		Decision visiterAvant(Noeud* noeud) { return fonction(noeud); }
+		Decision visiterApres(Noeud*) { return CONTINUER; }
+	};
+};
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VisiteurNoeud
+/// @brief Visiteur par dfaut pour ParcoursArbre, qui continue toujours
+///        le parcours.
+///
+///        Les visiteurs concrets en drivent et masquent les fonctions
+///        dont ils ont besoin.  Les appels sont rsolus  la compilation
+///        et ne sont donc pas virtuels.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+template <class Noeud>
+class VisiteurNoeud
+{
+public:
+	/// Visite d'un noeud avant ses enfants.
+	ParcoursArbre::Decision visiterAvant(Noeud* noeud) { return ParcoursArbre::CONTINUER; }
+	/// Visite d'un noeud aprs ses enfants.
+	ParcoursArbre::Decision visiterApres(Noeud* noeud) { return ParcoursArbre::CONTINUER; }
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn bool ParcoursArbre::parcourir(Noeud* racine, Visiteur& visiteur)
+///
+/// Cette fonction parcourt en profondeur le sous-arbre dont la racine est
+/// passe en paramtre.  Chaque noeud est visit avant ses enfants, puis
+/// aprs ceux-ci.  Si la visite prfixe d'un noeud retourne
+/// IGNORER_ENFANTS, ses enfants sont sauts et sa visite suffixe suit
+/// immdiatement.  Si une visite retourne ARRETER, le parcours s'arrte
+/// sans autre visite.
+///
+/// @param[in] racine   : La racine du sous-arbre  parcourir.
+/// @param[in] visiteur : Le visiteur avis de chaque noeud.
+///
+/// @return Faux si le parcours a t arrt par le visiteur.
+///
+////////////////////////////////////////////////////////////////////////
+template <class Noeud, class Visiteur>
+bool ParcoursArbre::parcourir(Noeud* racine, Visiteur& visiteur)
+{
+	Decision decision{ visiteur.visiterAvant(racine) };
+	if (decision == ARRETER)
+		return false;
+	if (decision == IGNORER_ENFANTS)
+		return visiteur.visiterApres(racine) != ARRETER;
+
+	std::vector< Cadre<Noeud> > pile;
+	pile.push_back(Cadre<Noeud>{ racine, 0 });
+
+	while (!pile.empty()) {
+		Cadre<Noeud>& cadre = pile.back();
+		if (cadre.prochainEnfant < cadre.noeud->obtenirNombreEnfants()) {
+			Noeud* enfant{ cadre.noeud->chercher(cadre.prochainEnfant++) };
+
+			decision = visiteur.visiterAvant(enfant);
+			if (decision == ARRETER)
+				return false;
+			if (decision == CONTINUER)
+				pile.push_back(Cadre<Noeud>{ enfant, 0 });
+			else if (visiteur.visiterApres(enfant) == ARRETER)
+				return false;
+		}
+		else {
+			Noeud* noeud{ cadre.noeud };
+			pile.pop_back();
+			if (visiteur.visiterApres(noeud) == ARRETER)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn bool ParcoursArbre::parcourirPrefixe(Noeud* racine, Fonction fonction)
+///
+/// Cette fonction parcourt en ordre prfixe le sous-arbre dont la racine
+/// est passe en paramtre, en appelant une fonction (par exemple une
+/// lambda) qui reoit chaque noeud et retourne une Decision.
+///
+/// @param[in] racine   : La racine du sous-arbre  parcourir.
+/// @param[in] fonction : La fonction appele pour chaque noeud.
+///
+/// @return Faux si le parcours a t arrt par la fonction.
+///
+////////////////////////////////////////////////////////////////////////
+template <class Noeud, class Fonction>
+bool ParcoursArbre::parcourirPrefixe(Noeud* racine, Fonction fonction)
+{
+	VisiteurPrefixe<Noeud, Fonction> visiteur{ fonction };
+	return parcourir(racine, visiteur);
+}
+
+
+#endif // __ARBRE_PARCOURSARBRE_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
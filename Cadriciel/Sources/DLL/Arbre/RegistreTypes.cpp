@@ -0,0 +1,70 @@
+////////////////////////////////////////////////
+/// @file   RegistreTypes.cpp
+/// @author DGI-INF2990
+/// @date   2026-10-17
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////
+
+#include "RegistreTypes.h"
+
+
+/// Identifiant retourn pour un nom qui n'est pas enregistr.
+const RegistreTypes::Identifiant RegistreTypes::INCONNU;
+/// Association des noms vers leur identifiant.
+std::unordered_map<std::string, RegistreTypes::Identifiant> RegistreTypes::identifiants_;
+/// Noms des types, selon leur identifiant.
+std::deque<std::string> RegistreTypes::noms_;
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn RegistreTypes::Identifiant RegistreTypes::enregistrer(const std::string& nom)
+///
+/// Cette fonction retourne l'identifiant d'un nom de type, en lui
+/// attribuant le prochain identifiant libre s'il n'tait pas encore
+/// enregistr.
+///
+/// @param[in] nom : Le nom du type.
+///
+/// @return L'identifiant du type.
+///
+////////////////////////////////////////////////////////////////////////
+RegistreTypes::Identifiant RegistreTypes::enregistrer(const std::string& nom)
+{
+	const Identifiant prochain{ static_cast<Identifiant>(noms_.size()) };
+	const auto resultat = identifiants_.insert(std::make_pair(nom, prochain));
+	if (resultat.second)
+		noms_.push_back(nom);
+
+	return resultat.first->second;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn RegistreTypes::Identifiant RegistreTypes::obtenirIdentifiant(const std::string& nom)
+///
+/// Cette fonction retourne l'identifiant d'un nom de type dj
+/// enregistr.  Elle sert aux recherches par nom: un nom qui n'a jamais
+/// t enregistr ne peut correspondre  aucun noeud.
+///
+/// @param[in] nom : Le nom du type.
+///
+/// @return L'identifiant du type, ou INCONNU s'il n'est pas enregistr.
+///
+////////////////////////////////////////////////////////////////////////
+RegistreTypes::Identifiant RegistreTypes::obtenirIdentifiant(const std::string& nom)
+{
+	const auto it = identifiants_.find(nom);
+	if (it == identifiants_.end())
+		return INCONNU;
+
+	return it->second;
+}
+
+
+////////////////////////////////////////////////
+/// @}
+////////////////////////////////////////////////
@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file RegistreTypes.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __ARBRE_REGISTRETYPES_H__
+#define __ARBRE_REGISTRETYPES_H__
+
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+
+///////////////////////////////////////////////////////////////////////////
+/// @class RegistreTypes
+/// @brief Registre global qui associe  chaque nom de type de noeud un
+///        petit identifiant entier.
+///
+///        Les noeuds conservent l'identifiant de leur type plutt qu'une
+///        copie de son nom, et les comparaisons de types se font sur les
+///        identifiants.  Les identifiants sont attribus conscutivement
+///         partir de 0 et ne sont jamais rutiliss, ce qui permet de
+///        s'en servir comme indices dans des tableaux.
+///
+///        Le registre n'est pas protg contre les accs concurrents: les
+///        types doivent tre enregistrs par le fil principal.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class RegistreTypes
+{
+public:
+	/// Identifiant d'un type de noeud.
+	using Identifiant = unsigned int;
+	/// Identifiant retourn pour un nom qui n'est pas enregistr.
+	static const Identifiant INCONNU{ 0xFFFFFFFF };
+
+	/// Enregistre un nom de type au besoin et retourne son identifiant.
+	static Identifiant enregistrer(const std::string& nom);
+	/// Retourne l'identifiant d'un nom de type, sans l'enregistrer.
+	static Identifiant obtenirIdentifiant(const std::string& nom);
+	/// Retourne le nom associ  un identifiant.
+	static inline const std::string& obtenirNom(Identifiant identifiant);
+	/// Retourne le nombre de types enregistrs.
+	static inline unsigned int obtenirNombreTypes();
+
+private:
+	/// Association des noms vers leur identifiant.
+	static std::unordered_map<std::string, Identifiant> identifiants_;
+	/// Noms des types, selon leur identifiant.  Une deque ne dplace pas
+	/// ses lments lors d'un ajout, de sorte que les rfrences
+	/// retournes par obtenirNom() restent valides.
+	static std::deque<std::string> noms_;
+};
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const std::string& RegistreTypes::obtenirNom(Identifiant identifiant)
+///
+/// Cette fonction retourne le nom du type associ  un identifiant
+/// obtenu par enregistrer().
+///
+/// @param[in] identifiant : L'identifiant du type.
+///
+/// @return Le nom du type.
+///
+////////////////////////////////////////////////////////////////////////
+inline const std::string& RegistreTypes::obtenirNom(Identifiant identifiant)
+{
+	return noms_[identifiant];
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline unsigned int RegistreTypes::obtenirNombreTypes()
+///
+/// Cette fonction retourne le nombre de types enregistrs, qui est aussi
+/// le plus grand identifiant attribu plus un.
+///
+/// @return Le nombre de types enregistrs.
+///
+////////////////////////////////////////////////////////////////////////
+inline unsigned int RegistreTypes::obtenirNombreTypes()
+{
+	return static_cast<unsigned int>(noms_.size());
+}
+
+
+#endif // __ARBRE_REGISTRETYPES_H__
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -13,10 +13,10 @@
 
 #include <string>
 
-#include "Modele3D.h"
-#include "OpenGL_Storage/ModeleStorage_Liste.h"
-
-class NoeudAbstrait;
+#include "RegistreModeles.h"
+#include "Utilitaire.h"
+#include "PoolMemoire.h"
+#include "NoeudAbstrait.h"
 
 ///////////////////////////////////////////////////////////////////////////
 /// @class UsineNoeud
@@ -30,9 +30,7 @@ class UsineNoeud
 {
 public:
    /// Destructeur vide dclar virtuel pour les classes drives.
-   inline virtual ~UsineNoeud() {
-	   liste_.storageRelacher();
-   }
+   inline virtual ~UsineNoeud() {}
 
    /// Fonction  surcharger pour la cration d'un noeud.
    virtual NoeudAbstrait* creerNoeud() const = 0;
@@ -40,19 +38,31 @@ public:
    /// Retourne le nom associ  l'usine
    inline const std::string& obtenirNom() const;
 
+   /// Retourne le pool dans lequel l'usine alloue ses noeuds.
+   inline const utilitaire::PoolMemoire& obtenirPool() const;
+   /// Relche la mmoire du pool si aucun noeud n'y est allou.
+   inline bool relacherMemoire() const;
+
 
 protected:
-   /// Constructeur qui prend le nom associ  l'usine.
-	UsineNoeud(const std::string& nomUsine, const std::string& nomModele) : nom_(nomUsine) {
-		modele_.charger(nomModele);
-		liste_ = modele::opengl_storage::OpenGL_Liste{ &modele_ };
-		liste_.storageCharger();
+   /// Constructeur qui prend le nom associ  l'usine, son modle dj
+   /// charg et partag (voir modele::RegistreModeles) et la taille des
+   /// noeuds qu'elle cre.
+	UsineNoeud(const std::string& nomUsine, modele::RegistreModeles::Poignee modele, std::size_t tailleNoeud)
+		: modele_(std::move(modele)), pool_(NoeudAbstrait::calculerTailleAllocation(tailleNoeud)), nom_(nomUsine) {
+		sphereEnglobante_ = utilitaire::calculerSphereEnglobante(modele_->obtenirModele());
 	}
 
-   /// Modle 3D correspondant  ce noeud.
-   modele::Modele3D modele_;
-   /// Storage pour le dessin du modle
-   modele::opengl_storage::OpenGL_Liste liste_;
+   /// Modle 3D correspondant  ce noeud, avec sa liste d'affichage,
+   /// partag avec les autres utilisateurs du mme fichier.
+   modele::RegistreModeles::Poignee modele_;
+   /// Sphre englobant le modle, calcule une seule fois pour tous les
+   /// noeuds crs par l'usine.
+   utilitaire::SphereEnglobante sphereEnglobante_;
+   /// Pool dans lequel les noeuds crs par l'usine sont allous, afin que
+   /// les noeuds d'un mme type soient contigus en mmoire.  Il doit
+   /// survivre  tous les noeuds crs par l'usine.
+   mutable utilitaire::PoolMemoire pool_;
 
 private:
    /// Le nom associ  l'usine
@@ -78,6 +88,39 @@ inline const std::string& UsineNoeud::obtenirNom() const
 }
 
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline const utilitaire::PoolMemoire& UsineNoeud::obtenirPool() const
+///
+/// Cette fonction retourne le pool dans lequel l'usine alloue ses
+/// noeuds, entre autres pour consulter ses compteurs d'allocations.
+///
+/// @return Le pool de l'usine.
+///
+////////////////////////////////////////////////////////////////////////
+inline const utilitaire::PoolMemoire& UsineNoeud::obtenirPool() const
+{
+   return pool_;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn inline bool UsineNoeud::relacherMemoire() const
+///
+/// Cette fonction relche d'un coup toutes les plaques du pool de
+/// l'usine,  condition que tous les noeuds qu'elle a crs aient t
+/// dtruits.
+///
+/// @return Vrai si la mmoire a t relche.
+///
+////////////////////////////////////////////////////////////////////////
+inline bool UsineNoeud::relacherMemoire() const
+{
+   return pool_.relacher();
+}
+
+
 #endif // __ARBRE_USINES_USINENOEUD_H__
 
 
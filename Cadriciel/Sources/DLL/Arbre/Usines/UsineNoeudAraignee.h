@@ -27,7 +27,7 @@ class UsineNoeudAraignee : public UsineNoeud
 {
 public:
    /// Constructeur par paramtres.
-   inline UsineNoeudAraignee(const std::string& nom);
+   inline UsineNoeudAraignee(const std::string& nom, modele::RegistreModeles::Poignee modele);
 
    /// Fonction  surcharger pour la cration d'un noeud.
    inline virtual NoeudAbstrait* creerNoeud() const;
@@ -38,18 +38,19 @@ public:
 
 ////////////////////////////////////////////////////////////////////////
 ///
-/// @fn UsineNoeudAraignee::UsineNoeudAraignee(const std::string& nom)
+/// @fn UsineNoeudAraignee::UsineNoeudAraignee(const std::string& nom, modele::RegistreModeles::Poignee modele)
 ///
 /// Ce constructeur ne fait qu'appeler la version de la classe et base
 /// et donner des valeurs par dfaut aux variables membres..
 ///
-/// @param[in] nom   : Le nom de l'usine qui correspond au type de noeuds crs.
+/// @param[in] nom    : Le nom de l'usine qui correspond au type de noeuds crs.
+/// @param[in] modele : Le modle partag des noeuds crs.
 ///
 /// @return Aucune (constructeur).
 ///
 ////////////////////////////////////////////////////////////////////////
-inline UsineNoeudAraignee::UsineNoeudAraignee(const std::string& nom)
-: UsineNoeud(nom, std::string{"media/spider.obj"})
+inline UsineNoeudAraignee::UsineNoeudAraignee(const std::string& nom, modele::RegistreModeles::Poignee modele)
+: UsineNoeud(nom, std::move(modele), sizeof(NoeudAraignee))
 {
 }
 
@@ -59,15 +60,15 @@ inline UsineNoeudAraignee::UsineNoeudAraignee(const std::string& nom)
 /// @fn NoeudAbstrait* UsineNoeudAraignee::creerNoeud() const
 ///
 /// Cette fonction retourne un noeud nouvellement cr du type produit
-/// par cette usine, soit une araigne.
+/// par cette usine, allou dans le pool de l'usine, soit une araigne.
 ///
 /// @return Le noeud nouvellement cr.
 ///
 ////////////////////////////////////////////////////////////////////////
 NoeudAbstrait* UsineNoeudAraignee::creerNoeud() const
 {
-	auto noeud = new NoeudAraignee{ obtenirNom() };
-	noeud->assignerObjetRendu(&modele_, &liste_);
+	auto noeud = new (pool_) NoeudAraignee{ obtenirNom() };
+	noeud->assignerObjetRendu(&modele_->obtenirModele(), &modele_->obtenirListe(), sphereEnglobante_.rayon);
 	return noeud;
 }
 
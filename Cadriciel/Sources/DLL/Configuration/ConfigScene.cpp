@@ -17,6 +17,23 @@ SINGLETON_DECLARATION_CPP(ConfigScene);
 /// Nombre de calculs par image.
 int ConfigScene::CALCULS_PAR_IMAGE{ 50 };
 
+/// Vrai si l'animation de la scne doit s'effectuer sur un seul fil.
+bool ConfigScene::ANIMATION_MONO_FIL{ false };
+
+/// Nombre de noeuds d'un sous-arbre  partir duquel il est anim en
+/// parallle.
+int ConfigScene::SEUIL_ANIMATION_PARALLELE{ 256 };
+
+/// Vrai si les noeuds hors du champ de la vue ne sont pas affichs.
+bool ConfigScene::ELIMINATION_HORS_CHAMP{ true };
+
+/// Mthode de la phase large de la dtection des collisions: 0 pour le
+/// balayage et lagage, 1 pour la grille spatiale, autre pour aucune.
+int ConfigScene::PHASE_LARGE{ 0 };
+
+/// Taille des cellules de la grille spatiale de la phase large.
+double ConfigScene::TAILLE_CELLULE_PHASE_LARGE{ 100.0 };
+
 
 ////////////////////////////////////////////////////////////////////////
 ///
@@ -35,6 +52,11 @@ void ConfigScene::creerDOM ( tinyxml2::XMLDocument& document ) const
 	// Crer le noeud scene et dfinir ses attributs
 	tinyxml2::XMLElement* elementScene{ document.NewElement("CScene") };
 	elementScene->SetAttribute("CALCULS_PAR_IMAGE", ConfigScene::CALCULS_PAR_IMAGE);
+	elementScene->SetAttribute("ANIMATION_MONO_FIL", ConfigScene::ANIMATION_MONO_FIL);
+	elementScene->SetAttribute("SEUIL_ANIMATION_PARALLELE", ConfigScene::SEUIL_ANIMATION_PARALLELE);
+	elementScene->SetAttribute("ELIMINATION_HORS_CHAMP", ConfigScene::ELIMINATION_HORS_CHAMP);
+	elementScene->SetAttribute("PHASE_LARGE", ConfigScene::PHASE_LARGE);
+	elementScene->SetAttribute("TAILLE_CELLULE_PHASE_LARGE", ConfigScene::TAILLE_CELLULE_PHASE_LARGE);
 	
 	// Adjoindre le noeud 'elementScene'
 	elementConfiguration->LinkEndChild(elementScene);
@@ -67,6 +89,25 @@ void ConfigScene::lireDOM( const tinyxml2::XMLDocument& document )
 			if (elementScene->QueryIntAttribute("CALCULS_PAR_IMAGE", &ConfigScene::CALCULS_PAR_IMAGE) != tinyxml2::XML_SUCCESS){
 				std::cerr << "Erreur : CALCULS_PAR_IMAGE : chargement XML : attribut inexistant ou de type incorrect" << std::endl;
 			}
+
+			// Les attributs de l'animation parallle, de l'limination hors
+			// du champ et de la phase large sont facultatifs, afin
+			// que les fichiers existants demeurent valides.
+			if (elementScene->QueryBoolAttribute("ANIMATION_MONO_FIL", &ConfigScene::ANIMATION_MONO_FIL) == tinyxml2::XML_WRONG_ATTRIBUTE_TYPE){
+				std::cerr << "Erreur : ANIMATION_MONO_FIL : chargement XML : attribut de type incorrect" << std::endl;
+			}
+			if (elementScene->QueryIntAttribute("SEUIL_ANIMATION_PARALLELE", &ConfigScene::SEUIL_ANIMATION_PARALLELE) == tinyxml2::XML_WRONG_ATTRIBUTE_TYPE){
+				std::cerr << "Erreur : SEUIL_ANIMATION_PARALLELE : chargement XML : attribut de type incorrect" << std::endl;
+			}
+			if (elementScene->QueryBoolAttribute("ELIMINATION_HORS_CHAMP", &ConfigScene::ELIMINATION_HORS_CHAMP) == tinyxml2::XML_WRONG_ATTRIBUTE_TYPE){
+				std::cerr << "Erreur : ELIMINATION_HORS_CHAMP : chargement XML : attribut de type incorrect" << std::endl;
+			}
+			if (elementScene->QueryIntAttribute("PHASE_LARGE", &ConfigScene::PHASE_LARGE) == tinyxml2::XML_WRONG_ATTRIBUTE_TYPE){
+				std::cerr << "Erreur : PHASE_LARGE : chargement XML : attribut de type incorrect" << std::endl;
+			}
+			if (elementScene->QueryDoubleAttribute("TAILLE_CELLULE_PHASE_LARGE", &ConfigScene::TAILLE_CELLULE_PHASE_LARGE) == tinyxml2::XML_WRONG_ATTRIBUTE_TYPE){
+				std::cerr << "Erreur : TAILLE_CELLULE_PHASE_LARGE : chargement XML : attribut de type incorrect" << std::endl;
+			}
 		}
 	}
 }
@@ -38,6 +38,23 @@ public:
    /// Nombre de calculs par image.
    static int CALCULS_PAR_IMAGE;
 
+   /// Vrai si l'animation de la scne doit s'effectuer sur un seul fil.
+   static bool ANIMATION_MONO_FIL;
+
+   /// Nombre de noeuds d'un sous-arbre  partir duquel il est anim en
+   /// parallle.
+   static int SEUIL_ANIMATION_PARALLELE;
+
+   /// Vrai si les noeuds hors du champ de la vue ne sont pas affichs.
+   static bool ELIMINATION_HORS_CHAMP;
+
+   /// Mthode de la phase large de la dtection des collisions: 0 pour le
+   /// balayage et lagage, 1 pour la grille spatiale, autre pour aucune.
+   static int PHASE_LARGE;
+
+   /// Taille des cellules de la grille spatiale de la phase large.
+   static double TAILLE_CELLULE_PHASE_LARGE;
+
 };
 
 
@@ -172,6 +172,82 @@ extern "C"
 	}
 
 
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn __declspec(dllexport) int __cdecl obtenirNombreNoeudsAffiches()
+	///
+	/// Cette fonction permet d'obtenir le nombre de noeuds affichs lors du
+	/// dernier affichage de la scne.
+	///
+	/// @return Le nombre de noeuds affichs.
+	///
+	////////////////////////////////////////////////////////////////////////
+	__declspec(dllexport) int __cdecl obtenirNombreNoeudsAffiches()
+	{
+		return static_cast<int>(
+			FacadeModele::obtenirInstance()->obtenirArbreRenduINF2990()->obtenirNombreNoeudsAffiches()
+			);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn __declspec(dllexport) int __cdecl obtenirNombreNoeudsElimines()
+	///
+	/// Cette fonction permet d'obtenir le nombre de noeuds qui n'ont pas t
+	/// affichs lors du dernier affichage de la scne parce qu'ils taient
+	/// hors du champ de la vue.
+	///
+	/// @return Le nombre de noeuds limins.
+	///
+	////////////////////////////////////////////////////////////////////////
+	__declspec(dllexport) int __cdecl obtenirNombreNoeudsElimines()
+	{
+		return static_cast<int>(
+			FacadeModele::obtenirInstance()->obtenirArbreRenduINF2990()->obtenirNombreNoeudsElimines()
+			);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn __declspec(dllexport) int __cdecl obtenirNombrePairesPhaseLarge()
+	///
+	/// Cette fonction permet d'obtenir le nombre de paires de noeuds
+	/// candidates  une collision lors de la dernire mise  jour de la
+	/// phase large.
+	///
+	/// @return Le nombre de paires candidates, ou 0 sans phase large.
+	///
+	////////////////////////////////////////////////////////////////////////
+	__declspec(dllexport) int __cdecl obtenirNombrePairesPhaseLarge()
+	{
+		const aidecollision::PhaseLarge* phaseLarge{
+			FacadeModele::obtenirInstance()->obtenirArbreRenduINF2990()->obtenirPhaseLarge()
+		};
+		return phaseLarge == nullptr ? 0 : static_cast<int>(phaseLarge->obtenirStatistiques().nombrePaires);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////
+	///
+	/// @fn __declspec(dllexport) double __cdecl obtenirDureePhaseLarge()
+	///
+	/// Cette fonction permet d'obtenir la dure de la dernire mise  jour
+	/// de la phase large.
+	///
+	/// @return La dure en millisecondes, ou 0 sans phase large.
+	///
+	////////////////////////////////////////////////////////////////////////
+	__declspec(dllexport) double __cdecl obtenirDureePhaseLarge()
+	{
+		const aidecollision::PhaseLarge* phaseLarge{
+			FacadeModele::obtenirInstance()->obtenirArbreRenduINF2990()->obtenirPhaseLarge()
+		};
+		return phaseLarge == nullptr ? 0.0 : phaseLarge->obtenirStatistiques().dureeMiseAJour;
+	}
+
+
 	////////////////////////////////////////////////////////////////////////
 	///
 	/// @fn __declspec(dllexport) bool __cdecl executerTests()
@@ -19,6 +19,10 @@ extern "C" {
 	__declspec(dllexport) void zoomIn();
 	__declspec(dllexport) void zoomOut();
 	__declspec(dllexport) int obtenirAffichagesParSeconde();
+	__declspec(dllexport) int obtenirNombreNoeudsAffiches();
+	__declspec(dllexport) int obtenirNombreNoeudsElimines();
+	__declspec(dllexport) int obtenirNombrePairesPhaseLarge();
+	__declspec(dllexport) double obtenirDureePhaseLarge();
 	__declspec(dllexport) bool executerTests();
 
 }
@@ -0,0 +1,313 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file AideCollisionLotTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "AideCollisionLotTest.h"
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(AideCollisionLotTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionLotTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionLotTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::comparer(const aidecollision::ContactLot<T>& contact, const aidecollision::DetailsCollision& details, double distance, double tolerance)
+///
+/// Vrifie qu'un contact par lots correspond aux dtails d'une collision
+/// calculs par la fonction scalaire.  Les directions sont multiplies
+/// par la distance donne avant d'tre compares, pour qu'une direction
+/// normalise  partir d'une trs courte distance ne soit pas juge
+/// trop svrement.  Prs d'une extrmit, le type de collision peut
+/// diffrer d'une prcision  l'autre, mais le contact doit rester le
+/// mme.
+///
+/// @param[in] contact   : Le contact par lots.
+/// @param[in] details   : Les dtails de la collision scalaire.
+/// @param[in] distance  : Le facteur appliqu aux directions.
+/// @param[in] tolerance : L'cart permis.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+template <class T>
+void AideCollisionLotTest::comparer(
+	const aidecollision::ContactLot<T>& contact, const aidecollision::DetailsCollision& details,
+	double distance, double tolerance
+	)
+{
+	CPPUNIT_ASSERT(contact.type == details.type ||
+		(contact.type != aidecollision::COLLISION_SPHERE && details.type != aidecollision::COLLISION_SPHERE));
+	CPPUNIT_ASSERT(std::abs(contact.enfoncement - details.enfoncement) <= tolerance);
+	const glm::dvec3 ecart{ glm::dvec3{ contact.direction } * distance - details.direction * distance };
+	CPPUNIT_ASSERT(std::abs(ecart.x) <= tolerance && std::abs(ecart.y) <= tolerance && std::abs(ecart.z) <= tolerance);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::verifierSpheres(aidecollision::JeuInstructions jeu, double tolerance)
+///
+/// Calcule par lots les collisions d'objets avec des sphres, puis
+/// vrifie chaque paire avec calculerCollisionSphere().  Une paire ne
+/// peut tre trouve par une seule des deux versions que si elle est 
+/// la limite du contact.  Le nombre d'objets n'est pas un multiple de la
+/// largeur des registres, pour vrifier aussi les objets restants.
+///
+/// @param[in] jeu       : Le jeu d'instructions  utiliser.
+/// @param[in] tolerance : L'cart permis.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+template <class T>
+void AideCollisionLotTest::verifierSpheres(aidecollision::JeuInstructions jeu, double tolerance)
+{
+	using aidecollision::Vecteur3;
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<T> coordonnee{ T(-100), T(100) };
+	std::uniform_real_distribution<T> rayon{ T(0.5), T(15) };
+	auto positionAleatoire = [&]() {
+		return Vecteur3<T>{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+	};
+
+	aidecollision::LotSpheres<T> objets, spheres;
+	for (int i = 0; i < 1003; ++i)
+		objets.ajouter(positionAleatoire(), rayon(generateur));
+	for (int j = 0; j < 71; ++j)
+		spheres.ajouter(positionAleatoire(), rayon(generateur));
+
+	std::vector< aidecollision::ContactLot<T> > contacts;
+	aidecollision::calculerCollisionsSpheres(spheres, objets, contacts, jeu);
+
+	std::map<std::pair<unsigned int, unsigned int>, const aidecollision::ContactLot<T>*> parPaire;
+	for (const auto& contact : contacts)
+		CPPUNIT_ASSERT(parPaire.insert(std::make_pair(std::make_pair(contact.objet, contact.cible), &contact)).second);
+
+	unsigned int nombreCommuns{ 0 };
+	for (unsigned int j = 0; j < spheres.obtenirTaille(); ++j) {
+		for (unsigned int i = 0; i < objets.obtenirTaille(); ++i) {
+			const aidecollision::DetailsCollision details{ aidecollision::calculerCollisionSphere(
+				glm::dvec3{ spheres.x[j], spheres.y[j], spheres.z[j] }, spheres.rayon[j],
+				glm::dvec3{ objets.x[i], objets.y[i], objets.z[i] }, objets.rayon[i]) };
+			const auto iter = parPaire.find(std::make_pair(i, j));
+			if (iter == parPaire.end()) {
+				CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_AUCUNE || details.enfoncement <= tolerance);
+			}
+			else if (details.type == aidecollision::COLLISION_AUCUNE) {
+				CPPUNIT_ASSERT(iter->second->enfoncement <= tolerance);
+			}
+			else {
+				comparer(*iter->second, details, 1.0, tolerance);
+				++nombreCommuns;
+			}
+		}
+	}
+	CPPUNIT_ASSERT(nombreCommuns > 50);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::verifierSegments(aidecollision::JeuInstructions jeu, bool collisionAvecPoints, double tolerance)
+///
+/// Calcule par lots les collisions d'objets avec des segments, puis
+/// vrifie chaque paire avec calculerCollisionSegment().  Une paire ne
+/// peut tre trouve par une seule des deux versions que si elle est 
+/// la limite du contact.
+///
+/// @param[in] jeu                 : Le jeu d'instructions  utiliser.
+/// @param[in] collisionAvecPoints : Vrai si on veut les collisions avec
+///                                  les extrmits.
+/// @param[in] tolerance           : L'cart permis.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+template <class T>
+void AideCollisionLotTest::verifierSegments(aidecollision::JeuInstructions jeu, bool collisionAvecPoints, double tolerance)
+{
+	using aidecollision::Vecteur3;
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<T> coordonnee{ T(-100), T(100) };
+	std::uniform_real_distribution<T> longueur{ T(-60), T(60) };
+	std::uniform_real_distribution<T> rayon{ T(0.5), T(15) };
+	auto positionAleatoire = [&]() {
+		return Vecteur3<T>{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+	};
+
+	aidecollision::LotSpheres<T> objets;
+	for (int i = 0; i < 1003; ++i)
+		objets.ajouter(positionAleatoire(), rayon(generateur));
+	aidecollision::LotSegments<T> segments;
+	for (int j = 0; j < 67; ++j) {
+		const Vecteur3<T> point1{ positionAleatoire() };
+		segments.ajouter(point1, point1 + Vecteur3<T>{ longueur(generateur), longueur(generateur), longueur(generateur) });
+	}
+
+	std::vector< aidecollision::ContactLot<T> > contacts;
+	aidecollision::calculerCollisionsSegments(segments, objets, contacts, collisionAvecPoints, jeu);
+
+	std::map<std::pair<unsigned int, unsigned int>, const aidecollision::ContactLot<T>*> parPaire;
+	for (const auto& contact : contacts)
+		CPPUNIT_ASSERT(parPaire.insert(std::make_pair(std::make_pair(contact.objet, contact.cible), &contact)).second);
+
+	unsigned int nombreCommuns{ 0 };
+	for (unsigned int j = 0; j < segments.obtenirTaille(); ++j) {
+		for (unsigned int i = 0; i < objets.obtenirTaille(); ++i) {
+			const aidecollision::DetailsCollision details{ aidecollision::calculerCollisionSegment(
+				glm::dvec3{ segments.x1[j], segments.y1[j], segments.z1[j] },
+				glm::dvec3{ segments.x2[j], segments.y2[j], segments.z2[j] },
+				glm::dvec3{ objets.x[i], objets.y[i], objets.z[i] }, objets.rayon[i],
+				collisionAvecPoints) };
+			const auto iter = parPaire.find(std::make_pair(i, j));
+			if (iter == parPaire.end()) {
+				CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_AUCUNE || details.enfoncement <= tolerance);
+			}
+			else if (details.type == aidecollision::COLLISION_AUCUNE) {
+				CPPUNIT_ASSERT(iter->second->enfoncement <= tolerance);
+			}
+			else {
+				comparer(*iter->second, details, objets.rayon[i] - details.enfoncement, tolerance);
+				++nombreCommuns;
+			}
+		}
+	}
+	CPPUNIT_ASSERT(nombreCommuns > 50);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::testCollisionsSpheres()
+///
+/// Cas de test: pour chaque prcision et chaque jeu d'instructions
+/// disponible, les collisions par lots avec des sphres correspondent 
+/// celles de calculerCollisionSphere().
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionLotTest::testCollisionsSpheres()
+{
+	for (int jeu = aidecollision::JEU_SCALAIRE; jeu <= aidecollision::obtenirJeuInstructions(); ++jeu) {
+		verifierSpheres<float>(static_cast<aidecollision::JeuInstructions>(jeu), 1e-3);
+		verifierSpheres<double>(static_cast<aidecollision::JeuInstructions>(jeu), 1e-9);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::testCollisionsSegments()
+///
+/// Cas de test: pour chaque prcision et chaque jeu d'instructions
+/// disponible, avec ou sans les extrmits, les collisions par lots avec
+/// des segments correspondent  celles de calculerCollisionSegment().
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionLotTest::testCollisionsSegments()
+{
+	for (int jeu = aidecollision::JEU_SCALAIRE; jeu <= aidecollision::obtenirJeuInstructions(); ++jeu) {
+		for (bool collisionAvecPoints : { true, false }) {
+			verifierSegments<float>(static_cast<aidecollision::JeuInstructions>(jeu), collisionAvecPoints, 1e-3);
+			verifierSegments<double>(static_cast<aidecollision::JeuInstructions>(jeu), collisionAvecPoints, 1e-9);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionLotTest::testCasLimites()
+///
+/// Cas de test: un segment dgnr ne touche rien, comme dans la
+/// version scalaire, un objet de rayon nul ou ngatif ne touche rien,
+/// les contacts sont ajouts  la fin de la liste et un contact simple
+/// a les valeurs attendues.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionLotTest::testCasLimites()
+{
+	using aidecollision::Vecteur3;
+
+	aidecollision::LotSpheres<double> objets;
+	aidecollision::LotSegments<double> segments;
+	std::vector< aidecollision::ContactLot<double> > contacts(1);
+
+	// Lots vides
+	aidecollision::calculerCollisionsSegments(segments, objets, contacts);
+	aidecollision::calculerCollisionsSpheres(objets, objets, contacts);
+	CPPUNIT_ASSERT(contacts.size() == 1);
+
+	// Segment dgnr
+	segments.ajouter(Vecteur3<double>{ 1.0, 2.0, 3.0 }, Vecteur3<double>{ 1.0, 2.0, 3.0 });
+	objets.ajouter(Vecteur3<double>{ 1.0, 2.0, 3.0 }, 5.0);
+	CPPUNIT_ASSERT(aidecollision::calculerCollisionSegment(
+		glm::dvec3{ 1.0, 2.0, 3.0 }, glm::dvec3{ 1.0, 2.0, 3.0 }, glm::dvec3{ 1.0, 2.0, 3.0 }, 5.0
+		).type == aidecollision::COLLISION_AUCUNE);
+	aidecollision::calculerCollisionsSegments(segments, objets, contacts);
+	CPPUNIT_ASSERT(contacts.size() == 1);
+
+	// Rayons nuls ou ngatifs, en nombre suffisant pour remplir un registre
+	segments.vider();
+	objets.vider();
+	segments.ajouter(Vecteur3<double>{ -10.0, 0.0, 0.0 }, Vecteur3<double>{ 10.0, 0.0, 0.0 });
+	for (int i = 0; i < 8; ++i)
+		objets.ajouter(Vecteur3<double>{ i - 4.0, 0.0, 0.0 }, i % 2 == 0 ? 0.0 : -1.0);
+	aidecollision::calculerCollisionsSegments(segments, objets, contacts);
+	aidecollision::calculerCollisionsSpheres(objets, objets, contacts);
+	CPPUNIT_ASSERT(contacts.size() == 1);
+
+	// Un contact simple, au milieu du segment
+	objets.vider();
+	for (int i = 0; i < 8; ++i)
+		objets.ajouter(Vecteur3<double>{ 0.0, i == 5 ? 1.0 : 100.0, 0.0 }, 1.5);
+	aidecollision::calculerCollisionsSegments(segments, objets, contacts);
+	CPPUNIT_ASSERT(contacts.size() == 2);
+	CPPUNIT_ASSERT(contacts.back().objet == 5 && contacts.back().cible == 0);
+	CPPUNIT_ASSERT(contacts.back().type == aidecollision::COLLISION_SEGMENT);
+	CPPUNIT_ASSERT(std::abs(contacts.back().enfoncement - 0.5) < 1e-12);
+	CPPUNIT_ASSERT(std::abs(contacts.back().direction.y - 1.0) < 1e-12);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
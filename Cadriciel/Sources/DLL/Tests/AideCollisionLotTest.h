@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file AideCollisionLotTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_AIDECOLLISIONLOTTEST_H
+#define _TESTS_AIDECOLLISIONLOTTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "AideCollisionLot.h"
+
+///////////////////////////////////////////////////////////////////////////
+/// @class AideCollisionLotTest
+/// @brief Classe de test cppunit pour vrifier que les calculs de
+///        collisions par lots donnent les mmes rsultats que les
+///        fonctions scalaires de aidecollision, pour chaque prcision et
+///        chaque jeu d'instructions disponible.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class AideCollisionLotTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( AideCollisionLotTest );
+	CPPUNIT_TEST( testCollisionsSpheres );
+	CPPUNIT_TEST( testCollisionsSegments );
+	CPPUNIT_TEST( testCasLimites );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: collisions d'objets avec des sphres
+	void testCollisionsSpheres();
+
+	/// Cas de test: collisions d'objets avec des segments
+	void testCollisionsSegments();
+
+	/// Cas de test: segments dgnrs, rayons nuls et lots vides
+	void testCasLimites();
+
+private:
+	/// Compare les collisions par lots avec des sphres  la version scalaire.
+	template <class T>
+	static void verifierSpheres(aidecollision::JeuInstructions jeu, double tolerance);
+	/// Compare les collisions par lots avec des segments  la version scalaire.
+	template <class T>
+	static void verifierSegments(aidecollision::JeuInstructions jeu, bool collisionAvecPoints, double tolerance);
+	/// Compare un contact par lots  des dtails de collision scalaires.
+	template <class T>
+	static void comparer(const aidecollision::ContactLot<T>& contact, const aidecollision::DetailsCollision& details, double distance, double tolerance);
+};
+
+#endif // _TESTS_AIDECOLLISIONLOTTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,473 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file AideCollisionTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "AideCollisionTest.h"
+#include "AideCollision.h"
+#include "Droite3D.h"
+#include "Plan3D.h"
+
+#include <cmath>
+#include <random>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(AideCollisionTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::testImpactSphere()
+///
+/// Cas de test: un objet qui fonce sur une sphre la touche  l'instant
+/// attendu, un objet qui passe  ct ne la touche pas et un objet dj
+/// en contact n'a un impact immdiat que s'il s'enfonce.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::testImpactSphere()
+{
+	const glm::dvec3 centre{ 0.0, 0.0, 0.0 };
+
+	aidecollision::DetailsImpact impact{ aidecollision::calculerImpactSphere(
+		centre, 2.0, glm::dvec3{ -10.0, 0.0, 0.0 }, glm::dvec3{ 20.0, 0.0, 0.0 }, 1.0
+		) };
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SPHERE);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.35) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.position - glm::dvec3{ -3.0, 0.0, 0.0 }) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ -1.0, 0.0, 0.0 }) < 1e-12);
+
+	//  ct, ou trop court.
+	impact = aidecollision::calculerImpactSphere(
+		centre, 2.0, glm::dvec3{ -10.0, 5.0, 0.0 }, glm::dvec3{ 20.0, 0.0, 0.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+	impact = aidecollision::calculerImpactSphere(
+		centre, 2.0, glm::dvec3{ -10.0, 0.0, 0.0 }, glm::dvec3{ 6.0, 0.0, 0.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+
+	// Dj en contact.
+	impact = aidecollision::calculerImpactSphere(
+		centre, 2.0, glm::dvec3{ 0.0, 2.5, 0.0 }, glm::dvec3{ 0.0, -1.0, 0.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SPHERE);
+	CPPUNIT_ASSERT(impact.instant == 0.0);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ 0.0, 1.0, 0.0 }) < 1e-12);
+	impact = aidecollision::calculerImpactSphere(
+		centre, 2.0, glm::dvec3{ 0.0, 2.5, 0.0 }, glm::dvec3{ 0.0, 1.0, 0.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+
+	// Version  deux dimensions.
+	impact = aidecollision::calculerImpactCercle(
+		glm::dvec2{ 0.0, 0.0 }, 2.0, glm::dvec2{ 0.0, -10.0 }, glm::dvec2{ 0.0, 20.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SPHERE);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.35) < 1e-12);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::testImpactSegment()
+///
+/// Cas de test: un objet rapide qui traverse un segment entre deux pas
+/// sans que calculerCollisionSegment() ne le dtecte a bien un impact,
+/// avec le segment ou avec ses extrmits.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::testImpactSegment()
+{
+	const glm::dvec3 point1{ 0.0, -5.0, 0.0 };
+	const glm::dvec3 point2{ 0.0, 5.0, 0.0 };
+	const glm::dvec3 depart{ -10.0, 0.0, 0.0 };
+	const glm::dvec3 deplacement{ 20.0, 0.0, 0.0 };
+
+	// Le segment est travers entre le dpart et l'arrive.
+	CPPUNIT_ASSERT(aidecollision::calculerCollisionSegment(point1, point2, depart, 1.0).type == aidecollision::COLLISION_AUCUNE);
+	CPPUNIT_ASSERT(aidecollision::calculerCollisionSegment(point1, point2, depart + deplacement, 1.0).type == aidecollision::COLLISION_AUCUNE);
+
+	aidecollision::DetailsImpact impact{ aidecollision::calculerImpactSegment(point1, point2, depart, deplacement, 1.0) };
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SEGMENT);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.45) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.position - glm::dvec3{ -1.0, 0.0, 0.0 }) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ -1.0, 0.0, 0.0 }) < 1e-12);
+
+	// Passage prs de la seconde extrmit.
+	impact = aidecollision::calculerImpactSegment(point1, point2, glm::dvec3{ -10.0, 5.5, 0.0 }, deplacement, 1.0);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SEGMENT_DEUXIEMEPOINT);
+	CPPUNIT_ASSERT(std::abs(impact.instant - (10.0 - std::sqrt(0.75)) / 20.0) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.position - impact.normale - point2) < 1e-12);
+	impact = aidecollision::calculerImpactSegment(point1, point2, glm::dvec3{ -10.0, 5.5, 0.0 }, deplacement, 1.0, false);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+
+	// Sans les extrmits, entre le long du segment.
+	impact = aidecollision::calculerImpactSegment(
+		point1, point2, glm::dvec3{ 0.5, -10.0, 0.0 }, glm::dvec3{ 0.0, 20.0, 0.0 }, 1.0, false
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SEGMENT);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.25) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ 1.0, 0.0, 0.0 }) < 1e-12);
+
+	// Segment dgnr, comme dans calculerCollisionSegment().
+	impact = aidecollision::calculerImpactSegment(point1, point1, depart, deplacement, 1.0);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+
+	// Version  deux dimensions.
+	impact = aidecollision::calculerImpactSegment(
+		glm::dvec2{ 0.0, -5.0 }, glm::dvec2{ 0.0, 5.0 }, glm::dvec2{ -10.0, 0.0 }, glm::dvec2{ 20.0, 0.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_SEGMENT);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.45) < 1e-12);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::testImpactArc()
+///
+/// Cas de test: un objet touche un quart de cercle par l'arc ou par l'un
+/// des rayons qui bornent son secteur, mais pas  l'extrieur du
+/// secteur.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::testImpactArc()
+{
+	const glm::dvec2 centre{ 0.0, 0.0 };
+	const glm::dvec2 point1{ 5.0, 0.0 };
+	const glm::dvec2 point2{ 0.0, 5.0 };
+
+	// Par l'arc.
+	aidecollision::DetailsImpact impact{ aidecollision::calculerImpactArc(
+		centre, point1, point2, glm::dvec2{ 10.0, 10.0 }, glm::dvec2{ -10.0, -10.0 }, 1.0
+		) };
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_ARC);
+	CPPUNIT_ASSERT(std::abs(impact.instant - (1.0 - 6.0 / std::sqrt(200.0))) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ std::sqrt(0.5), std::sqrt(0.5), 0.0 }) < 1e-12);
+
+	// Par le rayon de la seconde extrmit, aprs tre entr dans le cercle
+	//  l'extrieur du secteur.
+	impact = aidecollision::calculerImpactArc(
+		centre, point1, point2, glm::dvec2{ -10.0, -9.0 }, glm::dvec2{ 20.0, 20.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_ARC);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.5) < 1e-12);
+	CPPUNIT_ASSERT(glm::length(impact.position - glm::dvec3{ 0.0, 1.0, 0.0 }) < 1e-12);
+
+	//  l'extrieur du secteur.
+	impact = aidecollision::calculerImpactArc(
+		centre, point1, point2, glm::dvec2{ -10.0, -10.0 }, glm::dvec2{ 20.0, 0.0 }, 1.0
+		);
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::testImpactsAleatoires()
+///
+/// Cas de test: pour des dplacements alatoires dirigs vers des
+/// segments, des sphres et des arcs, l'instant de l'impact correspond
+/// au premier de plusieurs milliers de petits pas o la fonction de
+/// collision dtecte un contact, et l'objet touche bien l'obstacle 
+/// l'instant de l'impact.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::testImpactsAleatoires()
+{
+	const int nombrePas{ 4000 };
+	const double precision{ 1e-9 };
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<double> coordonnee{ -10.0, 10.0 };
+	std::uniform_real_distribution<double> bruit{ -3.0, 3.0 };
+	std::uniform_real_distribution<double> fraction{ 0.0, 1.0 };
+	std::uniform_real_distribution<double> rayon{ 0.1, 3.0 };
+	auto pointAleatoire = [&]() {
+		return glm::dvec3{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+	};
+
+	unsigned int nombreImpacts{ 0 };
+	for (int essai = 0; essai < 1500; ++essai) {
+		const int forme{ essai % 3 };
+
+		// Obstacle et dplacement dirig vers un point prs de l'obstacle.
+		glm::dvec3 point1{ pointAleatoire() };
+		glm::dvec3 point2{ pointAleatoire() };
+		const double rayonObstacle{ rayon(generateur) };
+		const double rayonObjet{ rayon(generateur) };
+		const bool collisionAvecPoints{ essai % 2 == 0 };
+		glm::dvec3 depart{ 2.0 * pointAleatoire() };
+		glm::dvec3 cible{ point1 + fraction(generateur) * (point2 - point1) +
+			glm::dvec3{ bruit(generateur), bruit(generateur), bruit(generateur) } };
+		if (forme == 2) {
+			// Arc de cercle dans le plan XY, centr en point1.
+			const double angle1{ 6.283 * fraction(generateur) };
+			const double angle2{ angle1 + 3.0 * fraction(generateur) };
+			point1.z = point2.z = depart.z = cible.z = 0.0;
+			point2 = point1 + rayonObstacle * 2.0 * glm::dvec3{ std::cos(angle1), std::sin(angle1), 0.0 };
+			cible = point1 + rayonObstacle * 2.0 * glm::dvec3{ std::cos(angle2), std::sin(angle2), 0.0 };
+			cible.x += bruit(generateur);
+			cible.y += bruit(generateur);
+		}
+		const glm::dvec3 deplacement{ (cible - depart) * (0.5 + fraction(generateur)) };
+
+		auto collision = [&](const glm::dvec3& position, double rayonTest) {
+			if (forme == 0) {
+				return aidecollision::calculerCollisionSegment(point1, point2, position, rayonTest, collisionAvecPoints).type;
+			}
+			else if (forme == 1) {
+				return aidecollision::calculerCollisionSphere(point1, rayonObstacle, position, rayonTest).type;
+			}
+			else {
+				const glm::dvec3 point3{ point1 + rayonObstacle * 2.0 * glm::dvec3{ -point2.y + point1.y, point2.x - point1.x, 0.0 } / glm::length(point2 - point1) };
+				return aidecollision::calculerCollisionArc(
+					glm::dvec2{ point1 }, glm::dvec2{ point2 }, glm::dvec2{ point3 }, glm::dvec2{ position }, rayonTest
+					).type;
+			}
+		};
+
+		aidecollision::DetailsImpact impact;
+		if (forme == 0) {
+			impact = aidecollision::calculerImpactSegment(point1, point2, depart, deplacement, rayonObjet, collisionAvecPoints);
+		}
+		else if (forme == 1) {
+			impact = aidecollision::calculerImpactSphere(point1, rayonObstacle, depart, deplacement, rayonObjet);
+		}
+		else {
+			const glm::dvec3 point3{ point1 + rayonObstacle * 2.0 * glm::dvec3{ -point2.y + point1.y, point2.x - point1.x, 0.0 } / glm::length(point2 - point1) };
+			impact = aidecollision::calculerImpactArc(
+				glm::dvec2{ point1 }, glm::dvec2{ point2 }, glm::dvec2{ point3 }, glm::dvec2{ depart }, glm::dvec2{ deplacement }, rayonObjet
+				);
+		}
+
+		// On ne vrifie que les objets qui ne touchent pas l'obstacle au dpart.
+		if (collision(depart, rayonObjet) != aidecollision::COLLISION_AUCUNE)
+			continue;
+
+		int premierPas{ 0 };
+		for (int pas = 1; pas <= nombrePas && premierPas == 0; ++pas) {
+			if (collision(depart + deplacement * (double(pas) / nombrePas), rayonObjet) != aidecollision::COLLISION_AUCUNE)
+				premierPas = pas;
+		}
+
+		if (premierPas != 0) {
+			CPPUNIT_ASSERT(impact.type != aidecollision::COLLISION_AUCUNE);
+			CPPUNIT_ASSERT(impact.instant <= double(premierPas) / nombrePas + precision);
+			CPPUNIT_ASSERT(impact.instant >= double(premierPas - 1) / nombrePas - precision);
+		}
+		if (impact.type != aidecollision::COLLISION_AUCUNE) {
+			CPPUNIT_ASSERT(glm::length(impact.position - (depart + impact.instant * deplacement)) < precision * 100.0);
+			CPPUNIT_ASSERT(std::abs(glm::length(impact.normale) - 1.0) < precision);
+			CPPUNIT_ASSERT(collision(
+				depart + deplacement * (impact.instant + 1e-7), rayonObjet * (1.0 + 1e-6) + 1e-6
+				) != aidecollision::COLLISION_AUCUNE);
+			++nombreImpacts;
+		}
+	}
+	CPPUNIT_ASSERT(nombreImpacts > 300);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::testAvancerParImpacts()
+///
+/// Cas de test: un objet trs rapide entre deux murs minces rebondit sur
+/// chacun d'eux plutt que de les traverser, ce que des sous-pas fixes
+/// ne permettraient pas de dtecter.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::testAvancerParImpacts()
+{
+	const glm::dvec3 murs[2][2]{
+		{ glm::dvec3{ 0.0, -5.0, 0.0 }, glm::dvec3{ 0.0, 5.0, 0.0 } },
+		{ glm::dvec3{ -20.0, -5.0, 0.0 }, glm::dvec3{ -20.0, 5.0, 0.0 } }
+	};
+	const aidecollision::CalculImpact calculerImpact{
+		[&murs](const glm::dvec3& position, const glm::dvec3& deplacement) {
+			return aidecollision::choisirPremierImpact(
+				aidecollision::calculerImpactSegment(murs[0][0], murs[0][1], position, deplacement, 1.0),
+				aidecollision::calculerImpactSegment(murs[1][0], murs[1][1], position, deplacement, 1.0)
+				);
+		}
+	};
+
+	// Cinq sous-pas fixes ne dtectent aucune collision.
+	for (int pas = 0; pas <= 5; ++pas) {
+		const glm::dvec3 position{ -10.0 + 20.0 * pas, 0.0, 0.0 };
+		CPPUNIT_ASSERT(aidecollision::calculerCollisionSegment(murs[0][0], murs[0][1], position, 1.0).type == aidecollision::COLLISION_AUCUNE);
+	}
+
+	// En une seconde, l'objet parcourt 9 units jusqu'au premier mur, puis
+	// 18 units entre chaque mur.
+	glm::dvec3 position{ -10.0, 0.0, 0.0 };
+	glm::dvec3 vitesse{ 100.0, 0.0, 0.0 };
+	CPPUNIT_ASSERT(aidecollision::avancerParImpacts(position, vitesse, 1.0, 1.0, calculerImpact) == 6);
+	CPPUNIT_ASSERT(glm::length(position - glm::dvec3{ -18.0, 0.0, 0.0 }) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(vitesse - glm::dvec3{ 100.0, 0.0, 0.0 }) < 1e-9);
+
+	// Au nombre maximal d'impacts, l'objet reste au dernier contact.
+	position = glm::dvec3{ -10.0, 0.0, 0.0 };
+	vitesse = glm::dvec3{ 100.0, 0.0, 0.0 };
+	CPPUNIT_ASSERT(aidecollision::avancerParImpacts(position, vitesse, 1.0, 1.0, calculerImpact, 3) == 3);
+	CPPUNIT_ASSERT(glm::length(position - glm::dvec3{ -1.0, 0.0, 0.0 }) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(vitesse - glm::dvec3{ -100.0, 0.0, 0.0 }) < 1e-9);
+
+	// Sans rebond, l'objet s'arrte contre le mur.
+	position = glm::dvec3{ -10.0, 0.0, 0.0 };
+	vitesse = glm::dvec3{ 100.0, 0.0, 0.0 };
+	CPPUNIT_ASSERT(aidecollision::avancerParImpacts(position, vitesse, 1.0, 0.0, calculerImpact) == 1);
+	CPPUNIT_ASSERT(glm::length(position - glm::dvec3{ -1.0, 0.0, 0.0 }) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(vitesse) < 1e-9);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void AideCollisionTest::testSimplePrecision()
+///
+/// Cas de test: pour des segments, des sphres et des arcs alatoires,
+/// les collisions, les impacts et les forces calculs en float
+/// correspondent  ceux calculs en double, sauf pour les contacts  la
+/// limite.  L'intersection d'une droite et d'un plan est aussi la mme
+/// dans les deux prcisions.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void AideCollisionTest::testSimplePrecision()
+{
+	const double tolerance{ 1e-3 };
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<float> coordonnee{ -10.0f, 10.0f };
+	std::uniform_real_distribution<float> rayon{ 0.1f, 5.0f };
+	auto pointAleatoire = [&]() {
+		return glm::vec3{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+	};
+	auto proches = [tolerance](const glm::vec3& simple, const glm::dvec3& double_) {
+		return glm::length(glm::dvec3{ simple } - double_) < tolerance;
+	};
+
+	unsigned int nombreCollisions{ 0 };
+	for (int essai = 0; essai < 2000; ++essai) {
+		const glm::vec3 point1{ pointAleatoire() };
+		const glm::vec3 point2{ pointAleatoire() };
+		const glm::vec3 position{ pointAleatoire() };
+		const glm::vec3 deplacement{ pointAleatoire() * 2.0f };
+		const float rayonObstacle{ rayon(generateur) };
+		const float rayonObjet{ rayon(generateur) };
+
+		// Collisions et forces.
+		aidecollision::DetailsCollisiont<float> simple;
+		aidecollision::DetailsCollision double_;
+		const glm::vec3 forceSimple{ aidecollision::calculerCollisionSegment(
+			point1, point2, position, rayonObjet, true, 10.0, 2.0, deplacement, &simple
+			) };
+		const glm::dvec3 forceDouble{ aidecollision::calculerCollisionSegment(
+			glm::dvec3{ point1 }, glm::dvec3{ point2 }, glm::dvec3{ position }, rayonObjet, true, 10.0, 2.0, glm::dvec3{ deplacement }, &double_
+			) };
+		if (std::abs(double_.enfoncement) > tolerance || double_.type == aidecollision::COLLISION_AUCUNE) {
+			CPPUNIT_ASSERT(simple.type == double_.type ||
+				(simple.type != aidecollision::COLLISION_AUCUNE && double_.type != aidecollision::COLLISION_AUCUNE));
+			if (double_.type != aidecollision::COLLISION_AUCUNE) {
+				CPPUNIT_ASSERT(std::abs(simple.enfoncement - double_.enfoncement) < tolerance);
+				CPPUNIT_ASSERT(glm::length(glm::dvec3{ forceSimple } - forceDouble) < tolerance * glm::length(forceDouble) + tolerance);
+				++nombreCollisions;
+			}
+		}
+
+		simple = aidecollision::calculerCollisionSphere(point1, rayonObstacle, position, rayonObjet);
+		double_ = aidecollision::calculerCollisionSphere(glm::dvec3{ point1 }, rayonObstacle, glm::dvec3{ position }, rayonObjet);
+		CPPUNIT_ASSERT(std::abs(simple.enfoncement - double_.enfoncement) < tolerance);
+		CPPUNIT_ASSERT(proches(simple.direction, double_.direction));
+
+		// Les points alatoires servent de centre et d'extrmits de l'arc.
+		simple = aidecollision::calculerCollisionArc(
+			glm::vec2{ point1 }, glm::vec2{ point2 }, glm::vec2{ position }, glm::vec2{ deplacement }, rayonObjet
+			);
+		double_ = aidecollision::calculerCollisionArc(
+			glm::dvec2{ point1 }, glm::dvec2{ point2 }, glm::dvec2{ position }, glm::dvec2{ deplacement }, rayonObjet
+			);
+		CPPUNIT_ASSERT(std::abs(simple.enfoncement - double_.enfoncement) < tolerance);
+
+		// Impacts.
+		const aidecollision::DetailsImpactt<float> impactSimple{ aidecollision::calculerImpactSphere(
+			point1, rayonObstacle, position, deplacement, rayonObjet
+			) };
+		const aidecollision::DetailsImpact impactDouble{ aidecollision::calculerImpactSphere(
+			glm::dvec3{ point1 }, rayonObstacle, glm::dvec3{ position }, glm::dvec3{ deplacement }, rayonObjet
+			) };
+		if (impactSimple.type == impactDouble.type) {
+			if (impactDouble.type != aidecollision::COLLISION_AUCUNE) {
+				CPPUNIT_ASSERT(std::abs(impactSimple.instant - impactDouble.instant) < tolerance);
+				CPPUNIT_ASSERT(proches(impactSimple.position, impactDouble.position));
+			}
+		}
+		else {
+			// Seul un contact rasant peut tre manqu par l'une des deux prcisions.
+			const aidecollision::DetailsImpact& impact{
+				impactDouble.type != aidecollision::COLLISION_AUCUNE ? impactDouble :
+				aidecollision::DetailsImpact{ impactSimple.type, impactSimple.instant,
+				glm::dvec3{ impactSimple.position }, glm::dvec3{ impactSimple.normale } } };
+			CPPUNIT_ASSERT(std::abs(glm::dot(glm::dvec3{ deplacement }, impact.normale)) < tolerance * glm::length(glm::dvec3{ deplacement }) * 100.0);
+		}
+	}
+	CPPUNIT_ASSERT(nombreCollisions > 50);
+
+	// Droite et plan.
+	const math::Plan3Df planSimple{ glm::vec3{ 0.0f, 0.0f, 1.0f }, glm::vec3{ 0.0f, 0.0f, 2.0f } };
+	const math::Plan3D planDouble{ glm::dvec3{ 0.0, 0.0, 1.0 }, glm::dvec3{ 0.0, 0.0, 2.0 } };
+	math::Droite3Df droiteSimple{ glm::vec3{ 1.0f, 2.0f, 10.0f }, glm::vec3{ 3.0f, -1.0f, -4.0f } };
+	math::Droite3D droiteDouble{ glm::dvec3{ 1.0, 2.0, 10.0 }, glm::dvec3{ 3.0, -1.0, -4.0 } };
+	glm::vec3 intersectionSimple;
+	glm::dvec3 intersectionDouble;
+	CPPUNIT_ASSERT(droiteSimple.intersection(planSimple, intersectionSimple));
+	CPPUNIT_ASSERT(droiteDouble.intersection(planDouble, intersectionDouble));
+	CPPUNIT_ASSERT(std::abs(intersectionDouble.z - 2.0) < 1e-12);
+	CPPUNIT_ASSERT(proches(intersectionSimple, intersectionDouble));
+	CPPUNIT_ASSERT(std::abs(droiteSimple.distancePoint(glm::vec3{ 5.0f, 5.0f, 0.0f }) -
+		droiteDouble.distancePoint(glm::dvec3{ 5.0, 5.0, 0.0 })) < tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
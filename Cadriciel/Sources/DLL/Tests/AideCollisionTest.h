@@ -0,0 +1,88 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file AideCollisionTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_AIDECOLLISIONTEST_H
+#define _TESTS_AIDECOLLISIONTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class AideCollisionTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        calculs d'impacts d'objets en mouvement de aidecollision, en
+///        simple et en double prcision.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class AideCollisionTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( AideCollisionTest );
+	CPPUNIT_TEST( testImpactSphere );
+	CPPUNIT_TEST( testImpactSegment );
+	CPPUNIT_TEST( testImpactArc );
+	CPPUNIT_TEST( testImpactsAleatoires );
+	CPPUNIT_TEST( testAvancerParImpacts );
+	CPPUNIT_TEST( testSimplePrecision );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: impacts d'objets avec des sphres
+	void testImpactSphere();
+
+	/// Cas de test: impacts d'objets avec des segments, y compris un
+	/// segment travers entre deux pas
+	void testImpactSegment();
+
+	/// Cas de test: impacts d'objets avec des arcs de cercle
+	void testImpactArc();
+
+	/// Cas de test: les impacts correspondent au premier pas o les
+	/// fonctions de collision dtectent un contact
+	void testImpactsAleatoires();
+
+	/// Cas de test: avance d'un objet d'impact en impact
+	void testAvancerParImpacts();
+
+	/// Cas de test: les calculs en float donnent les mmes rsultats que
+	/// ceux en double,  la prcision prs
+	void testSimplePrecision();
+
+};
+
+#endif // _TESTS_AIDECOLLISIONTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,708 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file ArbreRenduTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "ArbreRenduTest.h"
+#include "ArbreRendu.h"
+#include "NoeudComposite.h"
+#include "NoeudConeCube.h"
+#include "NoeudAraignee.h"
+#include "ArbreRenduINF2990.h"
+#include "OrdonnanceurTaches.h"
+#include "Utilitaire.h"
+#include "Frustum.h"
+#include "VueOrtho.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
+#include <random>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(ArbreRenduTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// On utilise un arbre de rendu sans usine afin de ne pas dpendre du
+/// chargement des modles.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::setUp()
+{
+	arbre = std::make_unique<ArbreRendu>();
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::tearDown()
+{
+	arbre.reset();
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testIndexAjout()
+///
+/// Cas de test: l'index des types suit les ajouts de noeuds, incluant
+/// ceux d'un sous-arbre construit avant d'tre ajout  l'arbre.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testIndexAjout()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+
+	// Un arbre vide ne contient que sa racine
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud("racine") == arbre.get());
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud(cube) == nullptr);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).empty());
+
+	// Sous-arbre construit hors de l'arbre, puis ajout d'un coup
+	NoeudAbstrait* groupe{ new NoeudComposite{ "groupe" } };
+	NoeudAbstrait* premier{ new NoeudConeCube{ cube } };
+	groupe->ajouter(premier);
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud(cube) == nullptr);
+	arbre->ajouter(groupe);
+
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud("groupe") == groupe);
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud(cube) == premier);
+
+	// Ajout direct sous un noeud dj prsent dans l'arbre
+	NoeudAbstrait* second{ new NoeudConeCube{ cube } };
+	groupe->ajouter(second);
+
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).size() == 2);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube)[1] == second);
+	CPPUNIT_ASSERT(arbre->chercher(cube) == premier);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testIndexRetrait()
+///
+/// Cas de test: l'index des types suit les retraits de noeuds effectus
+/// par effacer(), effacerSelection() et vider().
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testIndexRetrait()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+
+	NoeudAbstrait* groupe{ new NoeudComposite{ "groupe" } };
+	arbre->ajouter(groupe);
+	NoeudAbstrait* cubes[4];
+	for (NoeudAbstrait*& noeud : cubes) {
+		noeud = new NoeudConeCube{ cube };
+		groupe->ajouter(noeud);
+	}
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).size() == 4);
+
+	// Effacement d'un noeud prcis
+	arbre->effacer(cubes[0]);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).size() == 3);
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud(cube) == cubes[1]);
+
+	// Effacement de la slection
+	cubes[1]->assignerSelection(true);
+	cubes[3]->assignerSelection(true);
+	arbre->effacerSelection();
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).size() == 1);
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud(cube) == cubes[2]);
+
+	// Effacement d'un sous-arbre complet
+	arbre->effacer(groupe);
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud("groupe") == nullptr);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).empty());
+
+	// Vider l'arbre vide aussi l'index
+	arbre->ajouter(new NoeudConeCube{ cube });
+	arbre->vider();
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud(cube) == nullptr);
+	CPPUNIT_ASSERT(arbre->obtenirPremierNoeud("racine") == arbre.get());
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testEffacerSelectionOrdre()
+///
+/// Cas de test: effacerSelection() retire tous les enfants slectionns
+/// en une passe et prserve l'ordre relatif des enfants conservs, de
+/// mme que celui de l'index des types.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testEffacerSelectionOrdre()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+
+	NoeudAbstrait* cubes[6];
+	for (NoeudAbstrait*& noeud : cubes) {
+		noeud = new NoeudConeCube{ cube };
+		arbre->ajouter(noeud);
+	}
+
+	// On slectionne un enfant sur deux, incluant le premier et le dernier.
+	cubes[0]->assignerSelection(true);
+	cubes[2]->assignerSelection(true);
+	cubes[3]->assignerSelection(true);
+	cubes[5]->assignerSelection(true);
+	arbre->effacerSelection();
+
+	CPPUNIT_ASSERT(arbre->obtenirNombreEnfants() == 2);
+	CPPUNIT_ASSERT(arbre->chercher(0u) == cubes[1]);
+	CPPUNIT_ASSERT(arbre->chercher(1u) == cubes[4]);
+
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube).size() == 2);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube)[0] == cubes[1]);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(cube)[1] == cubes[4]);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testStockageTransformations()
+///
+/// Cas de test: activer le stockage contigu prserve les positions des
+/// noeuds existants et y place les nouveaux noeuds, les traitements de
+/// masse sur le stockage sont visibles depuis les noeuds, y compris dans
+/// leurs matrices monde dj calcules, et les indices des noeuds
+/// dtruits sont rutiliss.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testStockageTransformations()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+
+	NoeudAbstrait* groupe{ new NoeudComposite{ "groupe" } };
+	NoeudAbstrait* premier{ new NoeudConeCube{ cube } };
+	groupe->assignerPositionRelative({ 1.0, 2.0, 3.0 });
+	premier->assignerPositionRelative({ -1.0, 0.0, 1.0 });
+	groupe->ajouter(premier);
+	arbre->ajouter(groupe);
+	CPPUNIT_ASSERT(arbre->obtenirStockageTransformations() == nullptr);
+
+	// Activation: les positions existantes sont conserves
+	arbre->activerStockageTransformations(true);
+	utilitaire::StockageTransformations* stockage{ arbre->obtenirStockageTransformations() };
+	CPPUNIT_ASSERT(stockage != nullptr);
+	CPPUNIT_ASSERT(stockage->obtenirNombreTransformations() == 2);
+	CPPUNIT_ASSERT(premier->obtenirStockageTransformations() == stockage);
+	CPPUNIT_ASSERT(groupe->obtenirPositionRelative() == glm::dvec3(1.0, 2.0, 3.0));
+	CPPUNIT_ASSERT(premier->obtenirPositionRelative() == glm::dvec3(-1.0, 0.0, 1.0));
+
+	// Un noeud ajout par la suite est plac dans le stockage
+	NoeudAbstrait* second{ new NoeudConeCube{ cube } };
+	second->assignerPositionRelative({ 0.0, 5.0, 0.0 });
+	groupe->ajouter(second);
+	CPPUNIT_ASSERT(second->obtenirStockageTransformations() == stockage);
+	CPPUNIT_ASSERT(stockage->obtenirNombreTransformations() == 3);
+
+	// Un traitement de masse est visible depuis les noeuds, et rend
+	// primes les matrices monde dj calcules
+	CPPUNIT_ASSERT(glm::dvec3(second->obtenirMatriceMonde()[3]) == glm::dvec3(1.0, 7.0, 3.0));
+	stockage->translater({ 1.0, 1.0, 1.0 });
+	CPPUNIT_ASSERT(second->obtenirPositionRelative() == glm::dvec3(1.0, 6.0, 1.0));
+	CPPUNIT_ASSERT(stockage->obtenirPositions()[premier->obtenirIndiceTransformation()] == glm::dvec3(0.0, 1.0, 2.0));
+	CPPUNIT_ASSERT(glm::dvec3(second->obtenirMatriceMonde()[3]) == glm::dvec3(3.0, 9.0, 5.0));
+	CPPUNIT_ASSERT(glm::dvec3(groupe->obtenirMatriceMonde()[3]) == glm::dvec3(2.0, 3.0, 4.0));
+
+	const utilitaire::StockageTransformations::Indice indiceGroupe{ groupe->obtenirIndiceTransformation() };
+	stockage->modifierPositions([indiceGroupe](glm::dvec3* positions, std::size_t) {
+		positions[indiceGroupe] = glm::dvec3{ 0.0 };
+	});
+	CPPUNIT_ASSERT(glm::dvec3(second->obtenirMatriceMonde()[3]) == glm::dvec3(1.0, 6.0, 1.0));
+
+	arbre->translaterPositions({ 0.0, 0.0, 1.0 });
+	CPPUNIT_ASSERT(glm::dvec3(second->obtenirMatriceMonde()[3]) == glm::dvec3(1.0, 6.0, 3.0));
+
+	// L'indice d'un noeud dtruit est rutilis
+	const utilitaire::StockageTransformations::Indice indice{ premier->obtenirIndiceTransformation() };
+	groupe->effacer(premier);
+	CPPUNIT_ASSERT(stockage->obtenirNombreTransformations() == 2);
+	NoeudAbstrait* troisieme{ new NoeudConeCube{ cube } };
+	groupe->ajouter(troisieme);
+	CPPUNIT_ASSERT(troisieme->obtenirIndiceTransformation() == indice);
+	CPPUNIT_ASSERT(stockage->obtenirTaille() == 3);
+
+	// Dsactivation: les noeuds reprennent leur position
+	arbre->activerStockageTransformations(false);
+	CPPUNIT_ASSERT(arbre->obtenirStockageTransformations() == nullptr);
+	CPPUNIT_ASSERT(second->obtenirStockageTransformations() == nullptr);
+	CPPUNIT_ASSERT(second->obtenirPositionRelative() == glm::dvec3(1.0, 6.0, 2.0));
+
+	// Le dplacement en masse fonctionne aussi sans stockage contigu
+	arbre->translaterPositions({ 0.0, 0.0, -1.0 });
+	CPPUNIT_ASSERT(glm::dvec3(second->obtenirMatriceMonde()[3]) == glm::dvec3(1.0, 6.0, 1.0));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testAnimationParallele()
+///
+/// Cas de test: le nombre de descendants est tenu  jour et une
+/// animation dcoupe en tches anime tous les noeuds exactement une
+/// fois, avec le mme rsultat qu'une animation sur un seul fil.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testAnimationParallele()
+{
+	const std::string& araignee{ ArbreRenduINF2990::NOM_ARAIGNEE };
+	const unsigned int seuil{ NoeudComposite::obtenirSeuilAnimationParallele() };
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+	const bool monoFil{ ordonnanceur->estMonoFil() };
+	NoeudComposite::assignerSeuilAnimationParallele(4);
+
+	// Deux arbres identiques de 10 araignes ayant chacune 5 enfants
+	ArbreRendu parallele;
+	ArbreRendu sequentiel;
+	for (ArbreRendu* cible : { &parallele, &sequentiel }) {
+		for (int i = 0; i < 10; ++i) {
+			NoeudAbstrait* parent{ new NoeudAraignee{ araignee } };
+			for (int j = 0; j < 5; ++j)
+				parent->ajouter(new NoeudAraignee{ araignee });
+			cible->ajouter(parent);
+		}
+	}
+	CPPUNIT_ASSERT(parallele.obtenirNombreDescendants() == 60);
+	CPPUNIT_ASSERT(parallele.chercher(0u)->obtenirNombreDescendants() == 5);
+
+	ordonnanceur->assignerMonoFil(false);
+	parallele.animer(1.0f);
+	ordonnanceur->assignerMonoFil(true);
+	sequentiel.animer(1.0f);
+
+	// Une araigne anime une seule fois pendant une seconde a fait le
+	// quart d'une rvolution.
+	const std::vector<NoeudAbstrait*>& noeudsParallele = parallele.obtenirNoeuds(araignee);
+	const std::vector<NoeudAbstrait*>& noeudsSequentiel = sequentiel.obtenirNoeuds(araignee);
+	CPPUNIT_ASSERT(noeudsParallele.size() == noeudsSequentiel.size());
+	for (std::size_t i = 0; i < noeudsParallele.size(); ++i) {
+		const glm::dvec3& position = noeudsParallele[i]->obtenirPositionRelative();
+		CPPUNIT_ASSERT(position == noeudsSequentiel[i]->obtenirPositionRelative());
+		CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(position[1] - 40.0));
+	}
+
+	// Les retraits sont aussi compts
+	parallele.effacer(parallele.chercher(0u));
+	CPPUNIT_ASSERT(parallele.obtenirNombreDescendants() == 54);
+
+	ordonnanceur->assignerMonoFil(monoFil);
+	NoeudComposite::assignerSeuilAnimationParallele(seuil);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testParcoursProfond()
+///
+/// Cas de test: les parcours de l'arbre et sa destruction fonctionnent
+/// sur une chane de 10 000 noeuds, trop profonde pour des appels
+/// rcursifs.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testParcoursProfond()
+{
+	const unsigned int profondeur{ 10000 };
+
+	NoeudAbstrait* parent{ arbre.get() };
+	for (unsigned int i = 0; i < profondeur; ++i) {
+		NoeudAbstrait* enfant{ new NoeudComposite{ "composite" } };
+		parent->ajouter(enfant);
+		parent = enfant;
+	}
+	NoeudAbstrait* feuille{ new NoeudAbstrait{ "feuille" } };
+	parent->ajouter(feuille);
+	feuille->assignerPositionRelative({ 1.0, 2.0, 3.0 });
+
+	CPPUNIT_ASSERT(arbre->calculerProfondeur() == profondeur + 2);
+	CPPUNIT_ASSERT(arbre->NoeudComposite::chercher("feuille") == feuille);
+	CPPUNIT_ASSERT(arbre->NoeudComposite::chercher("inexistant") == nullptr);
+	CPPUNIT_ASSERT(!arbre->selectionExiste());
+	CPPUNIT_ASSERT(feuille->obtenirMatriceMonde()[3][2] == 3.0);
+
+	// La slection et le mode d'affichage atteignent la feuille
+	feuille->assignerSelection(true);
+	CPPUNIT_ASSERT(arbre->selectionExiste());
+	arbre->deselectionnerTout();
+	CPPUNIT_ASSERT(!feuille->estSelectionne());
+	arbre->assignerModePolygones(GL_LINE);
+	arbre->changerModePolygones(true);
+	CPPUNIT_ASSERT(!arbre->selectionExiste());
+
+	// Un dplacement de la racine invalide la matrice de la feuille
+	arbre->chercher(0u)->assignerPositionRelative({ 0.0, 0.0, 1.0 });
+	CPPUNIT_ASSERT(feuille->obtenirMatriceMonde()[3][2] == 4.0);
+
+	arbre->animer(1.0f);
+
+	// La destruction n'est pas rcursive non plus
+	arbre->vider();
+	CPPUNIT_ASSERT(arbre->obtenirNombreEnfants() == 0);
+	CPPUNIT_ASSERT(arbre->obtenirNombreDescendants() == 0);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds("composite").empty());
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testEnsembleSelection()
+///
+/// Cas de test: l'ensemble des noeuds slectionns suit les changements
+/// de slection, les ajouts et les retraits de noeuds.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testEnsembleSelection()
+{
+	const ArbreRendu::EnsembleSelection& selection = arbre->obtenirSelection();
+	NoeudAbstrait* parent{ new NoeudComposite{ "composite" } };
+	NoeudAbstrait* enfant{ new NoeudAbstrait{ "feuille" } };
+	NoeudAbstrait* autre{ new NoeudAbstrait{ "feuille" } };
+	parent->ajouter(enfant);
+	arbre->ajouter(parent);
+	arbre->ajouter(autre);
+	CPPUNIT_ASSERT(!arbre->selectionExiste());
+
+	// Les changements de slection sont signals  la racine
+	enfant->assignerSelection(true);
+	autre->inverserSelection();
+	CPPUNIT_ASSERT(arbre->selectionExiste());
+	CPPUNIT_ASSERT(selection.size() == 2);
+	CPPUNIT_ASSERT(selection.count(enfant) == 1 && selection.count(autre) == 1);
+
+	autre->assignerEstSelectionnable(false);
+	CPPUNIT_ASSERT(selection.size() == 1);
+	autre->assignerEstSelectionnable(true);
+
+	// Un sous-arbre ajout avec des noeuds dj slectionns
+	NoeudAbstrait* ajout{ new NoeudComposite{ "composite" } };
+	NoeudAbstrait* petitEnfant{ new NoeudAbstrait{ "feuille" } };
+	ajout->ajouter(petitEnfant);
+	petitEnfant->assignerSelection(true);
+	CPPUNIT_ASSERT(selection.size() == 1);
+	arbre->ajouter(ajout);
+	CPPUNIT_ASSERT(selection.size() == 2);
+	CPPUNIT_ASSERT(selection.count(petitEnfant) == 1);
+
+	// Un sous-arbre retir emporte ses noeuds slectionns
+	arbre->effacer(parent);
+	CPPUNIT_ASSERT(selection.size() == 1);
+
+	arbre->selectionnerTout();
+	// La racine n'est pas slectionnable
+	CPPUNIT_ASSERT(selection.size() == arbre->obtenirNombreDescendants());
+	arbre->deselectionnerTout();
+	CPPUNIT_ASSERT(selection.empty());
+	CPPUNIT_ASSERT(!arbre->selectionExiste());
+	CPPUNIT_ASSERT(!petitEnfant->estSelectionne());
+
+	// L'effacement de la slection vide l'ensemble
+	autre->assignerSelection(true);
+	petitEnfant->assignerSelection(true);
+	arbre->effacerSelection();
+	CPPUNIT_ASSERT(selection.empty());
+	CPPUNIT_ASSERT(arbre->obtenirNombreDescendants() == 1);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testRegistreTypes()
+///
+/// Cas de test: un mme nom de type donne toujours le mme identifiant,
+/// et les recherches par nom et par identifiant concordent.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testRegistreTypes()
+{
+	NoeudAbstrait* premier{ new NoeudAbstrait{ "typeTest" } };
+	NoeudAbstrait* second{ new NoeudAbstrait{ "typeTest" } };
+	NoeudAbstrait* autre{ new NoeudAbstrait{ "autreTypeTest" } };
+	arbre->ajouter(premier);
+	arbre->ajouter(second);
+	arbre->ajouter(autre);
+
+	const RegistreTypes::Identifiant type{ premier->obtenirIdentifiantType() };
+	CPPUNIT_ASSERT(second->obtenirIdentifiantType() == type);
+	CPPUNIT_ASSERT(autre->obtenirIdentifiantType() != type);
+	CPPUNIT_ASSERT(RegistreTypes::obtenirIdentifiant("typeTest") == type);
+	CPPUNIT_ASSERT(RegistreTypes::enregistrer("typeTest") == type);
+	CPPUNIT_ASSERT(RegistreTypes::obtenirNom(type) == "typeTest");
+	CPPUNIT_ASSERT(premier->obtenirType() == "typeTest");
+	CPPUNIT_ASSERT(type < RegistreTypes::obtenirNombreTypes());
+
+	// Un nom jamais enregistr ne correspond  aucun noeud
+	CPPUNIT_ASSERT(RegistreTypes::obtenirIdentifiant("typeInexistant") == RegistreTypes::INCONNU);
+	CPPUNIT_ASSERT(arbre->chercher("typeInexistant") == nullptr);
+	CPPUNIT_ASSERT(arbre->NoeudComposite::chercher("typeInexistant") == nullptr);
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds("typeInexistant").empty());
+	CPPUNIT_ASSERT(arbre->creerNoeud("typeInexistant") == nullptr);
+
+	CPPUNIT_ASSERT(&arbre->obtenirNoeuds(type) == &arbre->obtenirNoeuds("typeTest"));
+	CPPUNIT_ASSERT(arbre->obtenirNoeuds(type).size() == 2);
+	CPPUNIT_ASSERT(arbre->NoeudComposite::chercher("autreTypeTest") == autre);
+
+	// Un type sans usine ne permet pas de crer de noeud
+	CPPUNIT_ASSERT(arbre->creerNoeud(type) == nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testPoignees()
+///
+/// Cas de test: chaque noeud ajout reoit une poigne qui le dsigne
+/// jusqu' son retrait, aprs quoi la poigne est dtecte comme
+/// prime, mme si son crneau est rutilis.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testPoignees()
+{
+	NoeudAbstrait* parent{ new NoeudComposite{ "composite" } };
+	NoeudAbstrait* enfant{ new NoeudAbstrait{ "feuille" } };
+	parent->ajouter(enfant);
+	CPPUNIT_ASSERT(enfant->obtenirPoignee().estNulle());
+
+	arbre->ajouter(parent);
+	const utilitaire::Poignee poigneeParent{ parent->obtenirPoignee() };
+	const utilitaire::Poignee poigneeEnfant{ enfant->obtenirPoignee() };
+	CPPUNIT_ASSERT(!poigneeParent.estNulle() && !poigneeEnfant.estNulle());
+	CPPUNIT_ASSERT(poigneeParent != poigneeEnfant);
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeParent) == parent);
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeEnfant) == enfant);
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(utilitaire::Poignee{}) == nullptr);
+
+	// L'effacement du parent prime les deux poignes
+	CPPUNIT_ASSERT(arbre->effacer(poigneeParent));
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeParent) == nullptr);
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeEnfant) == nullptr);
+	CPPUNIT_ASSERT(!arbre->effacer(poigneeEnfant));
+
+	// Un crneau rutilis ne ranime pas une ancienne poigne
+	NoeudAbstrait* nouveau{ new NoeudAbstrait{ "feuille" } };
+	arbre->ajouter(nouveau);
+	const utilitaire::Poignee poigneeNouveau{ nouveau->obtenirPoignee() };
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeNouveau) == nouveau);
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeParent) == nullptr);
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeEnfant) == nullptr);
+
+	arbre->vider();
+	arbre->compacterPoignees();
+	CPPUNIT_ASSERT(arbre->obtenirNoeud(poigneeNouveau) == nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testEliminationHorsChamp()
+///
+/// Cas de test: la sphre englobante d'un composite contient celles de
+/// ses descendants, et un sous-arbre dont la sphre est hors du frustum
+/// est limin au complet, alors qu'un noeud qui chevauche le frustum
+/// est affich.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testEliminationHorsChamp()
+{
+	// Frustum orthogonal de 200 units de ct centr  l'origine
+	const vue::Frustum frustum{ glm::ortho(-100.0, 100.0, -100.0, 100.0, -100.0, 100.0) };
+	CPPUNIT_ASSERT(frustum.classerSphere(glm::dvec3{ 0, 0, 0 }, 10.0) == vue::Frustum::INTERIEUR);
+	CPPUNIT_ASSERT(frustum.classerSphere(glm::dvec3{ 100, 0, 0 }, 5.0) == vue::Frustum::INTERSECTION);
+	CPPUNIT_ASSERT(frustum.classerSphere(glm::dvec3{ 0, -120, 0 }, 5.0) == vue::Frustum::EXTERIEUR);
+	CPPUNIT_ASSERT(frustum.classerBoite(glm::dvec3{ 90, 90, 0 }, glm::dvec3{ 110, 110, 10 }) == vue::Frustum::INTERSECTION);
+	CPPUNIT_ASSERT(frustum.classerBoite(glm::dvec3{ 200, 0, 0 }, glm::dvec3{ 210, 10, 10 }) == vue::Frustum::EXTERIEUR);
+
+	// Un groupe visible, un groupe hors champ et une feuille  la limite
+	const double positions[]{ -10.0, 10.0, 500.0, 510.0, 520.0 };
+	NoeudAbstrait* visible{ new NoeudComposite{ "groupe" } };
+	NoeudAbstrait* horsChamp{ new NoeudComposite{ "groupe" } };
+	horsChamp->assignerPositionRelative(glm::dvec3{ 500, 0, 0 });
+	for (int i = 0; i < 5; ++i) {
+		NoeudAbstrait* feuille{ new NoeudAbstrait{ "feuille" } };
+		feuille->assignerObjetRendu(nullptr, nullptr, 5.0);
+		feuille->assignerPositionRelative(glm::dvec3{ positions[i] - (i < 2 ? 0.0 : 500.0), 0, 0 });
+		(i < 2 ? visible : horsChamp)->ajouter(feuille);
+	}
+	NoeudAbstrait* limite{ new NoeudAbstrait{ "feuille" } };
+	limite->assignerObjetRendu(nullptr, nullptr, 5.0);
+	limite->assignerPositionRelative(glm::dvec3{ 0, 102, 0 });
+	arbre->ajouter(visible);
+	arbre->ajouter(horsChamp);
+	arbre->ajouter(limite);
+
+	arbre->afficherVisibles(frustum, glm::dmat4{ 1.0 });
+	CPPUNIT_ASSERT(arbre->obtenirNombreNoeudsAffiches() == 5);
+	CPPUNIT_ASSERT(arbre->obtenirNombreNoeudsElimines() == 4);
+
+	// La sphre du groupe hors champ contient celles de ses feuilles
+	for (unsigned int i = 0; i < horsChamp->obtenirNombreEnfants(); ++i) {
+		const NoeudAbstrait* feuille{ horsChamp->chercher(i) };
+		const double distance{ glm::length(
+			feuille->obtenirCentreVolumeEnglobant() - horsChamp->obtenirCentreVolumeEnglobant()
+			) };
+		CPPUNIT_ASSERT(distance + feuille->obtenirRayonVolumeEnglobant() <=
+			horsChamp->obtenirRayonVolumeEnglobant() + 1e-9);
+	}
+
+	// Sans limination, tous les noeuds sont affichs
+	arbre->assignerEliminationHorsChamp(false);
+	arbre->afficherVisibles(frustum, glm::dmat4{ 1.0 });
+	CPPUNIT_ASSERT(arbre->obtenirNombreNoeudsAffiches() == 9);
+	CPPUNIT_ASSERT(arbre->obtenirNombreNoeudsElimines() == 0);
+
+	// Le frustum d'une vue qui montre la mme fentre est tir de sa
+	// camra et de sa projection, sans relire les matrices d'OpenGL.
+	const vue::VueOrtho vue{
+		vue::Camera{ glm::dvec3{ 0, 0, 200 }, glm::dvec3{ 0, 0, 0 }, glm::dvec3{ 0, 1, 0 }, glm::dvec3{ 0, 1, 0 } },
+		vue::ProjectionOrtho{
+			0, 500, 0, 500,
+			1, 1000, 1, 10000, 1.25,
+			-100, 100, -100, 100 }
+	};
+	arbre->assignerEliminationHorsChamp(true);
+	arbre->afficher(vue);
+	CPPUNIT_ASSERT(arbre->obtenirNombreNoeudsAffiches() == 5);
+	CPPUNIT_ASSERT(arbre->obtenirNombreNoeudsElimines() == 4);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreRenduTest::testRequetesSpatiales()
+///
+/// Cas de test: la hirarchie des volumes suit les ajouts, les
+/// dplacements et les retraits de noeuds, et ses requtes par bote,
+/// par rayon et des plus proches voisins donnent les mmes noeuds qu'un
+/// parcours exhaustif.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreRenduTest::testRequetesSpatiales()
+{
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<double> coordonnee{ -500.0, 500.0 };
+	auto positionAleatoire = [&]() {
+		return glm::dvec3{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+	};
+
+	// Des noeuds sous des groupes dplacs, qui n'ont pas de volume
+	std::vector<NoeudAbstrait*> feuilles;
+	for (int i = 0; i < 10; ++i) {
+		NoeudAbstrait* groupe{ new NoeudComposite{ "groupe" } };
+		groupe->assignerPositionRelative(glm::dvec3{ 10.0 * i, 0, 0 });
+		for (int j = 0; j < 50; ++j) {
+			NoeudAbstrait* feuille{ new NoeudAbstrait{ "feuille" } };
+			feuille->assignerObjetRendu(nullptr, nullptr, 1.0 + j % 7);
+			feuille->assignerPositionRelative(positionAleatoire());
+			groupe->ajouter(feuille);
+			feuilles.push_back(feuille);
+		}
+		arbre->ajouter(groupe);
+	}
+	CPPUNIT_ASSERT(arbre->obtenirArbreVolumes().obtenirNombreFeuilles() == feuilles.size());
+	CPPUNIT_ASSERT(arbre->obtenirArbreVolumes().obtenirHauteur() < 20);
+
+	// Dplacement d'une partie des noeuds, puis retrait d'un groupe
+	for (std::size_t i = 0; i < feuilles.size(); i += 3)
+		feuilles[i]->assignerPositionRelative(positionAleatoire());
+	arbre->mettreAJourVolumes();
+	NoeudAbstrait* groupeRetire{ arbre->chercher(0u) };
+	feuilles.erase(feuilles.begin(), feuilles.begin() + 50);
+	arbre->effacer(groupeRetire);
+	CPPUNIT_ASSERT(arbre->obtenirArbreVolumes().obtenirNombreFeuilles() == feuilles.size());
+
+	auto centre = [](const NoeudAbstrait* noeud) { return glm::dvec3{ noeud->obtenirMatriceMonde()[3] }; };
+
+	for (int essai = 0; essai < 20; ++essai) {
+		// Bote
+		const glm::dvec3 coin{ positionAleatoire() };
+		const utilitaire::BoiteEnglobante boite{ coin, coin + glm::dvec3{ 200.0 } };
+		std::vector<NoeudAbstrait*> trouves, attendus;
+		arbre->chercherNoeudsDansBoite(boite, trouves);
+		for (NoeudAbstrait* feuille : feuilles) {
+			if (utilitaire::ArbreVolumes<NoeudAbstrait*>::calculerDistance(centre(feuille), boite) <= feuille->obtenirRayonEnglobant())
+				attendus.push_back(feuille);
+		}
+		std::sort(trouves.begin(), trouves.end());
+		std::sort(attendus.begin(), attendus.end());
+		CPPUNIT_ASSERT(trouves == attendus);
+
+		// Plus proches voisins
+		const glm::dvec3 point{ positionAleatoire() };
+		auto distance = [&](const NoeudAbstrait* noeud) {
+			return glm::length(point - centre(noeud)) - noeud->obtenirRayonEnglobant();
+		};
+		std::vector<NoeudAbstrait*> voisins;
+		arbre->chercherNoeudsPlusProches(point, 5, voisins);
+		std::vector<NoeudAbstrait*> tries{ feuilles };
+		std::sort(tries.begin(), tries.end(), [&](const NoeudAbstrait* a, const NoeudAbstrait* b) {
+			return distance(a) < distance(b);
+		});
+		CPPUNIT_ASSERT(voisins.size() == 5);
+		for (int i = 0; i < 5; ++i)
+			CPPUNIT_ASSERT(std::abs(distance(voisins[i]) - distance(tries[i])) < 1e-9);
+
+		// Rayon visant le centre d'une feuille, depuis l'extrieur du nuage
+		NoeudAbstrait* cible{ feuilles[generateur() % feuilles.size()] };
+		const glm::dvec3 origine{ 0.0, 0.0, 2000.0 };
+		const glm::dvec3 direction{ glm::normalize(centre(cible) - origine) };
+		NoeudAbstrait* touche{ arbre->chercherNoeudSurRayon(origine, direction) };
+		CPPUNIT_ASSERT(touche != nullptr);
+		double meilleure{ glm::length(centre(cible) - origine) };
+		for (NoeudAbstrait* feuille : feuilles) {
+			const glm::dvec3 ecart{ centre(feuille) - origine };
+			const double projection{ glm::dot(ecart, direction) };
+			const double rayon{ feuille->obtenirRayonEnglobant() };
+			const double d2{ glm::dot(ecart, ecart) - projection * projection };
+			if (projection > 0.0 && d2 <= rayon * rayon) {
+				const double entree{ projection - sqrt(rayon * rayon - d2) };
+				if (entree < meilleure)
+					meilleure = entree;
+			}
+		}
+		const glm::dvec3 ecartTouche{ centre(touche) - origine };
+		const double projectionTouche{ glm::dot(ecartTouche, direction) };
+		const double d2Touche{ glm::dot(ecartTouche, ecartTouche) - projectionTouche * projectionTouche };
+		const double rayonTouche{ touche->obtenirRayonEnglobant() };
+		CPPUNIT_ASSERT(std::abs(projectionTouche - sqrt(rayonTouche * rayonTouche - d2Touche) - meilleure) < 1e-6);
+	}
+
+	arbre->vider();
+	CPPUNIT_ASSERT(arbre->obtenirArbreVolumes().obtenirNombreFeuilles() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file ArbreRenduTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_ARBRERENDUTEST_H
+#define _TESTS_ARBRERENDUTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <memory>
+
+class ArbreRendu;
+
+///////////////////////////////////////////////////////////////////////////
+/// @class ArbreRenduTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        mthodes de la classe ArbreRendu
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class ArbreRenduTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( ArbreRenduTest );
+	CPPUNIT_TEST( testIndexAjout );
+	CPPUNIT_TEST( testIndexRetrait );
+	CPPUNIT_TEST( testEffacerSelectionOrdre );
+	CPPUNIT_TEST( testStockageTransformations );
+	CPPUNIT_TEST( testAnimationParallele );
+	CPPUNIT_TEST( testParcoursProfond );
+	CPPUNIT_TEST( testEnsembleSelection );
+	CPPUNIT_TEST( testRegistreTypes );
+	CPPUNIT_TEST( testPoignees );
+	CPPUNIT_TEST( testEliminationHorsChamp );
+	CPPUNIT_TEST( testRequetesSpatiales );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: l'index des types suit les ajouts de noeuds
+	void testIndexAjout();
+
+	/// Cas de test: l'index des types suit les retraits de noeuds
+	void testIndexRetrait();
+
+	/// Cas de test: effacerSelection() prserve l'ordre des enfants conservs
+	void testEffacerSelectionOrdre();
+
+	/// Cas de test: les positions passent par le stockage contigu
+	void testStockageTransformations();
+
+	/// Cas de test: l'animation parallle donne le mme rsultat que sur un seul fil
+	void testAnimationParallele();
+
+	/// Cas de test: les parcours supportent un arbre trs profond
+	void testParcoursProfond();
+
+	/// Cas de test: l'ensemble des noeuds slectionns est tenu  jour
+	void testEnsembleSelection();
+
+	/// Cas de test: les types sont identifis par des entiers
+	void testRegistreTypes();
+
+	/// Cas de test: les poignes primes sont dtectes
+	void testPoignees();
+
+	/// Cas de test: les sous-arbres hors du frustum ne sont pas affichs
+	void testEliminationHorsChamp();
+
+	/// Cas de test: les requtes spatiales donnent les mmes noeuds qu'un parcours exhaustif
+	void testRequetesSpatiales();
+
+private:
+	/// Instance d'un arbre de rendu
+	std::unique_ptr<ArbreRendu> arbre;
+};
+
+#endif // _TESTS_ARBRERENDUTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file ArbreTrianglesTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "ArbreTrianglesTest.h"
+#include "ArbreTriangles.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(ArbreTrianglesTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void construireCube(modele::ArbreTriangles& arbre)
+///
+/// Construit la hirarchie d'un cube centr  l'origine, de ct 2, dont
+/// chaque face carre est forme de deux triangles.
+///
+/// @param[out] arbre : La hirarchie  construire.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+static void construireCube(modele::ArbreTriangles& arbre)
+{
+	std::vector<modele::ArbreTriangles::Sommet> sommets;
+	for (int i = 0; i < 8; ++i)
+		sommets.push_back(modele::ArbreTriangles::Sommet{ i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f });
+
+	const std::vector<modele::ArbreTriangles::Face> faces{
+		{ 0, 1, 3 }, { 0, 3, 2 }, { 4, 5, 7 }, { 4, 7, 6 },
+		{ 0, 1, 5 }, { 0, 5, 4 }, { 2, 3, 7 }, { 2, 7, 6 },
+		{ 0, 2, 6 }, { 0, 6, 4 }, { 1, 3, 7 }, { 1, 7, 5 }
+	};
+	arbre.construire(sommets, faces);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreTrianglesTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreTrianglesTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreTrianglesTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreTrianglesTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreTrianglesTest::testConstruction()
+///
+/// Cas de test: une hirarchie vide ne touche rien, et une hirarchie
+/// construite conserve tous ses triangles avec un nombre de noeuds
+/// proportionnel au nombre de feuilles.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreTrianglesTest::testConstruction()
+{
+	modele::ArbreTriangles arbre;
+	CPPUNIT_ASSERT(arbre.estVide());
+	CPPUNIT_ASSERT(arbre.calculerCollisionSphere(glm::dvec3{ 0.0 }, 1.0).type == aidecollision::COLLISION_AUCUNE);
+	CPPUNIT_ASSERT(arbre.calculerImpactRayon(glm::dvec3{ 0.0 }, glm::dvec3{ 1.0, 0.0, 0.0 }).type == aidecollision::COLLISION_AUCUNE);
+
+	construireCube(arbre);
+	CPPUNIT_ASSERT(!arbre.estVide());
+	CPPUNIT_ASSERT(arbre.obtenirNombreTriangles() == 12);
+	CPPUNIT_ASSERT(arbre.obtenirNombreNoeuds() < 2 * 12 / modele::ArbreTriangles::TRIANGLES_PAR_FEUILLE + 2);
+	CPPUNIT_ASSERT(arbre.obtenirMemoire() > 0);
+
+	arbre.vider();
+	CPPUNIT_ASSERT(arbre.estVide());
+	CPPUNIT_ASSERT(arbre.obtenirNombreNoeuds() == 0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreTrianglesTest::testCollisionSphere()
+///
+/// Cas de test: une sphre qui touche une face, une arte ou un coin du
+/// cube est en collision, avec la direction et l'enfoncement attendus.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreTrianglesTest::testCollisionSphere()
+{
+	modele::ArbreTriangles arbre;
+	construireCube(arbre);
+
+	// Face du dessus.
+	aidecollision::DetailsCollision details{ arbre.calculerCollisionSphere(glm::dvec3{ 0.2, -0.3, 1.3 }, 0.5) };
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_TRIANGLE);
+	CPPUNIT_ASSERT(std::abs(details.enfoncement - 0.2) < 1e-6);
+	CPPUNIT_ASSERT(glm::length(glm::normalize(details.direction) - glm::dvec3{ 0.0, 0.0, 1.0 }) < 1e-6);
+
+	// Arte et coin.
+	details = arbre.calculerCollisionSphere(glm::dvec3{ 1.3, 0.0, 1.4 }, 0.6);
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_TRIANGLE);
+	CPPUNIT_ASSERT(std::abs(details.enfoncement - 0.1) < 1e-6);
+	details = arbre.calculerCollisionSphere(glm::dvec3{ 2.0, 2.0, 2.0 }, 1.0);
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_AUCUNE);
+	details = arbre.calculerCollisionSphere(glm::dvec3{ 1.5, 1.5, 1.5 }, 1.0);
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_TRIANGLE);
+	CPPUNIT_ASSERT(std::abs(details.enfoncement - (1.0 - std::sqrt(0.75))) < 1e-6);
+
+	// Une sphre entirement  l'intrieur, loin des faces, ne touche rien.
+	details = arbre.calculerCollisionSphere(glm::dvec3{ 0.0 }, 0.5);
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_AUCUNE);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreTrianglesTest::testImpactRayon()
+///
+/// Cas de test: un rayon qui traverse le cube touche la premire face
+/// rencontre, avec une normale oriente vers son origine, et un rayon
+/// trop court ou qui passe  ct ne touche rien.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreTrianglesTest::testImpactRayon()
+{
+	modele::ArbreTriangles arbre;
+	construireCube(arbre);
+
+	aidecollision::DetailsImpact impact{ arbre.calculerImpactRayon(glm::dvec3{ 0.1, 0.2, 5.0 }, glm::dvec3{ 0.0, 0.0, -10.0 }) };
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_TRIANGLE);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.4) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(impact.position - glm::dvec3{ 0.1, 0.2, 1.0 }) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ 0.0, 0.0, 1.0 }) < 1e-9);
+
+	// Depuis l'intrieur, la normale fait face  l'origine.
+	impact = arbre.calculerImpactRayon(glm::dvec3{ 0.0, 0.3, 0.0 }, glm::dvec3{ -4.0, 0.0, 0.0 });
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_TRIANGLE);
+	CPPUNIT_ASSERT(std::abs(impact.instant - 0.25) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(impact.normale - glm::dvec3{ 1.0, 0.0, 0.0 }) < 1e-9);
+
+	// Trop court, ou  ct.
+	impact = arbre.calculerImpactRayon(glm::dvec3{ 0.0, 0.0, 5.0 }, glm::dvec3{ 0.0, 0.0, -3.0 });
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+	CPPUNIT_ASSERT(impact.instant == 1.0);
+	impact = arbre.calculerImpactRayon(glm::dvec3{ 1.5, 0.0, 5.0 }, glm::dvec3{ 0.0, 0.0, -10.0 });
+	CPPUNIT_ASSERT(impact.type == aidecollision::COLLISION_AUCUNE);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ArbreTrianglesTest::testComparaisonExhaustive()
+///
+/// Cas de test: sur un nuage de triangles alatoires, les requtes de la
+/// hirarchie donnent les mmes rsultats que le test de chacun des
+/// triangles, chacun plac seul dans sa propre hirarchie.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ArbreTrianglesTest::testComparaisonExhaustive()
+{
+	std::mt19937 generateur{ 17 };
+	std::uniform_real_distribution<float> position{ -10.0f, 10.0f };
+	std::uniform_real_distribution<float> taille{ -1.5f, 1.5f };
+
+	std::vector<modele::ArbreTriangles::Sommet> sommets;
+	std::vector<modele::ArbreTriangles::Face> faces;
+	std::vector<modele::ArbreTriangles> seuls(300);
+	for (int i = 0; i < 300; ++i) {
+		const modele::ArbreTriangles::Sommet centre{ position(generateur), position(generateur), position(generateur) };
+		std::vector<modele::ArbreTriangles::Sommet> triangle;
+		for (int j = 0; j < 3; ++j)
+			triangle.push_back(centre + modele::ArbreTriangles::Sommet{ taille(generateur), taille(generateur), taille(generateur) });
+
+		sommets.insert(sommets.end(), triangle.begin(), triangle.end());
+		faces.push_back(modele::ArbreTriangles::Face{ 3 * i, 3 * i + 1, 3 * i + 2 });
+		seuls[i].construire(triangle, std::vector<modele::ArbreTriangles::Face>{ modele::ArbreTriangles::Face{ 0, 1, 2 } });
+	}
+
+	modele::ArbreTriangles arbre;
+	arbre.construire(sommets, faces);
+	CPPUNIT_ASSERT(arbre.obtenirNombreTriangles() == 300);
+
+	int nombreCollisions{ 0 };
+	int nombreImpacts{ 0 };
+	std::uniform_real_distribution<double> coordonnee{ -12.0, 12.0 };
+	for (int i = 0; i < 500; ++i) {
+		const glm::dvec3 point{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+
+		// Le contact le plus profond parmi tous les triangles.
+		const double rayon{ 1.0 + (i % 3) };
+		double enfoncement{ 0.0 };
+		for (modele::ArbreTriangles const& seul : seuls) {
+			const aidecollision::DetailsCollision details{ seul.calculerCollisionSphere(point, rayon) };
+			if (details.type != aidecollision::COLLISION_AUCUNE && details.enfoncement > enfoncement)
+				enfoncement = details.enfoncement;
+		}
+		const aidecollision::DetailsCollision details{ arbre.calculerCollisionSphere(point, rayon) };
+		CPPUNIT_ASSERT((details.type != aidecollision::COLLISION_AUCUNE) == (enfoncement > 0.0));
+		if (enfoncement > 0.0) {
+			CPPUNIT_ASSERT(std::abs(details.enfoncement - enfoncement) < 1e-9);
+			++nombreCollisions;
+		}
+
+		// Le premier impact parmi tous les triangles.
+		const glm::dvec3 deplacement{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+		double instant{ 1.0 };
+		for (modele::ArbreTriangles const& seul : seuls) {
+			const aidecollision::DetailsImpact impact{ seul.calculerImpactRayon(point, deplacement) };
+			if (impact.type != aidecollision::COLLISION_AUCUNE && impact.instant < instant)
+				instant = impact.instant;
+		}
+		const aidecollision::DetailsImpact impact{ arbre.calculerImpactRayon(point, deplacement) };
+		CPPUNIT_ASSERT(impact.instant == instant);
+		if (impact.type != aidecollision::COLLISION_AUCUNE)
+			++nombreImpacts;
+	}
+
+	// Les requtes ont rellement trouv des contacts.
+	CPPUNIT_ASSERT(nombreCollisions > 20);
+	CPPUNIT_ASSERT(nombreImpacts > 20);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file ArbreTrianglesTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_ARBRETRIANGLESTEST_H
+#define _TESTS_ARBRETRIANGLESTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class ArbreTrianglesTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        collisions contre la hirarchie des triangles d'un modle 3D.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class ArbreTrianglesTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( ArbreTrianglesTest );
+	CPPUNIT_TEST( testConstruction );
+	CPPUNIT_TEST( testCollisionSphere );
+	CPPUNIT_TEST( testImpactRayon );
+	CPPUNIT_TEST( testComparaisonExhaustive );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: taille et mmoire de la hirarchie construite
+	void testConstruction();
+
+	/// Cas de test: collisions d'objets sphriques avec un cube
+	void testCollisionSphere();
+
+	/// Cas de test: impacts de rayons avec un cube
+	void testImpactRayon();
+
+	/// Cas de test: la hirarchie donne les mmes rsultats qu'un
+	/// parcours de tous les triangles
+	void testComparaisonExhaustive();
+
+};
+
+#endif // _TESTS_ARBRETRIANGLESTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file CacheContactsTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "CacheContactsTest.h"
+#include "CacheContacts.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(CacheContactsTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheContactsTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheContactsTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheContactsTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheContactsTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheContactsTest::testSeparation()
+///
+/// Cas de test: deux sphres spares de 3 units qui se rapprochent
+/// d'une unit par sous-pas ne sont recalcules qu'une fois la distance
+/// franchie, et la collision est alors dtecte.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheContactsTest::testSeparation()
+{
+	aidecollision::CacheContacts cache;
+	const aidecollision::CacheContacts::Paire paire{ 0, 1 };
+
+	glm::dvec3 position{ 5.0, 0.0, 0.0 };
+	int nombreCalculs{ 0 };
+	auto calculer = [&]() {
+		++nombreCalculs;
+		return aidecollision::calculerCollisionSphere(glm::dvec3{ 0.0 }, 1.0, position, 1.0);
+	};
+
+	aidecollision::DetailsCollision details{ cache.calculerCollision(paire, calculer) };
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_AUCUNE);
+	CPPUNIT_ASSERT(nombreCalculs == 1);
+
+	// Deux sous-pas ne suffisent pas  franchir les 3 units.
+	for (int i = 0; i < 2; ++i) {
+		position.x -= 1.0;
+		cache.deplacer(1, 1.0);
+		details = cache.calculerCollision(paire, calculer);
+		CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_AUCUNE);
+		CPPUNIT_ASSERT(std::abs(details.enfoncement + 2.0 - i) < 1e-12);
+	}
+	CPPUNIT_ASSERT(nombreCalculs == 1);
+
+	// Au troisime, les sphres pourraient se toucher.
+	position.x -= 1.5;
+	cache.deplacer(1, 1.5);
+	details = cache.calculerCollision(paire, calculer);
+	CPPUNIT_ASSERT(nombreCalculs == 2);
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_SPHERE);
+	CPPUNIT_ASSERT(std::abs(details.enfoncement - 0.5) < 1e-12);
+
+	const aidecollision::CacheContacts::Statistiques& statistiques{ cache.obtenirStatistiques() };
+	CPPUNIT_ASSERT(statistiques.nombreRequetes == 4);
+	CPPUNIT_ASSERT(statistiques.nombreSeparations == 2);
+	CPPUNIT_ASSERT(statistiques.nombreCalculs == 2);
+	CPPUNIT_ASSERT(statistiques.obtenirTauxSucces() == 0.5);
+
+	// Une paire oublie est recalcule.
+	cache.commencerImage();
+	CPPUNIT_ASSERT(cache.obtenirStatistiques().nombreRequetes == 0);
+	cache.retirerPaires(std::vector<aidecollision::CacheContacts::Paire>{ paire });
+	CPPUNIT_ASSERT(cache.obtenirNombrePaires() == 0);
+	cache.calculerCollision(paire, calculer);
+	CPPUNIT_ASSERT(nombreCalculs == 3);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheContactsTest::testRepos()
+///
+/// Cas de test: un contact dont les objets n'ont pas boug, ou ont boug
+/// moins que la tolrance de repos, est repris tel quel.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheContactsTest::testRepos()
+{
+	aidecollision::CacheContacts cache{ 0.01 };
+	const aidecollision::CacheContacts::Paire paire{ 2, 7 };
+
+	int nombreCalculs{ 0 };
+	auto calculer = [&]() {
+		++nombreCalculs;
+		return aidecollision::calculerCollisionSphere(glm::dvec3{ 0.0 }, 1.0, glm::dvec3{ 0.0, 1.5, 0.0 }, 1.0);
+	};
+
+	const aidecollision::DetailsCollision premier{ cache.calculerCollision(paire, calculer) };
+	CPPUNIT_ASSERT(premier.type == aidecollision::COLLISION_SPHERE);
+
+	cache.deplacer(7, 0.004);
+	cache.deplacer(2, 0.004);
+	const aidecollision::DetailsCollision repris{ cache.calculerCollision(paire, calculer) };
+	CPPUNIT_ASSERT(nombreCalculs == 1);
+	CPPUNIT_ASSERT(repris.type == premier.type);
+	CPPUNIT_ASSERT(repris.enfoncement == premier.enfoncement);
+	CPPUNIT_ASSERT(repris.direction == premier.direction);
+	CPPUNIT_ASSERT(cache.obtenirStatistiques().nombreRepos == 1);
+
+	// Au-del de la tolrance, le contact est recalcul.
+	cache.deplacer(7, 0.004);
+	cache.calculerCollision(paire, calculer);
+	CPPUNIT_ASSERT(nombreCalculs == 2);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheContactsTest::testSimulation()
+///
+/// Cas de test: des sphres qui se dplacent au hasard, testes contre
+/// des sphres et des segments fixes  chaque sous-pas, obtiennent du
+/// cache exactement les mmes collisions que du calcul exact, tout en
+/// vitant une bonne partie des calculs.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheContactsTest::testSimulation()
+{
+	std::mt19937 generateur{ 18 };
+	std::uniform_real_distribution<double> coordonnee{ -10.0, 10.0 };
+	std::uniform_real_distribution<double> pas{ -0.2, 0.2 };
+
+	// Les objets 0  9 bougent, les objets 10  19 sont fixes.
+	std::vector<glm::dvec3> positions;
+	for (int i = 0; i < 20; ++i)
+		positions.push_back(glm::dvec3{ coordonnee(generateur), coordonnee(generateur), 0.0 });
+
+	aidecollision::CacheContacts cache;
+	unsigned int nombreCollisions{ 0 };
+	for (int image = 0; image < 50; ++image) {
+		cache.commencerImage();
+		for (int sousPas = 0; sousPas < 4; ++sousPas) {
+			for (unsigned int i = 0; i < 10; ++i) {
+				const glm::dvec3 deplacement{ pas(generateur), pas(generateur), 0.0 };
+				positions[i] += deplacement;
+				cache.deplacer(i, glm::length(deplacement));
+			}
+
+			for (unsigned int i = 0; i < 10; ++i) {
+				for (unsigned int j = 10; j < 20; ++j) {
+					// Les objets pairs sont des sphres, les impairs des segments.
+					auto calculer = [&]() {
+						if (j % 2 == 0)
+							return aidecollision::calculerCollisionSphere(positions[j], 1.0, positions[i], 1.5);
+						return aidecollision::calculerCollisionSegment(
+							positions[j], positions[j] + glm::dvec3{ 4.0, 1.0, 0.0 }, positions[i], 1.5, j % 4 == 1);
+					};
+
+					const aidecollision::DetailsCollision exact{ calculer() };
+					const aidecollision::DetailsCollision details{ cache.calculerCollision(
+						aidecollision::CacheContacts::Paire{ i, j }, calculer) };
+					CPPUNIT_ASSERT(details.type == exact.type);
+					if (exact.type != aidecollision::COLLISION_AUCUNE) {
+						CPPUNIT_ASSERT(details.enfoncement == exact.enfoncement);
+						CPPUNIT_ASSERT(details.direction == exact.direction);
+						++nombreCollisions;
+					}
+					else {
+						CPPUNIT_ASSERT(details.enfoncement >= exact.enfoncement);
+					}
+				}
+			}
+		}
+
+		const aidecollision::CacheContacts::Statistiques& statistiques{ cache.obtenirStatistiques() };
+		CPPUNIT_ASSERT(statistiques.nombreRequetes == 400);
+		CPPUNIT_ASSERT(statistiques.nombreRequetes == statistiques.nombreCalculs +
+			statistiques.nombreSeparations + statistiques.nombreRepos);
+		if (image > 0)
+			CPPUNIT_ASSERT(statistiques.obtenirTauxSucces() > 0.5);
+	}
+	CPPUNIT_ASSERT(nombreCollisions > 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
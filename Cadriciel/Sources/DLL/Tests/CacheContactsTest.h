@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file CacheContactsTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_CACHECONTACTSTEST_H
+#define _TESTS_CACHECONTACTSTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class CacheContactsTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement du
+///        cache des rsultats de la phase troite.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class CacheContactsTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( CacheContactsTest );
+	CPPUNIT_TEST( testSeparation );
+	CPPUNIT_TEST( testRepos );
+	CPPUNIT_TEST( testSimulation );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: le calcul exact est vit tant que des objets spars
+	/// n'ont pas pu franchir la distance qui les spare
+	void testSeparation();
+
+	/// Cas de test: un contact au repos est repris sans calcul
+	void testRepos();
+
+	/// Cas de test: au cours d'une simulation, le cache donne les mmes
+	/// collisions que le calcul exact
+	void testSimulation();
+
+};
+
+#endif // _TESTS_CACHECONTACTSTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,374 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file CacheModeleTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "CacheModeleTest.h"
+#include "CacheModele.h"
+#include "Noeud.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(CacheModeleTest);
+
+/// Fichier tenant lieu de modle source pendant les tests.
+static const std::string FICHIER_MODELE{ "CacheModeleTest.obj" };
+/// Fichier cache utilis pendant les tests.
+static const std::string FICHIER_CACHE{ "CacheModeleTest.obj.cache" };
+/// Drapeaux d'importation utiliss pendant les tests.
+static const std::uint64_t DRAPEAUX{ 0x0000000c0008a5ebull };
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void ecrireFichier(const std::string& nomFichier, const std::string& contenu)
+///
+/// Remplace le contenu d'un fichier.
+///
+/// @param[in] nomFichier : Le nom du fichier.
+/// @param[in] contenu    : Le nouveau contenu.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+static void ecrireFichier(const std::string& nomFichier, const std::string& contenu)
+{
+	std::ofstream fichier{ nomFichier, std::ios::out | std::ios::binary | std::ios::trunc };
+	fichier.write(contenu.data(), static_cast<std::streamsize>(contenu.size()));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static std::string lireFichier(const std::string& nomFichier)
+///
+/// Lit tout le contenu d'un fichier.
+///
+/// @param[in] nomFichier : Le nom du fichier.
+///
+/// @return Le contenu du fichier.
+///
+////////////////////////////////////////////////////////////////////////
+static std::string lireFichier(const std::string& nomFichier)
+{
+	std::ifstream fichier{ nomFichier, std::ios::in | std::ios::binary };
+	return std::string{ std::istreambuf_iterator<char>{ fichier }, std::istreambuf_iterator<char>{} };
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static modele::Noeud construireModele()
+///
+/// Construit un modle de deux noeuds: la racine porte un triangle
+/// muni de tous les attributs, et son enfant, dplac, porte un carr
+/// de deux triangles sans attributs facultatifs.
+///
+/// @return Le noeud racine du modle.
+///
+////////////////////////////////////////////////////////////////////////
+static modele::Noeud construireModele()
+{
+	modele::Materiau materiau;
+	materiau.nom_ = "rouge";
+	materiau.diffuse_ = glm::vec3{ 1.0f, 0.0f, 0.0f };
+	materiau.speculaire_ = glm::vec3{ 0.5f, 0.5f, 0.5f };
+	materiau.opacite_ = 0.75f;
+	materiau.shininess_ = 32.0f;
+	materiau.nomTexture_ = "brique.png";
+	materiau.afficherDeuxCotes_ = true;
+
+	modele::Noeud::Conteneur<modele::Mesh> meshesRacine;
+	meshesRacine.emplace_back(
+		modele::Mesh::Conteneur<modele::Mesh::Vertex>{ { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 } },
+		modele::Mesh::Conteneur<modele::Mesh::Normale>{ { 0, 0, 1 }, { 0, 0, 1 }, { 0, 0, 1 } },
+		modele::Mesh::Conteneur<modele::Mesh::TexCoord>{ { 0, 0 }, { 1, 0 }, { 0, 1 } },
+		modele::Mesh::Conteneur<modele::Mesh::Couleur>{ { 1, 0, 0, 1 }, { 0, 1, 0, 1 }, { 0, 0, 1, 1 } },
+		modele::Mesh::Conteneur<modele::Mesh::Face>{ { 0, 1, 2 } },
+		materiau, "triangle");
+
+	modele::Noeud::Conteneur<modele::Mesh> meshesEnfant;
+	meshesEnfant.emplace_back(
+		modele::Mesh::Conteneur<modele::Mesh::Vertex>{ { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 } },
+		modele::Mesh::Conteneur<modele::Mesh::Normale>{},
+		modele::Mesh::Conteneur<modele::Mesh::TexCoord>{},
+		modele::Mesh::Conteneur<modele::Mesh::Couleur>{},
+		modele::Mesh::Conteneur<modele::Mesh::Face>{ { 0, 1, 2 }, { 0, 2, 3 } },
+		modele::Materiau{}, "");
+
+	glm::mat4x4 translation;
+	translation[3] = glm::vec4{ 5.0f, -2.0f, 1.0f, 1.0f };
+
+	modele::Noeud::Conteneur<modele::Noeud> enfants;
+	enfants.emplace_back("enfant", translation, std::move(meshesEnfant), modele::Noeud::Conteneur<modele::Noeud>{});
+
+	return modele::Noeud{ "racine", glm::mat4x4{}, std::move(meshesRacine), std::move(enfants) };
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static bool comparerNoeuds(modele::Noeud const& noeud1, modele::Noeud const& noeud2)
+///
+/// Compare rcursivement deux noeuds, leurs meshes et leurs matriaux.
+///
+/// @param[in] noeud1 : Le premier noeud.
+/// @param[in] noeud2 : Le second noeud.
+///
+/// @return Vrai si les deux noeuds sont identiques.
+///
+////////////////////////////////////////////////////////////////////////
+static bool comparerNoeuds(modele::Noeud const& noeud1, modele::Noeud const& noeud2)
+{
+	if (noeud1.obtenirNom() != noeud2.obtenirNom() ||
+		noeud1.obtenirTransformation() != noeud2.obtenirTransformation() ||
+		noeud1.obtenirMeshes().size() != noeud2.obtenirMeshes().size() ||
+		noeud1.obtenirEnfants().size() != noeud2.obtenirEnfants().size())
+		return false;
+
+	for (std::size_t i = 0; i < noeud1.obtenirMeshes().size(); ++i) {
+		modele::Mesh const& mesh1 = noeud1.obtenirMeshes()[i];
+		modele::Mesh const& mesh2 = noeud2.obtenirMeshes()[i];
+		modele::Materiau const& materiau1 = mesh1.obtenirMateriau();
+		modele::Materiau const& materiau2 = mesh2.obtenirMateriau();
+		if (mesh1.obtenirNom() != mesh2.obtenirNom() ||
+			mesh1.obtenirSommets() != mesh2.obtenirSommets() ||
+			mesh1.obtenirNormales() != mesh2.obtenirNormales() ||
+			mesh1.obtenirTexCoords() != mesh2.obtenirTexCoords() ||
+			mesh1.obtenirCouleurs() != mesh2.obtenirCouleurs() ||
+			mesh1.obtenirFaces() != mesh2.obtenirFaces() ||
+			materiau1.nom_ != materiau2.nom_ ||
+			materiau1.diffuse_ != materiau2.diffuse_ ||
+			materiau1.speculaire_ != materiau2.speculaire_ ||
+			materiau1.opacite_ != materiau2.opacite_ ||
+			materiau1.shininess_ != materiau2.shininess_ ||
+			materiau1.nomTexture_ != materiau2.nomTexture_ ||
+			materiau1.filDeFer_ != materiau2.filDeFer_ ||
+			materiau1.afficherDeuxCotes_ != materiau2.afficherDeuxCotes_)
+			return false;
+	}
+
+	for (std::size_t i = 0; i < noeud1.obtenirEnfants().size(); ++i)
+		if (!comparerNoeuds(noeud1.obtenirEnfants()[i], noeud2.obtenirEnfants()[i]))
+			return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheModeleTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheModeleTest::setUp()
+{
+	ecrireFichier(FICHIER_MODELE, "o triangle\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheModeleTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheModeleTest::tearDown()
+{
+	std::remove(FICHIER_MODELE.c_str());
+	std::remove(FICHIER_CACHE.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheModeleTest::testEcritureLecture()
+///
+/// Cas de test: la hirarchie et les textures lues du cache sont
+/// identiques  celles qui y ont t crites, et les tableaux sont
+/// aligns dans le fichier.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheModeleTest::testEcritureLecture()
+{
+	const modele::Noeud racine{ construireModele() };
+	const std::vector<std::string> textures{ "brique.png", "bois.jpg" };
+	CPPUNIT_ASSERT(modele::CacheModele::obtenirChemin(FICHIER_MODELE).string() == FICHIER_CACHE);
+	CPPUNIT_ASSERT(modele::CacheModele::ecrire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, racine, textures));
+
+	modele::Noeud lue;
+	std::vector<std::string> texturesLues;
+	CPPUNIT_ASSERT(modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, texturesLues));
+	CPPUNIT_ASSERT(texturesLues == textures);
+	CPPUNIT_ASSERT(comparerNoeuds(racine, lue));
+	CPPUNIT_ASSERT(lue.obtenirEnfants()[0].obtenirTransformation()[3] == glm::vec4(5.0f, -2.0f, 1.0f, 1.0f));
+
+	// Les sommets du premier mesh commencent  une position aligne.
+	const std::string contenu{ lireFichier(FICHIER_CACHE) };
+	const std::string sommets(reinterpret_cast<const char*>(racine.obtenirMeshes()[0].obtenirSommets().data()),
+		3 * sizeof(modele::Mesh::Vertex));
+	const std::size_t position{ contenu.find(sommets) };
+	CPPUNIT_ASSERT(position != std::string::npos);
+	CPPUNIT_ASSERT(position % modele::CacheModele::ALIGNEMENT == 0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheModeleTest::testInvalidation()
+///
+/// Cas de test: le cache n'est plus lu si les drapeaux d'importation
+/// diffrent, si le fichier source est modifi ou supprim, ou si le
+/// cache n'existe pas.  Rcrire le mme contenu ne l'invalide pas.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheModeleTest::testInvalidation()
+{
+	const modele::Noeud racine{ construireModele() };
+	modele::Noeud lue;
+	std::vector<std::string> textures;
+
+	CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, textures));
+	CPPUNIT_ASSERT(modele::CacheModele::ecrire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, racine, textures));
+	CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX ^ 1, lue, textures));
+
+	// Mme contenu: la date peut changer, mais le hachage correspond.
+	ecrireFichier(FICHIER_MODELE, lireFichier(FICHIER_MODELE));
+	CPPUNIT_ASSERT(modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, textures));
+	CPPUNIT_ASSERT(comparerNoeuds(racine, lue));
+
+	// Contenu modifi.
+	ecrireFichier(FICHIER_MODELE, "o carre\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nf 1 2 3 4\n");
+	CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, textures));
+
+	// Fichier source supprim.
+	CPPUNIT_ASSERT(modele::CacheModele::ecrire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, racine, textures));
+	std::remove(FICHIER_MODELE.c_str());
+	CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, textures));
+	CPPUNIT_ASSERT(!modele::CacheModele::ecrire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, racine, textures));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheModeleTest::testCacheCorrompu()
+///
+/// Cas de test: un cache tronqu, allong ou dont le contenu est
+/// altr est refus, et le noeud et les textures passs en paramtre
+/// ne sont alors pas modifis.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheModeleTest::testCacheCorrompu()
+{
+	const modele::Noeud racine{ construireModele() };
+	const std::vector<std::string> textures{ "brique.png" };
+	CPPUNIT_ASSERT(modele::CacheModele::ecrire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, racine, textures));
+	const std::string contenu{ lireFichier(FICHIER_CACHE) };
+
+	modele::Noeud lue{ construireModele() };
+	std::vector<std::string> texturesLues{ "intacte" };
+
+	// Toutes les troncatures sont refuses.
+	for (std::size_t taille = 0; taille < contenu.size(); ++taille) {
+		ecrireFichier(FICHIER_CACHE, contenu.substr(0, taille));
+		CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, texturesLues));
+	}
+
+	// Des octets en trop sont refuss.
+	ecrireFichier(FICHIER_CACHE, contenu + '\0');
+	CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, texturesLues));
+
+	// Un nombre d'lments ou une longueur dmesure, o qu'ils se
+	// trouvent, ne provoquent ni allocation dmesure ni lecture hors du
+	// fichier.  Seules les valeurs des tableaux peuvent tre altres sans
+	// que le cache soit refus.
+	std::string altere;
+	for (std::size_t i = 40; i + 4 <= contenu.size(); ++i) {
+		altere = contenu;
+		altere.replace(i, 4, "\xff\xff\xff\x7f", 4);
+		ecrireFichier(FICHIER_CACHE, altere);
+		modele::Noeud autre;
+		std::vector<std::string> autresTextures;
+		modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, autre, autresTextures);
+	}
+
+	// Un identifiant altr est refus.
+	altere = contenu;
+	altere[0] = 'X';
+	ecrireFichier(FICHIER_CACHE, altere);
+	CPPUNIT_ASSERT(!modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, texturesLues));
+
+	CPPUNIT_ASSERT(texturesLues.size() == 1 && texturesLues[0] == "intacte");
+	CPPUNIT_ASSERT(comparerNoeuds(racine, lue));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void CacheModeleTest::testProjection()
+///
+/// Cas de test: les meshes lus en mode projet ont les mmes donnes
+/// que ceux crits, mais ces donnes sont lues directement dans le cache,
+///  des adresses alignes.  Le cache reste projet tant qu'une copie
+/// d'un mesh existe.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void CacheModeleTest::testProjection()
+{
+	const modele::Noeud racine{ construireModele() };
+	const std::vector<std::string> textures{ "brique.png" };
+	CPPUNIT_ASSERT(modele::CacheModele::ecrire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, racine, textures));
+
+	modele::Mesh copie;
+	{
+		modele::Noeud lue;
+		std::vector<std::string> texturesLues;
+		CPPUNIT_ASSERT(modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, texturesLues, true));
+		CPPUNIT_ASSERT(texturesLues == textures);
+		CPPUNIT_ASSERT(comparerNoeuds(racine, lue));
+
+		const modele::Noeud* noeuds[]{ &lue, &lue.obtenirEnfants()[0] };
+		for (const modele::Noeud* noeud : noeuds) {
+			modele::Mesh const& mesh{ noeud->obtenirMeshes()[0] };
+			CPPUNIT_ASSERT(mesh.estProjete());
+			CPPUNIT_ASSERT(reinterpret_cast<std::uintptr_t>(mesh.obtenirSommets().data()) % modele::CacheModele::ALIGNEMENT == 0);
+			CPPUNIT_ASSERT(reinterpret_cast<std::uintptr_t>(mesh.obtenirFaces().data()) % modele::CacheModele::ALIGNEMENT == 0);
+		}
+		CPPUNIT_ASSERT(!lue.obtenirEnfants()[0].obtenirMeshes()[0].possedeNormales());
+
+		copie = lue.obtenirMeshes()[0];
+	}
+
+	// La copie fait rfrence aux mmes donnes, toujours projetes.
+	CPPUNIT_ASSERT(copie.estProjete());
+	CPPUNIT_ASSERT(copie.obtenirSommets() == racine.obtenirMeshes()[0].obtenirSommets());
+	CPPUNIT_ASSERT(copie.obtenirFaces() == racine.obtenirMeshes()[0].obtenirFaces());
+
+	// Les meshes lus par copie possdent leurs donnes.
+	modele::Noeud lue;
+	std::vector<std::string> texturesLues;
+	CPPUNIT_ASSERT(modele::CacheModele::lire(FICHIER_CACHE, FICHIER_MODELE, DRAPEAUX, lue, texturesLues));
+	CPPUNIT_ASSERT(!lue.obtenirMeshes()[0].estProjete());
+	CPPUNIT_ASSERT(lue.obtenirMeshes()[0].obtenirSommets().data() != copie.obtenirSommets().data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file CacheModeleTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_CACHEMODELETEST_H
+#define _TESTS_CACHEMODELETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class CacheModeleTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement du
+///        cache binaire des modles 3D.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class CacheModeleTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( CacheModeleTest );
+	CPPUNIT_TEST( testEcritureLecture );
+	CPPUNIT_TEST( testInvalidation );
+	CPPUNIT_TEST( testCacheCorrompu );
+	CPPUNIT_TEST( testProjection );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: la hirarchie lue du cache est identique  celle crite
+	void testEcritureLecture();
+
+	/// Cas de test: le cache est ignor lorsque le fichier source ou les
+	/// drapeaux d'importation changent
+	void testInvalidation();
+
+	/// Cas de test: un cache tronqu ou corrompu est ignor sans modifier
+	/// le modle
+	void testCacheCorrompu();
+
+	/// Cas de test: les meshes projets lisent leurs donnes directement
+	/// dans le cache
+	void testProjection();
+
+};
+
+#endif // _TESTS_CACHEMODELETEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
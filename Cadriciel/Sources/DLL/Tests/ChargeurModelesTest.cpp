@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file ChargeurModelesTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "ChargeurModelesTest.h"
+#include "ChargeurModeles.h"
+#include "CacheModele.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(ChargeurModelesTest);
+
+/// Nombre de modles imports pendant les tests.
+static const unsigned int NOMBRE_MODELES{ 6 };
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static std::string obtenirNomModele(unsigned int indice)
+///
+/// Retourne le nom du fichier d'un des modles utiliss par les tests.
+///
+/// @param[in] indice : L'indice du modle.
+///
+/// @return Le nom du fichier.
+///
+////////////////////////////////////////////////////////////////////////
+static std::string obtenirNomModele(unsigned int indice)
+{
+	return "ChargeurModelesTest" + std::to_string(indice) + ".obj";
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void ecrireGrille(const std::string& nomFichier, unsigned int colonnes)
+///
+/// crit un modle .obj form d'une bande de carrs, soit deux
+/// triangles par colonne une fois le modle triangul.
+///
+/// @param[in] nomFichier : Le nom du fichier.
+/// @param[in] colonnes   : Le nombre de carrs de la bande.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+static void ecrireGrille(const std::string& nomFichier, unsigned int colonnes)
+{
+	std::ofstream fichier{ nomFichier, std::ios::out | std::ios::trunc };
+	fichier << "o grille\n";
+	for (unsigned int i = 0; i <= colonnes; ++i)
+		fichier << "v " << i << " 0 0\nv " << i << " 1 0\n";
+	for (unsigned int i = 0; i < colonnes; ++i)
+		fichier << "f " << 2 * i + 1 << ' ' << 2 * i + 3 << ' ' << 2 * i + 4 << ' ' << 2 * i + 2 << '\n';
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ChargeurModelesTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ChargeurModelesTest::setUp()
+{
+	for (unsigned int i = 0; i < NOMBRE_MODELES; ++i)
+		ecrireGrille(obtenirNomModele(i), 10 * (i + 1));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ChargeurModelesTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ChargeurModelesTest::tearDown()
+{
+	for (unsigned int i = 0; i < NOMBRE_MODELES; ++i) {
+		std::remove(obtenirNomModele(i).c_str());
+		std::remove(modele::CacheModele::obtenirChemin(obtenirNomModele(i)).string().c_str());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void ChargeurModelesTest::testImportationParallele()
+///
+/// Cas de test: un lot de modles import en parallle donne, pour
+/// chaque modle et dans l'ordre des chemins, les mmes triangles qu'une
+/// importation un  un, que les modles soient imports par 'assimp' ou
+/// lus du cache.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void ChargeurModelesTest::testImportationParallele()
+{
+	std::vector<modele::ChargeurModeles::Path> chemins;
+	for (unsigned int i = 0; i < NOMBRE_MODELES; ++i)
+		chemins.push_back(obtenirNomModele(i));
+
+	// Premire importation: par 'assimp', ce qui cre les caches.
+	{
+		std::vector<modele::Modele3D> modeles(NOMBRE_MODELES);
+		CPPUNIT_ASSERT(modele::ChargeurModeles::importer(modeles, chemins) == NOMBRE_MODELES);
+		for (unsigned int i = 0; i < NOMBRE_MODELES; ++i) {
+			CPPUNIT_ASSERT(modeles[i].obtenirCheminFichier() == chemins[i]);
+			CPPUNIT_ASSERT(modeles[i].obtenirArbreTriangles().obtenirNombreTriangles() == 20 * (i + 1));
+		}
+	}
+
+	// Deuxime importation:  partir des caches, compare  une
+	// importation un  un.
+	std::vector<modele::Modele3D> modeles(NOMBRE_MODELES);
+	CPPUNIT_ASSERT(modele::ChargeurModeles::importer(modeles, chemins) == NOMBRE_MODELES);
+	for (unsigned int i = 0; i < NOMBRE_MODELES; ++i) {
+		modele::Modele3D reference;
+		CPPUNIT_ASSERT(reference.importer(chemins[i]));
+		CPPUNIT_ASSERT(modeles[i].obtenirArbreTriangles().obtenirNombreTriangles() ==
+			reference.obtenirArbreTriangles().obtenirNombreTriangles());
+		CPPUNIT_ASSERT(modeles[i].obtenirNoeudRacine().obtenirEnfants().size() ==
+			reference.obtenirNoeudRacine().obtenirEnfants().size());
+	}
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
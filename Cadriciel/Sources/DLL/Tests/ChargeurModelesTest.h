@@ -0,0 +1,65 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file ChargeurModelesTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_CHARGEURMODELESTEST_H
+#define _TESTS_CHARGEURMODELESTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class ChargeurModelesTest
+/// @brief Classe de test cppunit pour tester l'importation parallle
+///        d'un lot de modles 3D.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class ChargeurModelesTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( ChargeurModelesTest );
+	CPPUNIT_TEST( testImportationParallele );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: les modles imports en parallle sont identiques 
+	/// ceux imports un  un
+	void testImportationParallele();
+
+};
+
+#endif // _TESTS_CHARGEURMODELESTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file MeshCompactTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "MeshCompactTest.h"
+#include "MeshCompact.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(MeshCompactTest);
+
+using modele::Mesh;
+using modele::MeshCompact;
+
+/// Erreur angulaire maximale tolre pour les normales, en radians.
+static const float ERREUR_NORMALES{ 5e-5f };
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static float angle(Mesh::Normale const& a, Mesh::Normale const& b)
+///
+/// Retourne l'angle entre deux normales, prcis mme lorsqu'il est trs
+/// petit.
+///
+/// @param[in] a : La premire normale.
+/// @param[in] b : La seconde normale.
+///
+/// @return L'angle, en radians.
+///
+////////////////////////////////////////////////////////////////////////
+static float angle(Mesh::Normale const& a, Mesh::Normale const& b)
+{
+	return std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static Mesh construireBande(unsigned int colonnes)
+///
+/// Construit une bande de carrs dans le plan xy, de deux triangles par
+/// carr, dont chaque sommet a une normale, des coordonnes de texture
+/// et une couleur.
+///
+/// @param[in] colonnes : Le nombre de carrs de la bande.
+///
+/// @return Le mesh.
+///
+////////////////////////////////////////////////////////////////////////
+static Mesh construireBande(unsigned int colonnes)
+{
+	std::vector<Mesh::Vertex> sommets;
+	std::vector<Mesh::Normale> normales;
+	std::vector<Mesh::TexCoord> texCoords;
+	std::vector<Mesh::Couleur> couleurs;
+	std::vector<Mesh::Face> faces;
+	for (unsigned int i = 0; i <= colonnes; ++i) {
+		const float x{ static_cast<float>(i) };
+		for (unsigned int j = 0; j < 2; ++j) {
+			const float y{ static_cast<float>(j) };
+			sommets.emplace_back(x, y, 0.0f);
+			normales.push_back(glm::normalize(Mesh::Normale{ x - 0.5f * colonnes, y - 0.5f, 1.0f }));
+			texCoords.emplace_back(x / 3.0f, y);
+			couleurs.emplace_back(x / (colonnes + 1), 0.3f, y, 1.0f);
+		}
+	}
+	for (unsigned int i = 0; i < colonnes; ++i) {
+		const int coin{ static_cast<int>(2 * i) };
+		faces.emplace_back(coin, coin + 2, coin + 3);
+		faces.emplace_back(coin, coin + 3, coin + 1);
+	}
+	return Mesh{ sommets, normales, texCoords, couleurs, faces, modele::Materiau{}, "bande" };
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void MeshCompactTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void MeshCompactTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void MeshCompactTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void MeshCompactTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void MeshCompactTest::testNormales()
+///
+/// Cas de test: les axes sont encods exactement, et des normales
+/// alatoires dans toutes les directions, y compris l'hmisphre repli
+/// de l'octadre, sont dcodes unitaires et  moins de 5e-5 radian.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void MeshCompactTest::testNormales()
+{
+	const std::vector<Mesh::Normale> axes{
+		{ 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+	for (Mesh::Normale const& axe : axes)
+		CPPUNIT_ASSERT(MeshCompact::decoderNormale(MeshCompact::encoderNormale(axe)) == axe);
+
+	std::mt19937 generateur{ 42 };
+	std::normal_distribution<float> distribution;
+	for (unsigned int i = 0; i < 10000; ++i) {
+		const Mesh::Normale normale{ glm::normalize(Mesh::Normale{
+			distribution(generateur), distribution(generateur), distribution(generateur) }) };
+		const Mesh::Normale decodee{ MeshCompact::decoderNormale(MeshCompact::encoderNormale(normale)) };
+		CPPUNIT_ASSERT(std::abs(glm::length(decodee) - 1.0f) < 1e-6f);
+		CPPUNIT_ASSERT(angle(normale, decodee) < ERREUR_NORMALES);
+	}
+
+	// Une normale non unitaire est normalise, une normale nulle donne +z
+	CPPUNIT_ASSERT(MeshCompact::decoderNormale(MeshCompact::encoderNormale({ 0, 0, -3 })) == Mesh::Normale(0, 0, -1));
+	CPPUNIT_ASSERT(MeshCompact::decoderNormale(MeshCompact::encoderNormale({ 0, 0, 0 })) == Mesh::Normale(0, 0, 1));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void MeshCompactTest::testAttributs()
+///
+/// Cas de test: les coordonnes de texture gardent une prcision
+/// relative de 2^-11, mme au-del de [0, 1], et les couleurs sont 
+/// moins d'un demi-pas de 8 bits, hors des valeurs limites  [0, 1].
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void MeshCompactTest::testAttributs()
+{
+	const std::vector<Mesh::TexCoord> texCoords{ { 0, 1 }, { 0.5f, 0.25f }, { 0.1f, 0.9f }, { 3.5f, -2.0f }, { 12.3f, 0.001f } };
+	for (Mesh::TexCoord const& texCoord : texCoords) {
+		const Mesh::TexCoord decodees{ MeshCompact::decoderTexCoord(MeshCompact::encoderTexCoord(texCoord)) };
+		for (glm::length_t i = 0; i < texCoord.length(); ++i)
+			CPPUNIT_ASSERT(std::abs(decodees[i] - texCoord[i]) <= std::abs(texCoord[i]) / 2048.0f);
+	}
+	// Les valeurs exactement reprsentables ne changent pas
+	CPPUNIT_ASSERT(MeshCompact::decoderTexCoord(MeshCompact::encoderTexCoord({ 3.5f, -2.0f })) == Mesh::TexCoord(3.5f, -2.0f));
+
+	const std::vector<Mesh::Couleur> couleurs{ { 0, 0, 0, 0 }, { 1, 1, 1, 1 }, { 0.2f, 0.4f, 0.6f, 0.8f }, { 0.001f, 0.999f, 0.5f, 0.75f } };
+	for (Mesh::Couleur const& couleur : couleurs) {
+		const Mesh::Couleur decodee{ MeshCompact::decoderCouleur(MeshCompact::encoderCouleur(couleur)) };
+		for (glm::length_t i = 0; i < couleur.length(); ++i)
+			CPPUNIT_ASSERT(std::abs(decodee[i] - couleur[i]) <= 0.5f / 255.0f + 1e-6f);
+	}
+	CPPUNIT_ASSERT(MeshCompact::decoderCouleur(MeshCompact::encoderCouleur({ -1, 2, 0, 1 })) == Mesh::Couleur(0, 1, 0, 1));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void MeshCompactTest::testIndices()
+///
+/// Cas de test: un mesh de 65536 sommets a des indices sur 16 bits, un
+/// mesh d'un sommet de plus des indices sur 32 bits, et les faces de
+/// chacun sont conserves exactement.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void MeshCompactTest::testIndices()
+{
+	for (int nombreSommets : { 65536, 65537 }) {
+		const std::vector<Mesh::Vertex> sommets(nombreSommets, Mesh::Vertex{ 0.0f });
+		const std::vector<Mesh::Face> faces{ { 0, 1, 2 }, { nombreSommets - 1, 65535, 0 }, { 2, nombreSommets - 2, 1 } };
+		const Mesh mesh{ sommets, {}, {}, {}, faces, modele::Materiau{}, "" };
+		const MeshCompact compact{ mesh };
+
+		CPPUNIT_ASSERT(compact.possedeIndicesCourts() == (nombreSommets == 65536));
+		CPPUNIT_ASSERT(compact.obtenirNombreSommets() == sommets.size());
+		CPPUNIT_ASSERT(compact.obtenirNombreFaces() == faces.size());
+		for (std::size_t i = 0; i < faces.size(); ++i)
+			CPPUNIT_ASSERT(compact.obtenirFace(i) == faces[i]);
+
+		CPPUNIT_ASSERT(!compact.possedeNormales());
+		CPPUNIT_ASSERT(!compact.possedeTexCoords());
+		CPPUNIT_ASSERT(!compact.possedeCouleurs());
+		const std::size_t octetsIndices{ faces.size() * 3 * (compact.possedeIndicesCourts() ? 2 : 4) };
+		CPPUNIT_ASSERT(compact.obtenirMemoire() == sommets.size() * sizeof(Mesh::Vertex) + octetsIndices);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void MeshCompactTest::testRapport()
+///
+/// Cas de test: le rapport d'un modle de deux meshes donne la mmoire
+/// attendue et des erreurs dans les tolrances, et le mesh reconstruit
+/// reproduit le mesh d'origine.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void MeshCompactTest::testRapport()
+{
+	const Mesh bande{ construireBande(10) };
+	const MeshCompact compact{ bande };
+
+	// 22 sommets et 20 faces: 12 + 12 + 8 + 16 octets par sommet et 12
+	// par face, contre 12 + 4 + 4 + 4 par sommet et 6 par face.
+	MeshCompact::Rapport rapport{ compact.comparer(bande) };
+	CPPUNIT_ASSERT(rapport.octetsOriginaux == 22 * 48 + 20 * 12);
+	CPPUNIT_ASSERT(rapport.octetsCompacts == 22 * 24 + 20 * 6);
+	CPPUNIT_ASSERT(rapport.obtenirOctetsEconomises() == 22 * 24 + 20 * 6);
+	CPPUNIT_ASSERT(rapport.erreurNormales < ERREUR_NORMALES);
+	CPPUNIT_ASSERT(rapport.erreurTexCoords <= 4.0f / 2048.0f);
+	CPPUNIT_ASSERT(rapport.erreurCouleurs <= 0.5f / 255.0f + 1e-6f);
+	CPPUNIT_ASSERT(rapport.erreurCouleurs > 0.0f);
+
+	// Le rapport d'un modle cumule ceux de tous ses meshes
+	std::vector<Mesh> meshes;
+	meshes.push_back(construireBande(10));
+	std::vector<modele::Noeud> enfants;
+	enfants.emplace_back("enfant", glm::mat4x4{ 1.0f }, std::vector<Mesh>{ construireBande(10) }, std::vector<modele::Noeud>{});
+	const modele::Noeud racine{ "racine", glm::mat4x4{ 1.0f }, std::move(meshes), std::move(enfants) };
+	const MeshCompact::Rapport rapportModele{ MeshCompact::evaluer(racine) };
+	CPPUNIT_ASSERT(rapportModele.octetsOriginaux == 2 * rapport.octetsOriginaux);
+	CPPUNIT_ASSERT(rapportModele.octetsCompacts == 2 * rapport.octetsCompacts);
+	CPPUNIT_ASSERT(rapportModele.erreurNormales == rapport.erreurNormales);
+
+	// Le mesh reconstruit a les mmes sommets et faces, et des attributs
+	// dans les tolrances
+	const Mesh reconstruit{ compact.decompresser() };
+	CPPUNIT_ASSERT(reconstruit.obtenirNom() == "bande");
+	CPPUNIT_ASSERT(reconstruit.obtenirSommets() == bande.obtenirSommets());
+	CPPUNIT_ASSERT(reconstruit.obtenirFaces() == bande.obtenirFaces());
+	CPPUNIT_ASSERT(reconstruit.obtenirNormales().size() == bande.obtenirNormales().size());
+	CPPUNIT_ASSERT(reconstruit.obtenirCouleurs().size() == bande.obtenirCouleurs().size());
+	for (std::size_t i = 0; i < bande.obtenirTexCoords().size(); ++i) {
+		CPPUNIT_ASSERT(angle(reconstruit.obtenirNormales()[i], bande.obtenirNormales()[i]) < ERREUR_NORMALES);
+		CPPUNIT_ASSERT(reconstruit.obtenirTexCoords()[i] == compact.obtenirTexCoord(i));
+		CPPUNIT_ASSERT(reconstruit.obtenirCouleurs()[i] == compact.obtenirCouleur(i));
+	}
+	CPPUNIT_ASSERT(MeshCompact{ reconstruit }.comparer(reconstruit).erreurCouleurs < 1e-6f);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file MeshCompactTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_MESHCOMPACTTEST_H
+#define _TESTS_MESHCOMPACTTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class MeshCompactTest
+/// @brief Classe de test cppunit pour tester la reprsentation compacte
+///        des meshes.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class MeshCompactTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( MeshCompactTest );
+	CPPUNIT_TEST( testNormales );
+	CPPUNIT_TEST( testAttributs );
+	CPPUNIT_TEST( testIndices );
+	CPPUNIT_TEST( testRapport );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: les normales encodes sur l'octadre sont unitaires
+	/// et proches des originales, dans toutes les directions
+	void testNormales();
+
+	/// Cas de test: prcision des coordonnes de texture et des couleurs
+	void testAttributs();
+
+	/// Cas de test: les indices sont sur 16 bits lorsqu'ils le peuvent et
+	/// les faces sont conserves exactement
+	void testIndices();
+
+	/// Cas de test: mmoire conomise et erreurs d'un modle, et mesh
+	/// reconstruit
+	void testRapport();
+
+};
+
+#endif // _TESTS_MESHCOMPACTTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,7 @@
 
 #include "NoeudAbstraitTest.h"
 #include "NoeudConeCube.h"
+#include "NoeudComposite.h"
 #include "ArbreRenduINF2990.h"
 #include "Utilitaire.h"
 
@@ -159,6 +160,48 @@ void NoeudAbstraitTest::testEnfants()
 	delete nouveauNoeud;
 }
 
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void NoeudAbstraitTest::testMatriceMonde()
+///
+/// Cas de test: la matrice monde d'un noeud cumule les positions de ses
+/// anctres et suit les changements de position d'un anctre ou de
+/// parent.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void NoeudAbstraitTest::testMatriceMonde()
+{
+	NoeudComposite racine{ "racine" };
+	NoeudComposite* groupe{ new NoeudComposite{ "groupe" } };
+	racine.ajouter(groupe);
+
+	racine.assignerPositionRelative(glm::dvec3{ 1.0, 0.0, 0.0 });
+	groupe->assignerPositionRelative(glm::dvec3{ 0.0, 2.0, 0.0 });
+	noeud->assignerPositionRelative(glm::dvec3{ 0.0, 0.0, 3.0 });
+
+	// Un noeud sans parent est relatif  sa propre origine
+	glm::dvec4 origine{ noeud->obtenirMatriceMonde()[3] };
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[0]));
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[2] - 3.0));
+
+	// La translation de la matrice monde cumule celles des anctres
+	NoeudAbstrait* feuille{ noeud.release() };
+	groupe->ajouter(feuille);
+	origine = feuille->obtenirMatriceMonde()[3];
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[0] - 1.0));
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[1] - 2.0));
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[2] - 3.0));
+
+	// Le dplacement d'un anctre invalide la matrice de ses descendants
+	racine.assignerPositionRelative(glm::dvec3{ -1.0, 0.0, 0.0 });
+	origine = feuille->obtenirMatriceMonde()[3];
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[0] + 1.0));
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[1] - 2.0));
+	CPPUNIT_ASSERT(utilitaire::EGAL_ZERO(origine[2] - 3.0));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @}
 ///////////////////////////////////////////////////////////////////////////////
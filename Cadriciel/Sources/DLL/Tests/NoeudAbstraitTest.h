@@ -38,6 +38,7 @@ class NoeudAbstraitTest : public CppUnit::TestFixture
   CPPUNIT_TEST( testType );
   CPPUNIT_TEST( testSelection );
   CPPUNIT_TEST(testEnfants);
+  CPPUNIT_TEST( testMatriceMonde );
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -69,6 +70,9 @@ public:
 	/// Cas de test: s'assurer que le noeud abstrait n'a pas d'enfant
 	void testEnfants();
 
+	/// Cas de test: calcul et invalidation des matrices monde
+	void testMatriceMonde();
+
 private:
 	/// Instance d'un noeud abstrait
 	std::unique_ptr<NoeudAbstrait> noeud;
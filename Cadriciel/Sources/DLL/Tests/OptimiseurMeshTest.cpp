@@ -0,0 +1,326 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file OptimiseurMeshTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "OptimiseurMeshTest.h"
+#include "OptimiseurMesh.h"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(OptimiseurMeshTest);
+
+using modele::Mesh;
+using modele::OptimiseurMesh;
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void construireGrille(unsigned int cotes, std::vector<Mesh::Vertex>& sommets, std::vector<Mesh::Face>& faces)
+///
+/// Construit une grille carre dans le plan xy, de deux triangles par
+/// case, dont les faces sont ranges ligne par ligne.
+///
+/// @param[in]  cotes   : Le nombre de cases de chaque ct.
+/// @param[out] sommets : Les sommets de la grille.
+/// @param[out] faces   : Les faces de la grille.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+static void construireGrille(unsigned int cotes, std::vector<Mesh::Vertex>& sommets,
+	std::vector<Mesh::Face>& faces)
+{
+	sommets.clear();
+	faces.clear();
+	for (unsigned int y = 0; y <= cotes; ++y) {
+		for (unsigned int x = 0; x <= cotes; ++x)
+			sommets.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+	}
+	for (unsigned int y = 0; y < cotes; ++y) {
+		for (unsigned int x = 0; x < cotes; ++x) {
+			const int coin{ static_cast<int>(y * (cotes + 1) + x) };
+			const int haut{ coin + static_cast<int>(cotes) + 1 };
+			faces.emplace_back(coin, coin + 1, haut + 1);
+			faces.emplace_back(coin, haut + 1, haut);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static std::vector<std::vector<float>> obtenirTriangles(Mesh::Etendue<Mesh::Vertex> sommets, Mesh::Etendue<Mesh::Face> faces)
+///
+/// Obtient les triangles dessins, sous forme de positions, dans un
+/// ordre qui ne dpend ni de l'ordre des faces, ni de la numrotation
+/// des sommets, ni du premier sommet de chaque face.  Le sens des
+/// triangles est conserv.
+///
+/// @param[in] sommets : Les sommets.
+/// @param[in] faces   : Les faces.
+///
+/// @return Les triangles, tris.
+///
+////////////////////////////////////////////////////////////////////////
+static std::vector<std::vector<float>> obtenirTriangles(Mesh::Etendue<Mesh::Vertex> sommets,
+	Mesh::Etendue<Mesh::Face> faces)
+{
+	std::vector<std::vector<float>> triangles;
+	for (Mesh::Face const& face : faces) {
+		// Commencer par le plus petit sommet, sans changer le sens.
+		int premier{ 0 };
+		for (int i = 1; i < 3; ++i) {
+			Mesh::Vertex const& a{ sommets[face[i]] };
+			Mesh::Vertex const& b{ sommets[face[premier]] };
+			if (std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z))
+				premier = i;
+		}
+
+		std::vector<float> triangle;
+		for (int i = 0; i < 3; ++i) {
+			Mesh::Vertex const& sommet{ sommets[face[(premier + i) % 3]] };
+			triangle.insert(triangle.end(), { sommet.x, sommet.y, sommet.z });
+		}
+		triangles.push_back(triangle);
+	}
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OptimiseurMeshTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OptimiseurMeshTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OptimiseurMeshTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OptimiseurMeshTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OptimiseurMeshTest::testMesure()
+///
+/// Cas de test: une bande de triangles transforme chaque sommet une
+/// seule fois, des triangles disjoints transforment trois sommets
+/// chacun, et une petite cache oublie les sommets trop anciens.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OptimiseurMeshTest::testMesure()
+{
+	// Bande de quatre triangles sur six sommets.
+	const std::vector<Mesh::Face> bande{ { 0, 1, 2 }, { 2, 1, 3 }, { 2, 3, 4 }, { 4, 3, 5 } };
+	OptimiseurMesh::Statistiques statistiques{ OptimiseurMesh::mesurer(bande) };
+	CPPUNIT_ASSERT(statistiques.triangles == 4);
+	CPPUNIT_ASSERT(statistiques.sommets == 6);
+	CPPUNIT_ASSERT(statistiques.echecs == 6);
+	CPPUNIT_ASSERT(statistiques.obtenirACMR() == 1.5);
+	CPPUNIT_ASSERT(statistiques.obtenirATVR() == 1.0);
+
+	// Triangles disjoints.
+	const std::vector<Mesh::Face> disjoints{ { 0, 1, 2 }, { 3, 4, 5 }, { 6, 7, 8 } };
+	statistiques = OptimiseurMesh::mesurer(disjoints);
+	CPPUNIT_ASSERT(statistiques.obtenirACMR() == 3.0);
+	CPPUNIT_ASSERT(statistiques.obtenirATVR() == 1.0);
+
+	// Une cache de trois sommets a oubli le premier triangle lorsqu'il
+	// revient.
+	const std::vector<Mesh::Face> retour{ { 0, 1, 2 }, { 3, 4, 5 }, { 0, 1, 2 } };
+	statistiques = OptimiseurMesh::mesurer(retour, 3);
+	CPPUNIT_ASSERT(statistiques.echecs == 9);
+	CPPUNIT_ASSERT(statistiques.obtenirATVR() == 1.5);
+	statistiques = OptimiseurMesh::mesurer(retour, 6);
+	CPPUNIT_ASSERT(statistiques.echecs == 6);
+
+	// Aucune face.
+	statistiques = OptimiseurMesh::mesurer(std::vector<Mesh::Face>{});
+	CPPUNIT_ASSERT(statistiques.obtenirACMR() == 0.0);
+	CPPUNIT_ASSERT(statistiques.obtenirATVR() == 0.0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OptimiseurMeshTest::testOrdreCache()
+///
+/// Cas de test: les faces d'une grille mlanges puis ordonnes pour la
+/// cache sont les mmes, et l'ACMR obtenu est prs de celui d'un bon
+/// ordre.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OptimiseurMeshTest::testOrdreCache()
+{
+	std::vector<Mesh::Vertex> sommets;
+	std::vector<Mesh::Face> faces;
+	construireGrille(30, sommets, faces);
+
+	std::mt19937 generateur{ 2990 };
+	std::shuffle(faces.begin(), faces.end(), generateur);
+
+	std::vector<Mesh::Face> ordonnees{
+		OptimiseurMesh::ordonnerCache(faces, sommets.size(), OptimiseurMesh::TAILLE_CACHE) };
+
+	// Les mmes faces, chacune une seule fois.
+	auto inferieur = [](Mesh::Face const& a, Mesh::Face const& b) {
+		return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+	};
+	std::vector<Mesh::Face> attendues{ faces };
+	std::vector<Mesh::Face> obtenues{ ordonnees };
+	std::sort(attendues.begin(), attendues.end(), inferieur);
+	std::sort(obtenues.begin(), obtenues.end(), inferieur);
+	CPPUNIT_ASSERT(attendues == obtenues);
+
+	const OptimiseurMesh::Statistiques avant{ OptimiseurMesh::mesurer(faces) };
+	const OptimiseurMesh::Statistiques apres{ OptimiseurMesh::mesurer(ordonnees) };
+	CPPUNIT_ASSERT(avant.obtenirACMR() > 2.0);
+	CPPUNIT_ASSERT(apres.obtenirACMR() < 0.8);
+	CPPUNIT_ASSERT(apres.obtenirATVR() < 1.4);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OptimiseurMeshTest::testSurdessin()
+///
+/// Cas de test: de deux carrs tourns vers +z, celui qui est devant le
+/// centre du mesh, donc vers l'extrieur, est dessin en premier mme
+/// s'il vient en dernier.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OptimiseurMeshTest::testSurdessin()
+{
+	const std::vector<Mesh::Vertex> sommets{
+		{ 0, 0, -1 }, { 1, 0, -1 }, { 1, 1, -1 }, { 0, 1, -1 },
+		{ 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 } };
+	std::vector<Mesh::Face> faces{ { 0, 1, 2 }, { 0, 2, 3 }, { 4, 5, 6 }, { 4, 6, 7 } };
+
+	OptimiseurMesh::ordonnerSurdessin(faces, sommets, OptimiseurMesh::TAILLE_CACHE);
+
+	CPPUNIT_ASSERT(faces.size() == 4);
+	CPPUNIT_ASSERT(faces[0] == Mesh::Face(4, 5, 6));
+	CPPUNIT_ASSERT(faces[1] == Mesh::Face(4, 6, 7));
+	CPPUNIT_ASSERT(faces[2] == Mesh::Face(0, 1, 2));
+	CPPUNIT_ASSERT(faces[3] == Mesh::Face(0, 2, 3));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OptimiseurMeshTest::testOptimisation()
+///
+/// Cas de test: une grille dont les faces et les sommets sont mlangs
+/// est optimise.  Le mesh obtenu dessine les mmes triangles, chaque
+/// sommet garde ses attributs, les sommets sont numrots dans l'ordre
+/// de leur premire utilisation et le rapport montre l'amlioration.
+/// Optimiser  nouveau ne dtriore rien.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OptimiseurMeshTest::testOptimisation()
+{
+	std::vector<Mesh::Vertex> sommets;
+	std::vector<Mesh::Face> faces;
+	construireGrille(20, sommets, faces);
+
+	// Mlanger les faces et la numrotation des sommets.
+	std::mt19937 generateur{ 2990 };
+	std::shuffle(faces.begin(), faces.end(), generateur);
+	std::vector<int> numeros(sommets.size());
+	for (std::size_t i = 0; i < numeros.size(); ++i)
+		numeros[i] = static_cast<int>(i);
+	std::shuffle(numeros.begin(), numeros.end(), generateur);
+	std::vector<Mesh::Vertex> melanges(sommets.size());
+	for (std::size_t i = 0; i < sommets.size(); ++i)
+		melanges[numeros[i]] = sommets[i];
+	for (Mesh::Face& face : faces)
+		face = Mesh::Face(numeros[face.x], numeros[face.y], numeros[face.z]);
+
+	// Attributs qui dpendent de la position.
+	std::vector<Mesh::Normale> normales;
+	std::vector<Mesh::TexCoord> texCoords;
+	std::vector<Mesh::Couleur> couleurs;
+	for (Mesh::Vertex const& sommet : melanges) {
+		normales.push_back(glm::normalize(Mesh::Normale(sommet.x, sommet.y, 1.0f)));
+		texCoords.emplace_back(sommet.x / 20.0f, sommet.y / 20.0f);
+		couleurs.emplace_back(sommet.x, sommet.y, 0.0f, 1.0f);
+	}
+
+	const Mesh mesh{ melanges, normales, texCoords, couleurs, faces, modele::Materiau{}, "grille" };
+	OptimiseurMesh::Rapport rapport;
+	const Mesh optimise{ OptimiseurMesh::optimiser(mesh, &rapport) };
+
+	CPPUNIT_ASSERT(optimise.obtenirNom() == "grille");
+	CPPUNIT_ASSERT(optimise.obtenirSommets().size() == mesh.obtenirSommets().size());
+	CPPUNIT_ASSERT(optimise.obtenirFaces().size() == mesh.obtenirFaces().size());
+	CPPUNIT_ASSERT(obtenirTriangles(optimise.obtenirSommets(), optimise.obtenirFaces()) ==
+		obtenirTriangles(mesh.obtenirSommets(), mesh.obtenirFaces()));
+
+	// Chaque sommet garde ses attributs.
+	for (std::size_t i = 0; i < optimise.obtenirSommets().size(); ++i) {
+		Mesh::Vertex const& sommet{ optimise.obtenirSommets()[i] };
+		CPPUNIT_ASSERT(optimise.obtenirNormales()[i] == glm::normalize(Mesh::Normale(sommet.x, sommet.y, 1.0f)));
+		CPPUNIT_ASSERT(optimise.obtenirTexCoords()[i] == Mesh::TexCoord(sommet.x / 20.0f, sommet.y / 20.0f));
+		CPPUNIT_ASSERT(optimise.obtenirCouleurs()[i] == Mesh::Couleur(sommet.x, sommet.y, 0.0f, 1.0f));
+	}
+
+	// Les sommets sont lus dans l'ordre.
+	int prochain{ 0 };
+	for (Mesh::Face const& face : optimise.obtenirFaces()) {
+		for (int i = 0; i < 3; ++i) {
+			CPPUNIT_ASSERT(face[i] <= prochain);
+			if (face[i] == prochain)
+				++prochain;
+		}
+	}
+
+	// Le rapport.
+	CPPUNIT_ASSERT(rapport.avant.triangles == faces.size());
+	CPPUNIT_ASSERT(rapport.apres.triangles == faces.size());
+	CPPUNIT_ASSERT(rapport.apres.echecs == OptimiseurMesh::mesurer(optimise.obtenirFaces()).echecs);
+	CPPUNIT_ASSERT(rapport.apres.obtenirACMR() < rapport.avant.obtenirACMR());
+	CPPUNIT_ASSERT(rapport.apres.obtenirATVR() < rapport.avant.obtenirATVR());
+
+	// Optimiser  nouveau ne dtriore rien.
+	OptimiseurMesh::Rapport rapport2;
+	const Mesh reoptimise{ OptimiseurMesh::optimiser(optimise, &rapport2) };
+	CPPUNIT_ASSERT(rapport2.apres.echecs <= rapport2.avant.echecs);
+	CPPUNIT_ASSERT(obtenirTriangles(reoptimise.obtenirSommets(), reoptimise.obtenirFaces()) ==
+		obtenirTriangles(mesh.obtenirSommets(), mesh.obtenirFaces()));
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file OptimiseurMeshTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_OPTIMISEURMESHTEST_H
+#define _TESTS_OPTIMISEURMESHTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class OptimiseurMeshTest
+/// @brief Classe de test cppunit pour tester l'optimisation des meshes
+///        pour la cache des sommets et le surdessin.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class OptimiseurMeshTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( OptimiseurMeshTest );
+	CPPUNIT_TEST( testMesure );
+	CPPUNIT_TEST( testOrdreCache );
+	CPPUNIT_TEST( testSurdessin );
+	CPPUNIT_TEST( testOptimisation );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: l'ACMR et l'ATVR d'ordres de faces connus
+	void testMesure();
+
+	/// Cas de test: l'ordre pour la cache conserve les faces et rduit
+	/// l'ACMR d'un maillage mlang
+	void testOrdreCache();
+
+	/// Cas de test: les grappes tournes vers l'extrieur sont dessines
+	/// en premier
+	void testSurdessin();
+
+	/// Cas de test: le mesh optimis dessine les mmes triangles, avec les
+	/// mmes attributs, et ses sommets sont lus squentiellement
+	void testOptimisation();
+
+};
+
+#endif // _TESTS_OPTIMISEURMESHTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file OrdonnanceurTachesTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "OrdonnanceurTachesTest.h"
+#include "OrdonnanceurTaches.h"
+
+#include <atomic>
+#include <stdexcept>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(OrdonnanceurTachesTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OrdonnanceurTachesTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// Le mode mono-fil de l'ordonnanceur est retenu pour tre restaur.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OrdonnanceurTachesTest::setUp()
+{
+	monoFil = utilitaire::OrdonnanceurTaches::obtenirInstance()->estMonoFil();
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OrdonnanceurTachesTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OrdonnanceurTachesTest::tearDown()
+{
+	utilitaire::OrdonnanceurTaches::obtenirInstance()->assignerMonoFil(monoFil);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OrdonnanceurTachesTest::testSousTaches()
+///
+/// Cas de test: des tches qui lancent et attendent leurs propres
+/// sous-tches sont toutes excutes exactement une fois, sur plusieurs
+/// fils comme sur un seul.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OrdonnanceurTachesTest::testSousTaches()
+{
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+
+	for (bool monoFilTest : { false, true }) {
+		ordonnanceur->assignerMonoFil(monoFilTest);
+
+		std::atomic<int> executions{ 0 };
+		utilitaire::GroupeTaches groupe;
+		for (int i = 0; i < 16; ++i) {
+			ordonnanceur->lancer(groupe, [ordonnanceur, &executions] {
+				utilitaire::GroupeTaches sousGroupe;
+				for (int j = 0; j < 8; ++j)
+					ordonnanceur->lancer(sousGroupe, [&executions] { ++executions; });
+				ordonnanceur->attendre(sousGroupe);
+				++executions;
+			});
+		}
+		ordonnanceur->attendre(groupe);
+
+		CPPUNIT_ASSERT(groupe.estTermine());
+		CPPUNIT_ASSERT(executions.load() == 16 * 9);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void OrdonnanceurTachesTest::testExceptionTache()
+///
+/// Cas de test: une exception lance par une tche n'empche pas les
+/// autres tches du groupe de s'excuter ni le groupe de se terminer.
+/// Elle est relance par attendre(), une seule fois, et le groupe peut
+/// ensuite tre rutilis.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void OrdonnanceurTachesTest::testExceptionTache()
+{
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+
+	for (bool monoFilTest : { false, true }) {
+		ordonnanceur->assignerMonoFil(monoFilTest);
+
+		std::atomic<int> executions{ 0 };
+		utilitaire::GroupeTaches groupe;
+		for (int i = 0; i < 32; ++i) {
+			ordonnanceur->lancer(groupe, [i, &executions] {
+				if (i % 8 == 3)
+					throw std::runtime_error{ "Tche en erreur" };
+				++executions;
+			});
+		}
+		CPPUNIT_ASSERT_THROW(ordonnanceur->attendre(groupe), std::runtime_error);
+		CPPUNIT_ASSERT(groupe.estTermine());
+		CPPUNIT_ASSERT(executions.load() == 28);
+
+		// L'exception a t consomme: le groupe est rutilisable.
+		ordonnanceur->lancer(groupe, [&executions] { ++executions; });
+		ordonnanceur->attendre(groupe);
+		CPPUNIT_ASSERT(executions.load() == 29);
+	}
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
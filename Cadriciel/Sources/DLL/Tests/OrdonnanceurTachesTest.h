@@ -0,0 +1,71 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file OrdonnanceurTachesTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_ORDONNANCEURTACHESTEST_H
+#define _TESTS_ORDONNANCEURTACHESTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class OrdonnanceurTachesTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        mthodes de la classe utilitaire::OrdonnanceurTaches.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class OrdonnanceurTachesTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( OrdonnanceurTachesTest );
+	CPPUNIT_TEST( testSousTaches );
+	CPPUNIT_TEST( testExceptionTache );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: toutes les tches et sous-tches d'un groupe sont excutes
+	void testSousTaches();
+
+	/// Cas de test: l'exception d'une tche est relance par attendre()
+	void testExceptionTache();
+
+private:
+	/// Mode mono-fil de l'ordonnanceur avant les tests
+	bool monoFil;
+};
+
+#endif // _TESTS_ORDONNANCEURTACHESTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1385 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file PerformanceTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "PerformanceTest.h"
+#include "ArbreRendu.h"
+#include "NoeudComposite.h"
+#include "NoeudConeCube.h"
+#include "NoeudAraignee.h"
+#include "ArbreRenduINF2990.h"
+#include "ParcoursArbre.h"
+#include "RegistreTypes.h"
+#include "OrdonnanceurTaches.h"
+#include "PoolMemoire.h"
+#include "VueOrtho.h"
+#include "AideCollision.h"
+#include "AideCollisionLot.h"
+#include "Droite3D.h"
+#include "Plan3D.h"
+#include "ArbreTriangles.h"
+#include "Modele3D.h"
+#include "CacheModele.h"
+#include "OptimiseurMesh.h"
+#include "MeshCompact.h"
+
+#include <windows.h>
+#include <psapi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(PerformanceTest);
+
+#pragma comment ( lib, "psapi.lib" )
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static double mesurerDuree(Fonction fonction)
+///
+/// Chronomtre l'excution d'une fonction.
+///
+/// @param[in] fonction : La fonction  excuter.
+///
+/// @return La dure de l'excution, en millisecondes.
+///
+////////////////////////////////////////////////////////////////////////
+template <class Fonction>
+static double mesurerDuree(Fonction fonction)
+{
+	const auto debut = std::chrono::high_resolution_clock::now();
+	fonction();
+	const auto fin = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<double, std::milli>(fin - debut).count();
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static double obtenirMemoireResidente()
+///
+/// Obtient la mmoire rsidente du processus.
+///
+/// @return La mmoire rsidente, en mgaoctets.
+///
+////////////////////////////////////////////////////////////////////////
+static double obtenirMemoireResidente()
+{
+	PROCESS_MEMORY_COUNTERS compteurs;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &compteurs, sizeof(compteurs)))
+		return 0.0;
+	return compteurs.WorkingSetSize / 1024.0 / 1024.0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static modele::Mesh construireSphere(int segments, int anneaux, float repetitions)
+///
+/// Construit une sphre unitaire munie de normales, de coordonnes de
+/// texture et de couleurs.  Les coordonnes de texture vont de 0 au
+/// nombre de rptitions de la texture.
+///
+/// @param[in] segments     : Le nombre de divisions autour de l'axe.
+/// @param[in] anneaux      : Le nombre de divisions le long de l'axe.
+/// @param[in] repetitions  : Le nombre de rptitions de la texture.
+///
+/// @return La sphre.
+///
+////////////////////////////////////////////////////////////////////////
+static modele::Mesh construireSphere(int segments, int anneaux, float repetitions)
+{
+	modele::Mesh::Conteneur<modele::Mesh::Vertex> sommets;
+	modele::Mesh::Conteneur<modele::Mesh::Normale> normales;
+	modele::Mesh::Conteneur<modele::Mesh::TexCoord> texCoords;
+	modele::Mesh::Conteneur<modele::Mesh::Couleur> couleurs;
+	modele::Mesh::Conteneur<modele::Mesh::Face> faces;
+	for (int i = 0; i <= anneaux; ++i) {
+		const float v{ static_cast<float>(i) / anneaux };
+		for (int j = 0; j <= segments; ++j) {
+			const float u{ static_cast<float>(j) / segments };
+			const modele::Mesh::Normale normale{ sin(3.14159265f * v) * cos(6.28318531f * u),
+				sin(3.14159265f * v) * sin(6.28318531f * u), cos(3.14159265f * v) };
+			sommets.push_back(normale);
+			normales.push_back(normale);
+			texCoords.emplace_back(u * repetitions, v * repetitions);
+			couleurs.emplace_back(u, v, 1.0f - u, 0.5f + 0.5f * v);
+		}
+	}
+	for (int i = 0; i < anneaux; ++i) {
+		for (int j = 0; j < segments; ++j) {
+			const int coin{ i * (segments + 1) + j };
+			faces.emplace_back(coin, coin + segments + 1, coin + 1);
+			faces.emplace_back(coin + 1, coin + segments + 1, coin + segments + 2);
+		}
+	}
+	return modele::Mesh{ std::move(sommets), std::move(normales), std::move(texCoords), std::move(couleurs),
+		std::move(faces), modele::Materiau{}, "sphere" };
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void mesurerCollisionsLot(const char* precision)
+///
+/// Mesure les collisions de 1 000 objets sphriques avec 500 segments,
+/// par un appel de aidecollision::calculerCollisionSegment() par paire,
+/// puis par aidecollision::calculerCollisionsSegments() avec chaque jeu
+/// d'instructions permis  la compilation.  Tous doivent trouver  peu
+/// prs autant de contacts: seules les paires  la limite du contact
+/// peuvent diffrer.
+///
+/// @param[in] precision : Le nom de la prcision, pour l'affichage.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+template <class T>
+static void mesurerCollisionsLot(const char* precision)
+{
+	using aidecollision::Vecteur3;
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<T> coordonnee{ T(-500), T(500) };
+	std::uniform_real_distribution<T> rayon{ T(1), T(10) };
+	auto positionAleatoire = [&]() {
+		return Vecteur3<T>{ coordonnee(generateur), coordonnee(generateur), T(0) };
+	};
+
+	aidecollision::LotSpheres<T> objets;
+	aidecollision::LotSegments<T> segments;
+	for (int i = 0; i < 1000; ++i)
+		objets.ajouter(positionAleatoire(), rayon(generateur));
+	for (int j = 0; j < 500; ++j) {
+		const Vecteur3<T> point{ positionAleatoire() };
+		segments.ajouter(point, point + Vecteur3<T>{ T(40), T(25), T(0) });
+	}
+
+	std::size_t contactsScalaires{ 0 };
+	const double dureeScalaire{ mesurerDuree([&] {
+		for (std::size_t j = 0; j < segments.obtenirTaille(); ++j) {
+			const Vecteur3<T> point1{ segments.x1[j], segments.y1[j], segments.z1[j] };
+			const Vecteur3<T> point2{ segments.x2[j], segments.y2[j], segments.z2[j] };
+			for (std::size_t i = 0; i < objets.obtenirTaille(); ++i) {
+				if (aidecollision::calculerCollisionSegment<T>(point1, point2,
+					Vecteur3<T>{ objets.x[i], objets.y[i], objets.z[i] }, objets.rayon[i]).type != aidecollision::COLLISION_AUCUNE)
+					++contactsScalaires;
+			}
+		}
+	}) };
+	std::cout << "Collisions de 1000 objets et 500 segments en " << precision << ": "
+		<< dureeScalaire << " ms par appels scalaires (" << contactsScalaires << " contacts)";
+
+	const char* noms[]{ "lot scalaire", "lot SSE", "lot AVX" };
+	std::vector< aidecollision::ContactLot<T> > contacts;
+	for (int jeu = aidecollision::JEU_SCALAIRE; jeu <= aidecollision::obtenirJeuInstructions(); ++jeu) {
+		const double duree{ mesurerDuree([&] {
+			contacts.clear();
+			aidecollision::calculerCollisionsSegments(segments, objets, contacts, true,
+				static_cast<aidecollision::JeuInstructions>(jeu));
+		}) };
+		std::cout << ", " << duree << " ms par " << noms[jeu];
+		CPPUNIT_ASSERT(contacts.size() + contactsScalaires / 100 >= contactsScalaires);
+		CPPUNIT_ASSERT(contacts.size() <= contactsScalaires + contactsScalaires / 100);
+	}
+	std::cout << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void mesurerPrecision(const std::vector<glm::vec3>& points, const std::vector<float>& rayons, double durees[6], unsigned int resultats[6])
+///
+/// Mesure les calculs de collision, d'impact et d'intersection d'une
+/// droite et d'un plan dans la prcision T, sur des cas alatoires
+/// donns en float.  Chaque cas utilise quatre points conscutifs
+/// (extrmits, position et dplacement) et deux rayons conscutifs
+/// (obstacle et objet).
+///
+/// @param[in]  points     : Les points des cas.
+/// @param[in]  rayons     : Les rayons des cas.
+/// @param[out] durees     : La dure de chaque calcul, en millisecondes.
+/// @param[out] resultats  : Le nombre de collisions, d'impacts ou
+///                          d'intersections de chaque calcul.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+template <class T>
+static void mesurerPrecision(const std::vector<glm::vec3>& points, const std::vector<float>& rayons, double durees[6], unsigned int resultats[6])
+{
+	using aidecollision::Vecteur2;
+	using aidecollision::Vecteur3;
+
+	const std::vector< Vecteur3<T> > p(points.begin(), points.end());
+	const std::vector<T> r(rayons.begin(), rayons.end());
+	const std::size_t nombreCas{ r.size() / 2 };
+	std::fill(resultats, resultats + 6, 0u);
+
+	durees[0] = mesurerDuree([&] {
+		for (std::size_t i = 0; i < nombreCas; ++i) {
+			if (aidecollision::calculerCollisionSegment(p[4 * i], p[4 * i + 1], p[4 * i + 2], r[2 * i + 1]).type != aidecollision::COLLISION_AUCUNE)
+				++resultats[0];
+		}
+	});
+	durees[1] = mesurerDuree([&] {
+		for (std::size_t i = 0; i < nombreCas; ++i) {
+			if (aidecollision::calculerCollisionSphere(p[4 * i], r[2 * i], p[4 * i + 2], r[2 * i + 1]).type != aidecollision::COLLISION_AUCUNE)
+				++resultats[1];
+		}
+	});
+	durees[2] = mesurerDuree([&] {
+		for (std::size_t i = 0; i < nombreCas; ++i) {
+			if (aidecollision::calculerCollisionArc(Vecteur2<T>{ p[4 * i] }, Vecteur2<T>{ p[4 * i + 1] },
+				Vecteur2<T>{ p[4 * i + 2] }, Vecteur2<T>{ p[4 * i + 3] }, r[2 * i + 1]).type != aidecollision::COLLISION_AUCUNE)
+				++resultats[2];
+		}
+	});
+	durees[3] = mesurerDuree([&] {
+		for (std::size_t i = 0; i < nombreCas; ++i) {
+			if (aidecollision::calculerImpactSegment(p[4 * i], p[4 * i + 1], p[4 * i + 2], T(2) * p[4 * i + 3], r[2 * i + 1]).type != aidecollision::COLLISION_AUCUNE)
+				++resultats[3];
+		}
+	});
+	durees[4] = mesurerDuree([&] {
+		for (std::size_t i = 0; i < nombreCas; ++i) {
+			if (aidecollision::calculerImpactSphere(p[4 * i], r[2 * i], p[4 * i + 2], T(2) * p[4 * i + 3], r[2 * i + 1]).type != aidecollision::COLLISION_AUCUNE)
+				++resultats[4];
+		}
+	});
+	durees[5] = mesurerDuree([&] {
+		const math::Plan3Dt<T> plan{ Vecteur3<T>{ T(0), T(0), T(1) }, Vecteur3<T>{ T(0), T(0), T(2) } };
+		Vecteur3<T> intersection;
+		for (std::size_t i = 0; i < nombreCas; ++i) {
+			math::Droite3Dt<T> droite{ p[4 * i], p[4 * i + 1] };
+			if (droite.intersection(plan, intersection) && intersection.x > T(0))
+				++resultats[5];
+		}
+	});
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testInsertion()
+///
+/// Cas de test: mesure le cot d'une insertion sous un parent trouv
+/// par son type, comme dans ArbreRendu::ajouterNouveauNoeud(), pour des
+/// arbres de 1 000, 10 000 et 100 000 noeuds.  Le parent est recherch
+/// par l'index des types et, pour comparaison, par le parcours de
+/// NoeudComposite::chercher().  Le parent est ajout aprs tous les
+/// autres noeuds, ce qui est le pire cas du parcours.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testInsertion()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+	const int nombreInsertions{ 1000 };
+
+	for (int taille : { 1000, 10000, 100000 }) {
+		ArbreRendu arbre;
+		for (int i = 0; i < taille; ++i)
+			arbre.ajouter(new NoeudConeCube{ cube });
+		arbre.ajouter(new NoeudComposite{ "groupe" });
+
+		const double dureeIndex{ mesurerDuree([&arbre, &cube, nombreInsertions] {
+			for (int i = 0; i < nombreInsertions; ++i)
+				arbre.obtenirPremierNoeud("groupe")->ajouter(new NoeudConeCube{ cube });
+		}) };
+		const double dureeParcours{ mesurerDuree([&arbre, &cube, nombreInsertions] {
+			for (int i = 0; i < nombreInsertions; ++i)
+				arbre.NoeudComposite::chercher("groupe")->ajouter(new NoeudConeCube{ cube });
+		}) };
+
+		std::cout << "Insertion dans " << taille << " noeuds: "
+			<< static_cast<long long>(dureeIndex * 1e6 / nombreInsertions) << " ns par l'index, "
+			<< static_cast<long long>(dureeParcours * 1e6 / nombreInsertions) << " ns par le parcours" << std::endl;
+		CPPUNIT_ASSERT(arbre.obtenirNoeuds(cube).size() == static_cast<std::size_t>(taille + 2 * nombreInsertions));
+
+		// Le parcours visite tout l'arbre, l'index non
+		if (taille == 100000)
+			CPPUNIT_ASSERT(dureeIndex < dureeParcours);
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testAllocationPool()
+///
+/// Cas de test: mesure une passe d'animation de 100 000 noeuds allous
+/// sur le tas, entrecoups d'autres allocations comme dans un tas qui a
+/// dj servi, puis des mmes noeuds allous contigus dans un pool.  Les
+/// compteurs du pool et la dure de la libration de la scne au
+/// complet sont aussi affichs.  L'animation est faite sur un seul fil
+/// pour ne mesurer que le parcours.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testAllocationPool()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+	const std::size_t nombreNoeuds{ 100000 };
+	const int nombrePasses{ 20 };
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+	const bool monoFil{ ordonnanceur->estMonoFil() };
+	ordonnanceur->assignerMonoFil(true);
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_int_distribution<std::size_t> tailleAutre{ 16, 512 };
+	std::vector<std::unique_ptr<char[]>> autres;
+	ArbreRendu arbreTas;
+	for (std::size_t i = 0; i < nombreNoeuds; ++i) {
+		autres.emplace_back(new char[tailleAutre(generateur)]);
+		arbreTas.ajouter(new NoeudConeCube{ cube });
+	}
+
+	utilitaire::PoolMemoire pool{ NoeudAbstrait::calculerTailleAllocation(sizeof(NoeudConeCube)) };
+	ArbreRendu arbrePool;
+	for (std::size_t i = 0; i < nombreNoeuds; ++i)
+		arbrePool.ajouter(new (pool) NoeudConeCube{ cube });
+	CPPUNIT_ASSERT(pool.obtenirNombreAllocations() == nombreNoeuds);
+	CPPUNIT_ASSERT(pool.obtenirNombreBlocsUtilises() == nombreNoeuds);
+
+	const double dureeTas{ mesurerDuree([&arbreTas, nombrePasses] {
+		for (int i = 0; i < nombrePasses; ++i)
+			arbreTas.animer(0.01f);
+	}) };
+	const double dureePool{ mesurerDuree([&arbrePool, nombrePasses] {
+		for (int i = 0; i < nombrePasses; ++i)
+			arbrePool.animer(0.01f);
+	}) };
+	std::cout << "Animation de " << nombreNoeuds << " noeuds: "
+		<< dureeTas / nombrePasses << " ms sur le tas, "
+		<< dureePool / nombrePasses << " ms dans le pool" << std::endl;
+	std::cout << "Pool: " << pool.obtenirNombreAllocations() << " allocations, "
+		<< pool.obtenirNombrePlaques() << " plaques de "
+		<< pool.obtenirTailleBloc() << " octets par bloc" << std::endl;
+
+	// La scne est libre d'un coup, comme par ArbreRenduINF2990::initialiser()
+	bool relache{ false };
+	const double dureeLiberation{ mesurerDuree([&arbrePool, &pool, &relache] {
+		arbrePool.vider();
+		relache = pool.relacher();
+	}) };
+	std::cout << "Libration de la scne du pool: " << dureeLiberation << " ms" << std::endl;
+	CPPUNIT_ASSERT(relache);
+	CPPUNIT_ASSERT(pool.obtenirNombreLiberations() == nombreNoeuds);
+	CPPUNIT_ASSERT(pool.obtenirNombrePlaques() == 0);
+
+	ordonnanceur->assignerMonoFil(monoFil);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testStockageTransformations()
+///
+/// Cas de test: mesure une passe d'animation de 100 000 araignes, qui
+/// lisent et crivent leur position, et un dplacement de tous les
+/// noeuds par ArbreRendu::translaterPositions(), sans puis avec le
+/// stockage contigu des transformations.  Les deux arbres doivent
+/// donner les mmes positions.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testStockageTransformations()
+{
+	const std::string& araignee{ ArbreRenduINF2990::NOM_ARAIGNEE };
+	const int nombreNoeuds{ 100000 };
+	const int nombrePasses{ 10 };
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+	const bool monoFil{ ordonnanceur->estMonoFil() };
+	ordonnanceur->assignerMonoFil(true);
+
+	ArbreRendu arbres[2];
+	for (ArbreRendu& arbre : arbres) {
+		for (int i = 0; i < nombreNoeuds; ++i)
+			arbre.ajouter(new NoeudAraignee{ araignee });
+	}
+	arbres[1].activerStockageTransformations(true);
+
+	double dureesAnimation[2], dureesDeplacement[2];
+	for (int i = 0; i < 2; ++i) {
+		ArbreRendu& arbre = arbres[i];
+		dureesAnimation[i] = mesurerDuree([&arbre, nombrePasses] {
+			for (int j = 0; j < nombrePasses; ++j)
+				arbre.animer(0.01f);
+		}) / nombrePasses;
+		dureesDeplacement[i] = mesurerDuree([&arbre, nombrePasses] {
+			for (int j = 0; j < nombrePasses; ++j)
+				arbre.translaterPositions(glm::dvec3{ 1, 0, 0 });
+		}) / nombrePasses;
+	}
+	std::cout << "Animation de " << nombreNoeuds << " araignes: "
+		<< dureesAnimation[0] << " ms sans stockage, "
+		<< dureesAnimation[1] << " ms avec stockage contigu" << std::endl;
+	std::cout << "Dplacement de " << nombreNoeuds << " noeuds: "
+		<< dureesDeplacement[0] << " ms sans stockage, "
+		<< dureesDeplacement[1] << " ms avec stockage contigu" << std::endl;
+
+	const std::vector<NoeudAbstrait*>& sans = arbres[0].obtenirNoeuds(araignee);
+	const std::vector<NoeudAbstrait*>& avec = arbres[1].obtenirNoeuds(araignee);
+	for (std::size_t i = 0; i < sans.size(); ++i)
+		CPPUNIT_ASSERT(sans[i]->obtenirPositionRelative() == avec[i]->obtenirPositionRelative());
+
+	// Une boucle sur un tableau contre un appel virtuel par noeud
+	CPPUNIT_ASSERT(dureesDeplacement[1] < dureesDeplacement[0]);
+
+	ordonnanceur->assignerMonoFil(monoFil);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testParcours()
+///
+/// Cas de test: mesure les oprations de l'arbre qui reposent sur
+/// ParcoursArbre, sur une chane de 10 000 niveaux et sur une racine de
+/// 100 000 enfants.  Les dures sont donnes par noeud, pour comparer
+/// les deux formes d'arbre.  La recherche d'une feuille place  la fin
+/// de l'ordre prfixe et la vrification de la slection parcourent tout
+/// l'arbre.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testParcours()
+{
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+	const bool monoFil{ ordonnanceur->estMonoFil() };
+	ordonnanceur->assignerMonoFil(true);
+
+	for (bool profond : { true, false }) {
+		const unsigned int nombreNoeuds{ profond ? 10000u : 100000u };
+		ArbreRendu arbre;
+		NoeudAbstrait* parent{ &arbre };
+		const double dureeConstruction{ mesurerDuree([&parent, &arbre, profond, nombreNoeuds] {
+			for (unsigned int i = 0; i < nombreNoeuds; ++i) {
+				NoeudAbstrait* enfant{ new NoeudComposite{ "composite" } };
+				parent->ajouter(enfant);
+				if (profond)
+					parent = enfant;
+			}
+		}) };
+		NoeudAbstrait* feuille{ new NoeudAbstrait{ "feuille" } };
+		parent->ajouter(feuille);
+
+		unsigned int profondeur{ 0 };
+		const NoeudAbstrait* trouve{ nullptr };
+		bool selection{ true };
+		const double durees[]{
+			dureeConstruction,
+			mesurerDuree([&arbre, &profondeur] { profondeur = arbre.calculerProfondeur(); }),
+			mesurerDuree([&arbre, &trouve] { trouve = arbre.NoeudComposite::chercher("feuille"); }),
+			mesurerDuree([&arbre, &selection] { selection = arbre.NoeudComposite::selectionExiste(); }),
+			mesurerDuree([&arbre] { arbre.assignerModePolygones(GL_LINE); }),
+			mesurerDuree([&arbre] { arbre.animer(0.01f); }),
+			mesurerDuree([&arbre] { arbre.afficher(glm::dmat4{ 1.0 }); }),
+			mesurerDuree([&arbre] { arbre.vider(); })
+		};
+		CPPUNIT_ASSERT(profondeur == (profond ? nombreNoeuds + 2 : 2));
+		CPPUNIT_ASSERT(trouve == feuille);
+		CPPUNIT_ASSERT(!selection);
+		CPPUNIT_ASSERT(arbre.obtenirNombreDescendants() == 0);
+
+		const char* operations[]{
+			"construction", "profondeur", "recherche", "selection",
+			"mode", "animation", "affichage", "destruction"
+		};
+		std::cout << "Arbre " << (profond ? "profond" : "large") << " de " << nombreNoeuds << " noeuds (ns par noeud):";
+		for (int i = 0; i < 8; ++i)
+			std::cout << " " << operations[i] << " " << static_cast<long long>(durees[i] * 1e6 / nombreNoeuds);
+		std::cout << std::endl;
+	}
+
+	ordonnanceur->assignerMonoFil(monoFil);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testIdentifiantsTypes()
+///
+/// Cas de test: affiche la mmoire qu'occupe le type dans chaque noeud,
+/// puis mesure le dnombrement des cnes-cubes d'un arbre de 100 000
+/// noeuds de deux types, par un parcours qui compare les noms des
+/// types, par un parcours qui compare leurs identifiants et par l'index
+/// des types de l'arbre.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testIdentifiantsTypes()
+{
+	const std::string& cube{ ArbreRenduINF2990::NOM_CONECUBE };
+	const std::string& araignee{ ArbreRenduINF2990::NOM_ARAIGNEE };
+	const int nombreNoeuds{ 100000 };
+	const int nombrePasses{ 10 };
+
+	std::cout << "Type dans un noeud: " << sizeof(RegistreTypes::Identifiant)
+		<< " octets par identifiant, au lieu de " << sizeof(std::string)
+		<< " octets par chane; NoeudAbstrait: " << sizeof(NoeudAbstrait)
+		<< " octets, NoeudConeCube: " << sizeof(NoeudConeCube) << " octets" << std::endl;
+	CPPUNIT_ASSERT(sizeof(RegistreTypes::Identifiant) < sizeof(std::string));
+
+	ArbreRendu arbre;
+	for (int i = 0; i < nombreNoeuds; ++i) {
+		if (i % 2 == 0)
+			arbre.ajouter(new NoeudConeCube{ cube });
+		else
+			arbre.ajouter(new NoeudAraignee{ araignee });
+	}
+	const RegistreTypes::Identifiant identifiant{ RegistreTypes::obtenirIdentifiant(cube) };
+
+	std::size_t parNom{ 0 }, parIdentifiant{ 0 }, parIndex{ 0 };
+	const double dureeNom{ mesurerDuree([&] {
+		for (int i = 0; i < nombrePasses; ++i) {
+			ParcoursArbre::parcourirPrefixe<const NoeudAbstrait>(&arbre, [&](const NoeudAbstrait* noeud) {
+				if (noeud->obtenirType() == cube)
+					++parNom;
+				return ParcoursArbre::CONTINUER;
+			});
+		}
+	}) / nombrePasses };
+	const double dureeIdentifiant{ mesurerDuree([&] {
+		for (int i = 0; i < nombrePasses; ++i) {
+			ParcoursArbre::parcourirPrefixe<const NoeudAbstrait>(&arbre, [&](const NoeudAbstrait* noeud) {
+				if (noeud->obtenirIdentifiantType() == identifiant)
+					++parIdentifiant;
+				return ParcoursArbre::CONTINUER;
+			});
+		}
+	}) / nombrePasses };
+	const double dureeIndex{ mesurerDuree([&] {
+		for (int i = 0; i < nombrePasses; ++i)
+			parIndex += arbre.obtenirNoeuds(cube).size();
+	}) / nombrePasses };
+
+	std::cout << "Dnombrement d'un type parmi " << nombreNoeuds << " noeuds: "
+		<< dureeNom << " ms par les noms, "
+		<< dureeIdentifiant << " ms par les identifiants, "
+		<< dureeIndex << " ms par l'index" << std::endl;
+	CPPUNIT_ASSERT(parNom == nombrePasses * nombreNoeuds / 2);
+	CPPUNIT_ASSERT(parIdentifiant == parNom);
+	CPPUNIT_ASSERT(parIndex == parNom);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testEliminationHorsChamp()
+///
+/// Cas de test: mesure l'affichage d'une scne de 100 groupes de 1 000
+/// feuilles rpartis sur une grille de 2 000 units de ct, dans une
+/// vue orthogonale qui n'en montre que 200 par 200, avec et sans
+/// l'limination des noeuds hors du champ.  Les compteurs de noeuds
+/// affichs et limins du dernier affichage sont aussi affichs.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testEliminationHorsChamp()
+{
+	const int nombreGroupes{ 100 };
+	const int feuillesParGroupe{ 1000 };
+	const int nombrePasses{ 10 };
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<double> decalage{ -90.0, 90.0 };
+	ArbreRendu arbre;
+	for (int i = 0; i < nombreGroupes; ++i) {
+		NoeudAbstrait* groupe{ new NoeudComposite{ "groupe" } };
+		groupe->assignerPositionRelative(glm::dvec3{ (i % 10 - 4.5) * 200.0, (i / 10 - 4.5) * 200.0, 0 });
+		for (int j = 0; j < feuillesParGroupe; ++j) {
+			NoeudAbstrait* feuille{ new NoeudAbstrait{ "feuille" } };
+			feuille->assignerObjetRendu(nullptr, nullptr, 5.0);
+			feuille->assignerPositionRelative(glm::dvec3{ decalage(generateur), decalage(generateur), 0 });
+			groupe->ajouter(feuille);
+		}
+		arbre.ajouter(groupe);
+	}
+
+	const vue::VueOrtho vue{
+		vue::Camera{ glm::dvec3{ 0, 0, 200 }, glm::dvec3{ 0, 0, 0 }, glm::dvec3{ 0, 1, 0 }, glm::dvec3{ 0, 1, 0 } },
+		vue::ProjectionOrtho{
+			0, 500, 0, 500,
+			1, 1000, 1, 10000, 1.25,
+			-100, 100, -100, 100 }
+	};
+
+	double durees[2];
+	unsigned int affiches[2], elimines[2];
+	for (int i = 0; i < 2; ++i) {
+		arbre.assignerEliminationHorsChamp(i == 1);
+		durees[i] = mesurerDuree([&arbre, &vue, nombrePasses] {
+			for (int j = 0; j < nombrePasses; ++j)
+				arbre.afficher(vue);
+		}) / nombrePasses;
+		affiches[i] = arbre.obtenirNombreNoeudsAffiches();
+		elimines[i] = arbre.obtenirNombreNoeudsElimines();
+	}
+
+	std::cout << "Affichage de " << nombreGroupes * (feuillesParGroupe + 1) << " noeuds: "
+		<< durees[0] << " ms sans limination (" << affiches[0] << " affichs), "
+		<< durees[1] << " ms avec limination (" << affiches[1] << " affichs, "
+		<< elimines[1] << " limins)" << std::endl;
+	CPPUNIT_ASSERT(elimines[0] == 0);
+	CPPUNIT_ASSERT(affiches[1] + elimines[1] == affiches[0]);
+	CPPUNIT_ASSERT(affiches[1] < affiches[0] / 10);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testRequetesSpatiales()
+///
+/// Cas de test: mesure des requtes par bote, par rayon et des cinq
+/// plus proches voisins sur 1 000, 10 000 et 100 000 feuilles rparties
+/// dans un cube de 1 000 units, par la hirarchie des volumes de
+/// l'arbre et par un parcours exhaustif des feuilles.  La mise  jour de
+/// la hirarchie aprs le dplacement du dixime des feuilles est aussi
+/// mesure.  Les deux approches doivent trouver autant de noeuds.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testRequetesSpatiales()
+{
+	const int nombreRequetes{ 1000 };
+	const int nombreRequetesVoisins{ 100 };
+
+	for (int taille : { 1000, 10000, 100000 }) {
+		std::mt19937 generateur{ 2990 };
+		std::uniform_real_distribution<double> coordonnee{ -500.0, 500.0 };
+		auto positionAleatoire = [&]() {
+			return glm::dvec3{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) };
+		};
+
+		ArbreRendu arbre;
+		std::vector<NoeudAbstrait*> feuilles;
+		for (int i = 0; i < taille; ++i) {
+			NoeudAbstrait* feuille{ new NoeudAbstrait{ "feuille" } };
+			feuille->assignerObjetRendu(nullptr, nullptr, 1.0 + i % 5);
+			feuille->assignerPositionRelative(positionAleatoire());
+			arbre.ajouter(feuille);
+			feuilles.push_back(feuille);
+		}
+
+		const double dureeMiseAJour{ mesurerDuree([&] {
+			for (int i = 0; i < taille; i += 10)
+				feuilles[i]->assignerPositionRelative(positionAleatoire());
+			arbre.mettreAJourVolumes();
+		}) };
+
+		// Les mmes requtes pour les deux approches
+		std::vector<glm::dvec3> points(nombreRequetes);
+		for (glm::dvec3& point : points)
+			point = positionAleatoire();
+		auto centre = [](const NoeudAbstrait* noeud) { return glm::dvec3{ noeud->obtenirMatriceMonde()[3] }; };
+		const glm::dvec3 origine{ 0.0, 0.0, 2000.0 };
+
+		std::size_t trouvesHierarchie{ 0 }, trouvesParcours{ 0 };
+		std::vector<NoeudAbstrait*> trouves;
+		const double boiteHierarchie{ mesurerDuree([&] {
+			for (const glm::dvec3& coin : points) {
+				trouves.clear();
+				arbre.chercherNoeudsDansBoite(utilitaire::BoiteEnglobante{ coin, coin + glm::dvec3{ 50.0 } }, trouves);
+				trouvesHierarchie += trouves.size();
+			}
+		}) };
+		const double boiteParcours{ mesurerDuree([&] {
+			for (const glm::dvec3& coin : points) {
+				const utilitaire::BoiteEnglobante boite{ coin, coin + glm::dvec3{ 50.0 } };
+				for (const NoeudAbstrait* feuille : feuilles) {
+					if (utilitaire::ArbreVolumes<NoeudAbstrait*>::calculerDistance(centre(feuille), boite) <= feuille->obtenirRayonEnglobant())
+						++trouvesParcours;
+				}
+			}
+		}) };
+		CPPUNIT_ASSERT(trouvesHierarchie == trouvesParcours);
+
+		std::size_t touchesHierarchie{ 0 }, touchesParcours{ 0 };
+		const double rayonHierarchie{ mesurerDuree([&] {
+			for (const glm::dvec3& point : points) {
+				if (arbre.chercherNoeudSurRayon(origine, glm::normalize(point - origine)) != nullptr)
+					++touchesHierarchie;
+			}
+		}) };
+		const double rayonParcours{ mesurerDuree([&] {
+			for (const glm::dvec3& point : points) {
+				const glm::dvec3 direction{ glm::normalize(point - origine) };
+				const NoeudAbstrait* touche{ nullptr };
+				double meilleure{ std::numeric_limits<double>::max() };
+				for (const NoeudAbstrait* feuille : feuilles) {
+					const glm::dvec3 ecart{ centre(feuille) - origine };
+					const double projection{ glm::dot(ecart, direction) };
+					const double rayon{ feuille->obtenirRayonEnglobant() };
+					const double d2{ glm::dot(ecart, ecart) - projection * projection };
+					if (projection > 0.0 && d2 <= rayon * rayon && projection - sqrt(rayon * rayon - d2) < meilleure) {
+						meilleure = projection - sqrt(rayon * rayon - d2);
+						touche = feuille;
+					}
+				}
+				if (touche != nullptr)
+					++touchesParcours;
+			}
+		}) };
+		CPPUNIT_ASSERT(touchesHierarchie == touchesParcours);
+
+		std::vector<NoeudAbstrait*> voisins, tries{ feuilles };
+		const double voisinsHierarchie{ mesurerDuree([&] {
+			for (int i = 0; i < nombreRequetesVoisins; ++i) {
+				voisins.clear();
+				arbre.chercherNoeudsPlusProches(points[i], 5, voisins);
+			}
+		}) };
+		const double voisinsParcours{ mesurerDuree([&] {
+			for (int i = 0; i < nombreRequetesVoisins; ++i) {
+				const glm::dvec3& point = points[i];
+				std::partial_sort(tries.begin(), tries.begin() + 5, tries.end(), [&](const NoeudAbstrait* a, const NoeudAbstrait* b) {
+					return glm::length(point - centre(a)) - a->obtenirRayonEnglobant() <
+						glm::length(point - centre(b)) - b->obtenirRayonEnglobant();
+				});
+			}
+		}) };
+		CPPUNIT_ASSERT(voisins.size() == 5);
+
+		std::cout << "Requtes sur " << taille << " feuilles (hirarchie / parcours, microsecondes par requte): bote "
+			<< boiteHierarchie * 1e3 / nombreRequetes << " / " << boiteParcours * 1e3 / nombreRequetes << ", rayon "
+			<< rayonHierarchie * 1e3 / nombreRequetes << " / " << rayonParcours * 1e3 / nombreRequetes << ", voisins "
+			<< voisinsHierarchie * 1e3 / nombreRequetesVoisins << " / " << voisinsParcours * 1e3 / nombreRequetesVoisins
+			<< "; mise  jour de " << taille / 10 << " dplacements: " << dureeMiseAJour << " ms" << std::endl;
+
+		if (taille == 100000) {
+			CPPUNIT_ASSERT(boiteHierarchie < boiteParcours);
+			CPPUNIT_ASSERT(rayonHierarchie < rayonParcours);
+			CPPUNIT_ASSERT(voisinsHierarchie < voisinsParcours);
+		}
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testCollisionsLot()
+///
+/// Cas de test: mesure les collisions par lots contre les appels
+/// scalaires, en simple et en double prcision.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testCollisionsLot()
+{
+	mesurerCollisionsLot<float>("float");
+	mesurerCollisionsLot<double>("double");
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testAvancementParImpacts()
+///
+/// Cas de test: mesure une seconde de simulation de billes rapides dans
+/// une salle ferme par des murs minces et divise en quatre par deux
+/// cloisons.  Les sous-pas fixes corrigent l'enfoncement  la fin de
+/// chaque sous-pas alors que l'avancement par impacts s'arrte  chaque
+/// contact.  La prcision est la distance  la trajectoire exacte et le
+/// nombre de billes qui ont travers un mur ou une cloison.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testAvancementParImpacts()
+{
+	const int nombreBilles{ 200 };
+	const int nombreImages{ 60 };
+	const double dureeImage{ 1.0 / nombreImages };
+	const double rayon{ 0.25 };
+	const double demiCote{ 10.0 };
+
+	// Quatre murs et deux cloisons en croix qui divisent la salle en quatre.
+	// Les extrmits des cloisons touchent les murs: aucun coin saillant
+	// n'amplifie les erreurs d'arrondi.
+	const glm::dvec3 murs[][2]{
+		{ glm::dvec3{ -demiCote, -demiCote, 0.0 }, glm::dvec3{ demiCote, -demiCote, 0.0 } },
+		{ glm::dvec3{ demiCote, -demiCote, 0.0 }, glm::dvec3{ demiCote, demiCote, 0.0 } },
+		{ glm::dvec3{ demiCote, demiCote, 0.0 }, glm::dvec3{ -demiCote, demiCote, 0.0 } },
+		{ glm::dvec3{ -demiCote, demiCote, 0.0 }, glm::dvec3{ -demiCote, -demiCote, 0.0 } },
+		{ glm::dvec3{ -demiCote, 0.0, 0.0 }, glm::dvec3{ demiCote, 0.0, 0.0 } },
+		{ glm::dvec3{ 0.0, -demiCote, 0.0 }, glm::dvec3{ 0.0, demiCote, 0.0 } }
+	};
+	const aidecollision::CalculImpact calculerImpact{
+		[&murs, rayon](const glm::dvec3& position, const glm::dvec3& deplacement) {
+			aidecollision::DetailsImpact premier{ aidecollision::calculerImpactSegment(murs[0][0], murs[0][1], position, deplacement, rayon) };
+			for (const auto& mur : murs)
+				premier = aidecollision::choisirPremierImpact(premier, aidecollision::calculerImpactSegment(mur[0], mur[1], position, deplacement, rayon));
+			return premier;
+		}
+	};
+
+	// Billes hors de contact avec les murs, jusqu' 10 units par image.
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<double> coordonnee{ -demiCote + 2.0 * rayon, demiCote - 2.0 * rayon };
+	std::uniform_real_distribution<double> vitesse{ -425.0, 425.0 };
+	std::vector<glm::dvec3> positionsDepart, vitessesDepart;
+	while (positionsDepart.size() < static_cast<std::size_t>(nombreBilles)) {
+		const glm::dvec3 position{ coordonnee(generateur), coordonnee(generateur), 0.0 };
+		bool libre{ true };
+		for (const auto& mur : murs)
+			libre = libre && aidecollision::calculerCollisionSegment(mur[0], mur[1], position, 2.0 * rayon).type == aidecollision::COLLISION_AUCUNE;
+		if (libre) {
+			positionsDepart.push_back(position);
+			vitessesDepart.push_back(glm::dvec3{ vitesse(generateur), vitesse(generateur), 0.0 });
+		}
+	}
+
+	// Simule toutes les billes et retourne la dure.
+	auto simuler = [&](bool parImpacts, int sousPas, std::vector<glm::dvec3>& positions) {
+		positions = positionsDepart;
+		std::vector<glm::dvec3> vitesses{ vitessesDepart };
+		const double pas{ dureeImage / sousPas };
+		return mesurerDuree([&] {
+			for (int image = 0; image < nombreImages; ++image) {
+				for (int i = 0; i < nombreBilles; ++i) {
+					for (int sp = 0; sp < sousPas; ++sp) {
+						if (parImpacts) {
+							aidecollision::avancerParImpacts(positions[i], vitesses[i], pas, 1.0, calculerImpact, 16);
+							continue;
+						}
+						positions[i] += vitesses[i] * pas;
+						for (const auto& mur : murs) {
+							const aidecollision::DetailsCollision details{
+								aidecollision::calculerCollisionSegment(mur[0], mur[1], positions[i], rayon) };
+							if (details.type == aidecollision::COLLISION_AUCUNE)
+								continue;
+							positions[i] += details.enfoncement * details.direction;
+							const double vitesseNormale{ glm::dot(vitesses[i], details.direction) };
+							if (vitesseNormale < 0.0)
+								vitesses[i] -= 2.0 * vitesseNormale * details.direction;
+						}
+					}
+				}
+			}
+		});
+	};
+
+	// Une seule tape par image suit la trajectoire exacte.
+	std::vector<glm::dvec3> reference;
+	simuler(true, 1, reference);
+
+	const struct { bool parImpacts; int sousPas; } modes[]{
+		{ false, 5 }, { false, 10 }, { false, 50 }, { true, 1 }, { true, 5 }, { true, 10 }
+	};
+	for (const auto& mode : modes) {
+		std::vector<glm::dvec3> positions;
+		const double duree{ simuler(mode.parImpacts, mode.sousPas, positions) };
+
+		int traversees{ 0 };
+		double erreurMoyenne{ 0.0 }, erreurMaximale{ 0.0 };
+		for (int i = 0; i < nombreBilles; ++i) {
+			if (std::abs(positions[i].x) > demiCote || std::abs(positions[i].y) > demiCote ||
+				positions[i].x * reference[i].x < 0.0 || positions[i].y * reference[i].y < 0.0)
+				++traversees;
+			const double erreur{ glm::length(positions[i] - reference[i]) };
+			erreurMoyenne += erreur / nombreBilles;
+			if (erreur > erreurMaximale)
+				erreurMaximale = erreur;
+		}
+
+		std::cout << (mode.parImpacts ? "Par impacts, " : "Sous-pas fixes, ") << mode.sousPas << " sous-pas par image: "
+			<< duree << " ms pour " << nombreBilles << " billes et " << nombreImages << " images, "
+			<< traversees << " billes passes  travers un mur, erreur moyenne " << erreurMoyenne << " et maximale " << erreurMaximale << std::endl;
+
+		if (mode.parImpacts) {
+			CPPUNIT_ASSERT(traversees == 0);
+			CPPUNIT_ASSERT(erreurMaximale < 1e-6);
+		}
+		else if (mode.sousPas == 5) {
+			CPPUNIT_ASSERT(traversees > 0);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testSimplePrecision()
+///
+/// Cas de test: mesure les calculs de collision en float et en double sur
+/// les cas alatoires de AideCollisionTest::testSimplePrecision(), en
+/// plus grand nombre.  Les deux prcisions doivent trouver  peu prs
+/// autant de collisions: seuls les contacts  la limite peuvent
+/// diffrer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testSimplePrecision()
+{
+	const int nombreCas{ 200000 };
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<float> coordonnee{ -10.0f, 10.0f };
+	std::uniform_real_distribution<float> rayon{ 0.1f, 5.0f };
+	std::vector<glm::vec3> points;
+	std::vector<float> rayons;
+	for (int i = 0; i < 4 * nombreCas; ++i)
+		points.push_back(glm::vec3{ coordonnee(generateur), coordonnee(generateur), coordonnee(generateur) });
+	for (int i = 0; i < 2 * nombreCas; ++i)
+		rayons.push_back(rayon(generateur));
+
+	double dureesSimple[6], dureesDouble[6];
+	unsigned int resultatsSimple[6], resultatsDouble[6];
+	mesurerPrecision<float>(points, rayons, dureesSimple, resultatsSimple);
+	mesurerPrecision<double>(points, rayons, dureesDouble, resultatsDouble);
+
+	const char* noms[]{ "collision segment", "collision sphre", "collision arc", "impact segment", "impact sphre", "droite et plan" };
+	std::cout << nombreCas << " cas (float / double, ms), " << sizeof(glm::vec3) << " / " << sizeof(glm::dvec3) << " octets par point:";
+	for (int calcul = 0; calcul < 6; ++calcul) {
+		std::cout << (calcul == 0 ? " " : ", ") << noms[calcul] << " " << dureesSimple[calcul] << " / " << dureesDouble[calcul];
+		CPPUNIT_ASSERT(resultatsSimple[calcul] + resultatsDouble[calcul] / 1000 >= resultatsDouble[calcul]);
+		CPPUNIT_ASSERT(resultatsSimple[calcul] <= resultatsDouble[calcul] + resultatsDouble[calcul] / 1000);
+	}
+	std::cout << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testArbreTriangles()
+///
+/// Cas de test: mesure la construction, la mmoire et le dbit des
+/// requtes de la hirarchie de triangles sur un terrain ondul de 10 000,
+/// 100 000 et 1 000 000 de triangles.  Sur le plus petit terrain, les
+/// requtes sont compares au test de chacun des triangles, chacun plac
+/// seul dans sa propre hirarchie comme dans ArbreTrianglesTest.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testArbreTriangles()
+{
+	using Sommet = modele::ArbreTriangles::Sommet;
+	using Face = modele::ArbreTriangles::Face;
+
+	const double cote{ 100.0 };
+	auto hauteur = [](double x, double y) { return 2.0 * sin(x / 5.0) * cos(y / 7.0); };
+	const int nombreRequetes{ 100000 };
+	const int nombreRequetesExhaustives{ 200 };
+
+	for (int cases : { 71, 224, 707 }) {
+		// Grille de cases x cases carrs, chacun coup en deux triangles.
+		std::vector<Sommet> sommets;
+		std::vector<Face> faces;
+		const double pas{ cote / cases };
+		for (int i = 0; i <= cases; ++i) {
+			for (int j = 0; j <= cases; ++j)
+				sommets.push_back(Sommet{ static_cast<float>(i * pas), static_cast<float>(j * pas), static_cast<float>(hauteur(i * pas, j * pas)) });
+		}
+		for (int i = 0; i < cases; ++i) {
+			for (int j = 0; j < cases; ++j) {
+				const int coin{ i * (cases + 1) + j };
+				faces.push_back(Face{ coin, coin + cases + 1, coin + 1 });
+				faces.push_back(Face{ coin + 1, coin + cases + 1, coin + cases + 2 });
+			}
+		}
+
+		modele::ArbreTriangles arbre;
+		const double dureeConstruction{ mesurerDuree([&] { arbre.construire(sommets, faces); }) };
+		CPPUNIT_ASSERT(arbre.obtenirNombreTriangles() == faces.size());
+
+		// Sphres prs de la surface et rayons verticaux qui la traversent.
+		std::mt19937 generateur{ 2990 };
+		std::uniform_real_distribution<double> coordonnee{ 1.0, cote - 1.0 };
+		std::uniform_real_distribution<double> ecart{ -1.0, 1.0 };
+		std::vector<glm::dvec3> centres, origines;
+		for (int i = 0; i < nombreRequetes; ++i) {
+			const double x{ coordonnee(generateur) }, y{ coordonnee(generateur) };
+			centres.push_back(glm::dvec3{ x, y, hauteur(x, y) + ecart(generateur) });
+			origines.push_back(glm::dvec3{ x, y, 10.0 });
+		}
+		const glm::dvec3 deplacement{ 0.5, -0.5, -20.0 };
+
+		int collisions{ 0 }, impacts{ 0 };
+		const double dureeSpheres{ mesurerDuree([&] {
+			for (const glm::dvec3& centre : centres) {
+				if (arbre.calculerCollisionSphere(centre, 0.5).type != aidecollision::COLLISION_AUCUNE)
+					++collisions;
+			}
+		}) };
+		const double dureeRayons{ mesurerDuree([&] {
+			for (const glm::dvec3& origine : origines) {
+				if (arbre.calculerImpactRayon(origine, deplacement).type != aidecollision::COLLISION_AUCUNE)
+					++impacts;
+			}
+		}) };
+		CPPUNIT_ASSERT(collisions > nombreRequetes / 10);
+		CPPUNIT_ASSERT(impacts == nombreRequetes);
+
+		std::cout << faces.size() << " triangles: construction " << dureeConstruction << " ms, "
+			<< arbre.obtenirNombreNoeuds() << " noeuds, " << arbre.obtenirMemoire() / 1024.0 / 1024.0 << " Mo ("
+			<< static_cast<double>(arbre.obtenirMemoire()) / faces.size() << " octets par triangle), "
+			<< dureeSpheres * 1e3 / nombreRequetes << " us par sphre (" << collisions << " collisions), "
+			<< dureeRayons * 1e3 / nombreRequetes << " us par rayon";
+
+		if (cases == 71) {
+			std::vector<modele::ArbreTriangles> seuls(faces.size());
+			for (std::size_t f = 0; f < faces.size(); ++f) {
+				seuls[f].construire(std::vector<Sommet>{ sommets[faces[f].x], sommets[faces[f].y], sommets[faces[f].z] },
+					std::vector<Face>{ Face{ 0, 1, 2 } });
+			}
+
+			int collisionsExhaustives{ 0 }, impactsExhaustifs{ 0 }, collisionsHierarchie{ 0 };
+			const double dureeSpheresExhaustives{ mesurerDuree([&] {
+				for (int i = 0; i < nombreRequetesExhaustives; ++i) {
+					bool touche{ false };
+					for (const modele::ArbreTriangles& seul : seuls)
+						touche = seul.calculerCollisionSphere(centres[i], 0.5).type != aidecollision::COLLISION_AUCUNE || touche;
+					if (touche)
+						++collisionsExhaustives;
+				}
+			}) };
+			const double dureeRayonsExhaustifs{ mesurerDuree([&] {
+				for (int i = 0; i < nombreRequetesExhaustives; ++i) {
+					double instant{ 1.0 };
+					for (const modele::ArbreTriangles& seul : seuls) {
+						const double instantSeul{ seul.calculerImpactRayon(origines[i], deplacement).instant };
+						if (instantSeul < instant)
+							instant = instantSeul;
+					}
+					if (instant < 1.0)
+						++impactsExhaustifs;
+				}
+			}) };
+			for (int i = 0; i < nombreRequetesExhaustives; ++i) {
+				if (arbre.calculerCollisionSphere(centres[i], 0.5).type != aidecollision::COLLISION_AUCUNE)
+					++collisionsHierarchie;
+			}
+			CPPUNIT_ASSERT(collisionsExhaustives == collisionsHierarchie);
+			CPPUNIT_ASSERT(impactsExhaustifs == nombreRequetesExhaustives);
+
+			const double sphereExhaustive{ dureeSpheresExhaustives * 1e3 / nombreRequetesExhaustives };
+			const double rayonExhaustif{ dureeRayonsExhaustifs * 1e3 / nombreRequetesExhaustives };
+			std::cout << "; test de chaque triangle: " << sphereExhaustive << " us par sphre, " << rayonExhaustif << " us par rayon";
+			CPPUNIT_ASSERT(dureeSpheres * 1e3 / nombreRequetes < sphereExhaustive);
+			CPPUNIT_ASSERT(dureeRayons * 1e3 / nombreRequetes < rayonExhaustif);
+		}
+		std::cout << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testCacheModeles()
+///
+/// Cas de test: mesure l'importation  froid d'un modle .obj de 125 000
+/// triangles par 'assimp', qui optimise ses meshes et crit son cache,
+/// puis son importation  chaud  partir du cache projet en mmoire.
+/// Les deux importations construisent aussi la hirarchie des triangles.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testCacheModeles()
+{
+	const std::string nomFichier{ "PerformanceTestCache.obj" };
+	const std::string nomCache{ modele::CacheModele::obtenirChemin(nomFichier).string() };
+	const unsigned int cases{ 250 };
+
+	// Grille de cases x cases carrs, trianguls par 'assimp'.
+	{
+		std::ofstream fichier{ nomFichier, std::ios::out | std::ios::trunc };
+		fichier << "o grille\n";
+		for (unsigned int i = 0; i <= cases; ++i) {
+			for (unsigned int j = 0; j <= cases; ++j)
+				fichier << "v " << i << ' ' << j << ' ' << (i * j) % 7 << '\n';
+		}
+		for (unsigned int i = 0; i < cases; ++i) {
+			for (unsigned int j = 0; j < cases; ++j) {
+				const unsigned int coin{ i * (cases + 1) + j + 1 };
+				fichier << "f " << coin << ' ' << coin + cases + 1 << ' ' << coin + cases + 2 << ' ' << coin + 1 << '\n';
+			}
+		}
+	}
+	std::remove(nomCache.c_str());
+
+	std::size_t trianglesFroid{ 0 }, trianglesChaud{ 0 };
+	const double dureeFroid{ mesurerDuree([&] {
+		modele::Modele3D modele;
+		CPPUNIT_ASSERT(modele.importer(nomFichier));
+		trianglesFroid = modele.obtenirArbreTriangles().obtenirNombreTriangles();
+	}) };
+	const double dureeChaud{ mesurerDuree([&] {
+		modele::Modele3D modele;
+		CPPUNIT_ASSERT(modele.importer(nomFichier));
+		trianglesChaud = modele.obtenirArbreTriangles().obtenirNombreTriangles();
+	}) };
+
+	std::remove(nomFichier.c_str());
+	std::remove(nomCache.c_str());
+
+	CPPUNIT_ASSERT(trianglesFroid == 2 * cases * cases);
+	CPPUNIT_ASSERT(trianglesChaud == trianglesFroid);
+	std::cout << "Importation de " << trianglesFroid << " triangles: " << dureeFroid << " ms  froid par 'assimp', "
+		<< dureeChaud << " ms  chaud par le cache" << std::endl;
+	CPPUNIT_ASSERT(dureeChaud < dureeFroid);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testProjectionMeshes()
+///
+/// Cas de test: crit le cache d'un modle de 1 000 000 de triangles avec
+/// CacheModele::ecrire(), puis mesure sa lecture avec des meshes projets
+/// et avec des meshes copis: la dure de la lecture et la mmoire
+/// rsidente ajoute, juste aprs la lecture puis aprs avoir parcouru
+/// tous les sommets et toutes les faces.  Le cache vient d'tre crit et
+/// se trouve donc dj dans la mmoire du systme.  Les meshes copis
+/// peuvent rutiliser de la mmoire libre par les cas prcdents: seule
+/// la mmoire ajoute par la projection est vrifie.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testProjectionMeshes()
+{
+	const std::string nomFichier{ "PerformanceTestProjection.obj" };
+	const std::string nomCache{ modele::CacheModele::obtenirChemin(nomFichier).string() };
+	const std::uint64_t drapeaux{ 1 };
+	const int cases{ 707 };
+
+	{
+		std::ofstream fichier{ nomFichier, std::ios::out | std::ios::trunc };
+		fichier << "o grille\n";
+	}
+
+	// Grille de cases x cases carrs, chacun coup en deux triangles, avec
+	// normales et coordonnes de texture.
+	{
+		modele::Mesh::Conteneur<modele::Mesh::Vertex> sommets;
+		modele::Mesh::Conteneur<modele::Mesh::Normale> normales;
+		modele::Mesh::Conteneur<modele::Mesh::TexCoord> texCoords;
+		modele::Mesh::Conteneur<modele::Mesh::Face> faces;
+		for (int i = 0; i <= cases; ++i) {
+			for (int j = 0; j <= cases; ++j) {
+				sommets.emplace_back(static_cast<float>(i), static_cast<float>(j), 0.0f);
+				normales.emplace_back(0.0f, 0.0f, 1.0f);
+				texCoords.emplace_back(static_cast<float>(i) / cases, static_cast<float>(j) / cases);
+			}
+		}
+		for (int i = 0; i < cases; ++i) {
+			for (int j = 0; j < cases; ++j) {
+				const int coin{ i * (cases + 1) + j };
+				faces.emplace_back(coin, coin + cases + 1, coin + 1);
+				faces.emplace_back(coin + 1, coin + cases + 1, coin + cases + 2);
+			}
+		}
+
+		modele::Noeud::Conteneur<modele::Mesh> meshes;
+		meshes.emplace_back(std::move(sommets), std::move(normales), std::move(texCoords),
+			modele::Mesh::Conteneur<modele::Mesh::Couleur>{}, std::move(faces), modele::Materiau{}, "grille");
+		const modele::Noeud racine{ "racine", glm::mat4x4{}, std::move(meshes), modele::Noeud::Conteneur<modele::Noeud>{} };
+		CPPUNIT_ASSERT(modele::CacheModele::ecrire(nomCache, nomFichier, drapeaux, racine, std::vector<std::string>{}));
+	}
+
+	double durees[2], memoiresLecture[2], memoiresParcours[2], memoireDonnees{ 0.0 };
+	for (int projeter = 1; projeter >= 0; --projeter) {
+		modele::Noeud racine;
+		std::vector<std::string> textures;
+		const double memoireDepart{ obtenirMemoireResidente() };
+		durees[projeter] = mesurerDuree([&] {
+			CPPUNIT_ASSERT(modele::CacheModele::lire(nomCache, nomFichier, drapeaux, racine, textures, projeter != 0));
+		});
+		memoiresLecture[projeter] = obtenirMemoireResidente() - memoireDepart;
+
+		const modele::Mesh& mesh = racine.obtenirMeshes().front();
+		CPPUNIT_ASSERT(mesh.estProjete() == (projeter != 0));
+		CPPUNIT_ASSERT(mesh.obtenirFaces().size() == 2u * cases * cases);
+		memoireDonnees = (mesh.obtenirSommets().size() * sizeof(modele::Mesh::Vertex) +
+			mesh.obtenirNormales().size() * sizeof(modele::Mesh::Normale) +
+			mesh.obtenirTexCoords().size() * sizeof(modele::Mesh::TexCoord) +
+			mesh.obtenirFaces().size() * sizeof(modele::Mesh::Face)) / 1024.0 / 1024.0;
+		double somme{ 0.0 };
+		for (const modele::Mesh::Vertex& sommet : mesh.obtenirSommets())
+			somme += sommet.x;
+		for (const modele::Mesh::Normale& normale : mesh.obtenirNormales())
+			somme += normale.z;
+		for (const modele::Mesh::TexCoord& texCoord : mesh.obtenirTexCoords())
+			somme += texCoord.x;
+		for (const modele::Mesh::Face& face : mesh.obtenirFaces())
+			somme += face.x;
+		CPPUNIT_ASSERT(somme > 0.0);
+		memoiresParcours[projeter] = obtenirMemoireResidente() - memoireDepart;
+	}
+
+	std::remove(nomFichier.c_str());
+	std::remove(nomCache.c_str());
+
+	std::cout << "Lecture du cache de " << 2 * cases * cases << " triangles, " << memoireDonnees << " Mo de donnes (projection / copie): "
+		<< durees[1] << " / " << durees[0] << " ms, mmoire rsidente ajoute " << memoiresLecture[1] << " / " << memoiresLecture[0]
+		<< " Mo aprs la lecture et " << memoiresParcours[1] << " / " << memoiresParcours[0] << " Mo aprs le parcours" << std::endl;
+	CPPUNIT_ASSERT(durees[1] < durees[0]);
+	CPPUNIT_ASSERT(memoiresLecture[1] < memoireDonnees / 4.0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testOptimisationMeshes()
+///
+/// Cas de test: mesure l'optimisation de grilles de 20 000 et de 180 000
+/// triangles, dont les faces sont dans l'ordre des ranges, comme dans un
+/// fichier .obj export, ou mlanges.  Affiche l'ACMR et l'ATVR avant et
+/// aprs l'optimisation, ainsi que sa dure.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testOptimisationMeshes()
+{
+	for (int cases : { 100, 300 }) {
+		modele::Mesh::Conteneur<modele::Mesh::Vertex> sommets;
+		modele::Mesh::Conteneur<modele::Mesh::Face> faces;
+		for (int i = 0; i <= cases; ++i) {
+			for (int j = 0; j <= cases; ++j)
+				sommets.emplace_back(static_cast<float>(i), static_cast<float>(j), static_cast<float>((i * j) % 5));
+		}
+		for (int i = 0; i < cases; ++i) {
+			for (int j = 0; j < cases; ++j) {
+				const int coin{ i * (cases + 1) + j };
+				faces.emplace_back(coin, coin + cases + 1, coin + 1);
+				faces.emplace_back(coin + 1, coin + cases + 1, coin + cases + 2);
+			}
+		}
+
+		for (int melanger = 0; melanger <= 1; ++melanger) {
+			if (melanger != 0)
+				std::shuffle(faces.begin(), faces.end(), std::mt19937{ 2990 });
+
+			const modele::Mesh mesh{ sommets, modele::Mesh::Conteneur<modele::Mesh::Normale>{},
+				modele::Mesh::Conteneur<modele::Mesh::TexCoord>{}, modele::Mesh::Conteneur<modele::Mesh::Couleur>{},
+				faces, modele::Materiau{}, "grille" };
+			modele::OptimiseurMesh::Rapport rapport;
+			modele::Mesh optimise;
+			const double duree{ mesurerDuree([&] { optimise = modele::OptimiseurMesh::optimiser(mesh, &rapport); }) };
+			CPPUNIT_ASSERT(optimise.obtenirFaces().size() == faces.size());
+
+			std::cout << faces.size() << (melanger != 0 ? " triangles mlangs: " : " triangles en ranges: ")
+				<< "ACMR " << rapport.avant.obtenirACMR() << " -> " << rapport.apres.obtenirACMR()
+				<< ", ATVR " << rapport.avant.obtenirATVR() << " -> " << rapport.apres.obtenirATVR()
+				<< " (cache de " << modele::OptimiseurMesh::TAILLE_CACHE << " sommets), optimisation en " << duree << " ms" << std::endl;
+
+			CPPUNIT_ASSERT(rapport.apres.obtenirACMR() < rapport.avant.obtenirACMR());
+			CPPUNIT_ASSERT(rapport.apres.obtenirACMR() < 0.8);
+			CPPUNIT_ASSERT(rapport.apres.obtenirATVR() < 1.5);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PerformanceTest::testMeshesCompacts()
+///
+/// Cas de test: mesure la mmoire conomise par MeshCompact et l'erreur
+/// maximale de reconstruction pour trois modles: une sphre de 16 000
+/// triangles (indices sur 16 bits), une sphre de 320 000 triangles dont
+/// la texture est rpte (indices sur 32 bits) et une foule de 50
+/// petites sphres, chacune dans son propre noeud.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PerformanceTest::testMeshesCompacts()
+{
+	auto construireModele = [](modele::Mesh mesh) {
+		modele::Noeud::Conteneur<modele::Mesh> meshes;
+		meshes.push_back(std::move(mesh));
+		return modele::Noeud{ "racine", glm::mat4x4{}, std::move(meshes), modele::Noeud::Conteneur<modele::Noeud>{} };
+	};
+
+	modele::Noeud::Conteneur<modele::Noeud> spheres;
+	for (int i = 0; i < 50; ++i)
+		spheres.push_back(construireModele(construireSphere(16, 8, 1.0f)));
+
+	const char* noms[]{ "sphre", "grande sphre", "foule" };
+	const modele::Noeud modeles[]{
+		construireModele(construireSphere(128, 64, 1.0f)),
+		construireModele(construireSphere(400, 400, 4.0f)),
+		modele::Noeud{ "foule", glm::mat4x4{}, modele::Noeud::Conteneur<modele::Mesh>{}, std::move(spheres) }
+	};
+
+	for (int i = 0; i < 3; ++i) {
+		modele::MeshCompact::Rapport rapport;
+		const double duree{ mesurerDuree([&] { rapport = modele::MeshCompact::evaluer(modeles[i]); }) };
+
+		std::cout << "Modle " << noms[i] << ": " << rapport.octetsOriginaux / 1024.0 << " Ko -> "
+			<< rapport.octetsCompacts / 1024.0 << " Ko (" << rapport.obtenirOctetsEconomises() / 1024.0 << " Ko conomiss, "
+			<< 100.0 * rapport.obtenirOctetsEconomises() / rapport.octetsOriginaux << " %), erreur maximale: normales "
+			<< rapport.erreurNormales << " rad, coordonnes de texture " << rapport.erreurTexCoords << ", couleurs "
+			<< rapport.erreurCouleurs << "; compaction et comparaison en " << duree << " ms" << std::endl;
+
+		// Seules les faces de la grande sphre restent sur 32 bits.
+		CPPUNIT_ASSERT(rapport.octetsCompacts < rapport.octetsOriginaux);
+		if (i != 1)
+			CPPUNIT_ASSERT(rapport.octetsCompacts <= rapport.octetsOriginaux / 2);
+		CPPUNIT_ASSERT(rapport.erreurNormales < 5e-5f);
+		CPPUNIT_ASSERT(rapport.erreurTexCoords <= 4.0f / 2048.0f);
+		CPPUNIT_ASSERT(rapport.erreurCouleurs <= 0.5f / 255.0f + 1e-6f);
+	}
+
+	// Dcodage d'un mesh complet pour les utilisateurs qui attendent un Mesh.
+	const modele::Mesh& grande = modeles[1].obtenirMeshes().front();
+	const modele::MeshCompact compact{ grande };
+	CPPUNIT_ASSERT(!compact.possedeIndicesCourts());
+	modele::Mesh decompresse;
+	const double dureeDecompression{ mesurerDuree([&] { decompresse = compact.decompresser(); }) };
+	CPPUNIT_ASSERT(decompresse.obtenirFaces().size() == grande.obtenirFaces().size());
+	std::cout << "Dcompression de la grande sphre: " << dureeDecompression << " ms" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
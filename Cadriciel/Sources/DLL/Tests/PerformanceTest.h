@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file PerformanceTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_PERFORMANCETEST_H
+#define _TESTS_PERFORMANCETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class PerformanceTest
+/// @brief Classe de test cppunit qui mesure les performances des
+///        structures de l'arbre de rendu et des utilitaires.
+///
+///        Chaque cas de test chronomtre une opration, souvent 
+///        plusieurs tailles ou selon deux approches, et affiche les
+///        mesures dans la console.  Seules les diffrences assez grandes
+///        pour ne pas dpendre de la machine sont vrifies.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class PerformanceTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( PerformanceTest );
+	CPPUNIT_TEST( testInsertion );
+	CPPUNIT_TEST( testAllocationPool );
+	CPPUNIT_TEST( testStockageTransformations );
+	CPPUNIT_TEST( testParcours );
+	CPPUNIT_TEST( testIdentifiantsTypes );
+	CPPUNIT_TEST( testEliminationHorsChamp );
+	CPPUNIT_TEST( testRequetesSpatiales );
+	CPPUNIT_TEST( testCollisionsLot );
+	CPPUNIT_TEST( testAvancementParImpacts );
+	CPPUNIT_TEST( testSimplePrecision );
+	CPPUNIT_TEST( testArbreTriangles );
+	CPPUNIT_TEST( testCacheModeles );
+	CPPUNIT_TEST( testProjectionMeshes );
+	CPPUNIT_TEST( testOptimisationMeshes );
+	CPPUNIT_TEST( testMeshesCompacts );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: cot d'une insertion selon la taille de l'arbre
+	void testInsertion();
+
+	/// Cas de test: animation de noeuds allous sur le tas ou dans un pool
+	void testAllocationPool();
+
+	/// Cas de test: animation et dplacement avec ou sans stockage contigu
+	void testStockageTransformations();
+
+	/// Cas de test: parcours d'un arbre trs profond et d'un arbre trs large
+	void testParcours();
+
+	/// Cas de test: mmoire par noeud et parcours filtrs par type
+	void testIdentifiantsTypes();
+
+	/// Cas de test: affichage avec et sans limination hors du champ
+	void testEliminationHorsChamp();
+
+	/// Cas de test: requtes spatiales par la hirarchie des volumes ou par un parcours
+	void testRequetesSpatiales();
+
+	/// Cas de test: collisions par lots vectoriels ou par appels scalaires
+	void testCollisionsLot();
+
+	/// Cas de test: avancement par impacts contre des sous-pas fixes
+	void testAvancementParImpacts();
+
+	/// Cas de test: calculs de collision en simple ou en double prcision
+	void testSimplePrecision();
+
+	/// Cas de test: construction, mmoire et requtes de la hirarchie de triangles
+	void testArbreTriangles();
+
+	/// Cas de test: importation d'un modle par 'assimp' ou lecture de son cache
+	void testCacheModeles();
+
+	/// Cas de test: lecture du cache d'un modle par copie ou par projection
+	void testProjectionMeshes();
+
+	/// Cas de test: efficacit de la cache des sommets avant et aprs l'optimisation
+	void testOptimisationMeshes();
+
+	/// Cas de test: mmoire conomise et erreur des meshes compacts
+	void testMeshesCompacts();
+};
+
+#endif // _TESTS_PERFORMANCETEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
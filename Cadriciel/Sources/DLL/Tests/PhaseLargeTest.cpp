@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file PhaseLargeTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "PhaseLargeTest.h"
+#include "PhaseLarge.h"
+#include "ArbreRendu.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(PhaseLargeTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::verifierAnimation(aidecollision::PhaseLarge& phaseLarge)
+///
+/// Anime des sphres de tailles varies sur plusieurs images, en en
+/// retirant et en en ajoutant  chaque image, et vrifie que les paires
+/// candidates, apparues et disparues sont celles obtenues en comparant
+/// toutes les paires de botes.
+///
+/// @param[in] phaseLarge : La phase large  vrifier, vide.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::verifierAnimation(aidecollision::PhaseLarge& phaseLarge)
+{
+	using Identifiant = aidecollision::PhaseLarge::Identifiant;
+	using Paire = aidecollision::PhaseLarge::Paire;
+
+	std::mt19937 generateur{ 2990 };
+	std::uniform_real_distribution<double> coordonnee{ -300.0, 300.0 };
+	std::uniform_real_distribution<double> rayon{ 2.0, 25.0 };
+	std::uniform_real_distribution<double> vitesse{ -8.0, 8.0 };
+	auto vecteurAleatoire = [&](std::uniform_real_distribution<double>& distribution) {
+		return glm::dvec3{ distribution(generateur), distribution(generateur), distribution(generateur) };
+	};
+
+	// Copie des sphres, pour la comparaison exhaustive
+	std::map<Identifiant, std::pair<glm::dvec3, double>> spheres;
+	for (int i = 0; i < 300; ++i) {
+		const glm::dvec3 centre{ vecteurAleatoire(coordonnee) };
+		const double r{ rayon(generateur) };
+		spheres[phaseLarge.ajouter(centre, r)] = std::make_pair(centre, r);
+	}
+
+	std::vector<Paire> precedentes;
+	for (int image = 0; image < 15; ++image) {
+		for (auto& sphere : spheres) {
+			sphere.second.first += vecteurAleatoire(vitesse);
+			phaseLarge.deplacer(sphere.first, sphere.second.first, sphere.second.second);
+		}
+		if (image > 0) {
+			for (int i = 0; i < 10; ++i) {
+				auto iter = spheres.begin();
+				std::advance(iter, generateur() % spheres.size());
+				phaseLarge.retirer(iter->first);
+				spheres.erase(iter);
+			}
+			for (int i = 0; i < 8; ++i) {
+				const glm::dvec3 centre{ vecteurAleatoire(coordonnee) };
+				const double r{ rayon(generateur) };
+				const Identifiant identifiant{ phaseLarge.ajouter(centre, r) };
+				CPPUNIT_ASSERT(spheres.find(identifiant) == spheres.end());
+				spheres[identifiant] = std::make_pair(centre, r);
+			}
+		}
+		phaseLarge.mettreAJour();
+
+		std::vector<Paire> attendues;
+		for (auto i = spheres.begin(); i != spheres.end(); ++i) {
+			for (auto j = std::next(i); j != spheres.end(); ++j) {
+				const glm::dvec3 ecart{ glm::abs(i->second.first - j->second.first) };
+				const double somme{ i->second.second + j->second.second };
+				if (ecart.x <= somme && ecart.y <= somme && ecart.z <= somme)
+					attendues.push_back(Paire{ i->first, j->first });
+			}
+		}
+		CPPUNIT_ASSERT(phaseLarge.obtenirPaires() == attendues);
+
+		std::vector<Paire> ajoutees, retirees;
+		std::set_difference(attendues.begin(), attendues.end(), precedentes.begin(), precedentes.end(),
+			std::back_inserter(ajoutees));
+		std::set_difference(precedentes.begin(), precedentes.end(), attendues.begin(), attendues.end(),
+			std::back_inserter(retirees));
+		CPPUNIT_ASSERT(phaseLarge.obtenirPairesAjoutees() == ajoutees);
+		CPPUNIT_ASSERT(phaseLarge.obtenirPairesRetirees() == retirees);
+		precedentes = attendues;
+
+		// Les statistiques suivent la mise  jour, et la phase large vite
+		// la plupart des comparaisons
+		const aidecollision::PhaseLarge::Statistiques& statistiques{ phaseLarge.obtenirStatistiques() };
+		CPPUNIT_ASSERT(statistiques.nombreObjets == spheres.size());
+		CPPUNIT_ASSERT(statistiques.nombrePaires == attendues.size());
+		CPPUNIT_ASSERT(statistiques.nombrePairesAjoutees == ajoutees.size());
+		CPPUNIT_ASSERT(statistiques.nombrePairesRetirees == retirees.size());
+		CPPUNIT_ASSERT(statistiques.nombreTests >= attendues.size());
+		CPPUNIT_ASSERT(statistiques.nombreTests < spheres.size() * (spheres.size() - 1) / 8);
+		CPPUNIT_ASSERT(statistiques.dureeMiseAJour >= 0.0);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::testBalayageEtElagage()
+///
+/// Cas de test: le balayage et lagage trouve, image aprs image, les
+/// mmes paires que la comparaison de toutes les paires.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::testBalayageEtElagage()
+{
+	std::unique_ptr<aidecollision::PhaseLarge> phaseLarge{
+		aidecollision::PhaseLarge::creer(aidecollision::PhaseLarge::BALAYAGE_ET_ELAGAGE, 0.0)
+	};
+	CPPUNIT_ASSERT(dynamic_cast<aidecollision::BalayageEtElagage*>(phaseLarge.get()) != nullptr);
+	verifierAnimation(*phaseLarge);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::testGrilleSpatiale()
+///
+/// Cas de test: la grille spatiale trouve, image aprs image, les mmes
+/// paires que la comparaison de toutes les paires, y compris pour des
+/// sphres qui couvrent plusieurs cellules.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::testGrilleSpatiale()
+{
+	std::unique_ptr<aidecollision::PhaseLarge> phaseLarge{
+		aidecollision::PhaseLarge::creer(aidecollision::PhaseLarge::GRILLE_SPATIALE, 30.0)
+	};
+	CPPUNIT_ASSERT(dynamic_cast<aidecollision::GrilleSpatiale*>(phaseLarge.get()) != nullptr);
+	verifierAnimation(*phaseLarge);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::testPairesAjouteesRetirees()
+///
+/// Cas de test: une paire est signale lorsqu'elle apparat, puis
+/// lorsqu'elle disparat parce qu'une sphre s'loigne ou est retire.
+/// L'identifiant d'une sphre retire n'est rutilis qu'aprs la mise 
+/// jour suivante, et les paires se passent  la phase troite.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::testPairesAjouteesRetirees()
+{
+	using Paire = aidecollision::PhaseLarge::Paire;
+	aidecollision::BalayageEtElagage phaseLarge;
+
+	const auto a = phaseLarge.ajouter(glm::dvec3{ 0.0 }, 1.0);
+	const auto b = phaseLarge.ajouter(glm::dvec3{ 1.5, 0.0, 0.0 }, 1.0);
+	phaseLarge.mettreAJour();
+	const std::vector<Paire> paires{ Paire{ a, b } };
+	CPPUNIT_ASSERT(phaseLarge.obtenirPaires() == paires);
+	CPPUNIT_ASSERT(phaseLarge.obtenirPairesAjoutees() == paires);
+	CPPUNIT_ASSERT(phaseLarge.obtenirPairesRetirees().empty());
+
+	// Passage  la phase troite
+	const aidecollision::DetailsCollision details{ phaseLarge.calculerCollision(paires[0]) };
+	CPPUNIT_ASSERT(details.type == aidecollision::COLLISION_SPHERE);
+	CPPUNIT_ASSERT(details.enfoncement > 0.49 && details.enfoncement < 0.51);
+
+	// Une paire stable n'est plus signale
+	phaseLarge.mettreAJour();
+	CPPUNIT_ASSERT(phaseLarge.obtenirPaires() == paires);
+	CPPUNIT_ASSERT(phaseLarge.obtenirPairesAjoutees().empty());
+
+	phaseLarge.deplacer(b, glm::dvec3{ 10.0, 0.0, 0.0 }, 1.0);
+	phaseLarge.mettreAJour();
+	CPPUNIT_ASSERT(phaseLarge.obtenirPaires().empty());
+	CPPUNIT_ASSERT(phaseLarge.obtenirPairesRetirees() == paires);
+
+	phaseLarge.deplacer(b, glm::dvec3{ 0.0, 1.0, 0.0 }, 1.0);
+	phaseLarge.mettreAJour();
+	CPPUNIT_ASSERT(phaseLarge.obtenirPairesAjoutees() == paires);
+
+	// Le retrait fait disparatre la paire, sans rutiliser l'identifiant
+	phaseLarge.retirer(b);
+	CPPUNIT_ASSERT(!phaseLarge.contient(b));
+	const auto c = phaseLarge.ajouter(glm::dvec3{ 0.0 }, 1.0);
+	CPPUNIT_ASSERT(c != b);
+	phaseLarge.mettreAJour();
+	CPPUNIT_ASSERT(phaseLarge.obtenirPairesRetirees() == paires);
+	CPPUNIT_ASSERT((phaseLarge.obtenirPaires() == std::vector<Paire>{ Paire{ a, c } }));
+	CPPUNIT_ASSERT(phaseLarge.obtenirStatistiques().nombreObjets == 2);
+
+	const auto d = phaseLarge.ajouter(glm::dvec3{ 50.0 }, 1.0);
+	CPPUNIT_ASSERT(d == b);
+
+	phaseLarge.vider();
+	CPPUNIT_ASSERT(!phaseLarge.contient(a));
+	phaseLarge.mettreAJour();
+	CPPUNIT_ASSERT(phaseLarge.obtenirPaires().empty());
+	CPPUNIT_ASSERT(phaseLarge.obtenirStatistiques().nombreObjets == 0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PhaseLargeTest::testNoeudsArbre()
+///
+/// Cas de test: les noeuds qui affichent quelque chose sont ajouts  la
+/// phase large de l'arbre, y suivent leurs dplacements et en sont
+/// retirs avec l'arbre.  L'arbre n'a pas d'usine afin de ne pas
+/// dpendre du chargement des modles.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PhaseLargeTest::testNoeudsArbre()
+{
+	using Paire = aidecollision::PhaseLarge::Paire;
+	ArbreRendu arbre;
+
+	// Un noeud prsent avant l'assignation de la phase large
+	NoeudAbstrait* premier{ new NoeudAbstrait{ "feuille" } };
+	premier->assignerObjetRendu(nullptr, nullptr, 5.0);
+	arbre.ajouter(premier);
+	arbre.assignerPhaseLarge(
+		aidecollision::PhaseLarge::creer(aidecollision::PhaseLarge::GRILLE_SPATIALE, 10.0)
+		);
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge() != nullptr);
+
+	// Un groupe, qui n'affiche rien, dplace son enfant
+	NoeudAbstrait* groupe{ new NoeudComposite{ "groupe" } };
+	groupe->assignerPositionRelative(glm::dvec3{ 100.0, 0.0, 0.0 });
+	NoeudAbstrait* second{ new NoeudAbstrait{ "feuille" } };
+	second->assignerObjetRendu(nullptr, nullptr, 5.0);
+	groupe->ajouter(second);
+	arbre.ajouter(groupe);
+
+	arbre.mettreAJourVolumes();
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge()->obtenirStatistiques().nombreObjets == 2);
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge()->obtenirPaires().empty());
+
+	groupe->assignerPositionRelative(glm::dvec3{ 8.0, 0.0, 0.0 });
+	arbre.mettreAJourVolumes();
+	const std::vector<Paire>& paires{ arbre.obtenirPhaseLarge()->obtenirPaires() };
+	CPPUNIT_ASSERT(paires.size() == 1);
+	std::vector<NoeudAbstrait*> noeuds{
+		arbre.obtenirNoeudPhaseLarge(paires[0].first), arbre.obtenirNoeudPhaseLarge(paires[0].second)
+	};
+	std::sort(noeuds.begin(), noeuds.end());
+	std::vector<NoeudAbstrait*> attendus{ premier, second };
+	std::sort(attendus.begin(), attendus.end());
+	CPPUNIT_ASSERT(noeuds == attendus);
+
+	arbre.effacer(groupe);
+	arbre.mettreAJourVolumes();
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge()->obtenirPaires().empty());
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge()->obtenirPairesRetirees().size() == 1);
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge()->obtenirStatistiques().nombreObjets == 1);
+
+	arbre.vider();
+	arbre.mettreAJourVolumes();
+	CPPUNIT_ASSERT(arbre.obtenirPhaseLarge()->obtenirStatistiques().nombreObjets == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file PhaseLargeTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_PHASELARGETEST_H
+#define _TESTS_PHASELARGETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace aidecollision
+{
+	class PhaseLarge;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// @class PhaseLargeTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        mthodes de la phase large de la dtection des collisions.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class PhaseLargeTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( PhaseLargeTest );
+	CPPUNIT_TEST( testBalayageEtElagage );
+	CPPUNIT_TEST( testGrilleSpatiale );
+	CPPUNIT_TEST( testPairesAjouteesRetirees );
+	CPPUNIT_TEST( testNoeudsArbre );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: le balayage et lagage trouve les mmes paires que
+	/// la comparaison de toutes les paires
+	void testBalayageEtElagage();
+
+	/// Cas de test: la grille spatiale trouve les mmes paires que la
+	/// comparaison de toutes les paires
+	void testGrilleSpatiale();
+
+	/// Cas de test: les paires apparues et disparues sont signales
+	void testPairesAjouteesRetirees();
+
+	/// Cas de test: l'arbre de rendu tient la phase large  jour
+	void testNoeudsArbre();
+
+private:
+	/// Anime des sphres sur plusieurs images et vrifie les paires.
+	static void verifierAnimation(aidecollision::PhaseLarge& phaseLarge);
+};
+
+#endif // _TESTS_PHASELARGETEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
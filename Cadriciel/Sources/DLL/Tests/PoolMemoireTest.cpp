@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file PoolMemoireTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "PoolMemoireTest.h"
+#include "PoolMemoire.h"
+#include "NoeudComposite.h"
+#include "NoeudConeCube.h"
+#include "ArbreRenduINF2990.h"
+
+#include <cstdint>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(PoolMemoireTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PoolMemoireTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// Le pool est dimensionn pour contenir un NoeudConeCube, avec de
+/// petites plaques afin d'en forcer l'ajout.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PoolMemoireTest::setUp()
+{
+	pool = std::make_unique<utilitaire::PoolMemoire>(
+		NoeudAbstrait::calculerTailleAllocation(sizeof(NoeudConeCube)), 4);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PoolMemoireTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PoolMemoireTest::tearDown()
+{
+	pool.reset();
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PoolMemoireTest::testRecyclage()
+///
+/// Cas de test: les blocs sont aligns, un bloc libr est le prochain
+///  tre rutilis et les compteurs suivent les oprations.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PoolMemoireTest::testRecyclage()
+{
+	void* premier{ pool->allouer() };
+	void* second{ pool->allouer() };
+	CPPUNIT_ASSERT(premier != second);
+	CPPUNIT_ASSERT(reinterpret_cast<std::uintptr_t>(premier) % utilitaire::PoolMemoire::ALIGNEMENT == 0);
+	CPPUNIT_ASSERT(pool->obtenirTailleBloc() % utilitaire::PoolMemoire::ALIGNEMENT == 0);
+
+	pool->liberer(premier);
+	CPPUNIT_ASSERT(pool->allouer() == premier);
+
+	// Dpasser la capacit d'une plaque en ajoute une nouvelle
+	void* blocs[3];
+	for (auto& bloc : blocs)
+		bloc = pool->allouer();
+	CPPUNIT_ASSERT(pool->obtenirNombrePlaques() == 2);
+	CPPUNIT_ASSERT(pool->obtenirNombreBlocsUtilises() == 5);
+	CPPUNIT_ASSERT(pool->obtenirNombreAllocations() == 6);
+	CPPUNIT_ASSERT(pool->obtenirNombreLiberations() == 1);
+
+	for (auto bloc : blocs)
+		pool->liberer(bloc);
+	pool->liberer(premier);
+	pool->liberer(second);
+	CPPUNIT_ASSERT(pool->obtenirNombreBlocsUtilises() == 0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PoolMemoireTest::testRelacher()
+///
+/// Cas de test: relacher() refuse de librer les plaques tant qu'un bloc
+/// est utilis, puis les libre toutes d'un coup.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PoolMemoireTest::testRelacher()
+{
+	void* bloc{ pool->allouer() };
+	CPPUNIT_ASSERT(!pool->relacher());
+	CPPUNIT_ASSERT(pool->obtenirNombrePlaques() == 1);
+
+	pool->liberer(bloc);
+	CPPUNIT_ASSERT(pool->relacher());
+	CPPUNIT_ASSERT(pool->obtenirNombrePlaques() == 0);
+
+	// Le pool demeure utilisable aprs avoir t relch
+	bloc = pool->allouer();
+	CPPUNIT_ASSERT(bloc != nullptr);
+	pool->liberer(bloc);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void PoolMemoireTest::testAllocationNoeuds()
+///
+/// Cas de test: des noeuds allous dans le pool et dtruits par leur
+/// parent avec un delete ordinaire retournent au pool, alors que les
+/// noeuds allous sur le tas n'y touchent pas.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void PoolMemoireTest::testAllocationNoeuds()
+{
+	{
+		NoeudComposite parent{ "groupe" };
+		for (int i = 0; i < 6; ++i)
+			parent.ajouter(new (*pool) NoeudConeCube{ ArbreRenduINF2990::NOM_CONECUBE });
+		parent.ajouter(new NoeudConeCube{ ArbreRenduINF2990::NOM_CONECUBE });
+		CPPUNIT_ASSERT(pool->obtenirNombreBlocsUtilises() == 6);
+
+		parent.vider();
+		CPPUNIT_ASSERT(pool->obtenirNombreBlocsUtilises() == 0);
+		CPPUNIT_ASSERT(pool->obtenirNombreLiberations() == 6);
+	}
+	CPPUNIT_ASSERT(pool->relacher());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
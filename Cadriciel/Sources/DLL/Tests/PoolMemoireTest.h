@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file PoolMemoireTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_POOLMEMOIRETEST_H
+#define _TESTS_POOLMEMOIRETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <memory>
+
+namespace utilitaire
+{
+	class PoolMemoire;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// @class PoolMemoireTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        mthodes de la classe utilitaire::PoolMemoire et l'allocation
+///        des noeuds dans un pool.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class PoolMemoireTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( PoolMemoireTest );
+	CPPUNIT_TEST( testRecyclage );
+	CPPUNIT_TEST( testRelacher );
+	CPPUNIT_TEST( testAllocationNoeuds );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: les blocs librs sont rutiliss et aligns
+	void testRecyclage();
+
+	/// Cas de test: relacher() ne libre que les pools inutiliss
+	void testRelacher();
+
+	/// Cas de test: les noeuds allous dans un pool y retournent
+	void testAllocationNoeuds();
+
+private:
+	/// Instance d'un pool de mmoire
+	std::unique_ptr<utilitaire::PoolMemoire> pool;
+};
+
+#endif // _TESTS_POOLMEMOIRETEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file RegistreModelesTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "RegistreModelesTest.h"
+#include "RegistreModeles.h"
+#include "CacheModele.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(RegistreModelesTest);
+
+/// Nombre de modles utiliss pendant les tests.
+static const unsigned int NOMBRE_MODELES{ 2 };
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static std::string obtenirNomModele(unsigned int indice)
+///
+/// Retourne le nom du fichier d'un des modles utiliss par les tests.
+///
+/// @param[in] indice : L'indice du modle.
+///
+/// @return Le nom du fichier.
+///
+////////////////////////////////////////////////////////////////////////
+static std::string obtenirNomModele(unsigned int indice)
+{
+	return "RegistreModelesTest" + std::to_string(indice) + ".obj";
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static void ecrireGrille(const std::string& nomFichier, unsigned int colonnes)
+///
+/// crit un modle .obj form d'une bande de carrs, soit deux
+/// triangles par colonne une fois le modle triangul.
+///
+/// @param[in] nomFichier : Le nom du fichier.
+/// @param[in] colonnes   : Le nombre de carrs de la bande.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+static void ecrireGrille(const std::string& nomFichier, unsigned int colonnes)
+{
+	std::ofstream fichier{ nomFichier, std::ios::out | std::ios::trunc };
+	fichier << "o grille\n";
+	for (unsigned int i = 0; i <= colonnes; ++i)
+		fichier << "v " << i << " 0 0\nv " << i << " 1 0\n";
+	for (unsigned int i = 0; i < colonnes; ++i)
+		fichier << "f " << 2 * i + 1 << ' ' << 2 * i + 3 << ' ' << 2 * i + 4 << ' ' << 2 * i + 2 << '\n';
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void RegistreModelesTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void RegistreModelesTest::setUp()
+{
+	for (unsigned int i = 0; i < NOMBRE_MODELES; ++i)
+		ecrireGrille(obtenirNomModele(i), 10 * (i + 1));
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void RegistreModelesTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void RegistreModelesTest::tearDown()
+{
+	for (unsigned int i = 0; i < NOMBRE_MODELES; ++i) {
+		std::remove(obtenirNomModele(i).c_str());
+		std::remove(modele::CacheModele::obtenirChemin(obtenirNomModele(i)).string().c_str());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void RegistreModelesTest::testPartage()
+///
+/// Cas de test: un mme fichier demand par un chemin relatif, un chemin
+/// passant par "." et un chemin en majuscules donne la mme poigne, et
+/// n'est charg qu'une seule fois.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void RegistreModelesTest::testPartage()
+{
+	modele::RegistreModeles* registre{ modele::RegistreModeles::obtenirInstance() };
+	const unsigned int succes{ registre->obtenirNombreSucces() };
+	const unsigned int echecs{ registre->obtenirNombreEchecs() };
+	const std::size_t memoireCPU{ registre->obtenirMemoireCPU() };
+
+	std::string majuscules{ obtenirNomModele(0) };
+	for (char& caractere : majuscules)
+		caractere = static_cast<char>(std::toupper(static_cast<unsigned char>(caractere)));
+
+	modele::RegistreModeles::Poignee poignee1{ registre->obtenir(obtenirNomModele(0)) };
+	modele::RegistreModeles::Poignee poignee2{ registre->obtenir("./" + obtenirNomModele(0)) };
+	modele::RegistreModeles::Poignee poignee3{ registre->obtenir(majuscules) };
+
+	CPPUNIT_ASSERT(poignee1 != nullptr);
+	CPPUNIT_ASSERT(poignee1 == poignee2);
+	CPPUNIT_ASSERT(poignee1 == poignee3);
+	CPPUNIT_ASSERT(registre->obtenirNombreEchecs() == echecs + 1);
+	CPPUNIT_ASSERT(registre->obtenirNombreSucces() == succes + 2);
+
+	// Le modle est bien charg et sa mmoire compte une seule fois
+	CPPUNIT_ASSERT(poignee1->obtenirModele().obtenirArbreTriangles().obtenirNombreTriangles() == 20);
+	CPPUNIT_ASSERT(poignee1->obtenirMemoireCPU() > 0);
+	CPPUNIT_ASSERT(registre->obtenirMemoireCPU() == memoireCPU + poignee1->obtenirMemoireCPU());
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void RegistreModelesTest::testLot()
+///
+/// Cas de test: un lot contenant deux fois le mme fichier ne le charge
+/// qu'une fois, et retourne les poignes dans l'ordre des chemins.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void RegistreModelesTest::testLot()
+{
+	modele::RegistreModeles* registre{ modele::RegistreModeles::obtenirInstance() };
+	const unsigned int succes{ registre->obtenirNombreSucces() };
+	const unsigned int echecs{ registre->obtenirNombreEchecs() };
+
+	std::vector<modele::RegistreModeles::Poignee> poignees{
+		registre->obtenirLot({ obtenirNomModele(0), obtenirNomModele(1), obtenirNomModele(0) }) };
+
+	CPPUNIT_ASSERT(poignees.size() == 3);
+	CPPUNIT_ASSERT(poignees[0] == poignees[2]);
+	CPPUNIT_ASSERT(poignees[0] != poignees[1]);
+	CPPUNIT_ASSERT(poignees[0]->obtenirModele().obtenirArbreTriangles().obtenirNombreTriangles() == 20);
+	CPPUNIT_ASSERT(poignees[1]->obtenirModele().obtenirArbreTriangles().obtenirNombreTriangles() == 40);
+	CPPUNIT_ASSERT(registre->obtenirNombreEchecs() == echecs + 2);
+	CPPUNIT_ASSERT(registre->obtenirNombreSucces() == succes + 1);
+
+	// Une demande isole du mme fichier retrouve le modle du lot
+	CPPUNIT_ASSERT(registre->obtenir(obtenirNomModele(1)) == poignees[1]);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void RegistreModelesTest::testRelachement()
+///
+/// Cas de test: un modle reste dans le registre tant qu'il en existe une
+/// poigne, puis en est retir, avec sa mmoire,  la disparition de la
+/// dernire.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void RegistreModelesTest::testRelachement()
+{
+	modele::RegistreModeles* registre{ modele::RegistreModeles::obtenirInstance() };
+	const std::size_t nombreModeles{ registre->obtenirNombreModeles() };
+	const std::size_t memoireCPU{ registre->obtenirMemoireCPU() };
+	const std::size_t memoireGPU{ registre->obtenirMemoireGPU() };
+
+	modele::RegistreModeles::Poignee poignee1{ registre->obtenir(obtenirNomModele(1)) };
+	modele::RegistreModeles::Poignee poignee2{ poignee1 };
+	CPPUNIT_ASSERT(registre->obtenirNombreModeles() == nombreModeles + 1);
+
+	// Le modle figure parmi les modles chargs
+	bool trouve{ false };
+	for (modele::RegistreModeles::Poignee const& poignee : registre->obtenirModeles())
+		trouve = trouve || poignee == poignee1;
+	CPPUNIT_ASSERT(trouve);
+
+	poignee1.reset();
+	CPPUNIT_ASSERT(registre->obtenirNombreModeles() == nombreModeles + 1);
+
+	poignee2.reset();
+	CPPUNIT_ASSERT(registre->obtenirNombreModeles() == nombreModeles);
+	CPPUNIT_ASSERT(registre->obtenirMemoireCPU() == memoireCPU);
+	CPPUNIT_ASSERT(registre->obtenirMemoireGPU() == memoireGPU);
+
+	// Redemand, le modle est charg  nouveau
+	const unsigned int echecs{ registre->obtenirNombreEchecs() };
+	CPPUNIT_ASSERT(registre->obtenir(obtenirNomModele(1)) != nullptr);
+	CPPUNIT_ASSERT(registre->obtenirNombreEchecs() == echecs + 1);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
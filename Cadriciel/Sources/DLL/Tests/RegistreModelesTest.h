@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file RegistreModelesTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_REGISTREMODELESTEST_H
+#define _TESTS_REGISTREMODELESTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class RegistreModelesTest
+/// @brief Classe de test cppunit pour tester le partage des modles 3D
+///        par le registre des modles.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class RegistreModelesTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( RegistreModelesTest );
+	CPPUNIT_TEST( testPartage );
+	CPPUNIT_TEST( testLot );
+	CPPUNIT_TEST( testRelachement );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: un mme fichier, dsign de diffrentes faons, donne
+	/// le mme modle
+	void testPartage();
+
+	/// Cas de test: les doublons d'un lot ne sont chargs qu'une fois
+	void testLot();
+
+	/// Cas de test: un modle est relch avec sa dernire poigne
+	void testRelachement();
+
+};
+
+#endif // _TESTS_REGISTREMODELESTEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
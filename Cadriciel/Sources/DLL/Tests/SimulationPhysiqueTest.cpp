@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file SimulationPhysiqueTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "SimulationPhysiqueTest.h"
+#include "SimulationPhysique.h"
+#include "OrdonnanceurTaches.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(SimulationPhysiqueTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static aidecollision::SimulationPhysique::Corps creerCorps(const glm::dvec3& position, const glm::dvec3& vitesse, double masse)
+///
+/// Cre un corps de rayon unitaire avec des constantes de rebondissement
+/// et d'amortissement communes  tous les tests.
+///
+/// @param[in] position : La position du corps.
+/// @param[in] vitesse  : La vitesse du corps.
+/// @param[in] masse    : La masse du corps, nulle s'il est immobile.
+///
+/// @return Le corps.
+///
+////////////////////////////////////////////////////////////////////////
+static aidecollision::SimulationPhysique::Corps creerCorps(const glm::dvec3& position, const glm::dvec3& vitesse, double masse)
+{
+	aidecollision::SimulationPhysique::Corps corps;
+	corps.position = position;
+	corps.vitesse = vitesse;
+	corps.rayon = 1.0;
+	corps.masse = masse;
+	corps.constanteRebondissement = 2000.0;
+	corps.constanteAmortissement = 0.5;
+	return corps;
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void SimulationPhysiqueTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void SimulationPhysiqueTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void SimulationPhysiqueTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void SimulationPhysiqueTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void SimulationPhysiqueTest::testIlots()
+///
+/// Cas de test: les corps relis par des paires forment un lot, un
+/// corps immobile ne relie pas deux lots et ses paires sont attribues
+///  l'lot de l'autre corps.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void SimulationPhysiqueTest::testIlots()
+{
+	aidecollision::SimulationPhysique simulation;
+	for (int i = 0; i < 6; ++i)
+		simulation.ajouter(creerCorps(glm::dvec3{ 10.0 * i, 0.0, 0.0 }, glm::dvec3{ 0.0 }, i == 5 ? 0.0 : 1.0));
+	simulation.ajouter(creerCorps(glm::dvec3{ 100.0, 0.0, 0.0 }, glm::dvec3{ 0.0 }, 1.0));
+
+	const std::vector<aidecollision::SimulationPhysique::Paire> paires{
+		{ 3, 4 }, { 1, 2 }, { 0, 1 }, { 2, 5 }, { 3, 5 }
+	};
+	simulation.avancer(0.1, 5, paires);
+
+	const std::vector<aidecollision::SimulationPhysique::Ilot>& ilots = simulation.obtenirIlots();
+	const std::vector<unsigned int>& corps = simulation.obtenirCorpsIlots();
+	CPPUNIT_ASSERT(ilots.size() == 3);
+	CPPUNIT_ASSERT(ilots[0].nombreCorps == 3 && ilots[0].nombrePaires == 3);
+	CPPUNIT_ASSERT(ilots[1].nombreCorps == 2 && ilots[1].nombrePaires == 2);
+	CPPUNIT_ASSERT(ilots[2].nombreCorps == 1 && ilots[2].nombrePaires == 0);
+	CPPUNIT_ASSERT(corps.size() == 6);
+	CPPUNIT_ASSERT(corps[ilots[0].premierCorps] == 0 && corps[ilots[0].premierCorps + 2] == 2);
+	CPPUNIT_ASSERT(corps[ilots[1].premierCorps] == 3 && corps[ilots[2].premierCorps] == 6);
+	for (const aidecollision::SimulationPhysique::Ilot& ilot : ilots)
+		CPPUNIT_ASSERT(ilot.duree >= 0.0);
+	CPPUNIT_ASSERT(simulation.obtenirDureeImage() >= 0.0);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void SimulationPhysiqueTest::testRebond()
+///
+/// Cas de test: deux corps de mme masse qui foncent l'un sur l'autre
+/// rebondissent et repartent en sens inverse, en conservant leur quantit
+/// de mouvement, alors qu'un corps qui tombe sur un corps immobile
+/// rebondit sans le dplacer.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void SimulationPhysiqueTest::testRebond()
+{
+	aidecollision::SimulationPhysique simulation;
+	simulation.ajouter(creerCorps(glm::dvec3{ -2.0, 0.0, 0.0 }, glm::dvec3{ 1.0, 0.0, 0.0 }, 1.0));
+	simulation.ajouter(creerCorps(glm::dvec3{ 2.0, 0.0, 0.0 }, glm::dvec3{ -1.0, 0.0, 0.0 }, 1.0));
+	const std::vector<aidecollision::SimulationPhysique::Paire> paires{ { 0, 1 } };
+	for (int image = 0; image < 120; ++image)
+		simulation.avancer(1.0 / 30.0, 50, paires);
+
+	const aidecollision::SimulationPhysique::Corps& corps1 = simulation.obtenirCorps(0);
+	const aidecollision::SimulationPhysique::Corps& corps2 = simulation.obtenirCorps(1);
+	CPPUNIT_ASSERT(corps1.vitesse.x < -0.5 && corps2.vitesse.x > 0.5);
+	CPPUNIT_ASSERT(std::abs(corps1.vitesse.x + corps2.vitesse.x) < 1e-9);
+	CPPUNIT_ASSERT(corps2.position.x - corps1.position.x > 2.0);
+
+	// Chute sur un corps immobile.
+	simulation.vider();
+	simulation.assignerGravite(glm::dvec3{ 0.0, 0.0, -9.8 });
+	simulation.ajouter(creerCorps(glm::dvec3{ 0.0, 0.0, 0.0 }, glm::dvec3{ 0.0 }, 0.0));
+	simulation.ajouter(creerCorps(glm::dvec3{ 0.0, 0.0, 3.0 }, glm::dvec3{ 0.0 }, 1.0));
+	double vitesseMaximale{ 0.0 };
+	for (int image = 0; image < 30; ++image) {
+		simulation.avancer(1.0 / 30.0, 50, paires);
+		if (simulation.obtenirCorps(1).vitesse.z > vitesseMaximale)
+			vitesseMaximale = simulation.obtenirCorps(1).vitesse.z;
+	}
+	CPPUNIT_ASSERT(vitesseMaximale > 1.0);
+	CPPUNIT_ASSERT(simulation.obtenirCorps(0).position == glm::dvec3{ 0.0 });
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void SimulationPhysiqueTest::testDeterminisme()
+///
+/// Cas de test: deux simulations identiques de nombreux corps, l'une
+/// dcoupe en petites tches sur plusieurs fils et l'autre sur un seul
+/// fil, donnent exactement les mmes positions et vitesses.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void SimulationPhysiqueTest::testDeterminisme()
+{
+	utilitaire::OrdonnanceurTaches* ordonnanceur{ utilitaire::OrdonnanceurTaches::obtenirInstance() };
+	const bool monoFil{ ordonnanceur->estMonoFil() };
+
+	std::mt19937 generateur{ 19 };
+	std::uniform_real_distribution<double> coordonnee{ -30.0, 30.0 };
+	std::uniform_real_distribution<double> vitesse{ -3.0, 3.0 };
+
+	aidecollision::SimulationPhysique parallele;
+	aidecollision::SimulationPhysique sequentielle;
+	parallele.assignerTailleLot(4);
+	for (int i = 0; i < 400; ++i) {
+		const aidecollision::SimulationPhysique::Corps corps{ creerCorps(
+			glm::dvec3{ coordonnee(generateur), coordonnee(generateur), 0.0 },
+			glm::dvec3{ vitesse(generateur), vitesse(generateur), 0.0 },
+			i % 10 == 0 ? 0.0 : 1.0 + (i % 3)) };
+		parallele.ajouter(corps);
+		sequentielle.ajouter(corps);
+	}
+
+	std::size_t nombreIlots{ 0 };
+	for (int image = 0; image < 20; ++image) {
+		// Paires des corps assez proches pour se toucher pendant l'image.
+		std::vector<aidecollision::SimulationPhysique::Paire> paires;
+		for (unsigned int i = 0; i < parallele.obtenirNombreCorps(); ++i) {
+			for (unsigned int j = i + 1; j < parallele.obtenirNombreCorps(); ++j) {
+				if (glm::length(parallele.obtenirCorps(i).position - parallele.obtenirCorps(j).position) < 3.0)
+					paires.push_back(aidecollision::SimulationPhysique::Paire{ i, j });
+			}
+		}
+
+		ordonnanceur->assignerMonoFil(false);
+		parallele.avancer(1.0 / 30.0, 20, paires);
+		ordonnanceur->assignerMonoFil(true);
+		sequentielle.avancer(1.0 / 30.0, 20, paires);
+
+		nombreIlots += parallele.obtenirIlots().size();
+		for (unsigned int i = 0; i < parallele.obtenirNombreCorps(); ++i) {
+			CPPUNIT_ASSERT(parallele.obtenirCorps(i).position == sequentielle.obtenirCorps(i).position);
+			CPPUNIT_ASSERT(parallele.obtenirCorps(i).vitesse == sequentielle.obtenirCorps(i).vitesse);
+		}
+	}
+	CPPUNIT_ASSERT(nombreIlots > 0);
+
+	ordonnanceur->assignerMonoFil(monoFil);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
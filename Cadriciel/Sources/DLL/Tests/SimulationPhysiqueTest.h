@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file SimulationPhysiqueTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_SIMULATIONPHYSIQUETEST_H
+#define _TESTS_SIMULATIONPHYSIQUETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class SimulationPhysiqueTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        la simulation physique par lots.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class SimulationPhysiqueTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( SimulationPhysiqueTest );
+	CPPUNIT_TEST( testIlots );
+	CPPUNIT_TEST( testRebond );
+	CPPUNIT_TEST( testDeterminisme );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: regroupement des corps et des paires en lots
+	void testIlots();
+
+	/// Cas de test: rebond de deux corps l'un sur l'autre
+	void testRebond();
+
+	/// Cas de test: les rsultats sont identiques au bit prs avec un ou
+	/// plusieurs fils d'excution
+	void testDeterminisme();
+
+};
+
+#endif // _TESTS_SIMULATIONPHYSIQUETEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////////
+/// @file VueTest.cpp
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "VueTest.h"
+#include "VueOrtho.h"
+#include "Plan3D.h"
+
+#include <cmath>
+#include <vector>
+
+// Enregistrement de la suite de tests au sein du registre
+CPPUNIT_TEST_SUITE_REGISTRATION(VueTest);
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn static vue::VueOrtho creerVue(const glm::dvec3& position, const glm::dvec3& pointVise)
+///
+/// Cre une vue orthogonale semblable  la vue par dfaut de l'application:
+/// une clture de 500 par 500 pixels qui montre une fentre virtuelle de
+/// 200 par 200 units, entre les plans situs  1 et  1000 units de la
+/// camra.
+///
+/// @param[in] position  : La position de la camra.
+/// @param[in] pointVise : Le point vis par la camra.
+///
+/// @return La vue.
+///
+////////////////////////////////////////////////////////////////////////
+static vue::VueOrtho creerVue(const glm::dvec3& position, const glm::dvec3& pointVise)
+{
+	return vue::VueOrtho{
+		vue::Camera{ position, pointVise, glm::dvec3{ 0, 1, 0 }, glm::dvec3{ 0, 1, 0 } },
+		vue::ProjectionOrtho{
+			0, 500, 0, 500,
+			1, 1000, 1, 10000, 1.25,
+			-100, 100, -100, 100 }
+	};
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void VueTest::setUp()
+///
+/// Effectue l'initialisation pralable  l'excution de l'ensemble des
+/// cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void VueTest::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void VueTest::tearDown()
+///
+/// Effectue les oprations de finalisation ncessaires suite  l'excution
+/// de l'ensemble des cas de tests de cette suite de tests (si ncessaire).
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void VueTest::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void VueTest::testConversion()
+///
+/// Cas de test: avec une camra qui regarde le plan XY de face, le centre
+/// et les coins de la clture correspondent au centre et aux coins de la
+/// fentre virtuelle, l'axe des Y de la clture tant invers.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void VueTest::testConversion()
+{
+	const vue::VueOrtho vue{ creerVue(glm::dvec3{ 0, 0, 200 }, glm::dvec3{ 0, 0, 0 }) };
+
+	glm::dvec3 point;
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(250, 250, point));
+	CPPUNIT_ASSERT(glm::length(point) < 1e-9);
+
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(0, 0, point));
+	CPPUNIT_ASSERT(glm::length(point - glm::dvec3{ -100, 100, 0 }) < 1e-9);
+
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(500, 500, point));
+	CPPUNIT_ASSERT(glm::length(point - glm::dvec3{ 100, -100, 0 }) < 1e-9);
+
+	const math::Plan3D plan{ glm::dvec3{ 0, 0, 1 }, glm::dvec3{ 0, 0, 10 } };
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(375, 125, plan, point));
+	CPPUNIT_ASSERT(glm::length(point - glm::dvec3{ 50, 50, 10 }) < 1e-9);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void VueTest::testRayon()
+///
+/// Cas de test: le rayon qui passe par le centre de la clture d'une
+/// camra incline part du plan avant, suit la direction de vise et
+/// traverse tout le volume de visualisation.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void VueTest::testRayon()
+{
+	const glm::dvec3 position{ 30, 40, 200 };
+	const glm::dvec3 pointVise{ 10, -5, 0 };
+	const vue::VueOrtho vue{ creerVue(position, pointVise) };
+	const glm::dvec3 direction{ glm::normalize(pointVise - position) };
+
+	glm::dvec3 origine, deplacement;
+	CPPUNIT_ASSERT(vue.obtenirRayon(250, 250, origine, deplacement));
+	CPPUNIT_ASSERT(glm::length(origine - (position + direction)) < 1e-9);
+	CPPUNIT_ASSERT(glm::length(deplacement - direction * 999.0) < 1e-9);
+
+	// Un point dcal donne un rayon parallle en projection orthogonale.
+	glm::dvec3 origine2, deplacement2;
+	CPPUNIT_ASSERT(vue.obtenirRayon(100, 400, origine2, deplacement2));
+	CPPUNIT_ASSERT(glm::length(deplacement2 - deplacement) < 1e-9);
+	CPPUNIT_ASSERT(std::abs(glm::dot(origine2 - origine, direction)) < 1e-9);
+
+	// Le point vis se trouve au centre de la clture.
+	const math::Plan3D plan{ glm::dvec3{ 0, 0, 1 }, pointVise };
+	glm::dvec3 point;
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(250, 250, plan, point));
+	CPPUNIT_ASSERT(glm::length(point - pointVise) < 1e-9);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void VueTest::testConversionLot()
+///
+/// Cas de test: la conversion d'un lot de points donne les mmes points
+/// que les conversions individuelles, et aucun point ne peut tre converti
+/// sur un plan parallle  la direction de vise.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void VueTest::testConversionLot()
+{
+	const vue::VueOrtho vue{ creerVue(glm::dvec3{ -50, 80, 150 }, glm::dvec3{ 5, 0, 0 }) };
+	const math::Plan3D plan{ glm::dvec3{ 0, 0, 1 }, glm::dvec3{ 0, 0, 0 } };
+
+	std::vector<glm::ivec2> clotures;
+	for (int x = 0; x <= 500; x += 50)
+		for (int y = 0; y <= 500; y += 125)
+			clotures.push_back(glm::ivec2{ x, y });
+
+	std::vector<glm::dvec3> points;
+	std::vector<bool> valides;
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(clotures, plan, points, valides) == clotures.size());
+	CPPUNIT_ASSERT(points.size() == clotures.size() && valides.size() == clotures.size());
+	for (std::size_t i = 0; i < clotures.size(); ++i) {
+		glm::dvec3 point;
+		CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(clotures[i][0], clotures[i][1], plan, point));
+		CPPUNIT_ASSERT(valides[i]);
+		CPPUNIT_ASSERT(glm::length(points[i] - point) < 1e-9);
+	}
+
+	// Plan parallle  la direction de vise d'une camra de face.
+	const vue::VueOrtho vueFace{ creerVue(glm::dvec3{ 0, 0, 200 }, glm::dvec3{ 0, 0, 0 }) };
+	const math::Plan3D planParallele{ glm::dvec3{ 1, 0, 0 }, glm::dvec3{ 0, 0, 0 } };
+	CPPUNIT_ASSERT(vueFace.convertirClotureAVirtuelle(clotures, planParallele, points, valides) == 0);
+	for (std::size_t i = 0; i < clotures.size(); ++i)
+		CPPUNIT_ASSERT(!valides[i]);
+}
+
+////////////////////////////////////////////////////////////////////////
+///
+/// @fn void VueTest::testRedimensionnement()
+///
+/// Cas de test: la clture conserve par la projection, et donc utilise
+/// par les conversions, suit le redimensionnement de la fentre.
+///
+/// @return Aucune.
+///
+////////////////////////////////////////////////////////////////////////
+void VueTest::testRedimensionnement()
+{
+	vue::VueOrtho vue{ creerVue(glm::dvec3{ 0, 0, 200 }, glm::dvec3{ 0, 0, 0 }) };
+	CPPUNIT_ASSERT(vue.obtenirProjection().obtenirCloture() == glm::ivec4(0, 0, 500, 500));
+
+	vue.redimensionnerFenetre(glm::ivec2{ 0, 0 }, glm::ivec2{ 800, 600 });
+	CPPUNIT_ASSERT(vue.obtenirProjection().obtenirCloture() == glm::ivec4(0, 0, 800, 600));
+
+	// Le centre de la nouvelle clture correspond toujours au point vis.
+	glm::dvec3 point;
+	CPPUNIT_ASSERT(vue.convertirClotureAVirtuelle(400, 300, point));
+	CPPUNIT_ASSERT(glm::length(point) < 1e-9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////
+/// @file VueTest.h
+/// @author DGI-INF2990
+/// @date 2026-10-17
+/// @version 1.0
+///
+/// @addtogroup inf2990 INF2990
+/// @{
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTS_VUETEST_H
+#define _TESTS_VUETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+///////////////////////////////////////////////////////////////////////////
+/// @class VueTest
+/// @brief Classe de test cppunit pour tester le bon fonctionnement des
+///        conversions de coordonnes de clture en coordonnes virtuelles
+///        de la vue, faites sans appel  OpenGL.
+///
+/// @author DGI-INF2990
+/// @date 2026-10-17
+///////////////////////////////////////////////////////////////////////////
+class VueTest : public CppUnit::TestFixture
+{
+
+	// =================================================================
+	// Dclaration de la suite de tests et des mthodes de tests
+	//
+	// Important, vous devez dfinir chacun de vos cas de tests  l'aide
+	// de la macro CPPUNIT_TEST sinon ce dernier ne sera pas excut !
+	// =================================================================
+	CPPUNIT_TEST_SUITE( VueTest );
+	CPPUNIT_TEST( testConversion );
+	CPPUNIT_TEST( testRayon );
+	CPPUNIT_TEST( testConversionLot );
+	CPPUNIT_TEST( testRedimensionnement );
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+
+	// =================================================================
+	// Mthodes pour initialiser et 'finaliser' la suite de tests
+	// =================================================================
+
+	/// Traitement  effectuer pour initialiser cette suite de tests
+	void setUp();
+
+	/// Traitement  effectuer pour 'finaliser' cette suite de tests
+	void tearDown();
+
+
+	// =================================================================
+	// Dfinissez ici les diffrents cas de tests...
+	// =================================================================
+
+	/// Cas de test: conversion de points de clture en points virtuels
+	void testConversion();
+
+	/// Cas de test: rayons virtuels d'une camra incline
+	void testRayon();
+
+	/// Cas de test: la conversion par lot donne les mmes rsultats que
+	/// les conversions individuelles
+	void testConversionLot();
+
+	/// Cas de test: la clture suit le redimensionnement de la fentre
+	void testRedimensionnement();
+
+};
+
+#endif // _TESTS_VUETEST_H
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @}
+///////////////////////////////////////////////////////////////////////////////